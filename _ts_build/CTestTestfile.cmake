@@ -0,0 +1,28 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_ts_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("include")
+subdirs("libdispatch")
+subdirs("libsrc")
+subdirs("libsrc4")
+subdirs("libhdf5")
+subdirs("oc2")
+subdirs("libdap2")
+subdirs("libdap4")
+subdirs("liblib")
+subdirs("plugins")
+subdirs("ncgen")
+subdirs("ncgen3")
+subdirs("ncdump")
+subdirs("nctest")
+subdirs("nc_test")
+subdirs("nc_test4")
+subdirs("h5_test")
+subdirs("ncdap_test")
+subdirs("dap4_test")
+subdirs("examples")
+subdirs("unit_test")
+subdirs("docs")
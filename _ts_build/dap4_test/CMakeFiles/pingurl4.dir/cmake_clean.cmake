@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pingurl4.dir/pingurl4.c.o"
+  "CMakeFiles/pingurl4.dir/pingurl4.c.o.d"
+  "pingurl4"
+  "pingurl4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/pingurl4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
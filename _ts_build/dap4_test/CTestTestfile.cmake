@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dap4_test
+# Build directory: /root/repo/_ts_build/dap4_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(dap4_test_test_raw "bash" "-c" "export srcdir=/root/repo/dap4_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/dap4_test/test_raw.sh")
+set_tests_properties(dap4_test_test_raw PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/dap4_test/CMakeLists.txt;40;add_sh_test;/root/repo/dap4_test/CMakeLists.txt;0;")
+subdirs("baseline")
+subdirs("baselineraw")
+subdirs("baselineremote")
+subdirs("cdltestfiles")
+subdirs("daptestfiles")
+subdirs("dmrtestfiles")
+subdirs("nctestfiles")
+subdirs("misctestfiles")
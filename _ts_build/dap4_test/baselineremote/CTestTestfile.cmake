@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/dap4_test/baselineremote
+# Build directory: /root/repo/_ts_build/dap4_test/baselineremote
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
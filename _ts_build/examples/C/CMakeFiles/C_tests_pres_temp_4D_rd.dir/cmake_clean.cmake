@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "*.nc"
+  "CMakeFiles/C_tests_pres_temp_4D_rd.dir/pres_temp_4D_rd.c.o"
+  "CMakeFiles/C_tests_pres_temp_4D_rd.dir/pres_temp_4D_rd.c.o.d"
+  "C_tests_pres_temp_4D_rd"
+  "C_tests_pres_temp_4D_rd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/C_tests_pres_temp_4D_rd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "*.nc"
+  "CMakeFiles/C_tests_pres_temp_4D_wr.dir/pres_temp_4D_wr.c.o"
+  "CMakeFiles/C_tests_pres_temp_4D_wr.dir/pres_temp_4D_wr.c.o.d"
+  "C_tests_pres_temp_4D_wr"
+  "C_tests_pres_temp_4D_wr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/C_tests_pres_temp_4D_wr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
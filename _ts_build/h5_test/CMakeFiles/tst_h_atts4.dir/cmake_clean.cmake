@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_atts4.dir/tst_h_atts4.c.o"
+  "CMakeFiles/tst_h_atts4.dir/tst_h_atts4.c.o.d"
+  "tst_h_atts4"
+  "tst_h_atts4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_atts4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_compounds.dir/tst_h_compounds.c.o"
+  "CMakeFiles/tst_h_compounds.dir/tst_h_compounds.c.o.d"
+  "tst_h_compounds"
+  "tst_h_compounds.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_compounds.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_compounds2.dir/tst_h_compounds2.c.o"
+  "CMakeFiles/tst_h_compounds2.dir/tst_h_compounds2.c.o.d"
+  "tst_h_compounds2"
+  "tst_h_compounds2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_compounds2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_enums.dir/tst_h_enums.c.o"
+  "CMakeFiles/tst_h_enums.dir/tst_h_enums.c.o.d"
+  "tst_h_enums"
+  "tst_h_enums.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_enums.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
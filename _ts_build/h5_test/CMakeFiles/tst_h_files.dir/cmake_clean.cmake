@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_files.dir/tst_h_files.c.o"
+  "CMakeFiles/tst_h_files.dir/tst_h_files.c.o.d"
+  "tst_h_files"
+  "tst_h_files.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_vars.dir/tst_h_vars.c.o"
+  "CMakeFiles/tst_h_vars.dir/tst_h_vars.c.o.d"
+  "tst_h_vars"
+  "tst_h_vars.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_vars.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
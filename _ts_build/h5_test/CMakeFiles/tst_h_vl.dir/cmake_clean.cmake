@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_vl.dir/tst_h_vl.c.o"
+  "CMakeFiles/tst_h_vl.dir/tst_h_vl.c.o.d"
+  "tst_h_vl"
+  "tst_h_vl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_vl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
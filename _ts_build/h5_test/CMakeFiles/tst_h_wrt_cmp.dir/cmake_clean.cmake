@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_h_wrt_cmp.dir/tst_h_wrt_cmp.c.o"
+  "CMakeFiles/tst_h_wrt_cmp.dir/tst_h_wrt_cmp.c.o.d"
+  "tst_h_wrt_cmp"
+  "tst_h_wrt_cmp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_h_wrt_cmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dap2.dir/cache.c.o"
+  "CMakeFiles/dap2.dir/cache.c.o.d"
+  "CMakeFiles/dap2.dir/cdf.c.o"
+  "CMakeFiles/dap2.dir/cdf.c.o.d"
+  "CMakeFiles/dap2.dir/constraints.c.o"
+  "CMakeFiles/dap2.dir/constraints.c.o.d"
+  "CMakeFiles/dap2.dir/dapattr.c.o"
+  "CMakeFiles/dap2.dir/dapattr.c.o.d"
+  "CMakeFiles/dap2.dir/dapcvt.c.o"
+  "CMakeFiles/dap2.dir/dapcvt.c.o.d"
+  "CMakeFiles/dap2.dir/dapdebug.c.o"
+  "CMakeFiles/dap2.dir/dapdebug.c.o.d"
+  "CMakeFiles/dap2.dir/dapdump.c.o"
+  "CMakeFiles/dap2.dir/dapdump.c.o.d"
+  "CMakeFiles/dap2.dir/dapodom.c.o"
+  "CMakeFiles/dap2.dir/dapodom.c.o.d"
+  "CMakeFiles/dap2.dir/daputil.c.o"
+  "CMakeFiles/dap2.dir/daputil.c.o.d"
+  "CMakeFiles/dap2.dir/dceconstraints.c.o"
+  "CMakeFiles/dap2.dir/dceconstraints.c.o.d"
+  "CMakeFiles/dap2.dir/dcelex.c.o"
+  "CMakeFiles/dap2.dir/dcelex.c.o.d"
+  "CMakeFiles/dap2.dir/dceparse.c.o"
+  "CMakeFiles/dap2.dir/dceparse.c.o.d"
+  "CMakeFiles/dap2.dir/dcetab.c.o"
+  "CMakeFiles/dap2.dir/dcetab.c.o.d"
+  "CMakeFiles/dap2.dir/getvara.c.o"
+  "CMakeFiles/dap2.dir/getvara.c.o.d"
+  "CMakeFiles/dap2.dir/ncd2dispatch.c.o"
+  "CMakeFiles/dap2.dir/ncd2dispatch.c.o.d"
+  "CMakeFiles/dap2.dir/ncdaperr.c.o"
+  "CMakeFiles/dap2.dir/ncdaperr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dap2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dap4.dir/d4chunk.c.o"
+  "CMakeFiles/dap4.dir/d4chunk.c.o.d"
+  "CMakeFiles/dap4.dir/d4crc32.c.o"
+  "CMakeFiles/dap4.dir/d4crc32.c.o.d"
+  "CMakeFiles/dap4.dir/d4curlfunctions.c.o"
+  "CMakeFiles/dap4.dir/d4curlfunctions.c.o.d"
+  "CMakeFiles/dap4.dir/d4cvt.c.o"
+  "CMakeFiles/dap4.dir/d4cvt.c.o.d"
+  "CMakeFiles/dap4.dir/d4data.c.o"
+  "CMakeFiles/dap4.dir/d4data.c.o.d"
+  "CMakeFiles/dap4.dir/d4debug.c.o"
+  "CMakeFiles/dap4.dir/d4debug.c.o.d"
+  "CMakeFiles/dap4.dir/d4dump.c.o"
+  "CMakeFiles/dap4.dir/d4dump.c.o.d"
+  "CMakeFiles/dap4.dir/d4file.c.o"
+  "CMakeFiles/dap4.dir/d4file.c.o.d"
+  "CMakeFiles/dap4.dir/d4fix.c.o"
+  "CMakeFiles/dap4.dir/d4fix.c.o.d"
+  "CMakeFiles/dap4.dir/d4http.c.o"
+  "CMakeFiles/dap4.dir/d4http.c.o.d"
+  "CMakeFiles/dap4.dir/d4meta.c.o"
+  "CMakeFiles/dap4.dir/d4meta.c.o.d"
+  "CMakeFiles/dap4.dir/d4parser.c.o"
+  "CMakeFiles/dap4.dir/d4parser.c.o.d"
+  "CMakeFiles/dap4.dir/d4printer.c.o"
+  "CMakeFiles/dap4.dir/d4printer.c.o.d"
+  "CMakeFiles/dap4.dir/d4read.c.o"
+  "CMakeFiles/dap4.dir/d4read.c.o.d"
+  "CMakeFiles/dap4.dir/d4swap.c.o"
+  "CMakeFiles/dap4.dir/d4swap.c.o.d"
+  "CMakeFiles/dap4.dir/d4util.c.o"
+  "CMakeFiles/dap4.dir/d4util.c.o.d"
+  "CMakeFiles/dap4.dir/d4varx.c.o"
+  "CMakeFiles/dap4.dir/d4varx.c.o.d"
+  "CMakeFiles/dap4.dir/ezxml.c.o"
+  "CMakeFiles/dap4.dir/ezxml.c.o.d"
+  "CMakeFiles/dap4.dir/ezxml_extra.c.o"
+  "CMakeFiles/dap4.dir/ezxml_extra.c.o.d"
+  "CMakeFiles/dap4.dir/ncd4dispatch.c.o"
+  "CMakeFiles/dap4.dir/ncd4dispatch.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dap4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
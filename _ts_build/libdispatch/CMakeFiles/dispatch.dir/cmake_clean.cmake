@@ -0,0 +1,105 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispatch.dir/crc32.c.o"
+  "CMakeFiles/dispatch.dir/crc32.c.o.d"
+  "CMakeFiles/dispatch.dir/datt.c.o"
+  "CMakeFiles/dispatch.dir/datt.c.o.d"
+  "CMakeFiles/dispatch.dir/dattget.c.o"
+  "CMakeFiles/dispatch.dir/dattget.c.o.d"
+  "CMakeFiles/dispatch.dir/dattinq.c.o"
+  "CMakeFiles/dispatch.dir/dattinq.c.o.d"
+  "CMakeFiles/dispatch.dir/dattput.c.o"
+  "CMakeFiles/dispatch.dir/dattput.c.o.d"
+  "CMakeFiles/dispatch.dir/dauth.c.o"
+  "CMakeFiles/dispatch.dir/dauth.c.o.d"
+  "CMakeFiles/dispatch.dir/daux.c.o"
+  "CMakeFiles/dispatch.dir/daux.c.o.d"
+  "CMakeFiles/dispatch.dir/dcompound.c.o"
+  "CMakeFiles/dispatch.dir/dcompound.c.o.d"
+  "CMakeFiles/dispatch.dir/dcopy.c.o"
+  "CMakeFiles/dispatch.dir/dcopy.c.o.d"
+  "CMakeFiles/dispatch.dir/ddim.c.o"
+  "CMakeFiles/dispatch.dir/ddim.c.o.d"
+  "CMakeFiles/dispatch.dir/ddispatch.c.o"
+  "CMakeFiles/dispatch.dir/ddispatch.c.o.d"
+  "CMakeFiles/dispatch.dir/denum.c.o"
+  "CMakeFiles/dispatch.dir/denum.c.o.d"
+  "CMakeFiles/dispatch.dir/derror.c.o"
+  "CMakeFiles/dispatch.dir/derror.c.o.d"
+  "CMakeFiles/dispatch.dir/dfile.c.o"
+  "CMakeFiles/dispatch.dir/dfile.c.o.d"
+  "CMakeFiles/dispatch.dir/dfilter.c.o"
+  "CMakeFiles/dispatch.dir/dfilter.c.o.d"
+  "CMakeFiles/dispatch.dir/dgroup.c.o"
+  "CMakeFiles/dispatch.dir/dgroup.c.o.d"
+  "CMakeFiles/dispatch.dir/dinfermodel.c.o"
+  "CMakeFiles/dispatch.dir/dinfermodel.c.o.d"
+  "CMakeFiles/dispatch.dir/dinternal.c.o"
+  "CMakeFiles/dispatch.dir/dinternal.c.o.d"
+  "CMakeFiles/dispatch.dir/dmemimage.c.o"
+  "CMakeFiles/dispatch.dir/dmemimage.c.o.d"
+  "CMakeFiles/dispatch.dir/dnotnc3.c.o"
+  "CMakeFiles/dispatch.dir/dnotnc3.c.o.d"
+  "CMakeFiles/dispatch.dir/dnotnc4.c.o"
+  "CMakeFiles/dispatch.dir/dnotnc4.c.o.d"
+  "CMakeFiles/dispatch.dir/doffsets.c.o"
+  "CMakeFiles/dispatch.dir/doffsets.c.o.d"
+  "CMakeFiles/dispatch.dir/dopaque.c.o"
+  "CMakeFiles/dispatch.dir/dopaque.c.o.d"
+  "CMakeFiles/dispatch.dir/dparallel.c.o"
+  "CMakeFiles/dispatch.dir/dparallel.c.o.d"
+  "CMakeFiles/dispatch.dir/dperf.c.o"
+  "CMakeFiles/dispatch.dir/dperf.c.o.d"
+  "CMakeFiles/dispatch.dir/drc.c.o"
+  "CMakeFiles/dispatch.dir/drc.c.o.d"
+  "CMakeFiles/dispatch.dir/dreadonly.c.o"
+  "CMakeFiles/dispatch.dir/dreadonly.c.o.d"
+  "CMakeFiles/dispatch.dir/dstring.c.o"
+  "CMakeFiles/dispatch.dir/dstring.c.o.d"
+  "CMakeFiles/dispatch.dir/dthread.c.o"
+  "CMakeFiles/dispatch.dir/dthread.c.o.d"
+  "CMakeFiles/dispatch.dir/dtype.c.o"
+  "CMakeFiles/dispatch.dir/dtype.c.o.d"
+  "CMakeFiles/dispatch.dir/dutf8.c.o"
+  "CMakeFiles/dispatch.dir/dutf8.c.o.d"
+  "CMakeFiles/dispatch.dir/dutil.c.o"
+  "CMakeFiles/dispatch.dir/dutil.c.o.d"
+  "CMakeFiles/dispatch.dir/dv2i.c.o"
+  "CMakeFiles/dispatch.dir/dv2i.c.o.d"
+  "CMakeFiles/dispatch.dir/dvar.c.o"
+  "CMakeFiles/dispatch.dir/dvar.c.o.d"
+  "CMakeFiles/dispatch.dir/dvarget.c.o"
+  "CMakeFiles/dispatch.dir/dvarget.c.o.d"
+  "CMakeFiles/dispatch.dir/dvarinq.c.o"
+  "CMakeFiles/dispatch.dir/dvarinq.c.o.d"
+  "CMakeFiles/dispatch.dir/dvarput.c.o"
+  "CMakeFiles/dispatch.dir/dvarput.c.o.d"
+  "CMakeFiles/dispatch.dir/dvlen.c.o"
+  "CMakeFiles/dispatch.dir/dvlen.c.o.d"
+  "CMakeFiles/dispatch.dir/dwinpath.c.o"
+  "CMakeFiles/dispatch.dir/dwinpath.c.o.d"
+  "CMakeFiles/dispatch.dir/nc.c.o"
+  "CMakeFiles/dispatch.dir/nc.c.o.d"
+  "CMakeFiles/dispatch.dir/ncbytes.c.o"
+  "CMakeFiles/dispatch.dir/ncbytes.c.o.d"
+  "CMakeFiles/dispatch.dir/nchashmap.c.o"
+  "CMakeFiles/dispatch.dir/nchashmap.c.o.d"
+  "CMakeFiles/dispatch.dir/nclist.c.o"
+  "CMakeFiles/dispatch.dir/nclist.c.o.d"
+  "CMakeFiles/dispatch.dir/nclistmgr.c.o"
+  "CMakeFiles/dispatch.dir/nclistmgr.c.o.d"
+  "CMakeFiles/dispatch.dir/nclog.c.o"
+  "CMakeFiles/dispatch.dir/nclog.c.o.d"
+  "CMakeFiles/dispatch.dir/ncodom.c.o"
+  "CMakeFiles/dispatch.dir/ncodom.c.o.d"
+  "CMakeFiles/dispatch.dir/nctime.c.o"
+  "CMakeFiles/dispatch.dir/nctime.c.o.d"
+  "CMakeFiles/dispatch.dir/ncuri.c.o"
+  "CMakeFiles/dispatch.dir/ncuri.c.o.d"
+  "CMakeFiles/dispatch.dir/utf8proc.c.o"
+  "CMakeFiles/dispatch.dir/utf8proc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dispatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
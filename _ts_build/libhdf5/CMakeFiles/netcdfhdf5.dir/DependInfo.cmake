@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libhdf5/hdf5attr.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5attr.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5attr.c.o.d"
+  "/root/repo/libhdf5/hdf5cache.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5cache.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5cache.c.o.d"
+  "/root/repo/libhdf5/hdf5create.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5create.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5create.c.o.d"
+  "/root/repo/libhdf5/hdf5debug.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5debug.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5debug.c.o.d"
+  "/root/repo/libhdf5/hdf5dim.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5dim.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5dim.c.o.d"
+  "/root/repo/libhdf5/hdf5dispatch.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5dispatch.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5dispatch.c.o.d"
+  "/root/repo/libhdf5/hdf5file.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5file.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5file.c.o.d"
+  "/root/repo/libhdf5/hdf5filter.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5filter.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5filter.c.o.d"
+  "/root/repo/libhdf5/hdf5grp.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5grp.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5grp.c.o.d"
+  "/root/repo/libhdf5/hdf5internal.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5internal.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5internal.c.o.d"
+  "/root/repo/libhdf5/hdf5open.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5open.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5open.c.o.d"
+  "/root/repo/libhdf5/hdf5type.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5type.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5type.c.o.d"
+  "/root/repo/libhdf5/hdf5var.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5var.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/hdf5var.c.o.d"
+  "/root/repo/libhdf5/nc4hdf.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4hdf.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4hdf.c.o.d"
+  "/root/repo/libhdf5/nc4info.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4info.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4info.c.o.d"
+  "/root/repo/libhdf5/nc4mem.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4mem.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4mem.c.o.d"
+  "/root/repo/libhdf5/nc4memcb.c" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4memcb.c.o" "gcc" "libhdf5/CMakeFiles/netcdfhdf5.dir/nc4memcb.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
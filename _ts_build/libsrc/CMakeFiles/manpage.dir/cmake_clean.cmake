@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/manpage"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/manpage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
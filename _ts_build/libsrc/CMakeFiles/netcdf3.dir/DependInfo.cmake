@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libsrc/attr.c" "libsrc/CMakeFiles/netcdf3.dir/attr.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/attr.c.o.d"
+  "/root/repo/libsrc/dim.c" "libsrc/CMakeFiles/netcdf3.dir/dim.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/dim.c.o.d"
+  "/root/repo/libsrc/extent.c" "libsrc/CMakeFiles/netcdf3.dir/extent.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/extent.c.o.d"
+  "/root/repo/libsrc/lookup3.c" "libsrc/CMakeFiles/netcdf3.dir/lookup3.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/lookup3.c.o.d"
+  "/root/repo/libsrc/memio.c" "libsrc/CMakeFiles/netcdf3.dir/memio.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/memio.c.o.d"
+  "/root/repo/libsrc/mmapio.c" "libsrc/CMakeFiles/netcdf3.dir/mmapio.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/mmapio.c.o.d"
+  "/root/repo/libsrc/nc3copy.c" "libsrc/CMakeFiles/netcdf3.dir/nc3copy.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/nc3copy.c.o.d"
+  "/root/repo/libsrc/nc3dispatch.c" "libsrc/CMakeFiles/netcdf3.dir/nc3dispatch.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/nc3dispatch.c.o.d"
+  "/root/repo/libsrc/nc3internal.c" "libsrc/CMakeFiles/netcdf3.dir/nc3internal.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/nc3internal.c.o.d"
+  "/root/repo/libsrc/ncio.c" "libsrc/CMakeFiles/netcdf3.dir/ncio.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/ncio.c.o.d"
+  "/root/repo/libsrc/ncx.c" "libsrc/CMakeFiles/netcdf3.dir/ncx.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/ncx.c.o.d"
+  "/root/repo/libsrc/posixio.c" "libsrc/CMakeFiles/netcdf3.dir/posixio.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/posixio.c.o.d"
+  "/root/repo/libsrc/putget.c" "libsrc/CMakeFiles/netcdf3.dir/putget.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/putget.c.o.d"
+  "/root/repo/libsrc/v1hpg.c" "libsrc/CMakeFiles/netcdf3.dir/v1hpg.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/v1hpg.c.o.d"
+  "/root/repo/libsrc/var.c" "libsrc/CMakeFiles/netcdf3.dir/var.c.o" "gcc" "libsrc/CMakeFiles/netcdf3.dir/var.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
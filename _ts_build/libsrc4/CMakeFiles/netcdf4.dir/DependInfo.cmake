@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libsrc4/error4.c" "libsrc4/CMakeFiles/netcdf4.dir/error4.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/error4.c.o.d"
+  "/root/repo/libsrc4/nc4attr.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4attr.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4attr.c.o.d"
+  "/root/repo/libsrc4/nc4dim.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4dim.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4dim.c.o.d"
+  "/root/repo/libsrc4/nc4dispatch.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4dispatch.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4dispatch.c.o.d"
+  "/root/repo/libsrc4/nc4grp.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4grp.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4grp.c.o.d"
+  "/root/repo/libsrc4/nc4internal.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4internal.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4internal.c.o.d"
+  "/root/repo/libsrc4/nc4printer.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4printer.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4printer.c.o.d"
+  "/root/repo/libsrc4/nc4type.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4type.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4type.c.o.d"
+  "/root/repo/libsrc4/nc4var.c" "libsrc4/CMakeFiles/netcdf4.dir/nc4var.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/nc4var.c.o.d"
+  "/root/repo/libsrc4/ncfunc.c" "libsrc4/CMakeFiles/netcdf4.dir/ncfunc.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/ncfunc.c.o.d"
+  "/root/repo/libsrc4/ncindex.c" "libsrc4/CMakeFiles/netcdf4.dir/ncindex.c.o" "gcc" "libsrc4/CMakeFiles/netcdf4.dir/ncindex.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
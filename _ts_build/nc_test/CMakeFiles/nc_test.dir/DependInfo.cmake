@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/nc_test/error.c" "nc_test/CMakeFiles/nc_test.dir/error.c.o" "gcc" "nc_test/CMakeFiles/nc_test.dir/error.c.o.d"
+  "/root/repo/nc_test/nc_test.c" "nc_test/CMakeFiles/nc_test.dir/nc_test.c.o" "gcc" "nc_test/CMakeFiles/nc_test.dir/nc_test.c.o.d"
+  "/root/repo/nc_test/test_get.c" "nc_test/CMakeFiles/nc_test.dir/test_get.c.o" "gcc" "nc_test/CMakeFiles/nc_test.dir/test_get.c.o.d"
+  "/root/repo/nc_test/test_put.c" "nc_test/CMakeFiles/nc_test.dir/test_put.c.o" "gcc" "nc_test/CMakeFiles/nc_test.dir/test_put.c.o.d"
+  "/root/repo/nc_test/test_read.c" "nc_test/CMakeFiles/nc_test.dir/test_read.c.o" "gcc" "nc_test/CMakeFiles/nc_test.dir/test_read.c.o.d"
+  "/root/repo/nc_test/test_write.c" "nc_test/CMakeFiles/nc_test.dir/test_write.c.o" "gcc" "nc_test/CMakeFiles/nc_test.dir/test_write.c.o.d"
+  "/root/repo/nc_test/util.c" "nc_test/CMakeFiles/nc_test.dir/util.c.o" "gcc" "nc_test/CMakeFiles/nc_test.dir/util.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/liblib/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
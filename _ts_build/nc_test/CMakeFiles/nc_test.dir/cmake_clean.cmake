@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "/root/repo/nc_test/test_get.c"
+  "/root/repo/nc_test/test_put.c"
+  "/root/repo/nc_test/test_read.c"
+  "/root/repo/nc_test/test_write.c"
+  "CMakeFiles/nc_test.dir/error.c.o"
+  "CMakeFiles/nc_test.dir/error.c.o.d"
+  "CMakeFiles/nc_test.dir/nc_test.c.o"
+  "CMakeFiles/nc_test.dir/nc_test.c.o.d"
+  "CMakeFiles/nc_test.dir/test_get.c.o"
+  "CMakeFiles/nc_test.dir/test_get.c.o.d"
+  "CMakeFiles/nc_test.dir/test_put.c.o"
+  "CMakeFiles/nc_test.dir/test_put.c.o.d"
+  "CMakeFiles/nc_test.dir/test_read.c.o"
+  "CMakeFiles/nc_test.dir/test_read.c.o.d"
+  "CMakeFiles/nc_test.dir/test_write.c.o"
+  "CMakeFiles/nc_test.dir/test_write.c.o.d"
+  "CMakeFiles/nc_test.dir/util.c.o"
+  "CMakeFiles/nc_test.dir/util.c.o.d"
+  "nc_test"
+  "nc_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
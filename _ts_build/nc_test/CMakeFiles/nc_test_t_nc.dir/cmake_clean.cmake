@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_t_nc.dir/t_nc.c.o"
+  "CMakeFiles/nc_test_t_nc.dir/t_nc.c.o.d"
+  "nc_test_t_nc"
+  "nc_test_t_nc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_t_nc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
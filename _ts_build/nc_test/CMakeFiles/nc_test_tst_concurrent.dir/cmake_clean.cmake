@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_concurrent.dir/tst_concurrent.c.o"
+  "CMakeFiles/nc_test_tst_concurrent.dir/tst_concurrent.c.o.d"
+  "nc_test_tst_concurrent"
+  "nc_test_tst_concurrent.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_concurrent.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_copy_raw.dir/tst_copy_raw.c.o"
+  "CMakeFiles/nc_test_tst_copy_raw.dir/tst_copy_raw.c.o.d"
+  "nc_test_tst_copy_raw"
+  "nc_test_tst_copy_raw.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_copy_raw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
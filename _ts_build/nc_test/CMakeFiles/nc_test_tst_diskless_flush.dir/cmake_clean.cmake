@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_diskless_flush.dir/tst_diskless_flush.c.o"
+  "CMakeFiles/nc_test_tst_diskless_flush.dir/tst_diskless_flush.c.o.d"
+  "nc_test_tst_diskless_flush"
+  "nc_test_tst_diskless_flush.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_diskless_flush.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_err_enddef.dir/tst_err_enddef.c.o"
+  "CMakeFiles/nc_test_tst_err_enddef.dir/tst_err_enddef.c.o.d"
+  "nc_test_tst_err_enddef"
+  "nc_test_tst_err_enddef.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_err_enddef.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_fill_recs.dir/tst_fill_recs.c.o"
+  "CMakeFiles/nc_test_tst_fill_recs.dir/tst_fill_recs.c.o.d"
+  "nc_test_tst_fill_recs"
+  "nc_test_tst_fill_recs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_fill_recs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
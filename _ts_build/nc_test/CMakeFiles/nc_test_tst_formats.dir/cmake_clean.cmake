@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_formats.dir/tst_formats.c.o"
+  "CMakeFiles/nc_test_tst_formats.dir/tst_formats.c.o.d"
+  "nc_test_tst_formats"
+  "nc_test_tst_formats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_formats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_global_fillval.dir/tst_global_fillval.c.o"
+  "CMakeFiles/nc_test_tst_global_fillval.dir/tst_global_fillval.c.o.d"
+  "nc_test_tst_global_fillval"
+  "nc_test_tst_global_fillval.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_global_fillval.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_header_room.dir/tst_header_room.c.o"
+  "CMakeFiles/nc_test_tst_header_room.dir/tst_header_room.c.o.d"
+  "nc_test_tst_header_room"
+  "nc_test_tst_header_room.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_header_room.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_inq_type.dir/tst_inq_type.c.o"
+  "CMakeFiles/nc_test_tst_inq_type.dir/tst_inq_type.c.o.d"
+  "nc_test_tst_inq_type"
+  "nc_test_tst_inq_type.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_inq_type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
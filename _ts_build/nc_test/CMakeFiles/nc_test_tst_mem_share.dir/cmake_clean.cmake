@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_mem_share.dir/tst_mem_share.c.o"
+  "CMakeFiles/nc_test_tst_mem_share.dir/tst_mem_share.c.o.d"
+  "nc_test_tst_mem_share"
+  "nc_test_tst_mem_share.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_mem_share.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
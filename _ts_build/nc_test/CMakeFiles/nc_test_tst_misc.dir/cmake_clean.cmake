@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_misc.dir/tst_misc.c.o"
+  "CMakeFiles/nc_test_tst_misc.dir/tst_misc.c.o.d"
+  "nc_test_tst_misc"
+  "nc_test_tst_misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
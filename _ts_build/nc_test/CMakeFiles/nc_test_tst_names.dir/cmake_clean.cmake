@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_names.dir/tst_names.c.o"
+  "CMakeFiles/nc_test_tst_names.dir/tst_names.c.o.d"
+  "nc_test_tst_names"
+  "nc_test_tst_names.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_names.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
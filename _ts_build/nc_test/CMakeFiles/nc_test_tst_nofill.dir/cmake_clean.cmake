@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_nofill.dir/tst_nofill.c.o"
+  "CMakeFiles/nc_test_tst_nofill.dir/tst_nofill.c.o.d"
+  "nc_test_tst_nofill"
+  "nc_test_tst_nofill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_nofill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_perf_stats.dir/tst_perf_stats.c.o"
+  "CMakeFiles/nc_test_tst_perf_stats.dir/tst_perf_stats.c.o.d"
+  "nc_test_tst_perf_stats"
+  "nc_test_tst_perf_stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_perf_stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_threads.dir/tst_threads.c.o"
+  "CMakeFiles/nc_test_tst_threads.dir/tst_threads.c.o.d"
+  "nc_test_tst_threads"
+  "nc_test_tst_threads.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_threads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
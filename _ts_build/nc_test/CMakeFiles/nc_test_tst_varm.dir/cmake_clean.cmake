@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test_tst_varm.dir/tst_varm.c.o"
+  "CMakeFiles/nc_test_tst_varm.dir/tst_varm.c.o.d"
+  "nc_test_tst_varm"
+  "nc_test_tst_varm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test_tst_varm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_diskless.dir/tst_diskless.c.o"
+  "CMakeFiles/tst_diskless.dir/tst_diskless.c.o.d"
+  "tst_diskless"
+  "tst_diskless.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_diskless.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
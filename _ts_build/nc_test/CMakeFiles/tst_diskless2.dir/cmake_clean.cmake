@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_diskless2.dir/tst_diskless2.c.o"
+  "CMakeFiles/tst_diskless2.dir/tst_diskless2.c.o.d"
+  "tst_diskless2"
+  "tst_diskless2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_diskless2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
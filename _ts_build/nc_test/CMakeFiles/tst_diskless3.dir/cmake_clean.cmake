@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_diskless3.dir/tst_diskless3.c.o"
+  "CMakeFiles/tst_diskless3.dir/tst_diskless3.c.o.d"
+  "tst_diskless3"
+  "tst_diskless3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_diskless3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
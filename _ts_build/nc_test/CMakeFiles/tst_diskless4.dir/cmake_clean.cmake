@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_diskless4.dir/tst_diskless4.c.o"
+  "CMakeFiles/tst_diskless4.dir/tst_diskless4.c.o.d"
+  "tst_diskless4"
+  "tst_diskless4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_diskless4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_diskless5.dir/tst_diskless5.c.o"
+  "CMakeFiles/tst_diskless5.dir/tst_diskless5.c.o.d"
+  "tst_diskless5"
+  "tst_diskless5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_diskless5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,74 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/nc_test
+# Build directory: /root/repo/_ts_build/nc_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(nc_test_t_nc "/nc_test_t_nc")
+set_tests_properties(nc_test_t_nc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_small "/nc_test_tst_small")
+set_tests_properties(nc_test_tst_small PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_misc "/nc_test_tst_misc")
+set_tests_properties(nc_test_tst_misc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_norm "/nc_test_tst_norm")
+set_tests_properties(nc_test_tst_norm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_names "/nc_test_tst_names")
+set_tests_properties(nc_test_tst_names PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_nofill "/nc_test_tst_nofill")
+set_tests_properties(nc_test_tst_nofill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_nofill2 "/nc_test_tst_nofill2")
+set_tests_properties(nc_test_tst_nofill2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_nofill3 "/nc_test_tst_nofill3")
+set_tests_properties(nc_test_tst_nofill3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_meta "/nc_test_tst_meta")
+set_tests_properties(nc_test_tst_meta PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_inq_type "/nc_test_tst_inq_type")
+set_tests_properties(nc_test_tst_inq_type PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_utf8_validate "/nc_test_tst_utf8_validate")
+set_tests_properties(nc_test_tst_utf8_validate PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_utf8_phrases "/nc_test_tst_utf8_phrases")
+set_tests_properties(nc_test_tst_utf8_phrases PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_global_fillval "/nc_test_tst_global_fillval")
+set_tests_properties(nc_test_tst_global_fillval PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_max_var_dims "/nc_test_tst_max_var_dims")
+set_tests_properties(nc_test_tst_max_var_dims PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_formats "/nc_test_tst_formats")
+set_tests_properties(nc_test_tst_formats PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_def_var_fill "/nc_test_tst_def_var_fill")
+set_tests_properties(nc_test_tst_def_var_fill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_err_enddef "/nc_test_tst_err_enddef")
+set_tests_properties(nc_test_tst_err_enddef PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_default_format "/nc_test_tst_default_format")
+set_tests_properties(nc_test_tst_default_format PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_varm "/nc_test_tst_varm")
+set_tests_properties(nc_test_tst_varm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_copy_raw "/nc_test_tst_copy_raw")
+set_tests_properties(nc_test_tst_copy_raw PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_perf_stats "/nc_test_tst_perf_stats")
+set_tests_properties(nc_test_tst_perf_stats PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_fill_recs "/nc_test_tst_fill_recs")
+set_tests_properties(nc_test_tst_fill_recs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_lazy_fill "/nc_test_tst_lazy_fill")
+set_tests_properties(nc_test_tst_lazy_fill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_header_room "/nc_test_tst_header_room")
+set_tests_properties(nc_test_tst_header_room PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_mem_share "/nc_test_tst_mem_share")
+set_tests_properties(nc_test_tst_mem_share PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_diskless_flush "/nc_test_tst_diskless_flush")
+set_tests_properties(nc_test_tst_diskless_flush PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_concurrent "/nc_test_tst_concurrent")
+set_tests_properties(nc_test_tst_concurrent PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_threads "/nc_test_tst_threads")
+set_tests_properties(nc_test_tst_threads PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_tst_diskless6 "/nc_test_tst_diskless6")
+set_tests_properties(nc_test_tst_diskless6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;84;add_bin_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test "/nc_test")
+set_tests_properties(nc_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/nc_test/CMakeLists.txt;87;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_run_diskless "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test/run_diskless.sh")
+set_tests_properties(nc_test_run_diskless PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;91;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_run_mmap "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test/run_mmap.sh")
+set_tests_properties(nc_test_run_mmap PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;93;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_run_diskless5 "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test/run_diskless5.sh")
+set_tests_properties(nc_test_run_diskless5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;96;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
+add_test(nc_test_run_inmemory "bash" "-c" "export srcdir=/root/repo/nc_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test/run_inmemory.sh")
+set_tests_properties(nc_test_run_inmemory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test/CMakeLists.txt;97;add_sh_test;/root/repo/nc_test/CMakeLists.txt;0;")
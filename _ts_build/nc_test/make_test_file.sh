@@ -0,0 +1,2 @@
+#! /bin/sh
+./nc_test -c
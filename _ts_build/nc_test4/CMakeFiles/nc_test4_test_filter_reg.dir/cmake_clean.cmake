@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_test_filter_reg.dir/test_filter_reg.c.o"
+  "CMakeFiles/nc_test4_test_filter_reg.dir/test_filter_reg.c.o.d"
+  "nc_test4_test_filter_reg"
+  "nc_test4_test_filter_reg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_test_filter_reg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
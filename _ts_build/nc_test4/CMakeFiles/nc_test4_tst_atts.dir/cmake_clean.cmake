@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_atts.dir/tst_atts.c.o"
+  "CMakeFiles/nc_test4_tst_atts.dir/tst_atts.c.o.d"
+  "nc_test4_tst_atts"
+  "nc_test4_tst_atts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_atts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_atts_string_rewrite.dir/tst_atts_string_rewrite.c.o"
+  "CMakeFiles/nc_test4_tst_atts_string_rewrite.dir/tst_atts_string_rewrite.c.o.d"
+  "nc_test4_tst_atts_string_rewrite"
+  "nc_test4_tst_atts_string_rewrite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_atts_string_rewrite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_chunks_raw.dir/tst_chunks_raw.c.o"
+  "CMakeFiles/nc_test4_tst_chunks_raw.dir/tst_chunks_raw.c.o.d"
+  "nc_test4_tst_chunks_raw"
+  "nc_test4_tst_chunks_raw.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_chunks_raw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_converts.dir/tst_converts.c.o"
+  "CMakeFiles/nc_test4_tst_converts.dir/tst_converts.c.o.d"
+  "nc_test4_tst_converts"
+  "nc_test4_tst_converts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_converts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
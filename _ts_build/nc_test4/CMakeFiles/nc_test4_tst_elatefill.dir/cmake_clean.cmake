@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_elatefill.dir/tst_elatefill.c.o"
+  "CMakeFiles/nc_test4_tst_elatefill.dir/tst_elatefill.c.o.d"
+  "nc_test4_tst_elatefill"
+  "nc_test4_tst_elatefill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_elatefill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_endian_fill.dir/tst_endian_fill.c.o"
+  "CMakeFiles/nc_test4_tst_endian_fill.dir/tst_endian_fill.c.o.d"
+  "nc_test4_tst_endian_fill"
+  "nc_test4_tst_endian_fill.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_endian_fill.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
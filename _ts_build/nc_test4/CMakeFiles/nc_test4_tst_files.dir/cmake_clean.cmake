@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_files.dir/tst_files.c.o"
+  "CMakeFiles/nc_test4_tst_files.dir/tst_files.c.o.d"
+  "nc_test4_tst_files"
+  "nc_test4_tst_files.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_files5.dir/tst_files5.c.o"
+  "CMakeFiles/nc_test4_tst_files5.dir/tst_files5.c.o.d"
+  "nc_test4_tst_files5"
+  "nc_test4_tst_files5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_files5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_filterparser.dir/tst_filterparser.c.o"
+  "CMakeFiles/nc_test4_tst_filterparser.dir/tst_filterparser.c.o.d"
+  "nc_test4_tst_filterparser"
+  "nc_test4_tst_filterparser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_filterparser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
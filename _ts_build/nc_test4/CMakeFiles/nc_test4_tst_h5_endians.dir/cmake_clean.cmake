@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_h5_endians.dir/tst_h5_endians.c.o"
+  "CMakeFiles/nc_test4_tst_h5_endians.dir/tst_h5_endians.c.o.d"
+  "nc_test4_tst_h5_endians"
+  "nc_test4_tst_h5_endians.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_h5_endians.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
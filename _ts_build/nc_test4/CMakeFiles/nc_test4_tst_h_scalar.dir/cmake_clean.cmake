@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_h_scalar.dir/tst_h_scalar.c.o"
+  "CMakeFiles/nc_test4_tst_h_scalar.dir/tst_h_scalar.c.o.d"
+  "nc_test4_tst_h_scalar"
+  "nc_test4_tst_h_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_h_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
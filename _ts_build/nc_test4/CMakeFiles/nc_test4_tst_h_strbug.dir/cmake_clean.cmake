@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_h_strbug.dir/tst_h_strbug.c.o"
+  "CMakeFiles/nc_test4_tst_h_strbug.dir/tst_h_strbug.c.o.d"
+  "nc_test4_tst_h_strbug"
+  "nc_test4_tst_h_strbug.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_h_strbug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_hdf5_file_compat.dir/tst_hdf5_file_compat.c.o"
+  "CMakeFiles/nc_test4_tst_hdf5_file_compat.dir/tst_hdf5_file_compat.c.o.d"
+  "nc_test4_tst_hdf5_file_compat"
+  "nc_test4_tst_hdf5_file_compat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_hdf5_file_compat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
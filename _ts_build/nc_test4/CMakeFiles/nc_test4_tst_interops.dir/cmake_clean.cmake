@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_interops.dir/tst_interops.c.o"
+  "CMakeFiles/nc_test4_tst_interops.dir/tst_interops.c.o.d"
+  "nc_test4_tst_interops"
+  "nc_test4_tst_interops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_interops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
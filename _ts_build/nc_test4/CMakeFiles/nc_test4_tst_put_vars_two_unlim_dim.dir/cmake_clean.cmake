@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_put_vars_two_unlim_dim.dir/tst_put_vars_two_unlim_dim.c.o"
+  "CMakeFiles/nc_test4_tst_put_vars_two_unlim_dim.dir/tst_put_vars_two_unlim_dim.c.o.d"
+  "nc_test4_tst_put_vars_two_unlim_dim"
+  "nc_test4_tst_put_vars_two_unlim_dim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_put_vars_two_unlim_dim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
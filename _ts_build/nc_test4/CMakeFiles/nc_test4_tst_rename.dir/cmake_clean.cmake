@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_rename.dir/tst_rename.c.o"
+  "CMakeFiles/nc_test4_tst_rename.dir/tst_rename.c.o.d"
+  "nc_test4_tst_rename"
+  "nc_test4_tst_rename.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_rename.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
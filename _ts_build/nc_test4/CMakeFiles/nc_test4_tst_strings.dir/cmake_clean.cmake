@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_strings.dir/tst_strings.c.o"
+  "CMakeFiles/nc_test4_tst_strings.dir/tst_strings.c.o.d"
+  "nc_test4_tst_strings"
+  "nc_test4_tst_strings.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_strings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
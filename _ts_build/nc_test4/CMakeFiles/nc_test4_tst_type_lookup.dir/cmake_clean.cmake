@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_type_lookup.dir/tst_type_lookup.c.o"
+  "CMakeFiles/nc_test4_tst_type_lookup.dir/tst_type_lookup.c.o.d"
+  "nc_test4_tst_type_lookup"
+  "nc_test4_tst_type_lookup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_type_lookup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_udf.dir/tst_udf.c.o"
+  "CMakeFiles/nc_test4_tst_udf.dir/tst_udf.c.o.d"
+  "nc_test4_tst_udf"
+  "nc_test4_tst_udf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_udf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_varms.dir/tst_varms.c.o"
+  "CMakeFiles/nc_test4_tst_varms.dir/tst_varms.c.o.d"
+  "nc_test4_tst_varms"
+  "nc_test4_tst_varms.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_varms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nc_test4_tst_xplatform.dir/tst_xplatform.c.o"
+  "CMakeFiles/nc_test4_tst_xplatform.dir/tst_xplatform.c.o.d"
+  "nc_test4_tst_xplatform"
+  "nc_test4_tst_xplatform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nc_test4_tst_xplatform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
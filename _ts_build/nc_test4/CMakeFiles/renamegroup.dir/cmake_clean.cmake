@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renamegroup.dir/renamegroup.c.o"
+  "CMakeFiles/renamegroup.dir/renamegroup.c.o.d"
+  "renamegroup"
+  "renamegroup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/renamegroup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_filter.dir/test_filter.c.o"
+  "CMakeFiles/test_filter.dir/test_filter.c.o.d"
+  "test_filter"
+  "test_filter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_filter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
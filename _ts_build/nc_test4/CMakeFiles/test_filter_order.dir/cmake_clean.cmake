@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_filter_order.dir/test_filter_order.c.o"
+  "CMakeFiles/test_filter_order.dir/test_filter_order.c.o.d"
+  "test_filter_order"
+  "test_filter_order.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_filter_order.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
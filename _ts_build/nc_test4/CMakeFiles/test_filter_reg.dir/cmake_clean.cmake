@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_filter_reg.dir/test_filter_reg.c.o"
+  "CMakeFiles/test_filter_reg.dir/test_filter_reg.c.o.d"
+  "test_filter_reg"
+  "test_filter_reg.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_filter_reg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
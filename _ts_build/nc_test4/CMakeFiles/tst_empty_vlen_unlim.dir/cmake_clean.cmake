@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_empty_vlen_unlim.dir/tst_empty_vlen_unlim.c.o"
+  "CMakeFiles/tst_empty_vlen_unlim.dir/tst_empty_vlen_unlim.c.o.d"
+  "tst_empty_vlen_unlim"
+  "tst_empty_vlen_unlim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_empty_vlen_unlim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_filter_codecs.dir/tst_filter_codecs.c.o"
+  "CMakeFiles/tst_filter_codecs.dir/tst_filter_codecs.c.o.d"
+  "tst_filter_codecs"
+  "tst_filter_codecs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_filter_codecs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
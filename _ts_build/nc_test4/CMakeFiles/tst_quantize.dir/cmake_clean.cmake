@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_quantize.dir/tst_quantize.c.o"
+  "CMakeFiles/tst_quantize.dir/tst_quantize.c.o.d"
+  "tst_quantize"
+  "tst_quantize.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_quantize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
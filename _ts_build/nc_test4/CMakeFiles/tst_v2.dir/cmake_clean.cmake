@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_v2.dir/tst_v2.c.o"
+  "CMakeFiles/tst_v2.dir/tst_v2.c.o.d"
+  "tst_v2"
+  "tst_v2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_v2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
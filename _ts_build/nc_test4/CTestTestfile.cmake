@@ -0,0 +1,160 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/nc_test4
+# Build directory: /root/repo/_ts_build/nc_test4
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(nc_test4_run_grp_rename "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test4/run_grp_rename.sh")
+set_tests_properties(nc_test4_run_grp_rename PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;31;add_sh_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_misc "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test4/tst_misc.sh")
+set_tests_properties(nc_test4_tst_misc PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;32;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_filter "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test4/tst_filter.sh")
+set_tests_properties(nc_test4_tst_filter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;41;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_filter_codecs "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test4/tst_filter_codecs.sh")
+set_tests_properties(nc_test4_tst_filter_codecs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;42;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_run_empty_vlen_test "bash" "-c" "export srcdir=/root/repo/nc_test4;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nc_test4/run_empty_vlen_test.sh")
+set_tests_properties(nc_test4_run_empty_vlen_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;53;ADD_SH_TEST;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_dims "/nc_test4_tst_dims")
+set_tests_properties(nc_test4_tst_dims PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_dims2 "/nc_test4_tst_dims2")
+set_tests_properties(nc_test4_tst_dims2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_dims3 "/nc_test4_tst_dims3")
+set_tests_properties(nc_test4_tst_dims3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_files "/nc_test4_tst_files")
+set_tests_properties(nc_test4_tst_files PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_files4 "/nc_test4_tst_files4")
+set_tests_properties(nc_test4_tst_files4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_vars "/nc_test4_tst_vars")
+set_tests_properties(nc_test4_tst_vars PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_varms "/nc_test4_tst_varms")
+set_tests_properties(nc_test4_tst_varms PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_unlim_vars "/nc_test4_tst_unlim_vars")
+set_tests_properties(nc_test4_tst_unlim_vars PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_converts "/nc_test4_tst_converts")
+set_tests_properties(nc_test4_tst_converts PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_converts2 "/nc_test4_tst_converts2")
+set_tests_properties(nc_test4_tst_converts2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_grps "/nc_test4_tst_grps")
+set_tests_properties(nc_test4_tst_grps PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_grps2 "/nc_test4_tst_grps2")
+set_tests_properties(nc_test4_tst_grps2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_compounds "/nc_test4_tst_compounds")
+set_tests_properties(nc_test4_tst_compounds PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_compounds2 "/nc_test4_tst_compounds2")
+set_tests_properties(nc_test4_tst_compounds2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_compounds3 "/nc_test4_tst_compounds3")
+set_tests_properties(nc_test4_tst_compounds3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_opaques "/nc_test4_tst_opaques")
+set_tests_properties(nc_test4_tst_opaques PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_strings "/nc_test4_tst_strings")
+set_tests_properties(nc_test4_tst_strings PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_strings2 "/nc_test4_tst_strings2")
+set_tests_properties(nc_test4_tst_strings2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_interops "/nc_test4_tst_interops")
+set_tests_properties(nc_test4_tst_interops PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_interops4 "/nc_test4_tst_interops4")
+set_tests_properties(nc_test4_tst_interops4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_interops6 "/nc_test4_tst_interops6")
+set_tests_properties(nc_test4_tst_interops6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_interops_dims "/nc_test4_tst_interops_dims")
+set_tests_properties(nc_test4_tst_interops_dims PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_enums "/nc_test4_tst_enums")
+set_tests_properties(nc_test4_tst_enums PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_coords "/nc_test4_tst_coords")
+set_tests_properties(nc_test4_tst_coords PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_coords2 "/nc_test4_tst_coords2")
+set_tests_properties(nc_test4_tst_coords2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_coords3 "/nc_test4_tst_coords3")
+set_tests_properties(nc_test4_tst_coords3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_vars3 "/nc_test4_tst_vars3")
+set_tests_properties(nc_test4_tst_vars3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_vars4 "/nc_test4_tst_vars4")
+set_tests_properties(nc_test4_tst_vars4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_chunks "/nc_test4_tst_chunks")
+set_tests_properties(nc_test4_tst_chunks PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_chunks2 "/nc_test4_tst_chunks2")
+set_tests_properties(nc_test4_tst_chunks2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_utf8 "/nc_test4_tst_utf8")
+set_tests_properties(nc_test4_tst_utf8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_fills "/nc_test4_tst_fills")
+set_tests_properties(nc_test4_tst_fills PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_fills2 "/nc_test4_tst_fills2")
+set_tests_properties(nc_test4_tst_fills2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_fillbug "/nc_test4_tst_fillbug")
+set_tests_properties(nc_test4_tst_fillbug PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_xplatform2 "/nc_test4_tst_xplatform2")
+set_tests_properties(nc_test4_tst_xplatform2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_endian_fill "/nc_test4_tst_endian_fill")
+set_tests_properties(nc_test4_tst_endian_fill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_atts "/nc_test4_tst_atts")
+set_tests_properties(nc_test4_tst_atts PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_t_type "/nc_test4_t_type")
+set_tests_properties(nc_test4_t_type PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_cdm_sea_soundings "/nc_test4_cdm_sea_soundings")
+set_tests_properties(nc_test4_cdm_sea_soundings PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_vl "/nc_test4_tst_vl")
+set_tests_properties(nc_test4_tst_vl PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_atts1 "/nc_test4_tst_atts1")
+set_tests_properties(nc_test4_tst_atts1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_atts2 "/nc_test4_tst_atts2")
+set_tests_properties(nc_test4_tst_atts2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_vars2 "/nc_test4_tst_vars2")
+set_tests_properties(nc_test4_tst_vars2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_files5 "/nc_test4_tst_files5")
+set_tests_properties(nc_test4_tst_files5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_files6 "/nc_test4_tst_files6")
+set_tests_properties(nc_test4_tst_files6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_sync "/nc_test4_tst_sync")
+set_tests_properties(nc_test4_tst_sync PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_h_strbug "/nc_test4_tst_h_strbug")
+set_tests_properties(nc_test4_tst_h_strbug PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_h_refs "/nc_test4_tst_h_refs")
+set_tests_properties(nc_test4_tst_h_refs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_h_scalar "/nc_test4_tst_h_scalar")
+set_tests_properties(nc_test4_tst_h_scalar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_rename "/nc_test4_tst_rename")
+set_tests_properties(nc_test4_tst_rename PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_rename2 "/nc_test4_tst_rename2")
+set_tests_properties(nc_test4_tst_rename2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_rename3 "/nc_test4_tst_rename3")
+set_tests_properties(nc_test4_tst_rename3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_h5_endians "/nc_test4_tst_h5_endians")
+set_tests_properties(nc_test4_tst_h5_endians PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_atts_string_rewrite "/nc_test4_tst_atts_string_rewrite")
+set_tests_properties(nc_test4_tst_atts_string_rewrite PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_put_vars_two_unlim_dim "/nc_test4_tst_put_vars_two_unlim_dim")
+set_tests_properties(nc_test4_tst_put_vars_two_unlim_dim PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_hdf5_file_compat "/nc_test4_tst_hdf5_file_compat")
+set_tests_properties(nc_test4_tst_hdf5_file_compat PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_fill_attr_vanish "/nc_test4_tst_fill_attr_vanish")
+set_tests_properties(nc_test4_tst_fill_attr_vanish PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_rehash "/nc_test4_tst_rehash")
+set_tests_properties(nc_test4_tst_rehash PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_types "/nc_test4_tst_types")
+set_tests_properties(nc_test4_tst_types PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_bug324 "/nc_test4_tst_bug324")
+set_tests_properties(nc_test4_tst_bug324 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_atts3 "/nc_test4_tst_atts3")
+set_tests_properties(nc_test4_tst_atts3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_put_vars "/nc_test4_tst_put_vars")
+set_tests_properties(nc_test4_tst_put_vars PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_elatefill "/nc_test4_tst_elatefill")
+set_tests_properties(nc_test4_tst_elatefill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_udf "/nc_test4_tst_udf")
+set_tests_properties(nc_test4_tst_udf PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_bug1442 "/nc_test4_tst_bug1442")
+set_tests_properties(nc_test4_tst_bug1442 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_chunks_raw "/nc_test4_tst_chunks_raw")
+set_tests_properties(nc_test4_tst_chunks_raw PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_type_lookup "/nc_test4_tst_type_lookup")
+set_tests_properties(nc_test4_tst_type_lookup PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_xplatform "/nc_test4_tst_xplatform")
+set_tests_properties(nc_test4_tst_xplatform PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_filterparser "/nc_test4_tst_filterparser")
+set_tests_properties(nc_test4_tst_filterparser PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_test_filter_reg "/nc_test4_test_filter_reg")
+set_tests_properties(nc_test4_test_filter_reg PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_interops5 "/nc_test4_tst_interops5")
+set_tests_properties(nc_test4_tst_interops5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
+add_test(nc_test4_tst_camrun "/nc_test4_tst_camrun")
+set_tests_properties(nc_test4_tst_camrun PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/nc_test4/CMakeLists.txt;85;add_bin_test;/root/repo/nc_test4/CMakeLists.txt;0;")
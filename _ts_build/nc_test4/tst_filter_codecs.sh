@@ -0,0 +1,67 @@
+#!/bin/sh
+
+# Test the blockshuffle, quantize, zstd and lz4 filter plugins, those
+# that were built, through the API and through nccopy -F.
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+set -e
+
+# Load the findplugins function
+. ${builddir}/findplugin.sh
+
+# The plugins were built in the same directory; zstd and lz4 only
+# where their libraries were found.
+findplugin h5blockshuffle
+findplugin h5quantize >/dev/null
+SPECS="blockshuffle blockshuffle,1 blockshuffle,2,256 blockshuffle,1|deflate,5"
+if findplugin h5zstd >/dev/null ; then
+  SPECS="$SPECS zstd zstandard,19 blockshuffle|zstd,3"
+  HAVE_ZSTD=1
+fi
+if findplugin h5lz4 >/dev/null ; then
+  SPECS="$SPECS lz4 lz4,4096 blockshuffle,1|lz4"
+  HAVE_LZ4=1
+fi
+echo "final HDF5_PLUGIN_PATH=${HDF5_PLUGIN_PATH}"
+export HDF5_PLUGIN_PATH
+
+echo "*** Testing filter plugins using the API"
+${execdir}/tst_filter_codecs $SPECS
+${execdir}/tst_quantize
+
+echo "*** Testing filter plugins using nccopy"
+rm -f ./tst_codecs_in.nc ./tst_codecs_out.nc ./tst_codecs_in.cdl ./tst_codecs_out.cdl
+${NCGEN} -4 -lb -o tst_codecs_in.nc ${srcdir}/ref_unfiltered.cdl
+${NCDUMP} -n codecs tst_codecs_in.nc > tst_codecs_in.cdl
+FILTERS="blockshuffle,2"
+if test "x$HAVE_ZSTD" = x1 ; then FILTERS="$FILTERS|zstd,5"; fi
+if test "x$HAVE_LZ4" = x1 ; then FILTERS="$FILTERS|lz4"; fi
+${NCCOPY} -M0 "-F/g/var,$FILTERS" tst_codecs_in.nc tst_codecs_out.nc
+# The filters are there, and the data comes back
+${NCDUMP} -hs tst_codecs_out.nc | grep '_Filter = "32769,2,16384,4'
+${NCDUMP} -n codecs tst_codecs_out.nc > tst_codecs_out.cdl
+diff -b -w tst_codecs_in.cdl tst_codecs_out.cdl
+
+echo "*** Testing the quantize plugin using nccopy"
+${NCCOPY} -M0 "-F/g/var,quantize,2,10|blockshuffle" tst_codecs_in.nc tst_codecs_out.nc
+${NCDUMP} -hs tst_codecs_out.nc | grep '_Filter = "32770,2,10,4'
+${NCDUMP} -h tst_codecs_out.nc | grep '_QuantizeBitRoundNumberOfSignificantBits = 10'
+
+echo "*** Testing that ncfilterbench chooses a lossy chain only with -L"
+NCFILTERBENCH="${top_builddir}/ncdump${VS}/ncfilterbench${ext}"
+${NCFILTERBENCH} -r 1 -v /g/var -f deflate,1 -f "quantize,2,4|deflate,1" \
+    tst_codecs_in.nc > tst_codecs_bench.out
+cat tst_codecs_bench.out
+grep 'quantize,2,4|deflate,1 (lossy)' tst_codecs_bench.out
+grep '^  best: .*,deflate,1" -c ' tst_codecs_bench.out
+if grep '^  best: .*(lossy)' tst_codecs_bench.out ; then exit 1; fi
+${NCFILTERBENCH} -r 1 -v /g/var -f deflate,1 -f "quantize,2,4|deflate,1" -L \
+    tst_codecs_in.nc > tst_codecs_bench.out
+grep '^  best: .*,quantize,2,4|deflate,1" -c .* (lossy)$' tst_codecs_bench.out
+
+rm -f ./tst_filter_codecs.nc ./tst_quantize.nc ./tst_quantize_raw.nc ./tst_codecs_in.nc ./tst_codecs_out.nc
+rm -f ./tst_codecs_in.cdl ./tst_codecs_out.cdl ./tst_codecs_bench.out
+echo "*** Pass: filter plugins"
+exit 0
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/findtestserver.dir/findtestserver.c.o"
+  "CMakeFiles/findtestserver.dir/findtestserver.c.o.d"
+  "findtestserver"
+  "findtestserver.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/findtestserver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
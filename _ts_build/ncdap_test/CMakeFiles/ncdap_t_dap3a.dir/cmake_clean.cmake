@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdap_t_dap3a.dir/t_dap3a.c.o"
+  "CMakeFiles/ncdap_t_dap3a.dir/t_dap3a.c.o.d"
+  "ncdap_t_dap3a"
+  "ncdap_t_dap3a.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdap_t_dap3a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
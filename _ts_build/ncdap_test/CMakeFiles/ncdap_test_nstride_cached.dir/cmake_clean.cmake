@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdap_test_nstride_cached.dir/test_nstride_cached.c.o"
+  "CMakeFiles/ncdap_test_nstride_cached.dir/test_nstride_cached.c.o.d"
+  "ncdap_test_nstride_cached"
+  "ncdap_test_nstride_cached.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdap_test_nstride_cached.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdap_test_varm3.dir/test_varm3.c.o"
+  "CMakeFiles/ncdap_test_varm3.dir/test_varm3.c.o.d"
+  "ncdap_test_varm3"
+  "ncdap_test_varm3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdap_test_varm3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ncdap_test
+# Build directory: /root/repo/_ts_build/ncdap_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ncdap_tst_ncdap3 "bash" "-c" "export srcdir=/root/repo/ncdap_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdap_test/tst_ncdap3.sh")
+set_tests_properties(ncdap_tst_ncdap3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;30;add_sh_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_t_dap3a "bash" "-c" "TOPSRCDIR=/root/repo/ncdap_test /root/repo/_ts_build/ncdap_test/ncdap_t_dap3a")
+set_tests_properties(ncdap_t_dap3a PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1586;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;33;add_bin_env_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_test_cvt "bash" "-c" "TOPSRCDIR=/root/repo/ncdap_test /root/repo/_ts_build/ncdap_test/ncdap_test_cvt")
+set_tests_properties(ncdap_test_cvt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1586;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;34;add_bin_env_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_test_vara "bash" "-c" "TOPSRCDIR=/root/repo/ncdap_test /root/repo/_ts_build/ncdap_test/ncdap_test_vara")
+set_tests_properties(ncdap_test_vara PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1586;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;35;add_bin_env_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_tst_ber "bash" "-c" "export srcdir=/root/repo/ncdap_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdap_test/tst_ber.sh")
+set_tests_properties(ncdap_tst_ber PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;41;add_sh_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_tst_remote3 "bash" "-c" "export srcdir=/root/repo/ncdap_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdap_test/tst_remote3.sh")
+set_tests_properties(ncdap_tst_remote3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;42;add_sh_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_tst_zero_len_var "bash" "-c" "export srcdir=/root/repo/ncdap_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdap_test/tst_zero_len_var.sh")
+set_tests_properties(ncdap_tst_zero_len_var PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;43;add_sh_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_tst_fillmismatch "bash" "-c" "export srcdir=/root/repo/ncdap_test;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdap_test/tst_fillmismatch.sh")
+set_tests_properties(ncdap_tst_fillmismatch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;45;add_sh_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_test_varm3 "/ncdap_test_varm3")
+set_tests_properties(ncdap_test_varm3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;57;add_bin_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+add_test(ncdap_test_nstride_cached "/ncdap_test_nstride_cached")
+set_tests_properties(ncdap_test_nstride_cached PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/ncdap_test/CMakeLists.txt;58;add_bin_test;/root/repo/ncdap_test/CMakeLists.txt;0;")
+subdirs("testdata3")
+subdirs("expected3")
+subdirs("expectremote3")
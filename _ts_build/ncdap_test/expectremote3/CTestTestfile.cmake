@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ncdap_test/expectremote3
+# Build directory: /root/repo/_ts_build/ncdap_test/expectremote3
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bom.dir/bom.c.o"
+  "CMakeFiles/bom.dir/bom.c.o.d"
+  "bom"
+  "bom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
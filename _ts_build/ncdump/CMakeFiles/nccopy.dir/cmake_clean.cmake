@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nccopy.dir/chunkspec.c.o"
+  "CMakeFiles/nccopy.dir/chunkspec.c.o.d"
+  "CMakeFiles/nccopy.dir/copypool.c.o"
+  "CMakeFiles/nccopy.dir/copypool.c.o.d"
+  "CMakeFiles/nccopy.dir/dimmap.c.o"
+  "CMakeFiles/nccopy.dir/dimmap.c.o.d"
+  "CMakeFiles/nccopy.dir/list.c.o"
+  "CMakeFiles/nccopy.dir/list.c.o.d"
+  "CMakeFiles/nccopy.dir/nccopy.c.o"
+  "CMakeFiles/nccopy.dir/nccopy.c.o.d"
+  "CMakeFiles/nccopy.dir/nciter.c.o"
+  "CMakeFiles/nccopy.dir/nciter.c.o.d"
+  "CMakeFiles/nccopy.dir/rechunk.c.o"
+  "CMakeFiles/nccopy.dir/rechunk.c.o.d"
+  "CMakeFiles/nccopy.dir/utils.c.o"
+  "CMakeFiles/nccopy.dir/utils.c.o.d"
+  "nccopy"
+  "nccopy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nccopy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ncdump/dumplib.c" "ncdump/CMakeFiles/ncdump.dir/dumplib.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/dumplib.c.o.d"
+  "/root/repo/ncdump/dumppool.c" "ncdump/CMakeFiles/ncdump.dir/dumppool.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/dumppool.c.o.d"
+  "/root/repo/ncdump/indent.c" "ncdump/CMakeFiles/ncdump.dir/indent.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/indent.c.o.d"
+  "/root/repo/ncdump/ncdump.c" "ncdump/CMakeFiles/ncdump.dir/ncdump.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/ncdump.c.o.d"
+  "/root/repo/ncdump/nciter.c" "ncdump/CMakeFiles/ncdump.dir/nciter.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/nciter.c.o.d"
+  "/root/repo/ncdump/nctime0.c" "ncdump/CMakeFiles/ncdump.dir/nctime0.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/nctime0.c.o.d"
+  "/root/repo/ncdump/numfmt.c" "ncdump/CMakeFiles/ncdump.dir/numfmt.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/numfmt.c.o.d"
+  "/root/repo/ncdump/utils.c" "ncdump/CMakeFiles/ncdump.dir/utils.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/utils.c.o.d"
+  "/root/repo/ncdump/vardata.c" "ncdump/CMakeFiles/ncdump.dir/vardata.c.o" "gcc" "ncdump/CMakeFiles/ncdump.dir/vardata.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/liblib/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncdump.dir/dumplib.c.o"
+  "CMakeFiles/ncdump.dir/dumplib.c.o.d"
+  "CMakeFiles/ncdump.dir/dumppool.c.o"
+  "CMakeFiles/ncdump.dir/dumppool.c.o.d"
+  "CMakeFiles/ncdump.dir/indent.c.o"
+  "CMakeFiles/ncdump.dir/indent.c.o.d"
+  "CMakeFiles/ncdump.dir/ncdump.c.o"
+  "CMakeFiles/ncdump.dir/ncdump.c.o.d"
+  "CMakeFiles/ncdump.dir/nciter.c.o"
+  "CMakeFiles/ncdump.dir/nciter.c.o.d"
+  "CMakeFiles/ncdump.dir/nctime0.c.o"
+  "CMakeFiles/ncdump.dir/nctime0.c.o.d"
+  "CMakeFiles/ncdump.dir/numfmt.c.o"
+  "CMakeFiles/ncdump.dir/numfmt.c.o.d"
+  "CMakeFiles/ncdump.dir/utils.c.o"
+  "CMakeFiles/ncdump.dir/utils.c.o.d"
+  "CMakeFiles/ncdump.dir/vardata.c.o"
+  "CMakeFiles/ncdump.dir/vardata.c.o.d"
+  "ncdump"
+  "ncdump.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncdump.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ncdump/ncfilterbench.c" "ncdump/CMakeFiles/ncfilterbench.dir/ncfilterbench.c.o" "gcc" "ncdump/CMakeFiles/ncfilterbench.dir/ncfilterbench.c.o.d"
+  "/root/repo/ncdump/utils.c" "ncdump/CMakeFiles/ncfilterbench.dir/utils.c.o" "gcc" "ncdump/CMakeFiles/ncfilterbench.dir/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/liblib/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
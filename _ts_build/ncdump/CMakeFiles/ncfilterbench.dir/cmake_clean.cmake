@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncfilterbench.dir/ncfilterbench.c.o"
+  "CMakeFiles/ncfilterbench.dir/ncfilterbench.c.o.d"
+  "CMakeFiles/ncfilterbench.dir/utils.c.o"
+  "CMakeFiles/ncfilterbench.dir/utils.c.o.d"
+  "ncfilterbench"
+  "ncfilterbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncfilterbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
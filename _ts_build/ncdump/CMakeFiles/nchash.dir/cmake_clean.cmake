@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nchash.dir/nchash.c.o"
+  "CMakeFiles/nchash.dir/nchash.c.o.d"
+  "CMakeFiles/nchash.dir/sha256.c.o"
+  "CMakeFiles/nchash.dir/sha256.c.o.d"
+  "CMakeFiles/nchash.dir/utils.c.o"
+  "CMakeFiles/nchash.dir/utils.c.o.d"
+  "nchash"
+  "nchash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nchash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
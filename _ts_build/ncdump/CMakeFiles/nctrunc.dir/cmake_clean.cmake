@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nctrunc.dir/nctrunc.c.o"
+  "CMakeFiles/nctrunc.dir/nctrunc.c.o.d"
+  "nctrunc"
+  "nctrunc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/nctrunc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
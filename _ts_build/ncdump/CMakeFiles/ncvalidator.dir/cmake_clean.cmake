@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncvalidator.dir/ncvalidator.c.o"
+  "CMakeFiles/ncvalidator.dir/ncvalidator.c.o.d"
+  "ncvalidator"
+  "ncvalidator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncvalidator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ocprint.dir/ocprint.c.o"
+  "CMakeFiles/ocprint.dir/ocprint.c.o.d"
+  "ocprint"
+  "ocprint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ocprint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
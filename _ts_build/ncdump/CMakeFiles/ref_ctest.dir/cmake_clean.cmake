@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ref_ctest.dir/ref_ctest.c.o"
+  "CMakeFiles/ref_ctest.dir/ref_ctest.c.o.d"
+  "ref_ctest"
+  "ref_ctest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ref_ctest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
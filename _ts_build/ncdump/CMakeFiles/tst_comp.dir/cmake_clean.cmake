@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_comp.dir/tst_comp.c.o"
+  "CMakeFiles/tst_comp.dir/tst_comp.c.o.d"
+  "tst_comp"
+  "tst_comp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_comp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_comp2.dir/tst_comp2.c.o"
+  "CMakeFiles/tst_comp2.dir/tst_comp2.c.o.d"
+  "tst_comp2"
+  "tst_comp2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_comp2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
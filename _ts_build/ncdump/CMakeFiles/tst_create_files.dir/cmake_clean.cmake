@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_create_files.dir/tst_create_files.c.o"
+  "CMakeFiles/tst_create_files.dir/tst_create_files.c.o.d"
+  "tst_create_files"
+  "tst_create_files.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_create_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_dimsizes.dir/tst_dimsizes.c.o"
+  "CMakeFiles/tst_dimsizes.dir/tst_dimsizes.c.o.d"
+  "tst_dimsizes"
+  "tst_dimsizes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_dimsizes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
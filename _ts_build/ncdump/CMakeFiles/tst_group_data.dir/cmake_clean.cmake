@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_group_data.dir/tst_group_data.c.o"
+  "CMakeFiles/tst_group_data.dir/tst_group_data.c.o.d"
+  "tst_group_data"
+  "tst_group_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_group_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
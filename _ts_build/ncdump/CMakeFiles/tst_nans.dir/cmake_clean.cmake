@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_nans.dir/tst_nans.c.o"
+  "CMakeFiles/tst_nans.dir/tst_nans.c.o.d"
+  "tst_nans"
+  "tst_nans.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_nans.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
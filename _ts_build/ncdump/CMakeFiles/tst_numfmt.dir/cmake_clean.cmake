@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_numfmt.dir/numfmt.c.o"
+  "CMakeFiles/tst_numfmt.dir/numfmt.c.o.d"
+  "CMakeFiles/tst_numfmt.dir/tst_numfmt.c.o"
+  "CMakeFiles/tst_numfmt.dir/tst_numfmt.c.o.d"
+  "tst_numfmt"
+  "tst_numfmt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_numfmt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_string_data.dir/tst_string_data.c.o"
+  "CMakeFiles/tst_string_data.dir/tst_string_data.c.o.d"
+  "tst_string_data"
+  "tst_string_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_string_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
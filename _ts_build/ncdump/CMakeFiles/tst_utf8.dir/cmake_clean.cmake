@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_utf8.dir/tst_utf8.c.o"
+  "CMakeFiles/tst_utf8.dir/tst_utf8.c.o.d"
+  "tst_utf8"
+  "tst_utf8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_utf8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,92 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ncdump
+# Build directory: /root/repo/_ts_build/ncdump
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ncdump_run_tests "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/run_tests.sh")
+set_tests_properties(ncdump_run_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;174;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_64bit "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_64bit.sh")
+set_tests_properties(ncdump_tst_64bit PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;175;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ref_ctest "/ref_ctest")
+set_tests_properties(ref_ctest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1612;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;176;add_bin_test_no_prefix;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ref_ctest64 "/ref_ctest64")
+set_tests_properties(ref_ctest64 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1612;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;177;add_bin_test_no_prefix;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_output "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_output.sh")
+set_tests_properties(ncdump_tst_output PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;178;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_lengths "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_lengths.sh")
+set_tests_properties(ncdump_tst_lengths PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;179;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_calendars "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_calendars.sh")
+set_tests_properties(ncdump_tst_calendars PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;180;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(tst_numfmt "/tst_numfmt")
+set_tests_properties(tst_numfmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/ncdump/CMakeLists.txt;181;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_run_utf8_tests "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/run_utf8_tests.sh")
+set_tests_properties(ncdump_run_utf8_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;183;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_run_utf8_nc4_tests "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/run_utf8_nc4_tests.sh")
+set_tests_properties(ncdump_run_utf8_nc4_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;185;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_fileinfo "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_fileinfo.sh")
+set_tests_properties(ncdump_tst_fileinfo PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;186;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_hdf5_offset "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_hdf5_offset.sh")
+set_tests_properties(ncdump_tst_hdf5_offset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;187;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_test_unicode_directory "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/test_unicode_directory.sh")
+set_tests_properties(ncdump_test_unicode_directory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;189;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_null_byte_padding "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_null_byte_padding.sh")
+set_tests_properties(ncdump_tst_null_byte_padding PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;191;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_nccopy3 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_nccopy3.sh")
+set_tests_properties(ncdump_tst_nccopy3 PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;196;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_nccopy3_subset "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_nccopy3_subset.sh")
+set_tests_properties(ncdump_tst_nccopy3_subset PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;201;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_charfill "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_charfill.sh")
+set_tests_properties(ncdump_tst_charfill PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;202;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_formatx3 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_formatx3.sh")
+set_tests_properties(ncdump_tst_formatx3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;204;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_bom "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_bom.sh")
+set_tests_properties(ncdump_tst_bom PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;205;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_dimsizes "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_dimsizes.sh")
+set_tests_properties(ncdump_tst_dimsizes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;206;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_nchash "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_nchash.sh")
+set_tests_properties(ncdump_tst_nchash PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;207;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_inmemory_nc3 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_inmemory_nc3.sh")
+set_tests_properties(ncdump_tst_inmemory_nc3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;217;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_nccopy_w3 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_nccopy_w3.sh")
+set_tests_properties(ncdump_tst_nccopy_w3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;218;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_inmemory_nc4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_inmemory_nc4.sh")
+set_tests_properties(ncdump_tst_inmemory_nc4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;220;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_nccopy_w4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_nccopy_w4.sh")
+set_tests_properties(ncdump_tst_nccopy_w4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;221;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_formatx4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_formatx4.sh")
+set_tests_properties(ncdump_tst_formatx4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;235;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_netcdf4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_netcdf4.sh")
+set_tests_properties(ncdump_tst_netcdf4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;257;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_sh_tst_fillbug "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_fillbug.sh")
+set_tests_properties(ncdump_sh_tst_fillbug PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;264;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_netcdf4_4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_netcdf4_4.sh")
+set_tests_properties(ncdump_tst_netcdf4_4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;266;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_run_ncgen_tests "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/run_ncgen_tests.sh")
+set_tests_properties(ncdump_run_ncgen_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;275;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_run_ncgen_nc4_tests "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/run_ncgen_nc4_tests.sh")
+set_tests_properties(ncdump_run_ncgen_nc4_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;277;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_grp_spec "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_grp_spec.sh")
+set_tests_properties(ncdump_tst_grp_spec PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;280;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_mud "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_mud.sh")
+set_tests_properties(ncdump_tst_mud PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;281;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_shell_tst_h_scalar "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_h_scalar.sh")
+set_tests_properties(ncdump_shell_tst_h_scalar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;282;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_nccopy4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_nccopy4.sh")
+set_tests_properties(ncdump_tst_nccopy4 PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;284;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_nccopy5 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_nccopy5.sh")
+set_tests_properties(ncdump_tst_nccopy5 PROPERTIES  RUN_SERIAL "TRUE" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;289;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_ncfilterbench "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_ncfilterbench.sh")
+set_tests_properties(ncdump_tst_ncfilterbench PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;290;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_ncgen4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_ncgen4.sh")
+set_tests_properties(ncdump_tst_ncgen4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;296;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_inttags "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_inttags.sh")
+set_tests_properties(ncdump_tst_inttags PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;299;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_inttags4 "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_inttags4.sh")
+set_tests_properties(ncdump_tst_inttags4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;301;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_test_radix "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/test_radix.sh")
+set_tests_properties(ncdump_test_radix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;304;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+add_test(ncdump_tst_ctests "bash" "-c" "export srcdir=/root/repo/ncdump;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncdump/tst_ctests.sh")
+set_tests_properties(ncdump_tst_ctests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncdump/CMakeLists.txt;306;add_sh_test;/root/repo/ncdump/CMakeLists.txt;0;")
+subdirs("cdl")
+subdirs("expected")
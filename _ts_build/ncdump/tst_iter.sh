@@ -0,0 +1,109 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi 
+. ../test_common.sh
+
+# This shell script runs an ncdump bug test for netcdf
+# Test if the nciter code is working [NCF-154]
+
+set -e
+echo ""
+echo "*** Running ncdump nc_iter test."
+
+if test "x$CC" = "x" ; then CC="gcc"; fi
+
+CLEANUP="iter.* iter2.*"
+
+rm -f $CLEANUP
+
+# echo "create iter.cdl"
+cat > iter.cdl <<EOF
+netcdf iter {
+dimensions:
+x = 5 ;
+y = 256 ;
+z = 256;
+variables:
+int var(x,y,z) ;
+data:
+var =
+EOF
+cat >./iter.c <<EOF
+#include <stdlib.h>
+#include <stdio.h>
+#define N (5*256*256)
+int main() {
+  int i;
+  for(i=0;i<N-1;i++) {printf("%d,\n",i);}
+  printf("%d;\n}\n",N);
+  return 0;
+}
+EOF
+
+$CC ./iter.c -o iter.exe
+./iter.exe >>iter.cdl
+
+# echo "*** create iter.nc "
+${NCGEN} -k nc3 -o iter.nc ./iter.cdl
+echo "*** dumping iter.nc to iter.dmp"
+${NCDUMP} iter.nc > iter.dmp
+echo "*** reformat iter.dmp"
+mv iter.dmp iter.tmp
+sed -e 's/\([0-9][,]\) /\1@/g' <iter.tmp |tr '@' '\n' |sed -e '/^$/d' >./iter.dmp
+
+echo "*** comparing iter.dmp with iter.cdl..."
+diff -b -w ./iter.dmp ./iter.cdl
+
+echo "*** comparing ncdump -j 4 with serial ncdump..."
+for opts in "" "-b c" "-f c" ; do
+    ${NCDUMP} $opts iter.nc > iter.dmp
+    ${NCDUMP} -j 4 $opts iter.nc > iter.j4
+    cmp iter.dmp iter.j4
+done
+
+# A data list long enough for ncgen to spool it while parsing, with
+# fill values, ending with constants that are kept in memory
+cat > iter2.cdl <<EOF
+netcdf iter2 {
+dimensions:
+t = UNLIMITED ;
+x = 10 ;
+variables:
+short s(t,x) ;
+s:_FillValue = -99s ;
+data:
+s =
+EOF
+cat >./iter2.c <<EOF
+#include <stdlib.h>
+#include <stdio.h>
+#define N 20000
+int main(int argc, char** argv) {
+  FILE* exp = fopen(argv[1],"w");
+  int i;
+  for(i=0;i<N;i++) {
+    if(i % 7 == 3) {printf("_,\n"); fprintf(exp,"_\n");}
+    else {printf("%d,\n",i); fprintf(exp,"%d\n",i);}
+  }
+  printf("'7', \"12\" ;\n}\n");
+  /* the last record is filled */
+  fprintf(exp,"55\n12\n");
+  for(i=0;i<8;i++) fprintf(exp,"_\n");
+  fclose(exp);
+  return 0;
+}
+EOF
+
+$CC ./iter2.c -o iter2.exe
+./iter2.exe iter2.exp >>iter2.cdl
+
+echo "*** create iter2.nc "
+${NCGEN} -k nc3 -o iter2.nc ./iter2.cdl
+echo "*** comparing the data in iter2.nc with iter2.cdl..."
+${NCDUMP} -v s iter2.nc | sed -e '1,/^ s =/d' -e 's/[;}]//g' | tr ',' '\n' | sed -e 's/ //g' -e '/^$/d' > iter2.dmp
+diff ./iter2.dmp ./iter2.exp
+
+# cleanup
+rm -f $CLEANUP
+
+exit 0
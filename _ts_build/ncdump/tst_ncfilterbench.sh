@@ -0,0 +1,82 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+# This shell script tests that ncfilterbench tries the chains of
+# filters it is given on the variables it can filter, and that the
+# nccopy options it prints copy the file with the same contents.
+
+set -e
+echo ""
+echo "*** Testing ncfilterbench"
+
+CLEANUP="tst_ncfilterbench*.nc tst_ncfilterbench*.cdl tst_ncfilterbench*.out"
+rm -f $CLEANUP
+
+# A smooth chunked float, a double that is not chunked, an int in a
+# group, and a char variable, which is not tried.
+awk 'BEGIN {
+  print "netcdf tst_ncfilterbench {"
+  print "dimensions:"
+  print "	y = 40 ;"
+  print "	x = 50 ;"
+  print "	n = 8 ;"
+  print "variables:"
+  print "	float t(y, x) ;"
+  print "		t:_ChunkSizes = 10, 25 ;"
+  print "	double d(y, x) ;"
+  print "		d:_Storage = \"contiguous\" ;"
+  print "	char c(n) ;"
+  print "data:"
+  printf " t ="
+  for (i = 0; i < 2000; i++) printf "%s %.2f", (i ? "," : ""), 280 + int(i / 50) * 0.1 + (i % 50) * 0.01
+  print " ;"
+  printf " d ="
+  for (i = 0; i < 2000; i++) printf "%s %d.5", (i ? "," : ""), i % 97
+  print " ;"
+  print " c = \"filters\" ;"
+  print ""
+  print "group: g {"
+  print "  variables:"
+  print "	int i(y, x) ;"
+  print "  data:"
+  printf "   i ="
+  for (i = 0; i < 2000; i++) printf "%s %d", (i ? "," : ""), int(i / 3)
+  print " ;"
+  print "  } // group g"
+  print "}"
+}' > tst_ncfilterbench.cdl
+${NCGEN} -4 -b -o tst_ncfilterbench.nc tst_ncfilterbench.cdl
+
+echo "*** Trying chains of filters"
+${execdir}/ncfilterbench -n 4 -r 1 -f none -f deflate,1 -f "shuffle|deflate,9" \
+    -f 39999 tst_ncfilterbench.nc > tst_ncfilterbench.out
+cat tst_ncfilterbench.out
+# Three variables, with samples of whole chunks
+test `grep -c '^/' tst_ncfilterbench.out` = 3
+grep '^/t: float, 4 chunks of 10x25, 4000 bytes' tst_ncfilterbench.out
+grep '^/g/i: int, ' tst_ncfilterbench.out
+test `grep -c '39999 (not available)' tst_ncfilterbench.out` = 3
+test `grep -c '^  best: ' tst_ncfilterbench.out` = 3
+
+echo "*** Copying with the best chains"
+OPTIONS=`sed -n 's/^  best: //p' tst_ncfilterbench.out | tr '\n' ' '`
+eval ${NCCOPY} $OPTIONS tst_ncfilterbench.nc tst_ncfilterbench_copy.nc
+${execdir}/nchash -q tst_ncfilterbench.nc tst_ncfilterbench_copy.nc
+${NCDUMP} -hs tst_ncfilterbench_copy.nc > tst_ncfilterbench_copy.cdl
+grep 't:_ChunkSizes = 10, 25 ;' tst_ncfilterbench_copy.cdl
+grep 't:_DeflateLevel = ' tst_ncfilterbench_copy.cdl
+
+echo "*** Testing targets that cannot be met"
+${execdir}/ncfilterbench -r 1 -v t -f none -f deflate,1 -d 1e12 \
+    tst_ncfilterbench.nc > tst_ncfilterbench.out
+grep 'no chain meets the target' tst_ncfilterbench.out
+test `grep -c '^/' tst_ncfilterbench.out` = 1
+${execdir}/ncfilterbench -r 1 -v /g/i -f deflate,1 -t speed -R 1e9 \
+    tst_ncfilterbench.nc > tst_ncfilterbench.out
+grep 'no chain meets the target' tst_ncfilterbench.out
+
+rm -f $CLEANUP
+echo "*** All ncfilterbench tests passed!"
+exit 0
@@ -0,0 +1,14 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/makeparser"
+  "c0.nc"
+  "c0_4.nc"
+  "c0_4c.nc"
+  "c0_64.nc"
+  "ncgentab.h"
+  "ref_camrun.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/makeparser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ncgen3.dir/escapes.c.o"
+  "CMakeFiles/ncgen3.dir/escapes.c.o.d"
+  "CMakeFiles/ncgen3.dir/genlib.c.o"
+  "CMakeFiles/ncgen3.dir/genlib.c.o.d"
+  "CMakeFiles/ncgen3.dir/getfill.c.o"
+  "CMakeFiles/ncgen3.dir/getfill.c.o.d"
+  "CMakeFiles/ncgen3.dir/init.c.o"
+  "CMakeFiles/ncgen3.dir/init.c.o.d"
+  "CMakeFiles/ncgen3.dir/load.c.o"
+  "CMakeFiles/ncgen3.dir/load.c.o.d"
+  "CMakeFiles/ncgen3.dir/main.c.o"
+  "CMakeFiles/ncgen3.dir/main.c.o.d"
+  "CMakeFiles/ncgen3.dir/ncgentab.c.o"
+  "CMakeFiles/ncgen3.dir/ncgentab.c.o.d"
+  "c0.nc"
+  "c0_4.nc"
+  "c0_4c.nc"
+  "c0_64.nc"
+  "ncgen3"
+  "ncgen3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ncgen3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
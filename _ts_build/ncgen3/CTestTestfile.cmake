@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ncgen3
+# Build directory: /root/repo/_ts_build/ncgen3
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ncgen3_run_tests "bash" "-c" "export srcdir=/root/repo/ncgen3;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncgen3/run_tests.sh")
+set_tests_properties(ncgen3_run_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncgen3/CMakeLists.txt;53;add_sh_test;/root/repo/ncgen3/CMakeLists.txt;0;")
+add_test(ncgen3_run_nc4_tests "bash" "-c" "export srcdir=/root/repo/ncgen3;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/ncgen3/run_nc4_tests.sh")
+set_tests_properties(ncgen3_run_nc4_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/ncgen3/CMakeLists.txt;53;add_sh_test;/root/repo/ncgen3/CMakeLists.txt;0;")
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/nctest/add.c" "nctest/CMakeFiles/nctest.dir/add.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/add.c.o.d"
+  "/root/repo/nctest/atttests.c" "nctest/CMakeFiles/nctest.dir/atttests.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/atttests.c.o.d"
+  "/root/repo/nctest/cdftests.c" "nctest/CMakeFiles/nctest.dir/cdftests.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/cdftests.c.o.d"
+  "/root/repo/nctest/dimtests.c" "nctest/CMakeFiles/nctest.dir/dimtests.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/dimtests.c.o.d"
+  "/root/repo/nctest/driver.c" "nctest/CMakeFiles/nctest.dir/driver.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/driver.c.o.d"
+  "/root/repo/nctest/emalloc.c" "nctest/CMakeFiles/nctest.dir/emalloc.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/emalloc.c.o.d"
+  "/root/repo/nctest/error.c" "nctest/CMakeFiles/nctest.dir/error.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/error.c.o.d"
+  "/root/repo/nctest/misctest.c" "nctest/CMakeFiles/nctest.dir/misctest.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/misctest.c.o.d"
+  "/root/repo/nctest/rec.c" "nctest/CMakeFiles/nctest.dir/rec.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/rec.c.o.d"
+  "/root/repo/nctest/slabs.c" "nctest/CMakeFiles/nctest.dir/slabs.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/slabs.c.o.d"
+  "/root/repo/nctest/val.c" "nctest/CMakeFiles/nctest.dir/val.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/val.c.o.d"
+  "/root/repo/nctest/vardef.c" "nctest/CMakeFiles/nctest.dir/vardef.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/vardef.c.o.d"
+  "/root/repo/nctest/varget.c" "nctest/CMakeFiles/nctest.dir/varget.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/varget.c.o.d"
+  "/root/repo/nctest/vargetg.c" "nctest/CMakeFiles/nctest.dir/vargetg.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/vargetg.c.o.d"
+  "/root/repo/nctest/varput.c" "nctest/CMakeFiles/nctest.dir/varput.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/varput.c.o.d"
+  "/root/repo/nctest/varputg.c" "nctest/CMakeFiles/nctest.dir/varputg.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/varputg.c.o.d"
+  "/root/repo/nctest/vartests.c" "nctest/CMakeFiles/nctest.dir/vartests.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/vartests.c.o.d"
+  "/root/repo/nctest/vputget.c" "nctest/CMakeFiles/nctest.dir/vputget.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/vputget.c.o.d"
+  "/root/repo/nctest/vputgetg.c" "nctest/CMakeFiles/nctest.dir/vputgetg.c.o" "gcc" "nctest/CMakeFiles/nctest.dir/vputgetg.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ts_build/liblib/CMakeFiles/netcdf.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tst_rename.dir/tst_rename.c.o"
+  "CMakeFiles/tst_rename.dir/tst_rename.c.o.d"
+  "tst_rename"
+  "tst_rename.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tst_rename.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/nctest
+# Build directory: /root/repo/_ts_build/nctest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(nctest "/nctest")
+set_tests_properties(nctest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/nctest/CMakeLists.txt;18;ADD_TEST;/root/repo/nctest/CMakeLists.txt;0;")
+add_test(tst_rename "/tst_rename")
+set_tests_properties(tst_rename PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1612;ADD_TEST;/root/repo/nctest/CMakeLists.txt;20;add_bin_test_no_prefix;/root/repo/nctest/CMakeLists.txt;0;")
+add_test(nctest_compare_test_files "bash" "-c" "export srcdir=/root/repo/nctest;export TOPSRCDIR=/root/repo;/root/repo/_ts_build/nctest/compare_test_files.sh")
+set_tests_properties(nctest_compare_test_files PROPERTIES  DEPENDS "nctest" _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1743;ADD_TEST;/root/repo/nctest/CMakeLists.txt;21;add_sh_test;/root/repo/nctest/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5blockshuffle.dir/H5Zblockshuffle.c.o"
+  "CMakeFiles/h5blockshuffle.dir/H5Zblockshuffle.c.o.d"
+  "libh5blockshuffle.pdb"
+  "libh5blockshuffle.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5blockshuffle.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/h5quantize.dir/H5Zquantize.c.o"
+  "CMakeFiles/h5quantize.dir/H5Zquantize.c.o.d"
+  "libh5quantize.pdb"
+  "libh5quantize.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/h5quantize.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
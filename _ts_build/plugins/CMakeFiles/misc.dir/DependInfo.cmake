@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/plugins/H5Zmisc.c" "plugins/CMakeFiles/misc.dir/H5Zmisc.c.o" "gcc" "plugins/CMakeFiles/misc.dir/H5Zmisc.c.o.d"
+  "/root/repo/plugins/H5Zutil.c" "plugins/CMakeFiles/misc.dir/H5Zutil.c.o" "gcc" "plugins/CMakeFiles/misc.dir/H5Zutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/misc.dir/H5Zmisc.c.o"
+  "CMakeFiles/misc.dir/H5Zmisc.c.o.d"
+  "CMakeFiles/misc.dir/H5Zutil.c.o"
+  "CMakeFiles/misc.dir/H5Zutil.c.o.d"
+  "libmisc.pdb"
+  "libmisc.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/noop.dir/H5Znoop.c.o"
+  "CMakeFiles/noop.dir/H5Znoop.c.o.d"
+  "CMakeFiles/noop.dir/H5Zutil.c.o"
+  "CMakeFiles/noop.dir/H5Zutil.c.o.d"
+  "libnoop.pdb"
+  "libnoop.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/noop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/plugins/H5Zbzip2.c" "plugins/CMakeFiles/test_bzip2.dir/H5Zbzip2.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/H5Zbzip2.c.o.d"
+  "/root/repo/plugins/blocksort.c" "plugins/CMakeFiles/test_bzip2.dir/blocksort.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/blocksort.c.o.d"
+  "/root/repo/plugins/bzlib.c" "plugins/CMakeFiles/test_bzip2.dir/bzlib.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/bzlib.c.o.d"
+  "/root/repo/plugins/compress.c" "plugins/CMakeFiles/test_bzip2.dir/compress.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/compress.c.o.d"
+  "/root/repo/plugins/crctable.c" "plugins/CMakeFiles/test_bzip2.dir/crctable.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/crctable.c.o.d"
+  "/root/repo/plugins/decompress.c" "plugins/CMakeFiles/test_bzip2.dir/decompress.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/decompress.c.o.d"
+  "/root/repo/plugins/huffman.c" "plugins/CMakeFiles/test_bzip2.dir/huffman.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/huffman.c.o.d"
+  "/root/repo/plugins/randtable.c" "plugins/CMakeFiles/test_bzip2.dir/randtable.c.o" "gcc" "plugins/CMakeFiles/test_bzip2.dir/randtable.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bzip2.dir/H5Zbzip2.c.o"
+  "CMakeFiles/test_bzip2.dir/H5Zbzip2.c.o.d"
+  "CMakeFiles/test_bzip2.dir/blocksort.c.o"
+  "CMakeFiles/test_bzip2.dir/blocksort.c.o.d"
+  "CMakeFiles/test_bzip2.dir/bzlib.c.o"
+  "CMakeFiles/test_bzip2.dir/bzlib.c.o.d"
+  "CMakeFiles/test_bzip2.dir/compress.c.o"
+  "CMakeFiles/test_bzip2.dir/compress.c.o.d"
+  "CMakeFiles/test_bzip2.dir/crctable.c.o"
+  "CMakeFiles/test_bzip2.dir/crctable.c.o.d"
+  "CMakeFiles/test_bzip2.dir/decompress.c.o"
+  "CMakeFiles/test_bzip2.dir/decompress.c.o.d"
+  "CMakeFiles/test_bzip2.dir/huffman.c.o"
+  "CMakeFiles/test_bzip2.dir/huffman.c.o.d"
+  "CMakeFiles/test_bzip2.dir/randtable.c.o"
+  "CMakeFiles/test_bzip2.dir/randtable.c.o.d"
+  "libh5bzip2.pdb"
+  "libh5bzip2.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bzip2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_test_ncuri.dir/test_ncuri.c.o"
+  "CMakeFiles/unit_test_test_ncuri.dir/test_ncuri.c.o.d"
+  "unit_test_test_ncuri"
+  "unit_test_test_ncuri.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_test_ncuri.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
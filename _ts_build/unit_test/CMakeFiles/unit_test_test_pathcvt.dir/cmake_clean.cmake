@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_test_pathcvt.dir/test_pathcvt.c.o"
+  "CMakeFiles/unit_test_test_pathcvt.dir/test_pathcvt.c.o.d"
+  "unit_test_test_pathcvt"
+  "unit_test_test_pathcvt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_test_pathcvt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_crc32.dir/tst_crc32.c.o"
+  "CMakeFiles/unit_test_tst_crc32.dir/tst_crc32.c.o.d"
+  "unit_test_tst_crc32"
+  "unit_test_tst_crc32.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_crc32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
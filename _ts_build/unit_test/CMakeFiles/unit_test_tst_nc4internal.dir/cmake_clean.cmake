@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_nc4internal.dir/tst_nc4internal.c.o"
+  "CMakeFiles/unit_test_tst_nc4internal.dir/tst_nc4internal.c.o.d"
+  "unit_test_tst_nc4internal"
+  "unit_test_tst_nc4internal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_nc4internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_nclist.dir/tst_nclist.c.o"
+  "CMakeFiles/unit_test_tst_nclist.dir/tst_nclist.c.o.d"
+  "unit_test_tst_nclist"
+  "unit_test_tst_nclist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_nclist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_test_tst_ncodom.dir/tst_ncodom.c.o"
+  "CMakeFiles/unit_test_tst_ncodom.dir/tst_ncodom.c.o.d"
+  "unit_test_tst_ncodom"
+  "unit_test_tst_ncodom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unit_test_tst_ncodom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
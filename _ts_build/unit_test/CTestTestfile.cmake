@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unit_test
+# Build directory: /root/repo/_ts_build/unit_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit_test_tst_nclist "/unit_test_tst_nclist")
+set_tests_properties(unit_test_tst_nclist PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/unit_test/CMakeLists.txt;20;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test(unit_test_test_ncuri "/unit_test_test_ncuri")
+set_tests_properties(unit_test_test_ncuri PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/unit_test/CMakeLists.txt;20;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test(unit_test_test_pathcvt "/unit_test_test_pathcvt")
+set_tests_properties(unit_test_test_pathcvt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/unit_test/CMakeLists.txt;20;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test(unit_test_tst_crc32 "/unit_test_tst_crc32")
+set_tests_properties(unit_test_tst_crc32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/unit_test/CMakeLists.txt;20;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test(unit_test_tst_ncodom "/unit_test_tst_ncodom")
+set_tests_properties(unit_test_tst_ncodom PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/unit_test/CMakeLists.txt;20;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
+add_test(unit_test_tst_nc4internal "/unit_test_tst_nc4internal")
+set_tests_properties(unit_test_tst_nc4internal PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;1649;ADD_TEST;/root/repo/unit_test/CMakeLists.txt;20;add_bin_test;/root/repo/unit_test/CMakeLists.txt;0;")
@@ -60,6 +60,9 @@
 /** Struct to hold HDF5-specific info for the file. */
 typedef struct NC_HDF5_FILE_INFO {
    hid_t hdfid;
+   NC_hashmap *typeindex; /**< Signatures of user types to NClists of them. */
+   NClist *typebuckets;   /**< The lists in typeindex, to free them. */
+   size_t ntypesindexed;  /**< How much of alltypes is in typeindex. */
 #ifdef ENABLE_BYTERANGE
    struct HTTP {
 	NCURI* uri; /* Parse of the incoming path, if url */
@@ -135,6 +138,7 @@ int nc4_open_var_grp2(NC_GRP_INFO_T *grp, int varid, hid_t *dataset);
 /* Find types. */
 NC_TYPE_INFO_T *nc4_rec_find_hdf_type(NC_FILE_INFO_T* h5,
                                       hid_t target_hdf_typeid);
+void nc4_hdf5_type_index_free(NC_HDF5_FILE_INFO_T *hdf5_info);
 int nc4_get_hdf_typeid(NC_FILE_INFO_T *h5, nc_type xtype,
                        hid_t *hdf_typeid, int endianness);
 
@@ -27,6 +27,12 @@ typedef struct NC {
 	void* dispatchdata; /*per-'file' data; points to e.g. NC3_INFO data*/
 	char* path;
 	int   mode; /* as provided to nc_open/nc_create */
+	nc_perf_stats_t perf; /* see nc_inq_perf_stats() and ncperf.h */
+	struct NC_memimage* image; /* shared image it was opened from; see ncmemimage.h */
+#ifdef ENABLE_THREADSAFE
+	const struct NC_Dispatch* unlocked; /* the real dispatch table */
+	struct NC_mutex* lock; /* per-file lock or the global lock */
+#endif
 } NC;
 
 /*
@@ -174,6 +174,9 @@ extern "C" {
 
 /* End _var */
 
+    extern int
+    NC3_copy_data_raw(int ncid_in, int ncid_out);
+
     extern int NC3_initialize();
     extern int NC3_finalize();
 
@@ -218,6 +218,39 @@ NC_lookupvar(NC3_INFO* ncp, int varid, NC_var **varp);
 
 /* End defined in var.c */
 
+/*
+ * NC_extent: the byte range ['begin', 'end') of a file.
+ * NC_extentarray: a set of such ranges, kept sorted, disjoint and
+ * merged when adjacent.
+ */
+typedef struct NC_extent {
+    off_t begin;
+    off_t end;
+} NC_extent;
+
+typedef struct NC_extentarray {
+    size_t nalloc;          /* number allocated >= nelems */
+    size_t nelems;          /* length of the array */
+    NC_extent *value;
+} NC_extentarray;
+
+/* Begin defined in extent.c */
+
+extern void
+free_NC_extentarray(NC_extentarray *ncap);
+
+/* Index of the first extent ending after 'offset', or nelems */
+extern size_t
+NC_extents_find(const NC_extentarray *ncap, off_t offset);
+
+extern int
+NC_extents_add(NC_extentarray *ncap, off_t begin, off_t end);
+
+extern int
+NC_extents_remove(NC_extentarray *ncap, off_t begin, off_t end);
+
+/* End defined in extent.c */
+
 #define IS_RECVAR(vp)                                           \
     ((vp)->shape != NULL ? (*(vp)->shape == NC_UNLIMITED) : 0 )
 
@@ -244,6 +277,9 @@ struct NC3_INFO {
 #else
     size_t recsize;  /* length of 'record' */
 #endif
+    int lazyfill;    /* NC_LAZYFILL mode: fill on sync, redef or close */
+    NC_extentarray unfilled; /* ranges yet to be filled in NC_LAZYFILL mode */
+    int shared;      /* dims, attrs and vars belong to a shared image */
     /* below gets xdr'd */
     size_t numrecs; /* number of 'records' allocated */
     NC_dimarray dims;
@@ -295,6 +331,9 @@ struct NC3_INFO {
 
 /* Begin defined in nc.c */
 
+/* Bytes to leave after the header, or -1 for the default policy */
+extern long long NC3_header_headroom;
+
 extern int
 nc3_cktype(int mode, nc_type datatype);
 
@@ -337,6 +376,9 @@ nc_get_NC(NC3_INFO* ncp);
 extern int
 fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno);
 
+extern int
+NC_fill_unfilled(NC3_INFO* ncp);
+
 extern int
 nc_inq_rec(int ncid, size_t *nrecvars, int *recvarids, size_t *recsizes);
 
@@ -363,7 +363,6 @@ int nc4_find_nc4_grp(int ncid, NC_GRP_INFO_T **grp);
 int nc4_find_dim(NC_GRP_INFO_T *grp, int dimid, NC_DIM_INFO_T **dim,
                  NC_GRP_INFO_T **dim_grp);
 int nc4_find_var(NC_GRP_INFO_T *grp, const char *name, NC_VAR_INFO_T **var);
-int nc4_find_dim_len(NC_GRP_INFO_T *grp, int dimid, size_t **len);
 int nc4_find_type(const NC_FILE_INFO_T *h5, int typeid1, NC_TYPE_INFO_T **type);
 NC_TYPE_INFO_T *nc4_rec_find_named_type(NC_GRP_INFO_T *start_grp, char *name);
 NC_TYPE_INFO_T *nc4_rec_find_equal_type(NC_GRP_INFO_T *start_grp, int ncid1,
@@ -458,6 +457,8 @@ extern const NC_reservedatt *NC_findreserved(const char *name);
 #define NCFILTER_FILTERIDS      4
 #define NCFILTER_INFO		5
 #define NCFILTER_FREESPEC	6
+#define NCFILTER_READCHUNK	7
+#define NCFILTER_WRITECHUNK	8
 #define NCFILTER_CLIENT_REG	10
 #define NCFILTER_CLIENT_UNREG	11
 #define NCFILTER_CLIENT_INQ	12
@@ -466,6 +467,7 @@ typedef enum NC_FILTER_SORT {
 	NC_FILTER_SORT_SPEC=((int)1),
 	NC_FILTER_SORT_IDS=((int)2),
 	NC_FILTER_SORT_CLIENT=((int)3),
+	NC_FILTER_SORT_CHUNK=((int)4),
 } NC_FILTER_SORT;
 
 /* Provide structs to pass args to filter_actions function for HDF5*/
@@ -489,6 +491,14 @@ typedef struct NC_FILTER_CLIENT_HDF5 {
     void* info;
 } NC_FILTER_CLIENT_HDF5;
 
+/* One chunk exactly as stored, i.e. after the filters were applied */
+typedef struct NC_FILTER_CHUNK_HDF5 {
+    const size_t* offsets;    /**< index of the chunk's first element */
+    unsigned int filtermask;  /**< filters that were skipped for this chunk */
+    size_t size;              /**< size of the stored chunk, 0 if none */
+    void* data;               /**< stored bytes, NULL to just get size */
+} NC_FILTER_CHUNK_HDF5;
+
 typedef struct NC_FILTER_OBJ_HDF5 {
     NC_Filterobject hdr; /* So we can cast it */
     NC_FILTER_SORT sort; /* discriminate union */
@@ -496,6 +506,7 @@ typedef struct NC_FILTER_OBJ_HDF5 {
         NC_FILTER_SPEC_HDF5 spec;
         NC_FILTERIDS_HDF5 ids;
         NC_FILTER_CLIENT_HDF5 client;
+        NC_FILTER_CHUNK_HDF5 chunk;
     } u;
 } NC_FILTER_OBJ_HDF5;
 
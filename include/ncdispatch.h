@@ -24,6 +24,7 @@
 #include "ncmodel.h"
 #include "nc.h"
 #include "ncuri.h"
+#include "ncthread.h"
 #ifdef USE_PARALLEL
 #include "netcdf_par.h"
 #endif
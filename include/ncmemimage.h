@@ -0,0 +1,49 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+Shared in-memory images, registered with nc_mem_register().
+
+A registered image is immutable and may be opened read-only any
+number of times, by name, with nc_open_mem() given no memory or with
+nc_open() given NC_INMEMORY. Every open uses the registered memory in
+place, as if it had been passed to nc_open_mem() with NC_MEMIO_LOCKED.
+
+An image is reference counted: the registration holds one reference
+and each NC opened from it holds one in ncp->image, released by
+free_NC(). The memory, and the header parsed by the first classic
+open (which the later classic opens share, see NC3_open), go away
+with the last reference, so an image may be unregistered while it is
+still open.
+
+The registry and the reference counts are protected by the global
+lock in the thread-safe library.
+*/
+
+#ifndef NCMEMIMAGE_H
+#define NCMEMIMAGE_H
+
+typedef struct NC_memimage {
+    char* name;
+    void* memory;
+    size_t size;
+    int flags;      /* NC_MEMIO_LOCKED => the caller frees the memory */
+    int refcount;   /* the registration and each open */
+    void* header;   /* parsed metadata shared by the opens, or NULL */
+    void (*free_header)(void*);
+} NC_memimage;
+
+/* Find a registered image by name and add a reference to it */
+extern int NC_memimage_acquire(const char* name, NC_memimage** imagep);
+/* Drop a reference; the last one frees the image */
+extern void NC_memimage_release(NC_memimage* image);
+/* Give an image the metadata parsed by an open, unless another open
+   got there first; returns the header the image keeps */
+extern void* NC_memimage_set_header(NC_memimage* image, void* header,
+                                    void (*free_header)(void*));
+/* Unregister all images; called from NCDISPATCH_finalize */
+extern void NC_memimage_finalize(void);
+
+#endif /*NCMEMIMAGE_H*/
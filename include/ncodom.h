@@ -0,0 +1,134 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+
+/*
+Hyperslab odometer shared by the dispatch layer and the dispatchers.
+
+An odometer walks the elements selected by (start,count,stride) of a
+variable of a given shape, but rather than stepping one element at a
+time it steps one "run" at a time. A run is the largest group of
+selected elements that can be moved together:
+
+- by default, a run is a set of elements that are contiguous both in
+  the variable (row-major order within shape) and in memory. The
+  trailing dimensions that are selected whole are collapsed into the
+  run, together with the next dimension in if it has unit stride.
+- with NC_ODOM_BOX, a run is a box with unit stride in each of its
+  dimensions, i.e. something a single vara call can move; its trailing
+  dimensions need not be whole.
+- with NC_ODOM_ELEMENTS, every run is a single element.
+
+NC_ODOM_RECORDS says dimension 0 is a classic record dimension, whose
+elements are not contiguous with each other, so it is never collapsed
+into a run with the dimensions inside it.
+
+If an imap (in elements, as for nc_get_varm) is supplied, runs are also
+kept contiguous in memory and memoffset follows the map; otherwise the
+selection is packed in memory in row-major order.
+
+Typical use:
+
+    NCodometer odom;
+    if((stat = NC_odom_init(&odom,rank,shape,start,count,stride,NULL,0)))
+        return stat;
+    for(;NC_odom_more(&odom);NC_odom_next(&odom)) {
+        ... move odom.runlen elements from variable element odom.offset
+            (or from coordinates odom.index with edges odom.runedges)
+            to memory element odom.memoffset ...
+    }
+    NC_odom_free(&odom);
+
+An NCodometer must not be copied, since it may point into itself.
+*/
+
+#ifndef NCODOM_H
+#define NCODOM_H 1
+
+#include <stddef.h>
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__)
+extern "C" {
+#endif
+
+/* Flags for NC_odom_init */
+#define NC_ODOM_ELEMENTS 0x1 /* one element per run */
+#define NC_ODOM_BOX      0x2 /* runs are unit stride boxes, not linear runs */
+#define NC_ODOM_RECORDS  0x4 /* dimension 0 is a record dimension */
+
+/* Ranks up to this size need no allocation */
+#define NC_ODOM_NINLINE 12
+
+typedef struct NCodometer {
+    int rank;          /* rank of the variable */
+    int outer;         /* leading dimensions stepped one index at a time */
+    int more;          /* 0 once the walk is over */
+    size_t runlen;     /* number of elements in each run */
+    size_t offset;     /* row-major element offset of the run in shape */
+    size_t memoffset;  /* element offset of the run in memory */
+    size_t* index;     /* coordinates of the first element of the run */
+    size_t* runedges;  /* edges of a run: 1 for each outer dimension */
+    /* Private */
+    size_t* start;
+    size_t* stop;
+    size_t* stride;
+    size_t* step;      /* change in offset for one stride in each dim */
+    size_t* memstep;   /* change in memoffset for one stride in each dim */
+    size_t* space;     /* allocated storage for ranks > NC_ODOM_NINLINE */
+    size_t inlinespace[7*NC_ODOM_NINLINE];
+} NCodometer;
+
+/* Set up an odometer over a selection.
+   shape may be NULL when offset is not wanted, count NULL means to
+   the end of shape, start and stride NULL mean zeros and ones.
+   Returns NC_NOERR, NC_EINVAL, NC_ESTRIDE or NC_ENOMEM. */
+extern int NC_odom_init(NCodometer* odom, int rank, const size_t* shape,
+                        const size_t* start, const size_t* count,
+                        const ptrdiff_t* stride, const ptrdiff_t* imap,
+                        int flags);
+
+/* Set up an element-wise odometer over the indices of the chunks of
+   a grid with the given chunk sizes that hold any part of the box
+   spanned by the selection. */
+extern int NC_odom_initchunks(NCodometer* odom, int rank,
+                              const size_t* start, const size_t* count,
+                              const ptrdiff_t* stride,
+                              const size_t* chunksizes);
+
+extern void NC_odom_free(NCodometer* odom);
+extern int NC_odom_more(const NCodometer* odom);
+extern void NC_odom_next(NCodometer* odom);
+
+/* Number of elements in the whole selection */
+extern size_t NC_odom_nelements(const NCodometer* odom);
+
+/* Intersect a selection with the box [origin,origin+extent), e.g. a
+   chunk. On return the elements of the selection inside the box are
+   the selection (istart,icount,stride), and ipos is the position of
+   istart within the original selection, i.e. where it lands in
+   memory. Returns the number of elements in the intersection. */
+extern size_t NC_odom_intersect(int rank, const size_t* start,
+                                const size_t* count, const ptrdiff_t* stride,
+                                const size_t* origin, const size_t* extent,
+                                size_t* istart, size_t* icount, size_t* ipos);
+
+/* Copy a selection with the given edges between a packed row-major
+   buffer and a buffer laid out by imap (in elements, possibly
+   negative, relative to mapped). Transposing maps are copied in
+   cache sized tiles. Returns NC_NOERR or NC_ENOMEM. */
+extern int NC_odom_scatter(const void* packed, void* mapped, int rank,
+                           const size_t* edges, const ptrdiff_t* imap,
+                           size_t elemsize);
+extern int NC_odom_gather(const void* mapped, void* packed, int rank,
+                          const size_t* edges, const ptrdiff_t* imap,
+                          size_t elemsize);
+
+/* Largest staging buffer used by the default varm code */
+#ifndef NC_VARM_BLOCKSIZE
+#define NC_VARM_BLOCKSIZE 4194304
+#endif
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__)
+}
+#endif
+
+#endif /*NCODOM_H*/
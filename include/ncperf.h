@@ -0,0 +1,71 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+Per-file performance counters, returned by nc_inq_perf_stats().
+
+Each NC holds an nc_perf_stats_t, and the layers below the dispatch
+table add to it through a pointer: NC3_INFO's ncio, NC_FILE_INFO_T's
+controller, the DAP controller. The counters are always kept. The timers cost a clock read each, so they only
+run when NETCDF_PERF_STATS is set in the environment; then the
+counters of each file are also printed as JSON when it is closed, to
+stderr, or appended to the file named by NETCDF_PERF_STATS if it is
+not "1" or "stderr".
+
+Classic files opened with NC_CONCURRENT take no lock, so their
+readers may add to the same counters at once. Where the compiler has
+the __atomic builtins, the counters are therefore added to, and read
+by nc_inq_perf_stats(), with relaxed atomic operations; a time is
+added with a compare and swap loop.
+*/
+
+#ifndef NCPERF_H
+#define NCPERF_H
+
+#include "netcdf.h"
+
+struct NC;
+
+/* Nonzero when the timers run */
+extern int NC_perf_timing;
+
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+#define NC_PERF_ATOMIC 1
+#endif
+
+/* Add n to a counter; stats may be NULL */
+#ifdef NC_PERF_ATOMIC
+#define NC_PERF_ADD(stats,field,n) \
+    do{if((stats) != NULL) \
+        (void)__atomic_fetch_add(&(stats)->field,(unsigned long long)(n),__ATOMIC_RELAXED);}while(0)
+#else
+#define NC_PERF_ADD(stats,field,n) \
+    do{if((stats) != NULL) (stats)->field += (unsigned long long)(n);}while(0)
+#endif
+
+/* Start a timer in the double t, and add its time to a field */
+#define NC_PERF_START(t) ((t) = (NC_perf_timing ? NC_perf_now() : 0.0))
+#define NC_PERF_STOP(stats,field,t) \
+    do{if(NC_perf_timing && (stats) != NULL) NC_perf_add_time(&(stats)->field,NC_perf_now() - (t));}while(0)
+
+/* Add dt to a time */
+extern void NC_perf_add_time(double* time, double dt);
+
+/* Seconds since some fixed time */
+extern double NC_perf_now(void);
+
+/* Read NETCDF_PERF_STATS; called from NCDISPATCH_initialize */
+extern void NC_perf_initialize(void);
+
+/* Print the counters of a closed file, if NETCDF_PERF_STATS is set */
+extern void NC_perf_report(struct NC* ncp);
+
+#ifdef USE_HDF5
+/* Fill in the HDF5 metadata cache hit rate of an open file; also
+   called on close to keep the final rate in ncp->perf */
+extern void NC4_hdf5_perf_stats(struct NC* ncp, nc_perf_stats_t* stats);
+#endif
+
+#endif /*NCPERF_H*/
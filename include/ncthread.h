@@ -0,0 +1,73 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+Locking used when the library is built with ENABLE_THREADSAFE.
+
+There are three kinds of locks.
+1. The file list lock: a reader/writer lock protecting the NC list in
+   nclistmgr.c. It is only ever held for the duration of a list
+   operation, so no other lock is acquired while it is held.
+2. The per-file lock: a recursive mutex owned by each classic (NC3)
+   file. Every dispatch call for that file holds it, so different
+   classic files can be used from different threads in parallel.
+   A classic file opened read-only with NC_CONCURRENT gets no lock
+   at all: its header never changes after open and its ncio reads
+   with pread into per-call buffers, so any number of threads may
+   read it at once.
+3. The global lock: a recursive mutex that serializes everything not
+   known to be reentrant: library (de)initialization and every
+   dispatch call for non-classic files (HDF5, HDF4, DAP, pnetcdf,
+   user defined formats), since those layers share global state.
+
+Lock order is global -> per-file -> file list.
+
+When ENABLE_THREADSAFE is not defined all the macros are no-ops.
+*/
+
+#ifndef NCTHREAD_H
+#define NCTHREAD_H
+
+struct NC;
+struct NC_Dispatch;
+struct NC_mutex;
+
+#ifdef ENABLE_THREADSAFE
+
+extern void NC_lock_global(void);
+extern void NC_unlock_global(void);
+extern void NC_rdlock_filelist(void);
+extern void NC_wrlock_filelist(void);
+extern void NC_unlock_filelist(void);
+
+/* Give a new NC its lock and interpose the locking dispatch table */
+extern int NC_lock_init(struct NC* ncp);
+/* Release the lock acquired by NC_lock_init */
+extern void NC_lock_final(struct NC* ncp);
+/* Lock two files for a call that uses both, in a fixed order */
+extern void NC_lock_pair(struct NC* ncp1, struct NC* ncp2);
+extern void NC_unlock_pair(struct NC* ncp1, struct NC* ncp2);
+
+#define NCLOCKGLOBAL() NC_lock_global()
+#define NCUNLOCKGLOBAL() NC_unlock_global()
+#define NCRDLOCKLIST() NC_rdlock_filelist()
+#define NCWRLOCKLIST() NC_wrlock_filelist()
+#define NCUNLOCKLIST() NC_unlock_filelist()
+#define NCLOCKPAIR(a,b) NC_lock_pair((a),(b))
+#define NCUNLOCKPAIR(a,b) NC_unlock_pair((a),(b))
+
+#else /*!ENABLE_THREADSAFE*/
+
+#define NCLOCKGLOBAL()
+#define NCUNLOCKGLOBAL()
+#define NCRDLOCKLIST()
+#define NCWRLOCKLIST()
+#define NCUNLOCKLIST()
+#define NCLOCKPAIR(a,b)
+#define NCUNLOCKPAIR(a,b)
+
+#endif /*ENABLE_THREADSAFE*/
+
+#endif /*NCTHREAD_H*/
@@ -113,11 +113,13 @@ extern "C" {
 #define _FillValue      "_FillValue"
 #define NC_FILL         0       /**< Argument to nc_set_fill() to clear NC_NOFILL */
 #define NC_NOFILL       0x100   /**< Argument to nc_set_fill() to turn off filling of data. */
+#define NC_LAZYFILL     0x20000 /**< Argument to nc_set_fill() to defer filling of classic data until sync or close. */
 
 /* Define the ioflags bits for nc_create and nc_open.
    currently unused:
         0x0002
-   and the whole upper 16 bits
+   and the upper 16 bits other than 0x10000; 0x20000 is taken by
+   NC_LAZYFILL, since fill modes share the flags of a classic file.
 */
 
 #define NC_NOWRITE       0x0000 /**< Set read-only access for nc_open(). */
@@ -160,6 +162,13 @@ Use this in mode flags for both nc_create() and nc_open(). */
 #define NC_PERSIST       0x4000  /**< Save diskless contents to disk. Mode flag for nc_open() or nc_create() */
 #define NC_INMEMORY      0x8000  /**< Read from memory. Mode flag for nc_open() or nc_create() */
 
+/** Open a classic format file read-only for concurrent reads from
+ * many threads. Reads use pread() into per-call buffers and take no
+ * lock. Mode flag for nc_open(); may not be combined with NC_WRITE,
+ * NC_SHARE, NC_DISKLESS, NC_INMEMORY or NC_MMAP. Ignored for
+ * netCDF-4 files. */
+#define NC_CONCURRENT    0x10000
+
 #define NC_MAX_MAGIC_NUMBER_LEN 8 /**< Max len of user-defined format magic number. */
 
 /** Format specifier for nc_set_default_format() and returned
@@ -980,6 +989,36 @@ nc_inq_format(int ncid, int *formatp);
 EXTERNL int
 nc_inq_format_extended(int ncid, int *formatp, int* modep);
 
+/** Performance counters of an open file, returned by
+ * nc_inq_perf_stats(). Counters that do not apply to the format or
+ * storage of the file stay zero. Times are in seconds, and are only
+ * measured when the NETCDF_PERF_STATS environment variable is set. */
+typedef struct {
+    const char *backend;       /**< How the file is accessed: "posixio", "memio", "mmapio", "httpio", "hdf5", "dap2", "dap4". */
+    unsigned long long io_gets;        /**< Regions of a classic file asked for. */
+    unsigned long long io_get_bytes;   /**< Bytes in those regions. */
+    unsigned long long io_reads;       /**< Reads from a classic file. */
+    unsigned long long io_read_bytes;  /**< Bytes read from a classic file. */
+    unsigned long long io_writes;      /**< Writes to a classic file. */
+    unsigned long long io_write_bytes; /**< Bytes written to a classic file. */
+    double io_time;                    /**< Time in those reads and writes. */
+    unsigned long long h5_reads;       /**< Dataset reads with H5Dread(). */
+    unsigned long long h5_read_bytes;  /**< Bytes read with H5Dread(), in memory. */
+    double h5_read_time;               /**< Time in H5Dread(). */
+    unsigned long long h5_writes;      /**< Dataset writes with H5Dwrite(). */
+    unsigned long long h5_write_bytes; /**< Bytes written with H5Dwrite(), in memory. */
+    double h5_write_time;              /**< Time in H5Dwrite(). */
+    double mdc_hit_rate;               /**< HDF5 metadata cache hit rate, or -1. */
+    unsigned long long conversions;    /**< Conversions between file and memory types. */
+    unsigned long long convert_bytes;  /**< Bytes converted, in memory. */
+    double convert_time;               /**< Time in conversions. */
+    unsigned long long http_requests;  /**< HTTP requests to a server. */
+    double http_time;                  /**< Time in those requests. */
+} nc_perf_stats_t;
+
+EXTERNL int
+nc_inq_perf_stats(int ncid, nc_perf_stats_t *statsp);
+
 /* Begin _dim */
 
 EXTERNL int
@@ -1158,6 +1197,10 @@ nc_rename_var(int ncid, int varid, const char *name);
 EXTERNL int
 nc_copy_var(int ncid_in, int varid, int ncid_out);
 
+/* Copy all variable data between classic files without conversion. */
+EXTERNL int
+nc_copy_data_raw(int ncid_in, int ncid_out);
+
 #ifndef ncvarcpy
 /* support the old name for now */
 #define ncvarcpy(ncid_in, varid, ncid_out) ncvarcopy((ncid_in), (varid), (ncid_out))
@@ -31,6 +31,19 @@
 /** The maximum allowed setting for pixels_per_block when calling nc_def_var_szip(). */
 #define NC_MAX_PIXELS_PER_BLOCK 32
 
+/* The lossy quantize filter, plugins/H5Zquantize.c. It takes the
+   quantization and the number of digits or bits to keep; defining it
+   on a variable adds the matching attribute. */
+#define H5Z_FILTER_QUANTIZE 32770
+#define NC_QUANTIZE_BITGROOM 1 /**< Keep a number of significant digits. */
+#define NC_QUANTIZE_BITROUND 2 /**< Keep a number of bits of the mantissa. */
+#define NC_QUANTIZE_BITGROOM_ATT_NAME "_QuantizeBitGroomNumberOfSignificantDigits"
+#define NC_QUANTIZE_BITROUND_ATT_NAME "_QuantizeBitRoundNumberOfSignificantBits"
+#define NC_QUANTIZE_MAX_FLOAT_NSD 7
+#define NC_QUANTIZE_MAX_DOUBLE_NSD 15
+#define NC_QUANTIZE_MAX_FLOAT_NSB 23
+#define NC_QUANTIZE_MAX_DOUBLE_NSB 52
+
 #if defined(__cplusplus)
 extern "C" {
 #endif
@@ -78,6 +91,12 @@ nc_inq_var_filter_info(int ncid, int varid, unsigned int id, size_t* nparams, un
 /* Remove filter from variable*/
 EXTERNL int nc_var_filter_remove(int ncid, int varid, unsigned int id);
 
+/* Read and write chunks as stored, bypassing the filters */
+EXTERNL int nc_get_var_chunk_raw(int ncid, int varid, const size_t* offsets,
+                                 unsigned int* filtermaskp, size_t* sizep, void* data);
+EXTERNL int nc_put_var_chunk_raw(int ncid, int varid, const size_t* offsets,
+                                 unsigned int filtermask, size_t size, const void* data);
+
 /* Support direct user defined filters;
    last arg is void*, but is actually H5Z_class2_t*.
    It is void* to avoid having to reference hdf.h.
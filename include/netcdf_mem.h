@@ -43,6 +43,11 @@ EXTERNL int nc_open_memio(const char* path, int mode, NC_memio* info, int* ncidp
 /* Close memory file and return the final memory state */
 EXTERNL int nc_close_memio(int ncid, NC_memio* info);
 
+/* Register a read-only image that any number of opens share by name;
+   open it with nc_open_mem(name,NC_NOWRITE,0,NULL,&ncid) */
+EXTERNL int nc_mem_register(const char* name, size_t size, void* memory, int flags);
+EXTERNL int nc_mem_unregister(const char* name);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -14,6 +14,7 @@ extern int oc_dumpnode(OClink, OCddsnode);
 
 #include "dapincludes.h"
 #include "ncoffsets.h"
+#include "ncperf.h"
 
 #define LBRACKET '['
 #define RBRACKET ']'
@@ -656,6 +657,7 @@ dap_fetch(NCDAPCOMMON* nccomm, OClink conn, const char* ce,
     char* ext = NULL;
     OCflags flags = 0;
     int httpcode = 0;
+    double t0;
 #ifdef HAVE_GETTIMEOFDAY
     struct timeval time0;
     struct timeval time1;
@@ -688,7 +690,10 @@ dap_fetch(NCDAPCOMMON* nccomm, OClink conn, const char* ce,
 	gettimeofday(&time0,NULL);
 #endif
     }
+    NC_PERF_START(t0);
     ocstat = oc_fetch(conn,ce,dxd,flags,rootp);
+    NC_PERF_STOP(&nccomm->controller->perf,http_time,t0);
+    NC_PERF_ADD(&nccomm->controller->perf,http_requests,1);
     if(FLAGSET(nccomm->controls,NCF_SHOWFETCH)) {
 #ifdef HAVE_GETTIMEOFDAY
         double secs;
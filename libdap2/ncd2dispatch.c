@@ -299,6 +299,7 @@ NCD2_open(const char* path, int mode, int basepe, size_t *chunksizehintp,
     NCD2_DATA_SET(drno,dapcomm);
     drno->int_ncid = nc__pseudofd(); /* create a unique id */
     dapcomm->controller = (NC*)drno;
+    drno->perf.backend = "dap2";
 
     dapcomm->cdf.separator = ".";
     dapcomm->cdf.smallsizelimit = DFALTSMALLLIMIT;
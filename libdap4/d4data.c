@@ -8,7 +8,6 @@
 #include <assert.h>
 #include "ezxml.h"
 #include "d4includes.h"
-#include "d4odom.h"
 
 /**
 This code serves two purposes
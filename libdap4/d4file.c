@@ -63,6 +63,7 @@ NCD4_open(const char * path, int mode,
     nc->dispatchdata = d4info;
     nc->int_ncid = nc__pseudofd(); /* create a unique id */
     d4info->controller = (NC*)nc;
+    nc->perf.backend = "dap4";
 
     /* Parse url and params */
     if(ncuriparse(nc->path,&d4info->uri))
@@ -15,6 +15,7 @@ See \ref copyright file for more info.
 #include <fcntl.h>
 #endif
 #include "ncwinpath.h"
+#include "ncperf.h"
 
 /* Do conversion if this code was compiled via Vis. Studio or Mingw */
 
@@ -103,6 +104,7 @@ readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, long* las
     int fileprotocol = 0;
     const char* suffix = dxxextension(dxx);
     CURL* curl = state->curl->curl;
+    double t0;
 #ifdef HAVE_GETTIMEOFDAY
     struct timeval time0;
     struct timeval time1;
@@ -127,7 +129,10 @@ readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, long* las
    	    gettimeofday(&time0,NULL);
 #endif
 	}
+        NC_PERF_START(t0);
         stat = NCD4_fetchurl(curl,fetchurl,packet,lastmodified);
+        NC_PERF_STOP(&state->controller->perf,http_time,t0);
+        NC_PERF_ADD(&state->controller->perf,http_requests,1);
         nullfree(fetchurl);
 	if(stat) goto fail;
 	if(FLAGSET(state->controls.flags,NCF_SHOWFETCH)) {
@@ -8,7 +8,7 @@
 #include "ncd4dispatch.h"
 #include "nc4internal.h"
 #include "d4includes.h"
-#include "d4odom.h"
+#include "ncodom.h"
 
 /* Forward */
 static int getvarx(int ncid, int varid, NCD4INFO**, NCD4node** varp, nc_type* xtypep, size_t*, nc_type* nc4typep, size_t*);
@@ -35,7 +35,8 @@ NCD4_get_vars(int ncid, int varid,
     NCD4meta* meta;
     NCD4node* ncvar;
     NCD4node* nctype;
-    D4odometer* odom = NULL;
+    NCodometer odom;
+    int odomflags;
     nc_type nc4type;
     size_t nc4size, xsize;
     void* instance = NULL; /* Staging area in case we have to convert */
@@ -43,8 +44,8 @@ NCD4_get_vars(int ncid, int varid,
     int rank;
     size_t dimsizes[NC_MAX_VAR_DIMS];
     d4size_t dimproduct;
-    size_t dstcount;
     
+    odom.space = NULL; /* so cleanup is safe */
     if((ret=getvarx(ncid, varid, &info, &ncvar, &xtype, &xsize, &nc4type, &nc4size)))
 	{goto done;}
 
@@ -64,23 +65,34 @@ NCD4_get_vars(int ncid, int varid,
 	dimsizes[i] = (size_t)dim->dim.size;
     }
 	
+    /* Atomic data can be moved a run at a time; anything else has
+       to be filled in one instance at a time. */
+    odomflags = (nctype->meta.isfixedsize
+                 && (nctype->subsort <= NC_UINT64 || nctype->subsort == NC_ENUM)
+                 ? 0 : NC_ODOM_ELEMENTS);
+
     /* Extract and desired subset of data */
-    if(rank > 0)
-        odom = d4odom_new(rank,start,edges,stride,dimsizes);
-    else
-        odom = d4scalarodom_new();
-    dstcount = 0; /* We always write into dst starting at position 0*/
-    for(;d4odom_more(odom);dstcount++) {
+    if((ret=NC_odom_init(&odom,rank,dimsizes,start,edges,stride,NULL,odomflags)))
+	{goto done;}
+    for(;NC_odom_more(&odom);NC_odom_next(&odom)) {
 	void* xpos;
 	void* offset;
 	void* dst;
-	d4size_t count;
-        count = d4odom_next(odom);
-	if(count >= dimproduct) {
+	d4size_t count = odom.offset;
+	if(count + odom.runlen > dimproduct) {
 	    ret = THROW(NC_EINVALCOORDS);
 	    goto done;
 	}
-        xpos = INCR(memoryin,(xsize * dstcount)); /* ultimate destination */
+	/* We always write into dst starting at position 0 */
+        xpos = INCR(memoryin,(xsize * odom.memoffset)); /* ultimate destination */
+	if(odomflags == 0) {
+	    offset = INCR(ncvar->data.dap4data.memory,(nc4size * count));
+	    if(xtype == nc4type)
+	        memcpy(xpos,offset,nc4size * odom.runlen);
+	    else if((ret=NCD4_convert(nc4type,xtype,xpos,offset,odom.runlen)))
+	        {goto done;}
+	    continue;
+	}
 	/* We need to compute the offset in the dap4 data of this instance;
 	   for fixed size types, this is easy, otherwise we have to walk
 	   the variable size type
@@ -107,8 +119,7 @@ NCD4_get_vars(int ncid, int varid,
 
 done:
     /* cleanup */
-    if(odom != NULL)
-	d4odom_free(odom);
+    NC_odom_free(&odom);
     if(instance != NULL)
 	free(instance);
     if(ret != NC_NOERR) { /* reclaim all malloc'd data if there is an error*/
@@ -81,11 +81,43 @@ extern unsigned int NC_crc32(unsigned int crc, const unsigned char* buf, unsigne
 #define uInt unsigned int
 #define z_off64_t long long
 #define z_off_t long
-#define z_crc_t unsigned long
 #define z_size_t size_t
 #define Z_NULL NULL
 
+#include "config.h"
 #include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef HAVE_STDINT_H
+#include <stdint.h>
+#endif
+
+/* The word-at-a-time code needs an exactly 32 bit crc type */
+#if defined(HAVE_STDINT_H) || defined(UINT32_MAX)
+#define Z_U4 uint32_t
+#define z_crc_t Z_U4
+#else
+#define z_crc_t unsigned long
+#endif
+
+#define ZSWAP32(q) ((((q) >> 24) & 0xff) + (((q) >> 8) & 0xff00) + \
+                    (((q) & 0xff00) << 8) + (((q) & 0xff) << 24))
+
+/* Hardware assisted crc: PCLMULQDQ folding on x86_64 and the
+   ARMv8 CRC32 instructions on aarch64. Both are selected at run time,
+   so the library still runs on processors without them. */
+#if !defined(NOHWCRC) && defined(__GNUC__) && defined(__x86_64__)
+#  define HWCRC_PCLMUL
+#  include <immintrin.h>
+#endif
+#if !defined(NOHWCRC) && defined(__GNUC__) && defined(__aarch64__) && defined(__linux__)
+#  define HWCRC_ARMV8
+#  include <arm_acle.h>
+#  include <sys/auxv.h>
+#  ifndef HWCAP_CRC32
+#    define HWCAP_CRC32 (1 << 7)
+#  endif
+#endif
 
 #ifdef MAKECRCH
 #  include <stdio.h>
@@ -258,12 +290,158 @@ local const z_crc_t FAR * ZEXPORT get_crc_table()
 #define DO1 crc = crc_table[0][((int)crc ^ (*buf++)) & 0xff] ^ (crc >> 8)
 #define DO8 DO1; DO1; DO1; DO1; DO1; DO1; DO1; DO1
 
+#ifdef HWCRC_PCLMUL
+/* Smallest buffer worth handing to the folding code; it must be >= 64. */
+#define PCLMUL_MINLEN 64
+
+/* ========================================================================= */
+/*
+  Fold the buffer 64 bytes at a time with carry-less multiplies, then
+  Barrett reduce to 32 bits.  See "Fast CRC Computation for Generic
+  Polynomials Using PCLMULQDQ Instruction", Gopal et al., Intel, 2009.
+  len must be >= 64 and a multiple of 16; crc is the pre-inverted
+  register value and the result is likewise not post-inverted.
+*/
+__attribute__((target("sse4.1,pclmul")))
+local z_crc_t crc32_pclmul(crc, buf, len)
+    z_crc_t crc;
+    const unsigned char FAR *buf;
+    z_size_t len;
+{
+    /* Bit-reflected fold constants and the crc32+Barrett polynomials */
+    static const uint64_t k1k2[2] __attribute__((aligned(16))) = {0x0154442bd4ULL, 0x01c6e41596ULL};
+    static const uint64_t k3k4[2] __attribute__((aligned(16))) = {0x01751997d0ULL, 0x00ccaa009eULL};
+    static const uint64_t k5k0[2] __attribute__((aligned(16))) = {0x0163cd6124ULL, 0x0000000000ULL};
+    static const uint64_t poly[2] __attribute__((aligned(16))) = {0x01db710641ULL, 0x01f7011641ULL};
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    x0 = _mm_load_si128((const __m128i *)k1k2);
+    buf += 64;
+    len -= 64;
+
+    /* Fold four 128 bit lanes in parallel */
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        y5 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+        y6 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+        y7 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+        y8 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+        buf += 64;
+        len -= 64;
+    }
+
+    /* Fold the four lanes into one */
+    x0 = _mm_load_si128((const __m128i *)k3k4);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* Remaining 16 byte blocks */
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i *)buf);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        buf += 16;
+        len -= 16;
+    }
+
+    /* 128 bits to 64 bits */
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduction to 32 bits */
+    x0 = _mm_load_si128((const __m128i *)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return (z_crc_t)(unsigned int)_mm_extract_epi32(x1, 1);
+}
+
+local int have_pclmul()
+{
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+}
+#endif /* HWCRC_PCLMUL */
+
+#ifdef HWCRC_ARMV8
+/* Smallest buffer handed to the CRC32 instructions; shorter ones, such
+   as hash keys, are left to the tables. */
+#define ARMV8_MINLEN 64
+
+/* ========================================================================= */
+/* crc is the pre-inverted register value, as for crc32_pclmul(). */
+__attribute__((target("+crc")))
+local z_crc_t crc32_armv8(crc, buf, len)
+    z_crc_t crc;
+    const unsigned char FAR *buf;
+    z_size_t len;
+{
+    uint64_t word;
+
+    while (len && ((ptrdiff_t)buf & 7)) {
+        crc = __crc32b(crc, *buf++);
+        len--;
+    }
+    while (len >= 8) {
+        memcpy(&word, buf, sizeof(word));
+        crc = __crc32d(crc, word);
+        buf += 8;
+        len -= 8;
+    }
+    while (len--)
+        crc = __crc32b(crc, *buf++);
+    return crc;
+}
+
+local int have_armv8crc()
+{
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+}
+#endif /* HWCRC_ARMV8 */
+
 /* ========================================================================= */
 local unsigned long ZEXPORT crc32_z(crc, buf, len)
     unsigned long crc;
     const unsigned char FAR *buf;
     z_size_t len;
 {
+#if defined(HWCRC_PCLMUL) || defined(HWCRC_ARMV8)
+    /* -1 => not yet probed; the probe is idempotent so a race is benign */
+    static volatile int hwcrc = -1;
+#endif
+
     if (buf == Z_NULL) return 0UL;
 
 #ifdef DYNAMIC_CRC_TABLE
@@ -271,6 +449,26 @@ local unsigned long ZEXPORT crc32_z(crc, buf, len)
         make_crc_table();
 #endif /* DYNAMIC_CRC_TABLE */
 
+#ifdef HWCRC_PCLMUL
+    if (len >= PCLMUL_MINLEN) {
+        if (hwcrc < 0) hwcrc = have_pclmul();
+        if (hwcrc) {
+            z_size_t chunk = len & ~(z_size_t)15;
+            crc = ~crc32_pclmul(~(z_crc_t)crc, buf, chunk) & 0xffffffffUL;
+            buf += chunk;
+            len -= chunk;
+            if (len == 0) return crc;
+        }
+    }
+#endif /* HWCRC_PCLMUL */
+#ifdef HWCRC_ARMV8
+    if (len >= ARMV8_MINLEN) {
+        if (hwcrc < 0) hwcrc = have_armv8crc();
+        if (hwcrc)
+            return ~crc32_armv8(~(z_crc_t)crc, buf, len) & 0xffffffffUL;
+    }
+#endif /* HWCRC_ARMV8 */
+
 #ifdef BYFOUR
     if (sizeof(void *) == sizeof(ptrdiff_t)) {
         z_crc_t endian;
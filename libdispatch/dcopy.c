@@ -8,6 +8,7 @@
  * @author Dennis Heimbigner
 */
 #include "ncdispatch.h"
+#include "nc3dispatch.h"
 #include "nc_logging.h"
 
 #ifdef USE_NETCDF4
@@ -512,6 +513,53 @@ nc_copy_var(int ncid_in, int varid_in, int ncid_out)
    return retval;
 }
 
+/**
+ * Copy the data of all variables from one classic format file to
+ * another, as the bytes stored in the input file. Each variable of
+ * the output file gets the data of the variable of the same name in
+ * the input file, which must have the same type and shape. One of the
+ * two may have the unlimited dimension where the other has a fixed
+ * dimension with the number of records as its length. The files may
+ * have different classic formats and different header sizes and
+ * variable alignments.
+ *
+ * This is much faster than copying each variable with
+ * nc_get_vara()/nc_put_vara(), because no values are converted and
+ * adjacent variables are read and written together. The output file
+ * must have been defined already, e.g. with nc_copy_var() or by
+ * hand, and be in data mode. Nothing is written if the variables do
+ * not match.
+ *
+ * @param ncid_in File ID to copy from.
+ * @param ncid_out File ID to copy to.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADID Bad ncid.
+ * @return ::NC_ENOTNC3 Not both classic format files.
+ * @return ::NC_EINVAL The variables of the two files do not match.
+ * @return ::NC_EINDEFINE A file is in define mode.
+ * @return ::NC_EPERM Output file is read-only.
+*/
+int
+nc_copy_data_raw(int ncid_in, int ncid_out)
+{
+   NC *ncp_in, *ncp_out;
+   int retval;
+
+   if ((retval = NC_check_id(ncid_in, &ncp_in)))
+      return retval;
+   if ((retval = NC_check_id(ncid_out, &ncp_out)))
+      return retval;
+   if (ncp_in->dispatch->model != NC_FORMATX_NC3 ||
+       ncp_out->dispatch->model != NC_FORMATX_NC3)
+      return NC_ENOTNC3;
+
+   NCLOCKPAIR(ncp_in, ncp_out);
+   retval = NC3_copy_data_raw(ncid_in, ncid_out);
+   NCUNLOCKPAIR(ncp_in, ncp_out);
+   return retval;
+}
+
 /**
  * Copy an attribute from one open file to another. This is called by
  * nc_copy_att().
@@ -10,6 +10,8 @@ See LICENSE.txt for license information.
 #include "ncbytes.h"
 #include "ncrc.h"
 #include "ncoffsets.h"
+#include "ncperf.h"
+#include "ncmemimage.h"
 
 /* Required for getcwd, other functions. */
 #ifdef HAVE_UNISTD_H
@@ -120,6 +122,9 @@ NCDISPATCH_initialize(void)
     /* Compute type alignments */
     NC_compute_alignments();
 
+    /* Turn on the performance timers if asked */
+    NC_perf_initialize();
+
     /* Initialize curl if it is being used */
 #if defined(ENABLE_BYTERANGE) || defined(ENABLE_DAP) || defined(ENABLE_DAP4)
     {
@@ -135,6 +140,7 @@ int
 NCDISPATCH_finalize(void)
 {
     int status = NC_NOERR;
+    NC_memimage_finalize();
     ncrc_freeglobalstate();
 #if defined(ENABLE_BYTERANGE) || defined(ENABLE_DAP) || defined(ENABLE_DAP4)
     curl_global_cleanup();
@@ -37,6 +37,8 @@
 #include "netcdf_mem.h"
 #include "ncwinpath.h"
 #include "fbits.h"
+#include "ncperf.h"
+#include "ncmemimage.h"
 
 #undef DEBUG
 
@@ -605,6 +607,16 @@ nc__create_mp(const char *path, int cmode, size_t initialsz,
  * will read the whole file into memory on nc_open. Thus, MMAP will
  * provide some performance improvement in this case.
  *
+ * A classic format file may be opened read-only with the
+ * NC_CONCURRENT flag so that many threads can read it at the same
+ * time. The file's header is read once at open and never changes
+ * (nc_sync() does not reread it), and each read goes straight to the
+ * file with pread() into a buffer private to that call, so reads do
+ * not contend with one another. NC_CONCURRENT cannot be combined with
+ * NC_WRITE, NC_SHARE, NC_DISKLESS, NC_INMEMORY or NC_MMAP, and is
+ * ignored for netCDF-4 files. Opening and closing files must still
+ * be serialized unless the library was built thread-safe.
+ *
  * It is not necessary to pass any information about the format of the
  * file being opened. The file type will be detected automatically by
  * the netCDF library.
@@ -721,14 +733,18 @@ nc__open(const char *path, int omode,
 /** \ingroup datasets
     Open a netCDF file with the contents taken from a block of memory.
 
-    \param path Must be non-null, but otherwise only used to set the dataset name.
+    \param path Must be non-null, but otherwise only used to set the
+    dataset name; or, if memory is NULL, the name of an image
+    registered with nc_mem_register().
 
     \param omode the open mode flags; Note that this procedure uses a limited set of flags because it forcibly sets NC_INMEMORY.
 
-    \param size The length of the block of memory being passed.
+    \param size The length of the block of memory being passed; zero
+    to open a registered image.
 
     \param memory Pointer to the block of memory containing the contents
-    of a netcdf file.
+    of a netcdf file; NULL to open a registered image, which is then
+    shared with its other opens rather than copied.
 
     \param ncidp Pointer to location where returned netCDF ID is to be
     stored.
@@ -739,6 +755,8 @@ nc__open(const char *path, int omode,
 
     \returns ::NC_EDISKLESS diskless io is not enabled for fails.
 
+    \returns ::NC_ENOTFOUND No image of that name is registered.
+
     \returns ::NC_EINVAL, etc. other errors also returned by nc_open.
 
     <h1>Examples</h1>
@@ -769,7 +787,14 @@ nc_open_mem(const char* path, int omode, size_t size, void* memory, int* ncidp)
     NC_memio meminfo;
 
     /* Sanity checks */
-    if(memory == NULL || size < MAGIC_NUMBER_LEN || path == NULL)
+    if(path == NULL)
+        return NC_EINVAL;
+    if(memory == NULL && size == 0) { /* a registered image */
+        if(omode & NC_MMAP)
+            return NC_EINVAL;
+        return NC_open(path, omode|NC_INMEMORY, 0, NULL, 0, NULL, ncidp);
+    }
+    if(memory == NULL || size < MAGIC_NUMBER_LEN)
         return NC_EINVAL;
     if(omode & (NC_WRITE|NC_MMAP))
         return NC_EINVAL;
@@ -1058,6 +1083,17 @@ nc_enddef(int ncid)
     nc_redef, nc_enddef() by requesting that minfree bytes be available at
     the end of the section.
 
+    When h_minfree is 0, as with nc_enddef(), the library picks the
+    pad at the end of the header itself whenever the header is placed,
+    that is when the dataset is created and when it has outgrown its
+    space: none for datasets with less than 1 MiB of data, which are
+    cheap to copy, and otherwise enough for the header to double in
+    size, at least 4 KiB, with the data starting at a multiple of
+    4 KiB. Adding attributes or renaming things then rarely copies the
+    data. Setting the environment variable NETCDF_HEADER_HEADROOM to a
+    number of bytes before the library is initialized makes that the
+    pad instead, 0 to leave none.
+
     The align parameters allow one to set the alignment of the beginning
     of the corresponding sections. The beginning of the section is rounded
     up to an index which is a multiple of the align parameter. The flag
@@ -1088,7 +1124,8 @@ nc_enddef(int ncid)
     \param ncid NetCDF ID, from a previous call to nc_open() or
     nc_create().
 
-    \param h_minfree Sets the pad at the end of the "header" section.
+    \param h_minfree Sets the pad at the end of the "header" section,
+    or 0 for the default pad.
 
     \param v_align Controls the alignment of the beginning of the data
     section for fixed size variables.
@@ -1298,6 +1335,7 @@ nc_close(int ncid)
     /* Remove from the nc list */
     if (!stat)
     {
+        NC_perf_report(ncp);
         del_from_NCList(ncp);
         free_NC(ncp);
     }
@@ -1357,6 +1395,7 @@ nc_close_memio(int ncid, NC_memio* memio)
     /* Remove from the nc list */
     if (!stat)
     {
+        NC_perf_report(ncp);
         del_from_NCList(ncp);
         free_NC(ncp);
     }
@@ -1420,14 +1459,29 @@ nc_close_memio(int ncid, NC_memio* memio)
     future releases. Programmers are cautioned against heavy reliance upon
     this feature.
 
+    The fill mode ::NC_LAZYFILL keeps the default behavior, with less
+    I/O for classic format datasets. Fill values are not written when
+    the data is defined or records are added, but only when the
+    dataset is synchronized with nc_sync(), put back in define mode,
+    or closed, and then only where no data was written in the
+    meantime. Reading unwritten data before then still returns fill
+    values. This makes nc_enddef() and the writing of records far
+    ahead of the last one fast, and saves writing fill values that
+    would later be overwritten. Other programs reading the dataset
+    while it is open see zeros where fill values have not been written
+    yet. For netCDF-4 datasets, where HDF5 only writes fill values as
+    storage is allocated anyway, ::NC_LAZYFILL is the same as
+    ::NC_FILL.
+
     \param ncid NetCDF ID, from a previous call to nc_open() or
     nc_create().
 
-    \param fillmode Desired fill mode for the dataset, either ::NC_NOFILL or
-    ::NC_FILL.
+    \param fillmode Desired fill mode for the dataset, ::NC_NOFILL,
+    ::NC_FILL or ::NC_LAZYFILL.
 
     \param old_modep Pointer to location for returned current fill mode of
-    the dataset before this call, either ::NC_NOFILL or ::NC_FILL.
+    the dataset before this call, ::NC_NOFILL, ::NC_FILL or
+    ::NC_LAZYFILL.
 
     \returns ::NC_NOERR No error.
 
@@ -1437,8 +1491,8 @@ nc_close_memio(int ncid, NC_memio* memio)
     \returns ::NC_EPERM The specified netCDF ID refers to a dataset open for
     read-only access.
 
-    \returns ::NC_EINVAL The fill mode argument is neither ::NC_NOFILL nor
-    ::NC_FILL.
+    \returns ::NC_EINVAL The fill mode argument is not ::NC_NOFILL,
+    ::NC_FILL or ::NC_LAZYFILL.
 
     <h1>Example</h1>
 
@@ -1782,6 +1836,9 @@ check_create_mode(int mode)
     /* mmap is not allowed for netcdf-4 */
     if(mmap && (mode & NC_NETCDF4)) return NC_EINVAL;
 
+    /* NC_CONCURRENT is a read-only open mode */
+    if(mode & NC_CONCURRENT) return NC_EINVAL;
+
 #ifndef USE_NETCDF4
     /* If the user asks for a netCDF-4 file, and the library was built
      * without netCDF-4, then return an error.*/
@@ -1831,6 +1888,7 @@ NC_create(const char *path0, int cmode, size_t initialsz,
     char* path = NULL;
     NCmodel model;
     char* newpath = NULL;
+    int locked = 0;
 
     TRACE(nc_create);
     if(path0 == NULL)
@@ -1840,13 +1898,15 @@ NC_create(const char *path0, int cmode, size_t initialsz,
     if ((stat = check_create_mode(cmode)))
         return stat;
 
+    NCLOCKGLOBAL(); locked = 1;
+
     /* Initialize the library. The available dispatch tables
      * will depend on how netCDF was built
      * (with/without netCDF-4, DAP, CDMREMOTE). */
     if(!NC_initialized)
     {
         if ((stat = nc_initialize()))
-            return stat;
+            goto done;
     }
 
     {
@@ -1910,7 +1970,8 @@ NC_create(const char *path0, int cmode, size_t initialsz,
         dispatcher = NC3_dispatch_table;
         break;
     default:
-        return NC_ENOTNC;
+        stat = NC_ENOTNC;
+        goto done;
     }
 
     /* Create the NC* instance and insert its dispatcher and model */
@@ -1919,6 +1980,10 @@ NC_create(const char *path0, int cmode, size_t initialsz,
     /* Add to list of known open files and define ext_ncid */
     add_to_NCList(ncp);
 
+    /* Classic files have their own lock; see ncthread.h */
+    if(dispatcher->model == NC_FORMATX_NC3)
+        {NCUNLOCKGLOBAL(); locked = 0;}
+
     /* Assume create will fill in remaining ncp fields */
     if ((stat = dispatcher->create(ncp->path, cmode, initialsz, basepe, chunksizehintp,
                                    parameters, dispatcher, ncp->ext_ncid))) {
@@ -1928,6 +1993,7 @@ NC_create(const char *path0, int cmode, size_t initialsz,
         if(ncidp)*ncidp = ncp->ext_ncid;
     }
 done:
+    if(locked) NCUNLOCKGLOBAL();
     nullfree(path);
     return stat;
 }
@@ -1968,17 +2034,23 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
     char* path = NULL;
     NCmodel model;
     char* newpath = NULL;
+    int locked = 0;
+    NC_memimage* image = NULL;
+    NC_memio imageinfo;
 
     TRACE(nc_open);
-    if(!NC_initialized) {
-        stat = nc_initialize();
-        if(stat) return stat;
-    }
 
     /* Check inputs. */
     if (!path0)
         return NC_EINVAL;
 
+    NCLOCKGLOBAL(); locked = 1;
+
+    if(!NC_initialized) {
+        stat = nc_initialize();
+        if(stat) goto done;
+    }
+
     /* Capture the inmemory related flags */
     mmap = ((omode & NC_MMAP) == NC_MMAP);
     diskless = ((omode & NC_DISKLESS) == NC_DISKLESS);
@@ -1992,6 +2064,17 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
     /* mmap is not allowed for netcdf-4 */
     if(mmap && (omode & NC_NETCDF4)) {stat = NC_EINVAL; goto done;}
 
+    /* An in-memory open without memory is of a registered image, used
+       in place and read-only */
+    if(inmemory && parameters == NULL) {
+        if(omode & NC_WRITE) {stat = NC_EPERM; goto done;}
+        if((stat = NC_memimage_acquire(path0,&image))) goto done;
+        imageinfo.size = image->size;
+        imageinfo.memory = image->memory;
+        imageinfo.flags = NC_MEMIO_LOCKED;
+        parameters = &imageinfo;
+    }
+
     /* Attempt to do file path conversion: note that this will do
        nothing if path is a 'file:...' url, so it will need to be
        repeated in protocol code (e.g. libdap2, libdap4, etc).
@@ -2098,8 +2181,8 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
             dispatcher = NC3_dispatch_table;
             break;
         default:
-            nullfree(path);
-            return NC_ENOTNC;
+            stat = NC_ENOTNC;
+            goto done;
         }
     }
 
@@ -2109,10 +2192,16 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
 
     /* Create the NC* instance and insert its dispatcher */
     if((stat = new_NC(dispatcher,path,omode,&ncp))) goto done;
+    ncp->image = image; /* free_NC releases it */
+    image = NULL;
 
     /* Add to list of known open files. This assigns an ext_ncid. */
     add_to_NCList(ncp);
 
+    /* Classic files have their own lock; see ncthread.h */
+    if(dispatcher->model == NC_FORMATX_NC3)
+        {NCUNLOCKGLOBAL(); locked = 0;}
+
     /* Assume open will fill in remaining ncp fields */
     stat = dispatcher->open(ncp->path, omode, basepe, chunksizehintp,
                             parameters, dispatcher, ncp->ext_ncid);
@@ -2124,6 +2213,8 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
     }
 
 done:
+    NC_memimage_release(image);
+    if(locked) NCUNLOCKGLOBAL();
     nullfree(path);
     return stat;
 }
@@ -2145,6 +2236,8 @@ static int pseudofd = 0;
 int
 nc__pseudofd(void)
 {
+    int fd;
+    NCLOCKGLOBAL();
     if(pseudofd == 0)  {
         int maxfd = 32767; /* default */
 #ifdef HAVE_GETRLIMIT
@@ -2158,5 +2251,7 @@ nc__pseudofd(void)
         pseudofd = maxfd+1;
 #endif
     }
-    return pseudofd++;
+    fd = pseudofd++;
+    NCUNLOCKGLOBAL();
+    return fd;
 }
@@ -57,9 +57,10 @@ const struct FilterName {
     const char* name; /* name or alias as assigned by HDF group*/
     unsigned int id;  /* id as assigned by HDF group*/
 } known_filters[] = {
-{"zip", 2}, /* Standard zlib compression */
-{"zlib", 2}, /* alias */
-{"deflate", 2}, /* alias */
+{"zip", 1}, /* Standard zlib compression */
+{"zlib", 1}, /* alias */
+{"deflate", 1}, /* alias */
+{"shuffle", 2}, /* Standard HDF5 shuffle */
 {"szip", 4}, /* Standard szip compression */
 {"bzip2", 307}, /* BZIP2 lossless compression used by PyTables */
 {"lzf", 32000}, /* LZF lossless compression used by H5Py project */
@@ -78,10 +79,13 @@ const struct FilterName {
 {"zfp", 32013}, /* Rate, accuracy or precision bounded compression for floating-point arrays */
 {"fpzip", 32014}, /* Fast and Efficient Lossy or Lossless Compressor for Floating-Point Data */
 {"zstandard", 32015}, /* Real-time compression algorithm with wide range of compression / speed trade-off and fast decoder */
+{"zstd", 32015}, /* alias */
 {"b3d", 32016}, /* GPU based image compression method developed for light-microscopy applications */
 {"sz", 32017}, /* An error-bounded lossy compressor for scientific floating-point data */
 {"fcidecomp", 32018}, /* EUMETSAT CharLS compression filter for use with netCDF */
 {"user-defined", 32768}, /* First user-defined filter */
+{"blockshuffle", 32769}, /* Blocked byte or bit shuffle, plugins/H5Zblockshuffle.c */
+{"quantize", 32770}, /* BitGroom or BitRound quantization, plugins/H5Zquantize.c */
 {NULL,0}
 };
 
@@ -645,6 +649,108 @@ nc_var_filter_remove(int ncid, int varid, unsigned int id)
     return ncp->dispatch->filter_actions(ncid,varid,NCFILTER_REMOVE,(NC_Filterobject*)&spec);
 }
 
+/**
+Read one chunk of a variable as it is stored in the file, that is,
+still compressed or otherwise encoded by the variable's filters.
+
+Together with nc_put_var_chunk_raw() this lets a chunk be moved to a
+variable with the same type, chunk sizes and filters in another file
+without decoding and re-encoding it.
+
+As is usual, this may be called twice: once with data NULL to get
+the size, and again to read the bytes.
+
+\param ncid NetCDF or group ID.
+\param varid Variable ID.
+\param offsets Index of the first element of the chunk; each must be
+a multiple of the chunk size in that dimension.
+\param filtermaskp (Out) Filters that were skipped when the chunk was
+written; pass it on to nc_put_var_chunk_raw(). May be NULL.
+\param sizep (In) Size of data in bytes, when data is not NULL. (Out)
+Size of the stored chunk, 0 if the chunk was never written.
+\param data (Out) The stored bytes, or NULL.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_ENOTNC4 Not a netCDF-4 file.
+\returns ::NC_EBADID Bad ncid.
+\returns ::NC_ENOTVAR Invalid variable ID.
+\returns ::NC_EINVAL Variable not chunked, bad offsets, or data too small.
+\returns ::NC_EINDEFINE File is in define mode.
+\returns ::NC_ENOTBUILT HDF5 library too old for direct chunk access.
+\ingroup variables
+*/
+EXTERNL int
+nc_get_var_chunk_raw(int ncid, int varid, const size_t* offsets,
+                     unsigned int* filtermaskp, size_t* sizep, void* data)
+{
+    NC* ncp;
+    NC_FILTER_OBJ_HDF5 chunk;
+    int stat = NC_check_id(ncid,&ncp);
+
+    if(stat != NC_NOERR) return stat;
+    TRACE(nc_get_var_chunk_raw);
+    if(sizep == NULL) return NC_EINVAL;
+
+    memset(&chunk,0,sizeof(chunk));
+    chunk.hdr.format = NC_FILTER_FORMAT_HDF5;
+    chunk.sort = NC_FILTER_SORT_CHUNK;
+    chunk.u.chunk.offsets = offsets;
+    chunk.u.chunk.size = (data?*sizep:0);
+    chunk.u.chunk.data = data;
+    if((stat = ncp->dispatch->filter_actions(ncid,varid,NCFILTER_READCHUNK,(NC_Filterobject*)&chunk)))
+        return stat;
+    if(filtermaskp) *filtermaskp = chunk.u.chunk.filtermask;
+    *sizep = chunk.u.chunk.size;
+    return stat;
+}
+
+/**
+Write one chunk of a variable exactly as given, bypassing the
+variable's filters. The bytes must be what the filters would have
+produced, as returned by nc_get_var_chunk_raw() for a variable with
+the same type, chunk sizes and filters.
+
+The chunk must lie within the current extent of the variable; write
+the last element of a record variable first to extend it.
+
+\param ncid NetCDF or group ID.
+\param varid Variable ID.
+\param offsets Index of the first element of the chunk.
+\param filtermask Filters that were skipped, from nc_get_var_chunk_raw().
+\param size Size of data in bytes.
+\param data The stored bytes.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_ENOTNC4 Not a netCDF-4 file.
+\returns ::NC_EBADID Bad ncid.
+\returns ::NC_ENOTVAR Invalid variable ID.
+\returns ::NC_EINVAL Variable not chunked or bad offsets.
+\returns ::NC_EINDEFINE File is in define mode.
+\returns ::NC_EPERM File is read-only.
+\returns ::NC_ENOTBUILT HDF5 library too old for direct chunk access.
+\ingroup variables
+*/
+EXTERNL int
+nc_put_var_chunk_raw(int ncid, int varid, const size_t* offsets,
+                     unsigned int filtermask, size_t size, const void* data)
+{
+    NC* ncp;
+    NC_FILTER_OBJ_HDF5 chunk;
+    int stat = NC_check_id(ncid,&ncp);
+
+    if(stat != NC_NOERR) return stat;
+    TRACE(nc_put_var_chunk_raw);
+
+    memset(&chunk,0,sizeof(chunk));
+    chunk.hdr.format = NC_FILTER_FORMAT_HDF5;
+    chunk.sort = NC_FILTER_SORT_CHUNK;
+    chunk.u.chunk.offsets = offsets;
+    chunk.u.chunk.filtermask = filtermask;
+    chunk.u.chunk.size = size;
+    chunk.u.chunk.data = (void*)data; /* discard const */
+    return ncp->dispatch->filter_actions(ncid,varid,NCFILTER_WRITECHUNK,(NC_Filterobject*)&chunk);
+}
+
 /**************************************************/
 /* Utilities */
 
@@ -0,0 +1,252 @@
+/*********************************************************************
+   Copyright 2018, UCAR/Unidata See netcdf/COPYRIGHT file for
+   copying and redistribution conditions.
+*********************************************************************/
+/**
+ * @file
+ *
+ * The registry of shared in-memory images: nc_mem_register() and
+ * nc_mem_unregister(). See ncmemimage.h.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include "ncdispatch.h"
+#include "netcdf_mem.h"
+#include "nclist.h"
+#include "ncmemimage.h"
+#include "ncthread.h"
+
+/* The registered images */
+static NClist* images = NULL;
+
+/* Return the index in images of the image called name, or -1 */
+static int
+findimage(const char* name)
+{
+    size_t i;
+    for(i=0;i<nclistlength(images);i++) {
+        NC_memimage* image = (NC_memimage*)nclistget(images,i);
+        if(strcmp(image->name,name) == 0)
+            return (int)i;
+    }
+    return -1;
+}
+
+/* Drop a reference; the caller holds the global lock */
+static void
+releaseimage(NC_memimage* image)
+{
+    if(--image->refcount > 0)
+        return;
+    if(image->header != NULL && image->free_header != NULL)
+        image->free_header(image->header);
+    if(!(image->flags & NC_MEMIO_LOCKED))
+        free(image->memory);
+    free(image->name);
+    free(image);
+}
+
+/** \ingroup datasets
+    Register a block of memory holding a netCDF file as a shared,
+    read-only image. The image can then be opened any number of
+    times, by name, with nc_open_mem() given a NULL memory and a
+    size of zero, or with nc_open() given ::NC_INMEMORY.
+
+    Every open uses the registered memory in place, without copying
+    it, so the memory must not change while the image is registered
+    or open. Classic format opens also share the header parsed by
+    the first of them, so opening a registered classic image again
+    costs next to nothing. The images are opened read-only; opening
+    one with ::NC_WRITE fails with ::NC_EPERM.
+
+    \param name Name of the image; must not be the name of another
+    registered image.
+
+    \param size Size of the image in bytes.
+
+    \param memory The image. Unless flags has ::NC_MEMIO_LOCKED, the
+    memory must have been allocated with malloc(), and the library
+    takes it over and frees it once the image has been unregistered
+    and its last open has been closed.
+
+    \param flags ::NC_MEMIO_LOCKED if the caller keeps the memory;
+    it must then stay valid until the image has been unregistered
+    and every dataset opened from it has been closed.
+
+    \returns ::NC_NOERR No error.
+    \returns ::NC_EINVAL Invalid argument.
+    \returns ::NC_ENAMEINUSE An image of that name is registered.
+    \returns ::NC_ENOMEM Out of memory.
+
+    <h1>Example</h1>
+
+    @code
+    #include <netcdf.h>
+    #include <netcdf_mem.h>
+    ...
+    if((status = nc_mem_register("hot.nc", size, memory, 0)))
+        handle_error(status);
+    ...
+    status = nc_open_mem("hot.nc", NC_NOWRITE, 0, NULL, &ncid);
+    ...
+    nc_close(ncid);
+    ...
+    nc_mem_unregister("hot.nc");
+    @endcode
+*/
+int
+nc_mem_register(const char* name, size_t size, void* memory, int flags)
+{
+    int stat = NC_NOERR;
+    NC_memimage* image = NULL;
+
+    if(name == NULL || *name == '\0' || memory == NULL || size == 0)
+        return NC_EINVAL;
+    if(flags & ~NC_MEMIO_LOCKED)
+        return NC_EINVAL;
+
+    NCLOCKGLOBAL();
+    if(images == NULL && (images = nclistnew()) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    if(findimage(name) >= 0)
+        {stat = NC_ENAMEINUSE; goto done;}
+    if((image = (NC_memimage*)calloc(1,sizeof(NC_memimage))) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    if((image->name = strdup(name)) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    image->memory = memory;
+    image->size = size;
+    image->flags = flags;
+    image->refcount = 1;
+    if(!nclistpush(images,image))
+        {stat = NC_ENOMEM; goto done;}
+    image = NULL;
+
+done:
+    NCUNLOCKGLOBAL();
+    if(image != NULL) {
+        free(image->name);
+        free(image);
+    }
+    return stat;
+}
+
+/** \ingroup datasets
+    Unregister an image registered with nc_mem_register(). The image
+    can no longer be opened, but the datasets already opened from it
+    stay usable; its memory is released when the last of them has
+    been closed.
+
+    \param name Name of the image.
+
+    \returns ::NC_NOERR No error.
+    \returns ::NC_EINVAL Invalid argument.
+    \returns ::NC_ENOTFOUND No image of that name is registered.
+*/
+int
+nc_mem_unregister(const char* name)
+{
+    int stat = NC_NOERR;
+    int i;
+
+    if(name == NULL)
+        return NC_EINVAL;
+    NCLOCKGLOBAL();
+    if((i = findimage(name)) < 0)
+        stat = NC_ENOTFOUND;
+    else
+        releaseimage((NC_memimage*)nclistremove(images,(size_t)i));
+    NCUNLOCKGLOBAL();
+    return stat;
+}
+
+/**
+ * @internal Find a registered image by name, and add a reference to
+ * it for an NC that is opening it.
+ *
+ * @param name Name of the image.
+ * @param imagep Pointer that gets the image.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOTFOUND No image of that name is registered.
+ */
+int
+NC_memimage_acquire(const char* name, NC_memimage** imagep)
+{
+    int stat = NC_NOERR;
+    int i;
+
+    NCLOCKGLOBAL();
+    if((i = findimage(name)) < 0)
+        stat = NC_ENOTFOUND;
+    else {
+        NC_memimage* image = (NC_memimage*)nclistget(images,(size_t)i);
+        image->refcount++;
+        *imagep = image;
+    }
+    NCUNLOCKGLOBAL();
+    return stat;
+}
+
+/**
+ * @internal Drop a reference acquired by NC_memimage_acquire(). The
+ * last reference frees the image.
+ *
+ * @param image The image; may be NULL.
+ */
+void
+NC_memimage_release(NC_memimage* image)
+{
+    if(image == NULL)
+        return;
+    NCLOCKGLOBAL();
+    releaseimage(image);
+    NCUNLOCKGLOBAL();
+}
+
+/**
+ * @internal Give an image the metadata parsed by one of its opens,
+ * to be shared by the later ones, unless another open has already
+ * done so. The image then owns the header and frees it with
+ * free_header.
+ *
+ * @param image The image.
+ * @param header The parsed metadata, or NULL just to get the
+ * current header.
+ * @param free_header Function to free the header.
+ *
+ * @return The header kept by the image, which is the one passed in
+ * only if it was taken; NULL if there is none.
+ */
+void*
+NC_memimage_set_header(NC_memimage* image, void* header,
+                       void (*free_header)(void*))
+{
+    void* kept;
+
+    NCLOCKGLOBAL();
+    if(image->header == NULL && header != NULL) {
+        image->header = header;
+        image->free_header = free_header;
+    }
+    kept = image->header;
+    NCUNLOCKGLOBAL();
+    return kept;
+}
+
+/**
+ * @internal Unregister all images. Those still open are freed when
+ * they are closed.
+ */
+void
+NC_memimage_finalize(void)
+{
+    NCLOCKGLOBAL();
+    while(nclistlength(images) > 0)
+        releaseimage((NC_memimage*)nclistpop(images));
+    nclistfree(images);
+    images = NULL;
+    NCUNLOCKGLOBAL();
+}
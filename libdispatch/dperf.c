@@ -0,0 +1,218 @@
+/*********************************************************************
+   Copyright 2018, UCAR/Unidata See netcdf/COPYRIGHT file for
+   copying and redistribution conditions.
+*********************************************************************/
+/**
+ * @file
+ *
+ * Per-file performance counters: nc_inq_perf_stats() and the
+ * NETCDF_PERF_STATS report on close. See ncperf.h.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(HAVE_SYS_TIME_H)
+#include <sys/time.h>
+#endif
+#include "ncdispatch.h"
+#include "ncperf.h"
+#include "ncthread.h"
+
+/* Nonzero when the timers run */
+int NC_perf_timing = 0;
+
+/* Where the report goes; NULL for stderr */
+static char* perf_report_path = NULL;
+
+/**
+ * @internal Return the time in seconds since some fixed time, for
+ * the timers.
+ */
+double
+NC_perf_now(void)
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+    if(freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#elif defined(HAVE_GETTIMEOFDAY)
+    struct timeval tv;
+    gettimeofday(&tv,NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec * 1e-6;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/**
+ * @internal Turn on the timers and the report on close if
+ * NETCDF_PERF_STATS is set.
+ */
+void
+NC_perf_initialize(void)
+{
+    const char* env = getenv("NETCDF_PERF_STATS");
+
+    NC_perf_timing = 0;
+    if(perf_report_path != NULL) {free(perf_report_path); perf_report_path = NULL;}
+    if(env == NULL || *env == '\0' || strcmp(env,"0") == 0)
+        return;
+    NC_perf_timing = 1;
+    if(strcmp(env,"1") != 0 && strcmp(env,"stderr") != 0)
+        perf_report_path = strdup(env);
+}
+
+/**
+ * @internal Add to a time of the counters; see NC_PERF_STOP.
+ *
+ * @param time Pointer to the time.
+ * @param dt Seconds to add.
+ */
+void
+NC_perf_add_time(double* time, double dt)
+{
+#ifdef NC_PERF_ATOMIC
+    double old, sum;
+    __atomic_load(time,&old,__ATOMIC_RELAXED);
+    do {
+        sum = old + dt;
+    } while(!__atomic_compare_exchange(time,&old,&sum,0,__ATOMIC_RELAXED,__ATOMIC_RELAXED));
+#else
+    *time += dt;
+#endif
+}
+
+/* Copy the counters of a file that other threads may be adding to */
+static void
+perf_snapshot(nc_perf_stats_t* to, nc_perf_stats_t* from)
+{
+#ifdef NC_PERF_ATOMIC
+#define LOAD(field) __atomic_load(&from->field,&to->field,__ATOMIC_RELAXED)
+    to->backend = from->backend;
+    LOAD(io_gets); LOAD(io_get_bytes);
+    LOAD(io_reads); LOAD(io_read_bytes);
+    LOAD(io_writes); LOAD(io_write_bytes);
+    LOAD(io_time);
+    LOAD(h5_reads); LOAD(h5_read_bytes); LOAD(h5_read_time);
+    LOAD(h5_writes); LOAD(h5_write_bytes); LOAD(h5_write_time);
+    LOAD(mdc_hit_rate);
+    LOAD(conversions); LOAD(convert_bytes); LOAD(convert_time);
+    LOAD(http_requests); LOAD(http_time);
+#undef LOAD
+#else
+    *to = *from;
+#endif
+}
+
+/* Print a string as a JSON string */
+static void
+printjsonstring(FILE* f, const char* s)
+{
+    fputc('"',f);
+    for(;s != NULL && *s;s++) {
+        if(*s == '"' || *s == '\\')
+            fprintf(f,"\\%c",*s);
+        else if((unsigned char)*s < ' ')
+            fprintf(f,"\\u%04x",(unsigned int)(unsigned char)*s);
+        else
+            fputc(*s,f);
+    }
+    fputc('"',f);
+}
+
+/**
+ * @internal Print the counters of a file that has been closed as one
+ * line of JSON, if NETCDF_PERF_STATS is set.
+ *
+ * @param ncp Pointer to the NC of the file.
+ */
+void
+NC_perf_report(NC* ncp)
+{
+    nc_perf_stats_t stats;
+    FILE* f = stderr;
+
+    if(!NC_perf_timing || ncp == NULL)
+        return;
+    perf_snapshot(&stats,&ncp->perf);
+    if(perf_report_path != NULL && (f = fopen(perf_report_path,"a")) == NULL)
+        return;
+    fprintf(f,"{\"path\": ");
+    printjsonstring(f,ncp->path);
+    fprintf(f,", \"backend\": ");
+    printjsonstring(f,stats.backend == NULL ? "" : stats.backend);
+    fprintf(f,", \"io_gets\": %llu, \"io_get_bytes\": %llu"
+              ", \"io_reads\": %llu, \"io_read_bytes\": %llu"
+              ", \"io_writes\": %llu, \"io_write_bytes\": %llu, \"io_time\": %.6f",
+            stats.io_gets,stats.io_get_bytes,stats.io_reads,stats.io_read_bytes,
+            stats.io_writes,stats.io_write_bytes,stats.io_time);
+    fprintf(f,", \"h5_reads\": %llu, \"h5_read_bytes\": %llu, \"h5_read_time\": %.6f"
+              ", \"h5_writes\": %llu, \"h5_write_bytes\": %llu, \"h5_write_time\": %.6f"
+              ", \"mdc_hit_rate\": %.4f",
+            stats.h5_reads,stats.h5_read_bytes,stats.h5_read_time,
+            stats.h5_writes,stats.h5_write_bytes,stats.h5_write_time,
+            stats.mdc_hit_rate);
+    fprintf(f,", \"conversions\": %llu, \"convert_bytes\": %llu, \"convert_time\": %.6f"
+              ", \"http_requests\": %llu, \"http_time\": %.6f}\n",
+            stats.conversions,stats.convert_bytes,stats.convert_time,
+            stats.http_requests,stats.http_time);
+    if(f != stderr)
+        fclose(f);
+    else
+        fflush(f);
+}
+
+/** \ingroup datasets
+    Get the performance counters of an open dataset: the I/O done
+    by the library below the netCDF API, and the time spent in it.
+
+    The counters start at zero when the dataset is opened or
+    created, and are always kept. The times are only measured when
+    the NETCDF_PERF_STATS environment variable is set when the
+    library is initialized; then the counters of each dataset are
+    also printed as one line of JSON when it is closed, to stderr if
+    NETCDF_PERF_STATS is "1" or "stderr", or else appended to the
+    file it names.
+
+    \param ncid NetCDF ID, from a previous call to nc_open() or
+    nc_create(). The counters are those of the whole file, whatever
+    group ncid refers to.
+
+    \param statsp Pointer to location for returned counters.
+
+    \returns ::NC_NOERR No error.
+
+    \returns ::NC_EBADID Invalid ncid passed.
+
+    \returns ::NC_EINVAL statsp is NULL.
+*/
+int
+nc_inq_perf_stats(int ncid, nc_perf_stats_t *statsp)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    if(statsp == NULL) return NC_EINVAL;
+    perf_snapshot(statsp,&ncp->perf);
+    if(statsp->backend == NULL)
+        statsp->backend = "";
+#ifdef USE_HDF5
+    if(ncp->dispatch->model == NC_FORMATX_NC_HDF5) {
+        NCLOCKGLOBAL();
+        NC4_hdf5_perf_stats(ncp,statsp);
+        NCUNLOCKGLOBAL();
+    }
+#endif
+    return NC_NOERR;
+}
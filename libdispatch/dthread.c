@@ -0,0 +1,656 @@
+/*********************************************************************
+   Copyright 2018, UCAR/Unidata See netcdf/COPYRIGHT file for
+   copying and redistribution conditions.
+*********************************************************************/
+/**
+ * @file
+ *
+ * Locking for the thread-safe build (ENABLE_THREADSAFE). See
+ * ncthread.h for the locks and the order in which they are taken.
+ *
+ * Per-file locking is done by interposing a dispatch table: when an
+ * NC is created, its real dispatch table is saved in ncp->unlocked and
+ * ncp->dispatch is pointed at a table of NCL_xxx functions that lock
+ * ncp->lock, call the real function and unlock. For classic files
+ * ncp->lock is a lock private to the file; for all other formats it is
+ * the global lock. Closing a file while another thread is still using
+ * the same ncid is an error, as it is in the non-threadsafe library.
+ */
+
+#include "config.h"
+
+#ifdef ENABLE_THREADSAFE
+
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#include "ncdispatch.h"
+#include "ncthread.h"
+
+/* A recursive mutex */
+#ifdef _WIN32
+typedef struct NC_mutex {CRITICAL_SECTION cs;} NC_mutex;
+static SRWLOCK filelist_lock = SRWLOCK_INIT;
+static INIT_ONCE once = INIT_ONCE_STATIC_INIT;
+/* SRW locks do not remember their mode, so we must */
+static __declspec(thread) int filelist_exclusive = 0;
+#else
+typedef struct NC_mutex {pthread_mutex_t m;} NC_mutex;
+static pthread_rwlock_t filelist_lock = PTHREAD_RWLOCK_INITIALIZER;
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+#endif
+
+static NC_mutex global_lock;
+
+/* One locking dispatch table per model, so ncp->dispatch->model
+   still reports the real model. */
+#define NMODELS (NC_FORMATX_ZARR+1)
+static NC_Dispatch locked_tables[NMODELS];
+
+static void buildtables(void);
+
+static int
+mutex_init(NC_mutex* mp)
+{
+#ifdef _WIN32
+    InitializeCriticalSection(&mp->cs); /* always recursive */
+    return NC_NOERR;
+#else
+    pthread_mutexattr_t attr;
+    int stat = NC_NOERR;
+    if(pthread_mutexattr_init(&attr)) return NC_ENOMEM;
+    if(pthread_mutexattr_settype(&attr,PTHREAD_MUTEX_RECURSIVE)
+       || pthread_mutex_init(&mp->m,&attr))
+        stat = NC_ENOMEM;
+    pthread_mutexattr_destroy(&attr);
+    return stat;
+#endif
+}
+
+static void
+mutex_destroy(NC_mutex* mp)
+{
+#ifdef _WIN32
+    DeleteCriticalSection(&mp->cs);
+#else
+    pthread_mutex_destroy(&mp->m);
+#endif
+}
+
+static void
+mutex_lock(NC_mutex* mp)
+{
+#ifdef _WIN32
+    EnterCriticalSection(&mp->cs);
+#else
+    pthread_mutex_lock(&mp->m);
+#endif
+}
+
+static void
+mutex_unlock(NC_mutex* mp)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(&mp->cs);
+#else
+    pthread_mutex_unlock(&mp->m);
+#endif
+}
+
+/* Once-only initialization of the global lock and the locking tables */
+static void
+initonce(void)
+{
+    if(mutex_init(&global_lock)) abort(); /* nothing sensible to do */
+    buildtables();
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK
+initonce_win(PINIT_ONCE o, PVOID p, PVOID* ctx)
+{
+    initonce();
+    return TRUE;
+}
+#define ONCE() InitOnceExecuteOnce(&once,initonce_win,NULL,NULL)
+#else
+#define ONCE() pthread_once(&once,initonce)
+#endif
+
+void
+NC_lock_global(void)
+{
+    ONCE();
+    mutex_lock(&global_lock);
+}
+
+void
+NC_unlock_global(void)
+{
+    mutex_unlock(&global_lock);
+}
+
+void
+NC_rdlock_filelist(void)
+{
+#ifdef _WIN32
+    AcquireSRWLockShared(&filelist_lock);
+#else
+    pthread_rwlock_rdlock(&filelist_lock);
+#endif
+}
+
+void
+NC_wrlock_filelist(void)
+{
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&filelist_lock);
+    filelist_exclusive = 1;
+#else
+    pthread_rwlock_wrlock(&filelist_lock);
+#endif
+}
+
+void
+NC_unlock_filelist(void)
+{
+#ifdef _WIN32
+    if(filelist_exclusive) {
+        filelist_exclusive = 0;
+        ReleaseSRWLockExclusive(&filelist_lock);
+    } else
+        ReleaseSRWLockShared(&filelist_lock);
+#else
+    pthread_rwlock_unlock(&filelist_lock);
+#endif
+}
+
+/**
+ * @internal Give a newly allocated NC its lock and substitute the
+ * locking dispatch table for ncp->dispatch.
+ *
+ * @param ncp Pointer to NC whose dispatch field has been set.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ */
+int
+NC_lock_init(NC* ncp)
+{
+    const NC_Dispatch* table = ncp->dispatch;
+
+    ONCE();
+    if(table == NULL) return NC_NOERR; /* nothing to lock */
+    if(table->model < 0 || table->model >= NMODELS)
+        return NC_EINVAL;
+    /* A classic file opened read-only with NC_CONCURRENT has an
+       immutable header and a pread based ncio, so it needs no lock */
+    if(table->model == NC_FORMATX_NC3
+       && (ncp->mode & NC_CONCURRENT) && !(ncp->mode & NC_WRITE))
+        return NC_NOERR;
+    if(table->model == NC_FORMATX_NC3) {
+        NC_mutex* lock = (NC_mutex*)calloc(1,sizeof(NC_mutex));
+        if(lock == NULL) return NC_ENOMEM;
+        if(mutex_init(lock)) {free(lock); return NC_ENOMEM;}
+        ncp->lock = lock;
+    } else
+        ncp->lock = &global_lock;
+    ncp->unlocked = table;
+    ncp->dispatch = &locked_tables[table->model];
+    return NC_NOERR;
+}
+
+/**
+ * @internal Release the lock given to an NC by NC_lock_init().
+ *
+ * @param ncp Pointer to NC.
+ */
+void
+NC_lock_final(NC* ncp)
+{
+    if(ncp->lock != NULL && ncp->lock != &global_lock) {
+        mutex_destroy(ncp->lock);
+        free(ncp->lock);
+    }
+    ncp->lock = NULL;
+}
+
+/**
+ * @internal Lock the files of a call that works on two files at
+ * once, such as nc_copy_data_raw(). The locks are taken in address
+ * order so that two such calls can not deadlock; files without a
+ * lock and a lock shared by both files are handled.
+ *
+ * @param ncp1 First file.
+ * @param ncp2 Second file.
+ */
+void
+NC_lock_pair(NC* ncp1, NC* ncp2)
+{
+    NC_mutex* l1 = ncp1->lock;
+    NC_mutex* l2 = ncp2->lock;
+    if(l1 == l2) l2 = NULL;
+    if(l1 != NULL && l2 != NULL && l2 < l1)
+        {NC_mutex* t = l1; l1 = l2; l2 = t;}
+    if(l1 != NULL) mutex_lock(l1);
+    if(l2 != NULL) mutex_lock(l2);
+}
+
+/**
+ * @internal Release the locks taken by NC_lock_pair().
+ *
+ * @param ncp1 First file.
+ * @param ncp2 Second file.
+ */
+void
+NC_unlock_pair(NC* ncp1, NC* ncp2)
+{
+    if(ncp2->lock != NULL && ncp2->lock != ncp1->lock)
+        mutex_unlock(ncp2->lock);
+    if(ncp1->lock != NULL)
+        mutex_unlock(ncp1->lock);
+}
+
+/**************************************************/
+/* The locking dispatch functions */
+
+/* Find and lock the file for ncid */
+static int
+lockfile(int ncid, NC** ncpp)
+{
+    int stat = NC_check_id(ncid,ncpp);
+    if(stat == NC_NOERR)
+        mutex_lock((*ncpp)->lock);
+    return stat;
+}
+
+#define LOCKED(ncid,call) \
+{ \
+    NC* ncp; \
+    int stat; \
+    if((stat = lockfile((ncid),&ncp))) return stat; \
+    stat = ncp->unlocked->call; \
+    mutex_unlock(ncp->lock); \
+    return stat; \
+}
+
+static int
+NCL_redef(int ncid)
+LOCKED(ncid,redef(ncid))
+
+static int
+NCL__enddef(int ncid, size_t h_minfree, size_t v_align, size_t v_minfree, size_t r_align)
+LOCKED(ncid,_enddef(ncid,h_minfree,v_align,v_minfree,r_align))
+
+static int
+NCL_sync(int ncid)
+LOCKED(ncid,sync(ncid))
+
+static int
+NCL_abort(int ncid)
+LOCKED(ncid,abort(ncid))
+
+static int
+NCL_close(int ncid, void* params)
+LOCKED(ncid,close(ncid,params))
+
+static int
+NCL_set_fill(int ncid, int fillmode, int* old_modep)
+LOCKED(ncid,set_fill(ncid,fillmode,old_modep))
+
+static int
+NCL_inq_format(int ncid, int* formatp)
+LOCKED(ncid,inq_format(ncid,formatp))
+
+static int
+NCL_inq_format_extended(int ncid, int* formatp, int* modep)
+LOCKED(ncid,inq_format_extended(ncid,formatp,modep))
+
+static int
+NCL_inq(int ncid, int* ndimsp, int* nvarsp, int* nattsp, int* unlimdimidp)
+LOCKED(ncid,inq(ncid,ndimsp,nvarsp,nattsp,unlimdimidp))
+
+static int
+NCL_inq_type(int ncid, nc_type xtype, char* name, size_t* sizep)
+LOCKED(ncid,inq_type(ncid,xtype,name,sizep))
+
+static int
+NCL_def_dim(int ncid, const char* name, size_t len, int* idp)
+LOCKED(ncid,def_dim(ncid,name,len,idp))
+
+static int
+NCL_inq_dimid(int ncid, const char* name, int* idp)
+LOCKED(ncid,inq_dimid(ncid,name,idp))
+
+static int
+NCL_inq_dim(int ncid, int dimid, char* name, size_t* lenp)
+LOCKED(ncid,inq_dim(ncid,dimid,name,lenp))
+
+static int
+NCL_inq_unlimdim(int ncid, int* unlimdimidp)
+LOCKED(ncid,inq_unlimdim(ncid,unlimdimidp))
+
+static int
+NCL_rename_dim(int ncid, int dimid, const char* name)
+LOCKED(ncid,rename_dim(ncid,dimid,name))
+
+static int
+NCL_inq_att(int ncid, int varid, const char* name, nc_type* xtypep, size_t* lenp)
+LOCKED(ncid,inq_att(ncid,varid,name,xtypep,lenp))
+
+static int
+NCL_inq_attid(int ncid, int varid, const char* name, int* idp)
+LOCKED(ncid,inq_attid(ncid,varid,name,idp))
+
+static int
+NCL_inq_attname(int ncid, int varid, int attnum, char* name)
+LOCKED(ncid,inq_attname(ncid,varid,attnum,name))
+
+static int
+NCL_rename_att(int ncid, int varid, const char* name, const char* newname)
+LOCKED(ncid,rename_att(ncid,varid,name,newname))
+
+static int
+NCL_del_att(int ncid, int varid, const char* name)
+LOCKED(ncid,del_att(ncid,varid,name))
+
+static int
+NCL_get_att(int ncid, int varid, const char* name, void* value, nc_type memtype)
+LOCKED(ncid,get_att(ncid,varid,name,value,memtype))
+
+static int
+NCL_put_att(int ncid, int varid, const char* name, nc_type xtype, size_t len, const void* value, nc_type memtype)
+LOCKED(ncid,put_att(ncid,varid,name,xtype,len,value,memtype))
+
+static int
+NCL_def_var(int ncid, const char* name, nc_type xtype, int ndims, const int* dimidsp, int* varidp)
+LOCKED(ncid,def_var(ncid,name,xtype,ndims,dimidsp,varidp))
+
+static int
+NCL_inq_varid(int ncid, const char* name, int* varidp)
+LOCKED(ncid,inq_varid(ncid,name,varidp))
+
+static int
+NCL_rename_var(int ncid, int varid, const char* name)
+LOCKED(ncid,rename_var(ncid,varid,name))
+
+static int
+NCL_get_vara(int ncid, int varid, const size_t* start, const size_t* count, void* value, nc_type memtype)
+LOCKED(ncid,get_vara(ncid,varid,start,count,value,memtype))
+
+static int
+NCL_put_vara(int ncid, int varid, const size_t* start, const size_t* count, const void* value, nc_type memtype)
+LOCKED(ncid,put_vara(ncid,varid,start,count,value,memtype))
+
+static int
+NCL_get_vars(int ncid, int varid, const size_t* start, const size_t* count, const ptrdiff_t* stride, void* value, nc_type memtype)
+LOCKED(ncid,get_vars(ncid,varid,start,count,stride,value,memtype))
+
+static int
+NCL_put_vars(int ncid, int varid, const size_t* start, const size_t* count, const ptrdiff_t* stride, const void* value, nc_type memtype)
+LOCKED(ncid,put_vars(ncid,varid,start,count,stride,value,memtype))
+
+static int
+NCL_get_varm(int ncid, int varid, const size_t* start, const size_t* count, const ptrdiff_t* stride, const ptrdiff_t* imap, void* value, nc_type memtype)
+LOCKED(ncid,get_varm(ncid,varid,start,count,stride,imap,value,memtype))
+
+static int
+NCL_put_varm(int ncid, int varid, const size_t* start, const size_t* count, const ptrdiff_t* stride, const ptrdiff_t* imap, const void* value, nc_type memtype)
+LOCKED(ncid,put_varm(ncid,varid,start,count,stride,imap,value,memtype))
+
+static int
+NCL_inq_var_all(int ncid, int varid, char* name, nc_type* xtypep, int* ndimsp, int* dimidsp, int* nattsp, int* shufflep, int* deflatep, int* deflate_levelp, int* fletcher32p, int* contiguousp, size_t* chunksizesp, int* no_fill, void* fill_valuep, int* endiannessp, unsigned int* idp, size_t* nparamsp, unsigned int* params)
+LOCKED(ncid,inq_var_all(ncid,varid,name,xtypep,ndimsp,dimidsp,nattsp,shufflep,deflatep,deflate_levelp,fletcher32p,contiguousp,chunksizesp,no_fill,fill_valuep,endiannessp,idp,nparamsp,params))
+
+static int
+NCL_var_par_access(int ncid, int varid, int par_access)
+LOCKED(ncid,var_par_access(ncid,varid,par_access))
+
+static int
+NCL_def_var_fill(int ncid, int varid, int no_fill, const void* fill_value)
+LOCKED(ncid,def_var_fill(ncid,varid,no_fill,fill_value))
+
+static int
+NCL_show_metadata(int ncid)
+LOCKED(ncid,show_metadata(ncid))
+
+static int
+NCL_inq_unlimdims(int ncid, int* nunlimdimsp, int* unlimdimidsp)
+LOCKED(ncid,inq_unlimdims(ncid,nunlimdimsp,unlimdimidsp))
+
+static int
+NCL_inq_ncid(int ncid, const char* name, int* grp_ncid)
+LOCKED(ncid,inq_ncid(ncid,name,grp_ncid))
+
+static int
+NCL_inq_grps(int ncid, int* numgrps, int* ncids)
+LOCKED(ncid,inq_grps(ncid,numgrps,ncids))
+
+static int
+NCL_inq_grpname(int ncid, char* name)
+LOCKED(ncid,inq_grpname(ncid,name))
+
+static int
+NCL_inq_grpname_full(int ncid, size_t* lenp, char* full_name)
+LOCKED(ncid,inq_grpname_full(ncid,lenp,full_name))
+
+static int
+NCL_inq_grp_parent(int ncid, int* parent_ncid)
+LOCKED(ncid,inq_grp_parent(ncid,parent_ncid))
+
+static int
+NCL_inq_grp_full_ncid(int ncid, const char* full_name, int* grp_ncid)
+LOCKED(ncid,inq_grp_full_ncid(ncid,full_name,grp_ncid))
+
+static int
+NCL_inq_varids(int ncid, int* nvars, int* varids)
+LOCKED(ncid,inq_varids(ncid,nvars,varids))
+
+static int
+NCL_inq_dimids(int ncid, int* ndims, int* dimids, int include_parents)
+LOCKED(ncid,inq_dimids(ncid,ndims,dimids,include_parents))
+
+static int
+NCL_inq_typeids(int ncid, int* ntypes, int* typeids)
+LOCKED(ncid,inq_typeids(ncid,ntypes,typeids))
+
+static int
+NCL_inq_type_equal(int ncid1, nc_type typeid1, int ncid2, nc_type typeid2, int* equal)
+LOCKED(ncid1,inq_type_equal(ncid1,typeid1,ncid2,typeid2,equal))
+
+static int
+NCL_def_grp(int parent_ncid, const char* name, int* new_ncid)
+LOCKED(parent_ncid,def_grp(parent_ncid,name,new_ncid))
+
+static int
+NCL_rename_grp(int grpid, const char* name)
+LOCKED(grpid,rename_grp(grpid,name))
+
+static int
+NCL_inq_user_type(int ncid, nc_type xtype, char* name, size_t* size, nc_type* base_nc_typep, size_t* nfieldsp, int* classp)
+LOCKED(ncid,inq_user_type(ncid,xtype,name,size,base_nc_typep,nfieldsp,classp))
+
+static int
+NCL_inq_typeid(int ncid, const char* name, nc_type* typeidp)
+LOCKED(ncid,inq_typeid(ncid,name,typeidp))
+
+static int
+NCL_def_compound(int ncid, size_t size, const char* name, nc_type* typeidp)
+LOCKED(ncid,def_compound(ncid,size,name,typeidp))
+
+static int
+NCL_insert_compound(int ncid, nc_type xtype, const char* name, size_t offset, nc_type field_typeid)
+LOCKED(ncid,insert_compound(ncid,xtype,name,offset,field_typeid))
+
+static int
+NCL_insert_array_compound(int ncid, nc_type xtype, const char* name, size_t offset, nc_type field_typeid, int ndims, const int* dim_sizes)
+LOCKED(ncid,insert_array_compound(ncid,xtype,name,offset,field_typeid,ndims,dim_sizes))
+
+static int
+NCL_inq_compound_field(int ncid, nc_type xtype, int fieldid, char* name, size_t* offsetp, nc_type* field_typeidp, int* ndimsp, int* dim_sizesp)
+LOCKED(ncid,inq_compound_field(ncid,xtype,fieldid,name,offsetp,field_typeidp,ndimsp,dim_sizesp))
+
+static int
+NCL_inq_compound_fieldindex(int ncid, nc_type xtype, const char* name, int* fieldidp)
+LOCKED(ncid,inq_compound_fieldindex(ncid,xtype,name,fieldidp))
+
+static int
+NCL_def_vlen(int ncid, const char* name, nc_type base_typeid, nc_type* xtypep)
+LOCKED(ncid,def_vlen(ncid,name,base_typeid,xtypep))
+
+static int
+NCL_put_vlen_element(int ncid, int typeid1, void* vlen_element, size_t len, const void* data)
+LOCKED(ncid,put_vlen_element(ncid,typeid1,vlen_element,len,data))
+
+static int
+NCL_get_vlen_element(int ncid, int typeid1, const void* vlen_element, size_t* len, void* data)
+LOCKED(ncid,get_vlen_element(ncid,typeid1,vlen_element,len,data))
+
+static int
+NCL_def_enum(int ncid, nc_type base_typeid, const char* name, nc_type* typeidp)
+LOCKED(ncid,def_enum(ncid,base_typeid,name,typeidp))
+
+static int
+NCL_insert_enum(int ncid, nc_type xtype, const char* name, const void* value)
+LOCKED(ncid,insert_enum(ncid,xtype,name,value))
+
+static int
+NCL_inq_enum_member(int ncid, nc_type xtype, int idx, char* name, void* value)
+LOCKED(ncid,inq_enum_member(ncid,xtype,idx,name,value))
+
+static int
+NCL_inq_enum_ident(int ncid, nc_type xtype, long long value, char* identifier)
+LOCKED(ncid,inq_enum_ident(ncid,xtype,value,identifier))
+
+static int
+NCL_def_opaque(int ncid, size_t size, const char* name, nc_type* xtypep)
+LOCKED(ncid,def_opaque(ncid,size,name,xtypep))
+
+static int
+NCL_def_var_deflate(int ncid, int varid, int shuffle, int deflate, int deflate_level)
+LOCKED(ncid,def_var_deflate(ncid,varid,shuffle,deflate,deflate_level))
+
+static int
+NCL_def_var_fletcher32(int ncid, int varid, int fletcher32)
+LOCKED(ncid,def_var_fletcher32(ncid,varid,fletcher32))
+
+static int
+NCL_def_var_chunking(int ncid, int varid, int storage, const size_t* chunksizesp)
+LOCKED(ncid,def_var_chunking(ncid,varid,storage,chunksizesp))
+
+static int
+NCL_def_var_endian(int ncid, int varid, int endianness)
+LOCKED(ncid,def_var_endian(ncid,varid,endianness))
+
+static int
+NCL_def_var_filter(int ncid, int varid, unsigned int id, size_t nparams, const unsigned int* parms)
+LOCKED(ncid,def_var_filter(ncid,varid,id,nparams,parms))
+
+static int
+NCL_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems, float preemption)
+LOCKED(ncid,set_var_chunk_cache(ncid,varid,size,nelems,preemption))
+
+static int
+NCL_get_var_chunk_cache(int ncid, int varid, size_t* sizep, size_t* nelemsp, float* preemptionp)
+LOCKED(ncid,get_var_chunk_cache(ncid,varid,sizep,nelemsp,preemptionp))
+
+static int
+NCL_filter_actions(int ncid, int varid, int action, struct NC_Filterobject* spec)
+LOCKED(ncid,filter_actions(ncid,varid,action,spec))
+
+/* The locking dispatch table template; model is filled in per table */
+static const NC_Dispatch NCL_dispatcher = {
+
+NC_FORMATX_UNDEFINED,
+NC_DISPATCH_VERSION,
+
+NULL, /* create: not locked, see NC_create() */
+NULL, /* open: not locked, see NC_open() */
+
+NCL_redef,
+NCL__enddef,
+NCL_sync,
+NCL_abort,
+NCL_close,
+NCL_set_fill,
+NCL_inq_format,
+NCL_inq_format_extended,
+NCL_inq,
+NCL_inq_type,
+NCL_def_dim,
+NCL_inq_dimid,
+NCL_inq_dim,
+NCL_inq_unlimdim,
+NCL_rename_dim,
+NCL_inq_att,
+NCL_inq_attid,
+NCL_inq_attname,
+NCL_rename_att,
+NCL_del_att,
+NCL_get_att,
+NCL_put_att,
+NCL_def_var,
+NCL_inq_varid,
+NCL_rename_var,
+NCL_get_vara,
+NCL_put_vara,
+NCL_get_vars,
+NCL_put_vars,
+NCL_get_varm,
+NCL_put_varm,
+NCL_inq_var_all,
+NCL_var_par_access,
+NCL_def_var_fill,
+NCL_show_metadata,
+NCL_inq_unlimdims,
+NCL_inq_ncid,
+NCL_inq_grps,
+NCL_inq_grpname,
+NCL_inq_grpname_full,
+NCL_inq_grp_parent,
+NCL_inq_grp_full_ncid,
+NCL_inq_varids,
+NCL_inq_dimids,
+NCL_inq_typeids,
+NCL_inq_type_equal,
+NCL_def_grp,
+NCL_rename_grp,
+NCL_inq_user_type,
+NCL_inq_typeid,
+NCL_def_compound,
+NCL_insert_compound,
+NCL_insert_array_compound,
+NCL_inq_compound_field,
+NCL_inq_compound_fieldindex,
+NCL_def_vlen,
+NCL_put_vlen_element,
+NCL_get_vlen_element,
+NCL_def_enum,
+NCL_insert_enum,
+NCL_inq_enum_member,
+NCL_inq_enum_ident,
+NCL_def_opaque,
+NCL_def_var_deflate,
+NCL_def_var_fletcher32,
+NCL_def_var_chunking,
+NCL_def_var_endian,
+NCL_def_var_filter,
+NCL_set_var_chunk_cache,
+NCL_get_var_chunk_cache,
+NCL_filter_actions,
+};
+
+static void
+buildtables(void)
+{
+    int i;
+    for(i=0;i<NMODELS;i++) {
+        locked_tables[i] = NCL_dispatcher;
+        locked_tables[i].model = i;
+    }
+}
+
+#endif /*ENABLE_THREADSAFE*/
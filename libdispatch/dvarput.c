@@ -6,76 +6,7 @@ Research/Unidata. See COPYRIGHT file for more info.
 */
 
 #include "ncdispatch.h"
-
-struct PUTodometer {
-    int            rank;
-    size_t         index[NC_MAX_VAR_DIMS];
-    size_t         start[NC_MAX_VAR_DIMS];
-    size_t         edges[NC_MAX_VAR_DIMS];
-    ptrdiff_t      stride[NC_MAX_VAR_DIMS];
-    size_t         stop[NC_MAX_VAR_DIMS];
-};
-
-/**
- * @internal Initialize odometer.
- *
- * @param odom Pointer to odometer.
- * @param rank
- * @param start Start indices.
- * @param edges Counts.
- * @param stride Strides.
- *
- */
-static void
-odom_init(struct PUTodometer* odom, int rank, const size_t* start,
-          const size_t* edges, const ptrdiff_t* stride)
-{
-    int i;
-    memset(odom,0,sizeof(struct PUTodometer));
-    odom->rank = rank;
-    assert(odom->rank <= NC_MAX_VAR_DIMS);
-    for(i=0;i<odom->rank;i++) {
-	odom->start[i] = (start != NULL ? start[i] : 0);
-	odom->edges[i] = (edges != NULL ? edges[i] : 1);
-	odom->stride[i] = (stride != NULL ? stride[i] : 1);
-	odom->stop[i] = odom->start[i] + (odom->edges[i]*(size_t)odom->stride[i]);
-	odom->index[i] = odom->start[i];
-    }
-}
-
-/**
- * @internal Return true if there is more.
- *
- * @param odom Pointer to odometer.
- *
- * @return True if there is more, 0 otherwise.
- */
-static int
-odom_more(struct PUTodometer* odom)
-{
-    return (odom->index[0] < odom->stop[0]);
-}
-
-/**
- * @internal Return true if there is more.
- *
- * @param odom Pointer to odometer.
- *
- * @return True if there is more, 0 otherwise.
- */
-static int
-odom_next(struct PUTodometer* odom)
-{
-    int i;
-    if(odom->rank == 0) return 0;
-    for(i=odom->rank-1;i>=0;i--) {
-        odom->index[i] += (size_t)odom->stride[i];
-        if(odom->index[i] < odom->stop[i]) break;
-	if(i == 0) return 0; /* leave the 0th entry if it overflows*/
-	odom->index[i] = odom->start[i]; /* reset this position*/
-    }
-    return 1;
-}
+#include "ncodom.h"
 
 /** \internal
 \ingroup variables
@@ -137,7 +68,7 @@ NCDEFAULT_put_vars(int ncid, int varid, const size_t * start,
    int status = NC_NOERR;
    int i,isstride1,isrecvar;
    int rank;
-   struct PUTodometer odom;
+   NCodometer odom;
    nc_type vartype = NC_NAT;
    NC* ncp;
    size_t vartypelen;
@@ -267,19 +198,15 @@ NCDEFAULT_put_vars(int ncid, int varid, const size_t * start,
       return NC_NOERR; /* cannot write anything */
    }
 	   
-   /* Initial version uses and odometer to walk the variable
-      and read each value one at a time. This can later be optimized
-      to read larger chunks at a time.
-    */
-
-
-   odom_init(&odom,rank,mystart,myedges,mystride);
+   /* Walk the selection one unit stride box at a time, so that
+      only the dimensions with stride > 1 cost a call each. */
+   status = NC_odom_init(&odom,rank,varshape,mystart,myedges,mystride,NULL,NC_ODOM_BOX);
+   if(status != NC_NOERR) return status;
 
-   /* walk the odometer to extract values */
-   while(odom_more(&odom)) {
+   for(;NC_odom_more(&odom);NC_odom_next(&odom)) {
       int localstatus = NC_NOERR;
-      /* Write a single value */
-      localstatus = NC_put_vara(ncid,varid,odom.index,NC_coord_one,memptr,memtype);
+      /* Write one box of values */
+      localstatus = NC_put_vara(ncid,varid,odom.index,odom.runedges,memptr,memtype);
       /* So it turns out that when get_varm is used, all errors are
          delayed and ERANGE will be overwritten by more serious errors.
       */
@@ -287,9 +214,9 @@ NCDEFAULT_put_vars(int ncid, int varid, const size_t * start,
 	    if(status == NC_NOERR || localstatus != NC_ERANGE)
 	       status = localstatus;
       }
-      memptr += memtypelen;
-      odom_next(&odom);
+      memptr += odom.runlen * (size_t)memtypelen;
    }
+   NC_odom_free(&odom);
    return status;
 }
 
@@ -365,11 +292,18 @@ NCDEFAULT_put_varm(
       int idim;
       size_t *mystart = NULL;
       size_t *myedges = 0;
-      size_t *iocount= 0;    /* count vector */
-      size_t *stop = 0;   /* stop indexes */
-      size_t *length = 0; /* edge lengths in bytes */
+      size_t *bstart;  /* start of the current block */
+      size_t *bedges;  /* edges of the current block */
+      size_t *bpos;    /* position of the block within the selection */
       ptrdiff_t *mystride = 0;
       ptrdiff_t *mymap= 0;
+      ptrdiff_t packedmap = 1; /* the map for a row-major layout */
+      int packed;    /* is mymap the row-major layout? */
+      int split;     /* dimensions from split in are whole in a block */
+      size_t inner;  /* bytes in one index of dimension split-1 */
+      size_t blocklen; /* indices of dimension split-1 in a block */
+      void *block = NULL; /* staging buffer */
+      NCodometer odom;
       size_t varshape[NC_MAX_VAR_DIMS];
       int isrecvar;
       size_t numrecs;
@@ -405,11 +339,12 @@ NCDEFAULT_put_varm(
       /* assert(sizeof(ptrdiff_t) >= sizeof(size_t)); */
       mystart = (size_t *)calloc((size_t)(varndims * 7), sizeof(ptrdiff_t));
       if(mystart == NULL) return NC_ENOMEM;
+      odom.space = NULL; /* so that cleanup is safe */
       myedges = mystart + varndims;
-      iocount = myedges + varndims;
-      stop = iocount + varndims;
-      length = stop + varndims;
-      mystride = (ptrdiff_t *)(length + varndims);
+      bstart = myedges + varndims;
+      bedges = bstart + varndims;
+      bpos = bedges + varndims;
+      mystride = (ptrdiff_t *)(bpos + varndims);
       mymap = mystride + varndims;
 
       /*
@@ -447,9 +382,10 @@ NCDEFAULT_put_varm(
       /*
        * Initialize I/O parameters.
        */
+      packed = 1;
       for (idim = maxidim; idim >= 0; --idim)
       {
-	 if (edges != NULL && edges[idim] == 0)
+	 if (myedges[idim] == 0)
 	 {
 	    status = NC_NOERR;    /* read/write no data */
 	    goto done;
@@ -458,66 +394,93 @@ NCDEFAULT_put_varm(
 	 mystride[idim] = stride != NULL
 	    ? stride[idim]
 	    : 1;
+
+	 /* Remember: in netCDF-2 imapp is byte oriented, not index oriented
+	  *           Starting from netCDF-3, imapp is index oriented */
+	 if (idim == maxidim)
+	    packedmap = 1;
+	 else
+	    packedmap *= (ptrdiff_t) myedges[idim + 1];
 	 mymap[idim] = imapp != NULL
 	    ? imapp[idim]
-	    : idim == maxidim
-	        ? 1
-	        : mymap[idim + 1] * (ptrdiff_t) myedges[idim + 1];
-
-	 iocount[idim] = 1;
-	 length[idim] = ((size_t)mymap[idim]) * myedges[idim];
-	 stop[idim] = mystart[idim] + myedges[idim] * (size_t)mystride[idim];
+	    : packedmap;
+	 if (myedges[idim] > 1 && mymap[idim] != packedmap)
+	    packed = 0;
       }
 
-      /* Lower body */
       /*
-       * As an optimization, adjust I/O parameters when the fastest
-       * dimension has unity stride both externally and internally.
-       * In this case, the user could have called a simpler routine
-       * (i.e. ncvar$1()
+       * A map that describes the row-major layout needs no staging
+       * at all; this is just a vars call.
        */
-      if (mystride[maxidim] == 1
-	  && mymap[maxidim] == 1)
+      if (packed)
       {
-	 iocount[maxidim] = myedges[maxidim];
-	 mystride[maxidim] = (ptrdiff_t) myedges[maxidim];
-	 mymap[maxidim] = (ptrdiff_t) length[maxidim];
+	 status = ncp->dispatch->put_vars(ncid, varid, mystart, myedges,
+					  mystride, value, memtype);
+	 goto done;
       }
 
       /*
-       * Perform I/O.  Exit when done.
+       * Otherwise move the selection through a staging buffer of at
+       * most NC_VARM_BLOCKSIZE bytes: each block is a few large
+       * contiguous vars transfers, and the copy between the block
+       * and the user's layout is done in cache sized tiles. A block
+       * is made of whole trailing dimensions from split in, plus
+       * blocklen indices of dimension split-1.
        */
-      for (;;)
+      inner = (size_t)memtypelen;
+      split = varndims;
+      while (split > 0 && inner * myedges[split - 1] <= NC_VARM_BLOCKSIZE)
+	 inner *= myedges[--split];
+      blocklen = (split > 0 ? NC_VARM_BLOCKSIZE / inner : 1);
+      block = malloc(inner * blocklen);
+      if (block == NULL)
       {
-	 /* TODO: */
-	 int lstatus = NC_put_vara(ncid, varid, mystart, iocount,
-				   value, memtype);
-	 if (lstatus != NC_NOERR) {
-	    if(status == NC_NOERR || lstatus != NC_ERANGE)
-	       status = lstatus;
-	 }
-
-	 /*
-	  * The following code permutes through the variable s
-	  * external start-index space and it s internal address
-	  * space.  At the UPC, this algorithm is commonly
-	  * called "odometer code".
-	  */
-	 idim = maxidim;
-        carry:
-	 value += (mymap[idim] * memtypelen);
-	 mystart[idim] += (size_t)mystride[idim];
-	 if (mystart[idim] == stop[idim])
+	 status = NC_ENOMEM;
+	 goto done;
+      }
+      for (idim = 0; idim < varndims; idim++)
+      {
+	 bpos[idim] = 0;
+	 bedges[idim] = (idim >= split ? myedges[idim] : 1);
+      }
+      if (split > 0)
+	 bedges[split - 1] = blocklen;
+      /* Count the blocks along each dimension; bstart is not needed
+	 until the walk begins */
+      for (idim = 0; idim < split; idim++)
+	 bstart[idim] = (myedges[idim] + bedges[idim] - 1) / bedges[idim];
+      status = NC_odom_init(&odom, split, NULL, NULL, bstart, NULL, NULL,
+			    NC_ODOM_ELEMENTS);
+      if (status != NC_NOERR)
+	 goto done;
+
+      for (;NC_odom_more(&odom);NC_odom_next(&odom))
+      {
+	 int lstatus;
+	 const char* src = value;
+	 for (idim = 0; idim < varndims; idim++)
 	 {
-	    size_t l = (length[idim] * (size_t)memtypelen);
-	    value -= l;
-	    mystart[idim] = start[idim];
-	    if (--idim < 0)
-	       break; /* normal return */
-	    goto carry;
+	    if (idim < split)
+	       bpos[idim] = odom.index[idim] * (idim == split - 1 ? blocklen : 1);
+	    if (idim == split - 1)
+	       bedges[idim] = (myedges[idim] - bpos[idim] < blocklen
+			       ? myedges[idim] - bpos[idim] : blocklen);
+	    bstart[idim] = mystart[idim] + bpos[idim] * (size_t)mystride[idim];
+	    src += (ptrdiff_t)bpos[idim] * mymap[idim] * memtypelen;
 	 }
-      } /* I/O loop */
+	 lstatus = NC_odom_gather(src, block, varndims, bedges, mymap,
+				  (size_t)memtypelen);
+	 if (lstatus != NC_NOERR) {status = lstatus; goto done;}
+	 lstatus = ncp->dispatch->put_vars(ncid, varid, bstart, bedges, mystride,
+					   block, memtype);
+	 if (lstatus != NC_NOERR) {
+	    if(lstatus != NC_ERANGE) {status = lstatus; goto done;}
+	    status = lstatus;
+	 }
+      }
      done:
+      NC_odom_free(&odom);
+      if (block != NULL) free(block);
       free(mystart);
    } /* variable is array */
    return status;
@@ -20,6 +20,7 @@
 #include <unistd.h>
 #endif
 #include "ncdispatch.h"
+#include "ncmemimage.h"
 
 /** This is the default create format for nc_create and nc__create. */
 static int default_create_format = NC_FORMAT_CLASSIC;
@@ -59,6 +60,10 @@ free_NC(NC *ncp)
         return;
     if(ncp->path)
         free(ncp->path);
+    NC_memimage_release(ncp->image);
+#ifdef ENABLE_THREADSAFE
+    NC_lock_final(ncp);
+#endif
     /* We assume caller has already cleaned up ncp->dispatchdata */
     free(ncp);
 }
@@ -86,10 +91,20 @@ new_NC(const NC_Dispatch* dispatcher, const char* path, int mode, NC** ncpp)
     ncp->dispatch = dispatcher;
     ncp->path = nulldup(path);
     ncp->mode = mode;
+    ncp->perf.mdc_hit_rate = -1;
     if(ncp->path == NULL) { /* fail */
         free_NC(ncp);
         return NC_ENOMEM;
     }
+#ifdef ENABLE_THREADSAFE
+    {
+        int stat;
+        if((stat = NC_lock_init(ncp))) {
+            free_NC(ncp);
+            return stat;
+        }
+    }
+#endif
     if(ncpp) {
         *ncpp = ncp;
     } else {
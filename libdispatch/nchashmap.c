@@ -32,9 +32,6 @@ entry. Since we also keep the hashkey, the probability is high that
 we will only do string comparisons when they will match.
 */
 
-/* Prototype for the crc32 function */
-extern unsigned int NC_crc32(unsigned int crc, const unsigned char* buf, unsigned int len);
-
 #undef SMALLTABLE
 
 #ifdef ASSERTIONS
@@ -155,11 +152,12 @@ locate(NC_hashmap* hash, unsigned int hashkey, const char* key, size_t keysize,
 }
 
 /* Return the hash key for specified key; takes key+size*/
-/* Wrapper for crc32 */
+/* Keys are mostly short object names, for which Jenkins' lookup3
+   hash (word at a time, no table lookups) beats a table driven crc32. */
 unsigned int
 NC_hashmapkey(const char* key, size_t size)
 {
-    return NC_crc32(0,(unsigned char*)key,(unsigned int)size);
+    return hash_fast(key,size);
 }
 
 NC_hashmap*
@@ -194,7 +192,7 @@ NC_hashmapadd(NC_hashmap* hash, uintptr_t data, const char* key, size_t keysize)
 
     if(key == NULL || keysize == 0)
       return 0;
-    hashkey = NC_crc32(0,(unsigned char*)key,(unsigned int)keysize);
+    hashkey = NC_hashmapkey(key,keysize);
 
     if(hash->alloc*3/4 <= hash->active)
 	rehash(hash);
@@ -238,7 +236,7 @@ NC_hashmapremove(NC_hashmap* hash, const char* key, size_t keysize, uintptr_t* d
     if(key == NULL || keysize == 0)
 	return 0;
 
-    hashkey = NC_crc32(0,(unsigned char*)key,(unsigned int)keysize);
+    hashkey = NC_hashmapkey(key,keysize);
     if(!locate(hash,hashkey,key,keysize,&index,0))
 	return 0; /* not present */
     h = &hash->table[index];
@@ -263,7 +261,7 @@ NC_hashmapget(NC_hashmap* hash, const char* key, size_t keysize, uintptr_t* data
 
     if(key == NULL || keysize == 0)
 	return 0;
-    hashkey = NC_crc32(0,(unsigned char*)key,(unsigned int)keysize);
+    hashkey = NC_hashmapkey(key,keysize);
     if(hash->active) {
       size_t index;
       NC_hentry* h;
@@ -293,7 +291,7 @@ NC_hashmapsetdata(NC_hashmap* hash, const char* key, size_t keysize, uintptr_t n
 
     if(key == NULL || keysize == 0)
 	return 0;
-    hashkey = NC_crc32(0,(unsigned char*)key,(unsigned int)keysize);
+    hashkey = NC_hashmapkey(key,keysize);
     if(hash == NULL || hash->active == 0)
 	return 0; /* no such entry */
     if(!locate(hash,hashkey,key,keysize,&index,0))
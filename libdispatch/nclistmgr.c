@@ -42,7 +42,20 @@ static int numfiles = 0;
 int
 count_NCList(void)
 {
-    return numfiles;
+    int count;
+    NCRDLOCKLIST();
+    count = numfiles;
+    NCUNLOCKLIST();
+    return count;
+}
+
+/* Free the list; caller must hold the list lock for writing. */
+static void
+freelist(void)
+{
+    if(numfiles > 0) return; /* not empty */
+    if(nc_filelist != NULL) free(nc_filelist);
+    nc_filelist = NULL;
 }
 
 /**
@@ -54,9 +67,9 @@ count_NCList(void)
 void
 free_NCList(void)
 {
-    if(numfiles > 0) return; /* not empty */
-    if(nc_filelist != NULL) free(nc_filelist);
-    nc_filelist = NULL;
+    NCWRLOCKLIST();
+    freelist();
+    NCUNLOCKLIST();
 }
 
 /**
@@ -83,9 +96,12 @@ add_to_NCList(NC* ncp)
 {
     int i;
     int new_id;
+    NCWRLOCKLIST();
     if(nc_filelist == NULL) {
-        if (!(nc_filelist = calloc(1, sizeof(NC*)*NCFILELISTLENGTH)))
+        if (!(nc_filelist = calloc(1, sizeof(NC*)*NCFILELISTLENGTH))) {
+            NCUNLOCKLIST();
             return NC_ENOMEM;
+        }
         numfiles = 0;
     }
 
@@ -93,10 +109,11 @@ add_to_NCList(NC* ncp)
     for(i=1; i < NCFILELISTLENGTH; i++) {
         if(nc_filelist[i] == NULL) {new_id = i; break;}
     }
-    if(new_id == 0) return NC_ENOMEM; /* no more slots */
+    if(new_id == 0) {NCUNLOCKLIST(); return NC_ENOMEM;} /* no more slots */
     nc_filelist[new_id] = ncp;
     numfiles++;
     ncp->ext_ncid = (new_id << ID_SHIFT);
+    NCUNLOCKLIST();
     return NC_NOERR;
 }
 
@@ -113,20 +130,25 @@ add_to_NCList(NC* ncp)
 int
 move_in_NCList(NC *ncp, int new_id)
 {
+    int stat = NC_NOERR;
+
+    NCWRLOCKLIST();
     /* If no files in list, error. */
     if (!nc_filelist)
-        return NC_EINVAL;
+        {stat = NC_EINVAL; goto done;}
 
     /* If new slot is already taken, error. */
     if (nc_filelist[new_id])
-        return NC_EINVAL;
+        {stat = NC_EINVAL; goto done;}
 
     /* Move the file. */
     nc_filelist[ncp->ext_ncid >> ID_SHIFT] = NULL;
     nc_filelist[new_id] = ncp;
     ncp->ext_ncid = (new_id << ID_SHIFT);
 
-    return NC_NOERR;
+done:
+    NCUNLOCKLIST();
+    return stat;
 }
 
 /**
@@ -145,15 +167,18 @@ void
 del_from_NCList(NC* ncp)
 {
     unsigned int ncid = ((unsigned int)ncp->ext_ncid) >> ID_SHIFT;
-    if(numfiles == 0 || ncid == 0 || nc_filelist == NULL) return;
-    if(nc_filelist[ncid] != ncp) return;
+    NCWRLOCKLIST();
+    if(numfiles == 0 || ncid == 0 || nc_filelist == NULL) goto done;
+    if(nc_filelist[ncid] != ncp) goto done;
 
     nc_filelist[ncid] = NULL;
     numfiles--;
 
     /* If all files have been closed, release the filelist memory. */
     if (numfiles == 0)
-        free_NCList();
+        freelist();
+done:
+    NCUNLOCKLIST();
 }
 
 /**
@@ -176,11 +201,13 @@ find_in_NCList(int ext_ncid)
 
     /* If we have a filelist, there will be an entry, possibly NULL,
      * for this ncid. */
+    NCRDLOCKLIST();
     if (nc_filelist)
     {
         assert(numfiles);
         f = nc_filelist[ncid];
     }
+    NCUNLOCKLIST();
 
     /* For classic files, ext_ncid must be a multiple of
      * (1<<ID_SHIFT). That is, the group part of the ext_ncid (the
@@ -207,16 +234,18 @@ find_in_NCList_by_name(const char* path)
 {
     int i;
     NC* f = NULL;
-    if(nc_filelist == NULL)
-        return NULL;
-    for(i=1; i < NCFILELISTLENGTH; i++) {
-        if(nc_filelist[i] != NULL) {
-            if(strcmp(nc_filelist[i]->path,path)==0) {
-                f = nc_filelist[i];
-                break;
+    NCRDLOCKLIST();
+    if(nc_filelist != NULL) {
+        for(i=1; i < NCFILELISTLENGTH; i++) {
+            if(nc_filelist[i] != NULL) {
+                if(strcmp(nc_filelist[i]->path,path)==0) {
+                    f = nc_filelist[i];
+                    break;
+                }
             }
         }
     }
+    NCUNLOCKLIST();
     return f;
 }
 
@@ -240,6 +269,8 @@ iterate_NCList(int index, NC** ncp)
     /* Walk from 0 ...; 0 return => stop */
     if(index < 0 || index >= NCFILELISTLENGTH)
         return NC_ERANGE;
-    if(ncp) *ncp = nc_filelist[index];
+    NCRDLOCKLIST();
+    if(ncp) *ncp = (nc_filelist == NULL ? NULL : nc_filelist[index]);
+    NCUNLOCKLIST();
     return NC_NOERR;
 }
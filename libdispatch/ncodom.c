@@ -0,0 +1,312 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+
+/*
+Hyperslab odometer; see ncodom.h for a description.
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include "netcdf.h"
+#include "ncodom.h"
+
+int
+NC_odom_init(NCodometer* odom, int rank, const size_t* shape,
+             const size_t* start, const size_t* count,
+             const ptrdiff_t* stride, const ptrdiff_t* imap, int flags)
+{
+    int i;
+    size_t* base;
+    size_t dimprod = 1;
+    size_t memprod = 1;
+    size_t nelems = 1;
+
+    odom->space = NULL;
+    if(rank < 0 || rank > NC_MAX_VAR_DIMS)
+        return NC_EINVAL;
+    if(rank <= NC_ODOM_NINLINE)
+        base = odom->inlinespace;
+    else {
+        base = (size_t*)malloc(sizeof(size_t)*7*(size_t)rank);
+        if(base == NULL) return NC_ENOMEM;
+        odom->space = base;
+    }
+    odom->index = base;
+    odom->runedges = base + rank;
+    odom->start = base + 2*rank;
+    odom->stop = base + 3*rank;
+    odom->stride = base + 4*rank;
+    odom->step = base + 5*rank;
+    odom->memstep = base + 6*rank;
+
+    odom->rank = rank;
+    odom->offset = 0;
+    odom->memoffset = 0;
+    for(i=rank-1;i>=0;i--) {
+        size_t st = (start != NULL ? start[i] : 0);
+        size_t ct = (count != NULL ? count[i] : (shape != NULL ? shape[i] - st : 1));
+        ptrdiff_t sd = (stride != NULL ? stride[i] : 1);
+        if(sd <= 0) {NC_odom_free(odom); return NC_ESTRIDE;}
+        odom->start[i] = st;
+        odom->index[i] = st;
+        odom->stride[i] = (size_t)sd;
+        odom->stop[i] = st + ct*(size_t)sd;
+        odom->runedges[i] = ct;
+        odom->step[i] = (size_t)sd*dimprod;
+        /* Negative map values wrap around, which is fine for unsigned arithmetic */
+        odom->memstep[i] = (imap != NULL ? (size_t)imap[i] : memprod);
+        odom->offset += st*dimprod;
+        if(shape != NULL) dimprod *= shape[i];
+        memprod *= ct;
+        nelems *= ct;
+    }
+    odom->more = (nelems > 0);
+
+    /* Collapse as many trailing dimensions as possible into the run */
+    odom->outer = rank;
+    odom->runlen = 1;
+    if(!(flags & NC_ODOM_ELEMENTS)) {
+        size_t expect = 1; /* map value that keeps the run contiguous in memory */
+        for(i=rank-1;i>=0;i--) {
+            size_t ct = odom->runedges[i];
+            if(ct != 1) {
+                if(odom->stride[i] != 1) break;
+                if(imap != NULL && (size_t)imap[i] != expect) break;
+                if(i == 0 && (flags & NC_ODOM_RECORDS) && !(flags & NC_ODOM_BOX)) break;
+            }
+            odom->runlen *= ct;
+            expect = odom->runlen;
+            odom->outer = i;
+            /* A linear run can only grow outward past a whole dimension */
+            if(!(flags & NC_ODOM_BOX)
+               && (shape == NULL || odom->start[i] != 0 || ct != shape[i]))
+                break;
+        }
+    }
+    for(i=0;i<odom->outer;i++)
+        odom->runedges[i] = 1;
+    return NC_NOERR;
+}
+
+int
+NC_odom_initchunks(NCodometer* odom, int rank,
+                   const size_t* start, const size_t* count,
+                   const ptrdiff_t* stride, const size_t* chunksizes)
+{
+    int i;
+    size_t cstart[NC_MAX_VAR_DIMS];
+    size_t ccount[NC_MAX_VAR_DIMS];
+
+    odom->space = NULL;
+    if(rank < 0 || rank > NC_MAX_VAR_DIMS || count == NULL || chunksizes == NULL)
+        return NC_EINVAL;
+    for(i=0;i<rank;i++) {
+        size_t st = (start != NULL ? start[i] : 0);
+        ptrdiff_t sd = (stride != NULL ? stride[i] : 1);
+        if(chunksizes[i] == 0) return NC_EINVAL;
+        if(sd <= 0) return NC_ESTRIDE;
+        cstart[i] = st / chunksizes[i];
+        if(count[i] == 0)
+            ccount[i] = 0;
+        else {
+            size_t last = st + (count[i]-1)*(size_t)sd;
+            ccount[i] = (last / chunksizes[i]) - cstart[i] + 1;
+        }
+    }
+    return NC_odom_init(odom,rank,NULL,cstart,ccount,NULL,NULL,NC_ODOM_ELEMENTS);
+}
+
+void
+NC_odom_free(NCodometer* odom)
+{
+    if(odom == NULL) return;
+    if(odom->space != NULL) free(odom->space);
+    odom->space = NULL;
+}
+
+int
+NC_odom_more(const NCodometer* odom)
+{
+    return odom->more;
+}
+
+/* Move to the next run */
+void
+NC_odom_next(NCodometer* odom)
+{
+    int i; /* do not make unsigned */
+    for(i=odom->outer-1;i>=0;i--) {
+        size_t n;
+        odom->index[i] += odom->stride[i];
+        odom->offset += odom->step[i];
+        odom->memoffset += odom->memstep[i];
+        if(odom->index[i] < odom->stop[i]) return;
+        /* carry: reset this position and move the next one out */
+        n = (odom->index[i] - odom->start[i]) / odom->stride[i];
+        odom->offset -= n*odom->step[i];
+        odom->memoffset -= n*odom->memstep[i];
+        odom->index[i] = odom->start[i];
+    }
+    odom->more = 0;
+}
+
+size_t
+NC_odom_nelements(const NCodometer* odom)
+{
+    int i;
+    size_t n = odom->runlen;
+    for(i=0;i<odom->outer;i++)
+        n *= (odom->stop[i] - odom->start[i]) / odom->stride[i];
+    return n;
+}
+
+size_t
+NC_odom_intersect(int rank, const size_t* start, const size_t* count,
+                  const ptrdiff_t* stride,
+                  const size_t* origin, const size_t* extent,
+                  size_t* istart, size_t* icount, size_t* ipos)
+{
+    int i;
+    size_t n = 1;
+    for(i=0;i<rank;i++) {
+        size_t st = (start != NULL ? start[i] : 0);
+        size_t sd = (stride != NULL ? (size_t)stride[i] : 1);
+        size_t lo = origin[i];
+        size_t hi = origin[i] + extent[i]; /* exclusive */
+        size_t jlo, jhi; /* selection positions [jlo,jhi) inside the box */
+        jlo = (lo > st ? (lo - st + sd - 1) / sd : 0);
+        jhi = (hi > st ? (hi - st - 1) / sd + 1 : 0);
+        if(jhi > count[i]) jhi = count[i];
+        if(jlo >= jhi) {
+            istart[i] = st;
+            icount[i] = 0;
+            ipos[i] = 0;
+            n = 0;
+            continue;
+        }
+        istart[i] = st + jlo*sd;
+        icount[i] = jhi - jlo;
+        ipos[i] = jlo;
+        n *= icount[i];
+    }
+    return n;
+}
+
+/* Tiles of this many elements on a side are copied at a time when a
+   map transposes the selection. */
+#define NC_ODOM_TILE 32
+
+#define COPYTILE(T) \
+    for(ip=(ptrdiff_t)p0;ip<pe;ip++) { \
+        T* pk = (T*)packed + ip*pstep; \
+        T* mp = (T*)mapped + ip*mpstep; \
+        if(scatter) \
+            for(iq=(ptrdiff_t)q0;iq<qe;iq++) mp[iq*mqstep] = pk[iq]; \
+        else \
+            for(iq=(ptrdiff_t)q0;iq<qe;iq++) pk[iq] = mp[iq*mqstep]; \
+    }
+
+/* Copy one 2-d slice; p and q are the dimensions that are contiguous
+   in the mapped and the packed layouts respectively. */
+static void
+copyslice(char* packed, char* mapped, size_t np, size_t nq,
+          ptrdiff_t pstep, ptrdiff_t mpstep, ptrdiff_t mqstep,
+          size_t elemsize, int scatter)
+{
+    size_t p0, q0;
+    ptrdiff_t ip, iq, pe, qe;
+    for(p0=0;p0<np;p0+=NC_ODOM_TILE) {
+        pe = (ptrdiff_t)(p0+NC_ODOM_TILE < np ? p0+NC_ODOM_TILE : np);
+        for(q0=0;q0<nq;q0+=NC_ODOM_TILE) {
+            qe = (ptrdiff_t)(q0+NC_ODOM_TILE < nq ? q0+NC_ODOM_TILE : nq);
+            switch (elemsize) {
+            case 1: COPYTILE(unsigned char); break;
+            case 2: COPYTILE(unsigned short); break;
+            case 4: COPYTILE(unsigned int); break;
+            case 8: COPYTILE(unsigned long long); break;
+            default:
+                for(ip=(ptrdiff_t)p0;ip<pe;ip++) {
+                    for(iq=(ptrdiff_t)q0;iq<qe;iq++) {
+                        char* pk = packed + (ip*pstep + iq)*(ptrdiff_t)elemsize;
+                        char* mp = mapped + (ip*mpstep + iq*mqstep)*(ptrdiff_t)elemsize;
+                        if(scatter) memcpy(mp,pk,elemsize); else memcpy(pk,mp,elemsize);
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+
+static int
+copymapped(char* packed, char* mapped, int rank, const size_t* edges,
+           const ptrdiff_t* imap, size_t elemsize, int scatter)
+{
+    int stat, i, p, q;
+    NCodometer odom;
+    size_t count[NC_MAX_VAR_DIMS];
+    size_t pstep;
+
+    /* q is the innermost dimension that matters, p the one with the
+       smallest map among the others */
+    for(q=rank-1;q>=0 && edges[q]==1;q--);
+    p = -1;
+    if(q >= 0 && imap[q] != 1) {
+        for(i=0;i<q;i++) {
+            ptrdiff_t m = (imap[i] < 0 ? -imap[i] : imap[i]);
+            if(edges[i] == 1) continue;
+            if(p < 0 || m < (imap[p] < 0 ? -imap[p] : imap[p])) p = i;
+        }
+    }
+
+    if(p < 0) {
+        /* Runs are contiguous in both layouts (or only one dimension
+           varies), so copy a run at a time */
+        if((stat = NC_odom_init(&odom,rank,edges,NULL,edges,NULL,imap,0)))
+            return stat;
+        for(;NC_odom_more(&odom);NC_odom_next(&odom)) {
+            char* pk = packed + odom.offset*elemsize;
+            char* mp = mapped + (ptrdiff_t)odom.memoffset*(ptrdiff_t)elemsize;
+            if(odom.runlen == 1) {
+                if(scatter) memcpy(mp,pk,elemsize); else memcpy(pk,mp,elemsize);
+            } else if(scatter)
+                memcpy(mp,pk,odom.runlen*elemsize);
+            else
+                memcpy(pk,mp,odom.runlen*elemsize);
+        }
+        NC_odom_free(&odom);
+        return NC_NOERR;
+    }
+
+    /* Transpose each (p,q) slice in tiles */
+    pstep = 1;
+    for(i=p+1;i<rank;i++) pstep *= edges[i];
+    for(i=0;i<rank;i++) count[i] = edges[i];
+    count[p] = 1;
+    count[q] = 1;
+    if((stat = NC_odom_init(&odom,rank,edges,NULL,count,NULL,imap,NC_ODOM_ELEMENTS)))
+        return stat;
+    for(;NC_odom_more(&odom);NC_odom_next(&odom)) {
+        copyslice(packed + odom.offset*elemsize,
+                  mapped + (ptrdiff_t)odom.memoffset*(ptrdiff_t)elemsize,
+                  edges[p],edges[q],(ptrdiff_t)pstep,imap[p],imap[q],
+                  elemsize,scatter);
+    }
+    NC_odom_free(&odom);
+    return NC_NOERR;
+}
+
+int
+NC_odom_scatter(const void* packed, void* mapped, int rank,
+                const size_t* edges, const ptrdiff_t* imap, size_t elemsize)
+{
+    return copymapped((char*)packed,(char*)mapped,rank,edges,imap,elemsize,1);
+}
+
+int
+NC_odom_gather(const void* mapped, void* packed, int rank,
+               const size_t* edges, const ptrdiff_t* imap, size_t elemsize)
+{
+    return copymapped((char*)packed,(char*)mapped,rank,edges,imap,elemsize,0);
+}
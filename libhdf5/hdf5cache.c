@@ -12,6 +12,7 @@
 
 #include "config.h"
 #include "hdf5internal.h"
+#include "ncthread.h"
 
 /* These are the default chunk cache sizes for HDF5 files created or
  * opened with netCDF-4. */
@@ -73,9 +74,11 @@ nc_set_chunk_cache(size_t size, size_t nelems, float preemption)
 {
     if (preemption < 0 || preemption > 1)
         return NC_EINVAL;
+    NCLOCKGLOBAL();
     nc4_chunk_cache_size = size;
     nc4_chunk_cache_nelems = nelems;
     nc4_chunk_cache_preemption = preemption;
+    NCUNLOCKGLOBAL();
     return NC_NOERR;
 }
 
@@ -97,6 +100,7 @@ nc_set_chunk_cache(size_t size, size_t nelems, float preemption)
 int
 nc_get_chunk_cache(size_t *sizep, size_t *nelemsp, float *preemptionp)
 {
+    NCLOCKGLOBAL();
     if (sizep)
         *sizep = nc4_chunk_cache_size;
 
@@ -105,6 +109,7 @@ nc_get_chunk_cache(size_t *sizep, size_t *nelemsp, float *preemptionp)
 
     if (preemptionp)
         *preemptionp = nc4_chunk_cache_preemption;
+    NCUNLOCKGLOBAL();
     return NC_NOERR;
 }
 
@@ -126,9 +131,11 @@ nc_set_chunk_cache_ints(int size, int nelems, int preemption)
 {
     if (size <= 0 || nelems <= 0 || preemption < 0 || preemption > 100)
         return NC_EINVAL;
+    NCLOCKGLOBAL();
     nc4_chunk_cache_size = size;
     nc4_chunk_cache_nelems = nelems;
     nc4_chunk_cache_preemption = (float)preemption / 100;
+    NCUNLOCKGLOBAL();
     return NC_NOERR;
 }
 
@@ -148,12 +155,14 @@ nc_set_chunk_cache_ints(int size, int nelems, int preemption)
 int
 nc_get_chunk_cache_ints(int *sizep, int *nelemsp, int *preemptionp)
 {
+    NCLOCKGLOBAL();
     if (sizep)
         *sizep = (int)nc4_chunk_cache_size;
     if (nelemsp)
         *nelemsp = (int)nc4_chunk_cache_nelems;
     if (preemptionp)
         *preemptionp = (int)(nc4_chunk_cache_preemption * 100);
+    NCUNLOCKGLOBAL();
 
     return NC_NOERR;
 }
@@ -275,6 +275,7 @@ NC4_create(const char* path, int cmode, size_t initialsz, int basepe,
            size_t *chunksizehintp, void *parameters,
            const NC_Dispatch *dispatch, int ncid)
 {
+    NC *nc;
     int res;
 
     assert(path);
@@ -300,5 +301,9 @@ NC4_create(const char* path, int cmode, size_t initialsz, int basepe,
     /* Create the netCDF-4/HDF5 file. */
     res = nc4_create_file(path, cmode, initialsz, parameters, ncid);
 
+    /* Name the storage for nc_inq_perf_stats(). */
+    if (!res && !NC_check_id(ncid, &nc))
+        nc->perf.backend = "hdf5";
+
     return res;
 }
@@ -159,26 +159,16 @@ NC4_inq_dim(int ncid, int dimid, char *name, size_t *lenp)
     /* Return the dimension length, if the caller wants it. */
     if (lenp)
     {
-        if (dim->unlimited)
+        /* The length of an unlimited dimension is the max number of
+           records of all the vars that share it. That is found when
+           the file is opened, and kept up to date by NC4_put_vars(). */
+        if (!dim->unlimited && dim->too_long)
         {
-            /* Since this is an unlimited dimension, go to the file
-               and see how many records there are. Take the max number
-               of records from all the vars that share this
-               dimension. */
-            *lenp = 0;
-            if ((ret = nc4_find_dim_len(dim_grp, dimid, &lenp)))
-                return ret;
+            ret = NC_EDIMSIZE;
+            *lenp = NC_MAX_UINT;
         }
         else
-        {
-            if (dim->too_long)
-            {
-                ret = NC_EDIMSIZE;
-                *lenp = NC_MAX_UINT;
-            }
-            else
-                *lenp = dim->len;
-        }
+            *lenp = dim->len;
     }
 
     return ret;
@@ -14,6 +14,7 @@
 #include "config.h"
 #include "hdf5internal.h"
 #include "ncrc.h"
+#include "ncperf.h"
 
 extern int NC4_extract_file_image(NC_FILE_INFO_T* h5); /* In nc4memcb.c */
 
@@ -227,6 +228,27 @@ sync_netcdf4_file(NC_FILE_INFO_T *h5)
     return NC_NOERR;
 }
 
+/**
+ * @internal Fill in the HDF5 metadata cache hit rate of an open file,
+ * for nc_inq_perf_stats().
+ *
+ * @param nc Pointer to the NC of the file.
+ * @param stats Pointer to the counters to fill in.
+ */
+void
+NC4_hdf5_perf_stats(NC *nc, nc_perf_stats_t *stats)
+{
+    NC_FILE_INFO_T *h5 = (NC_FILE_INFO_T *)nc->dispatchdata;
+    NC_HDF5_FILE_INFO_T *hdf5_info;
+    double rate;
+
+    if (!h5 || !(hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info) ||
+        hdf5_info->hdfid <= 0)
+        return;
+    if (H5Fget_mdc_hit_rate(hdf5_info->hdfid, &rate) >= 0)
+        stats->mdc_hit_rate = rate;
+}
+
 /**
  * @internal This function will free all allocated metadata memory,
  * and close the HDF5 file. The group that is passed in must be the
@@ -270,6 +292,10 @@ nc4_close_netcdf4_file(NC_FILE_INFO_T *h5, int abort, NC_memio *memio)
      * hidden attribute. */
     NC4_clear_provenance(&h5->provenance);
 
+    /* Keep the final metadata cache hit rate for the report on
+     * close. */
+    NC4_hdf5_perf_stats(h5->controller, &h5->controller->perf);
+
     /* Close hdf file. It may not be open, since this function is also
      * called by NC_create() when a file opening is aborted. */
     if (hdf5_info->hdfid > 0 && H5Fclose(hdf5_info->hdfid) < 0)
@@ -305,6 +331,7 @@ nc4_close_netcdf4_file(NC_FILE_INFO_T *h5, int abort, NC_memio *memio)
     /* Free the HDF5-specific info. */
     if (h5->format_file_info) {
 	NC_HDF5_FILE_INFO_T* hdf5_file = (NC_HDF5_FILE_INFO_T*)h5->format_file_info;
+	nc4_hdf5_type_index_free(hdf5_file);
 	free(hdf5_file);
     }
     
@@ -438,8 +465,10 @@ NC4_set_fill(int ncid, int fillmode, int *old_modep)
     if (nc4_info->no_write)
         return NC_EPERM;
 
-    /* Did you pass me some weird fillmode? */
-    if (fillmode != NC_FILL && fillmode != NC_NOFILL)
+    /* Did you pass me some weird fillmode? HDF5 already writes fill
+     * values only as storage is allocated, so NC_LAZYFILL is the same
+     * as NC_FILL here. */
+    if (fillmode != NC_FILL && fillmode != NC_NOFILL && fillmode != NC_LAZYFILL)
         return NC_EINVAL;
 
     /* If the user wants to know, tell him what the old mode was. */
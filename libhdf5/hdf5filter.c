@@ -168,6 +168,101 @@ done:
     return THROW(stat);
 } 
 
+/**
+ * @internal Read or write one chunk of a variable as stored in the
+ * file, bypassing the filter pipeline.
+ *
+ * @param h5 File info.
+ * @param var Variable info.
+ * @param op NCFILTER_READCHUNK or NCFILTER_WRITECHUNK.
+ * @param chunk Chunk offsets, filter mask, size and data.
+ *
+ * @returns ::NC_NOERR for success
+ * @returns ::NC_EINVAL Not chunked, bad offsets, or data too small.
+ * @returns ::NC_EINDEFINE Still in define mode.
+ * @returns ::NC_EPERM Write to read-only file.
+ * @returns ::NC_ENOTBUILT HDF5 too old for direct chunk I/O.
+ * @returns ::NC_EHDFERR HDF5 error.
+ */
+static int
+chunk_raw(NC_FILE_INFO_T* h5, NC_VAR_INFO_T* var, int op, NC_FILTER_CHUNK_HDF5* chunk)
+{
+#ifdef HAVE_H5DREAD_CHUNK
+    NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+    hsize_t offsets[NC_MAX_VAR_DIMS];
+    hsize_t storage = 0;
+    uint32_t mask = 0;
+    int d;
+
+    if (var->storage != NC_CHUNKED || var->ndims == 0) return THROW(NC_EINVAL);
+    /* The dataset only exists once enddef has run. */
+    if ((h5->flags & NC_INDEF) || !var->created) return THROW(NC_EINDEFINE);
+    if (chunk->offsets == NULL) return THROW(NC_EINVAL);
+    for (d = 0; d < var->ndims; d++) {
+        if (chunk->offsets[d] % var->chunksizes[d]) return THROW(NC_EINVAL);
+        offsets[d] = (hsize_t)chunk->offsets[d];
+    }
+
+    if (op == NCFILTER_READCHUNK) {
+        /* A chunk that was never written has no storage. */
+        if (H5Dget_chunk_storage_size(hdf5_var->hdf_datasetid, offsets, &storage) < 0)
+            storage = 0;
+        if (storage > 0 && chunk->data != NULL) {
+            if (chunk->size < (size_t)storage) return THROW(NC_EINVAL);
+            if (H5Dread_chunk(hdf5_var->hdf_datasetid, H5P_DEFAULT, offsets,
+                              &mask, chunk->data) < 0)
+                return THROW(NC_EHDFERR);
+        }
+        chunk->filtermask = (unsigned int)mask;
+        chunk->size = (size_t)storage;
+    } else {
+        if (h5->no_write) return THROW(NC_EPERM);
+        if (chunk->data == NULL || chunk->size == 0) return THROW(NC_EINVAL);
+        if (H5Dwrite_chunk(hdf5_var->hdf_datasetid, H5P_DEFAULT,
+                           (uint32_t)chunk->filtermask, offsets, chunk->size,
+                           chunk->data) < 0)
+            return THROW(NC_EHDFERR);
+    }
+    return NC_NOERR;
+#else
+    return THROW(NC_ENOTBUILT);
+#endif /* HAVE_H5DREAD_CHUNK */
+}
+
+/**
+ * @internal Set the attribute that records the quantization of a
+ * variable, and delete the one for the other kind of quantization.
+ *
+ * @param ncid File ID.
+ * @param varid Variable ID.
+ * @param params Parameters of the quantize filter, or NULL to
+ * delete both attributes.
+ *
+ * @returns ::NC_NOERR for success
+ */
+static int
+quantize_atts(int ncid, int varid, const unsigned int* params)
+{
+    int stat;
+    int keep;
+
+    if(params == NULL || params[0] != NC_QUANTIZE_BITGROOM) {
+        stat = NC4_HDF5_del_att(ncid,varid,NC_QUANTIZE_BITGROOM_ATT_NAME);
+        if(stat != NC_NOERR && stat != NC_ENOTATT) return stat;
+    }
+    if(params == NULL || params[0] != NC_QUANTIZE_BITROUND) {
+        stat = NC4_HDF5_del_att(ncid,varid,NC_QUANTIZE_BITROUND_ATT_NAME);
+        if(stat != NC_NOERR && stat != NC_ENOTATT) return stat;
+    }
+    if(params == NULL)
+        return NC_NOERR;
+    keep = (int)params[1];
+    return NC4_HDF5_put_att(ncid,varid,
+                            (params[0] == NC_QUANTIZE_BITGROOM ? NC_QUANTIZE_BITGROOM_ATT_NAME
+                                                               : NC_QUANTIZE_BITROUND_ATT_NAME),
+                            NC_INT,1,&keep,NC_INT);
+}
+
 /**
  * @internal Define filter settings. Called by nc_def_var_filter().
  *
@@ -276,6 +371,25 @@ NC4_filter_actions(int ncid, int varid, int op, NC_Filterobject* args)
         if(id == H5Z_FILTER_SZIP)
             return THROW(NC_EFILTER); /* Not allowed */
 #endif
+        if(id == H5Z_FILTER_QUANTIZE) { /* Do error checking */
+	    size_t size = var->type_info->size;
+            if(nparams < 2)
+                return THROW(NC_EFILTER); /* incorrect no. of parameters */
+            if(var->type_info->hdr.id != NC_FLOAT && var->type_info->hdr.id != NC_DOUBLE)
+                return THROW(NC_EINVAL);
+	    switch (params[0]) {
+	    case NC_QUANTIZE_BITGROOM:
+	        if(params[1] < 1 || params[1] > (size == 4 ? NC_QUANTIZE_MAX_FLOAT_NSD : NC_QUANTIZE_MAX_DOUBLE_NSD))
+		    return THROW(NC_EINVAL);
+		break;
+	    case NC_QUANTIZE_BITROUND:
+	        if(params[1] < 1 || params[1] > (size == 4 ? NC_QUANTIZE_MAX_FLOAT_NSB : NC_QUANTIZE_MAX_DOUBLE_NSB))
+		    return THROW(NC_EINVAL);
+		break;
+	    default:
+	        return THROW(NC_EINVAL);
+	    }
+        }
         /* Filter => chunking */
 	var->storage = NC_CHUNKED;
         /* Determine default chunksizes for this variable unless already specified */
@@ -300,8 +414,27 @@ NC4_filter_actions(int ncid, int varid, int op, NC_Filterobject* args)
                 return THROW(NC_EINVAL);
         }
 #endif
+        if(id == H5Z_FILTER_QUANTIZE) {
+	    /* A new quantization replaces the old one */
+	    int k;
+	    for(k=nclistlength(var->filters)-1;k>=0;k--) {
+		NC_FILTER_SPEC_HDF5* f = nclistget(var->filters,k);
+		if(f->filterid == H5Z_FILTER_QUANTIZE) {
+		    nclistremove(var->filters,k);
+		    NC4_freefilterspec(f);
+		}
+	    }
+	}
 	if((stat = NC4_hdf5_addfilter(var,!FILTERACTIVE,id,nparams,params)))
   	    goto done;
+        /* Record the quantization with the variable */
+        if(id == H5Z_FILTER_QUANTIZE) {
+	    /* Quantization must see the data before the shuffle and
+	     * any compressor, so it always goes first. */
+	    nclistinsert(var->filters,0,nclistpop(var->filters));
+            if((stat = quantize_atts(ncid,varid,params)))
+                goto done;
+        }
 #ifdef USE_PARALLEL
 #ifdef HDF5_SUPPORTS_PAR_FILTERS
         /* Switch to collective access. HDF5 requires collevtive access
@@ -361,6 +494,11 @@ NC4_filter_actions(int ncid, int varid, int op, NC_Filterobject* args)
 	}
 	if(!found) {stat = NC_ENOFILTER; goto done;}
 	} break;
+    case NCFILTER_READCHUNK:
+    case NCFILTER_WRITECHUNK:
+        if(obj->sort != NC_FILTER_SORT_CHUNK) return THROW(NC_EFILTER);
+        if((stat = chunk_raw(h5,var,op,&obj->u.chunk))) goto done;
+	break;
     case NCFILTER_REMOVE: {
 	int k;
         if (!(h5->flags & NC_INDEF)) return THROW(NC_EINDEFINE);
@@ -378,6 +516,10 @@ NC4_filter_actions(int ncid, int varid, int op, NC_Filterobject* args)
 		NC4_freefilterspec(f);
 	    }
 	}
+        if(id == H5Z_FILTER_QUANTIZE) {
+            if((stat = quantize_atts(ncid,varid,NULL)))
+                goto done;
+        }
 	} break;
     default:
 	{stat = NC_EINTERNAL; goto done;}	
@@ -16,6 +16,7 @@
 
 #include "config.h"
 #include "hdf5internal.h"
+#include "ncbytes.h"
 
 #undef DEBUGH5
 
@@ -94,173 +95,255 @@ nc4_hdf5_finalize(void)
 }
 
 /**
- * @internal Given a varid, return the maximum length of a dimension
- * using dimid.
+ * @internal Get the HDF5 typeid to compare a user-defined type with:
+ * the native typeid if there is one.
  *
- * @param grp Pointer to group info struct.
- * @param varid Variable ID.
- * @param dimid Dimension ID.
- * @param maxlen Pointer that gets the max length.
+ * @param type Pointer to type info struct.
+ *
+ * @return The typeid, or 0 if the type has not been committed yet.
+ */
+static hid_t
+type_hdf_typeid(NC_TYPE_INFO_T *type)
+{
+    NC_HDF5_TYPE_INFO_T *hdf5_type;
+
+    /* Get HDF5-specific type info. */
+    hdf5_type = (NC_HDF5_TYPE_INFO_T *)type->format_type_info;
+    if (!hdf5_type)
+        return 0;
+    return hdf5_type->native_hdf_typeid ?
+        hdf5_type->native_hdf_typeid : hdf5_type->hdf_typeid;
+}
+
+/**
+ * @internal Append the signature of an HDF5 type to a buffer: its
+ * class and size, and the names, offsets, classes and sizes of its
+ * members, or the class and size of its base type. Types that
+ * H5Tequal() finds equal have the same signature.
+ *
+ * @param typeid HDF5 type ID.
+ * @param sig Buffer that gets the signature.
  *
  * @return ::NC_NOERR No error.
- * @author Ed Hartnett
+ * @return ::NC_EHDFERR HDF5 returned error.
  */
 static int
-find_var_dim_max_length(NC_GRP_INFO_T *grp, int varid, int dimid,
-                        size_t *maxlen)
+type_signature(hid_t typeid, NCbytes *sig)
 {
-    hid_t datasetid = 0, spaceid = 0;
-    NC_VAR_INFO_T *var;
-    hsize_t *h5dimlen = NULL, *h5dimlenmax = NULL;
-    int d, dataset_ndims = 0;
+    H5T_class_t class;
+    size_t size;
+    hid_t super = -1;
+    int nmembers, m;
     int retval = NC_NOERR;
 
-    *maxlen = 0;
-
-    /* Find this var. */
-    var = (NC_VAR_INFO_T*)ncindexith(grp->vars,varid);
-    if (!var) return NC_ENOTVAR;
-    assert(var->hdr.id == varid);
+    if ((class = H5Tget_class(typeid)) < 0 || !(size = H5Tget_size(typeid)))
+        return NC_EHDFERR;
+    ncbytesappendn(sig, &class, sizeof(class));
+    ncbytesappendn(sig, &size, sizeof(size));
 
-    /* If the var hasn't been created yet, its size is 0. */
-    if (!var->created)
-    {
-        *maxlen = 0;
-    }
-    else
+    switch (class)
     {
-        /* Get the number of records in the dataset. */
-        if ((retval = nc4_open_var_grp2(grp, var->hdr.id, &datasetid)))
-            BAIL(retval);
-        if ((spaceid = H5Dget_space(datasetid)) < 0)
-            BAIL(NC_EHDFERR);
-
-        /* If it's a scalar dataset, it has length one. */
-        if (H5Sget_simple_extent_type(spaceid) == H5S_SCALAR)
-        {
-            *maxlen = (var->dimids && var->dimids[0] == dimid) ? 1 : 0;
-        }
-        else
+    case H5T_COMPOUND:
+    case H5T_ENUM:
+        if ((nmembers = H5Tget_nmembers(typeid)) < 0)
+            return NC_EHDFERR;
+        ncbytesappendn(sig, &nmembers, sizeof(nmembers));
+        for (m = 0; m < nmembers; m++)
         {
-            /* Check to make sure ndims is right, then get the len of each
-               dim in the space. */
-            if ((dataset_ndims = H5Sget_simple_extent_ndims(spaceid)) < 0)
-                BAIL(NC_EHDFERR);
-            if (dataset_ndims != var->ndims)
-                BAIL(NC_EHDFERR);
-            if (!(h5dimlen = malloc(dataset_ndims * sizeof(hsize_t))))
-                BAIL(NC_ENOMEM);
-            if (!(h5dimlenmax = malloc(dataset_ndims * sizeof(hsize_t))))
-                BAIL(NC_ENOMEM);
-            if ((dataset_ndims = H5Sget_simple_extent_dims(spaceid,
-                                                           h5dimlen, h5dimlenmax)) < 0)
-                BAIL(NC_EHDFERR);
-            LOG((5, "find_var_dim_max_length: varid %d len %d max: %d",
-                 varid, (int)h5dimlen[0], (int)h5dimlenmax[0]));
-            for (d=0; d<dataset_ndims; d++) {
-                if (var->dimids[d] == dimid) {
-                    *maxlen = *maxlen > h5dimlen[d] ? *maxlen : h5dimlen[d];
-                }
+            char *name;
+
+            if (!(name = H5Tget_member_name(typeid, (unsigned)m)))
+                return NC_EHDFERR;
+            ncbytesappendn(sig, name, strlen(name) + 1);
+            H5free_memory(name);
+            if (class == H5T_COMPOUND)
+            {
+                H5T_class_t mclass;
+                size_t offset = H5Tget_member_offset(typeid, (unsigned)m);
+                hid_t mtypeid;
+
+                if ((mclass = H5Tget_member_class(typeid, (unsigned)m)) < 0 ||
+                    (mtypeid = H5Tget_member_type(typeid, (unsigned)m)) < 0)
+                    return NC_EHDFERR;
+                size = H5Tget_size(mtypeid);
+                if (H5Tclose(mtypeid) < 0 || !size)
+                    return NC_EHDFERR;
+                ncbytesappendn(sig, &offset, sizeof(offset));
+                ncbytesappendn(sig, &mclass, sizeof(mclass));
+                ncbytesappendn(sig, &size, sizeof(size));
             }
         }
+        break;
+    case H5T_VLEN:
+    case H5T_ARRAY:
+        if ((super = H5Tget_super(typeid)) < 0)
+            return NC_EHDFERR;
+        if ((class = H5Tget_class(super)) < 0 || !(size = H5Tget_size(super)))
+            BAIL(NC_EHDFERR);
+        ncbytesappendn(sig, &class, sizeof(class));
+        ncbytesappendn(sig, &size, sizeof(size));
+        break;
+    default:
+        break;
     }
 
 exit:
-    if (spaceid > 0 && H5Sclose(spaceid) < 0)
-        BAIL2(NC_EHDFERR);
-    if (h5dimlen) free(h5dimlen);
-    if (h5dimlenmax) free(h5dimlenmax);
+    if (super >= 0 && H5Tclose(super) < 0)
+        retval = NC_EHDFERR;
     return retval;
 }
 
 /**
- * @internal Search for type with a given HDF type id.
+ * @internal Add the types defined since the last search to the index
+ * of user-defined types by signature. The index stops at the first
+ * type not committed yet, until it is.
  *
  * @param h5 File
- * @param target_hdf_typeid HDF5 type ID to find.
+ * @param sig Buffer for the signatures.
  *
- * @return Pointer to type info struct, or NULL if not found.
- * @author Ed Hartnett
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EHDFERR HDF5 returned error.
  */
-NC_TYPE_INFO_T *
-nc4_rec_find_hdf_type(NC_FILE_INFO_T *h5, hid_t target_hdf_typeid)
+static int
+type_index_update(NC_FILE_INFO_T *h5, NCbytes *sig)
 {
-    NC_TYPE_INFO_T *type;
-    htri_t equal;
-    int i;
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    int retval;
 
-    assert(h5);
+    if (!hdf5_info->typeindex)
+    {
+        if (!(hdf5_info->typeindex = NC_hashmapnew(0)) ||
+            !(hdf5_info->typebuckets = nclistnew()))
+            return NC_ENOMEM;
+    }
 
-    for (i = 0; i < nclistlength(h5->alltypes); i++)
+    for (; hdf5_info->ntypesindexed < nclistlength(h5->alltypes);
+         hdf5_info->ntypesindexed++)
     {
-        NC_HDF5_TYPE_INFO_T *hdf5_type;
+        NC_TYPE_INFO_T *type;
+        NClist *bucket;
+        uintptr_t data;
         hid_t hdf_typeid;
 
-        type = (NC_TYPE_INFO_T*)nclistget(h5->alltypes, i);
-        if(type == NULL) continue;
-
-        /* Get HDF5-specific type info. */
-        hdf5_type = (NC_HDF5_TYPE_INFO_T *)type->format_type_info;
-
-        /* Select the HDF5 typeid to use. */
-        hdf_typeid = hdf5_type->native_hdf_typeid ?
-            hdf5_type->native_hdf_typeid : hdf5_type->hdf_typeid;
+        type = (NC_TYPE_INFO_T*)nclistget(h5->alltypes, hdf5_info->ntypesindexed);
+        if (type == NULL) continue;
+        if (!(hdf_typeid = type_hdf_typeid(type)))
+            break;
 
-        /* Is this the type we are searching for? */
-        if ((equal = H5Tequal(hdf_typeid, target_hdf_typeid)) < 0)
-            return NULL;
-        if (equal)
-            return type;
+        ncbytesclear(sig);
+        if ((retval = type_signature(hdf_typeid, sig)))
+            return retval;
+        if (NC_hashmapget(hdf5_info->typeindex, ncbytescontents(sig),
+                          ncbyteslength(sig), &data))
+            bucket = (NClist *)data;
+        else
+        {
+            if (!(bucket = nclistnew()))
+                return NC_ENOMEM;
+            nclistpush(hdf5_info->typebuckets, bucket);
+            NC_hashmapadd(hdf5_info->typeindex, (uintptr_t)bucket,
+                          ncbytescontents(sig), ncbyteslength(sig));
+        }
+        nclistpush(bucket, type);
     }
-    /* Can't find it. Fate, why do you mock me? */
-    return NULL;
+    return NC_NOERR;
 }
 
 /**
- * @internal Find the actual length of a dim by checking the length of
- * that dim in all variables that use it, in grp or children. **len
- * must be initialized to zero before this function is called.
+ * @internal Free the index of user-defined types of a file.
  *
- * @param grp Pointer to group info struct.
- * @param dimid Dimension ID.
- * @param len Pointer to pointer that gets length.
+ * @param hdf5_info HDF5-specific file info.
+ */
+void
+nc4_hdf5_type_index_free(NC_HDF5_FILE_INFO_T *hdf5_info)
+{
+    size_t i;
+
+    for (i = 0; i < nclistlength(hdf5_info->typebuckets); i++)
+        nclistfree((NClist *)nclistget(hdf5_info->typebuckets, i));
+    nclistfree(hdf5_info->typebuckets);
+    if (hdf5_info->typeindex)
+        NC_hashmapfree(hdf5_info->typeindex);
+    hdf5_info->typebuckets = NULL;
+    hdf5_info->typeindex = NULL;
+    hdf5_info->ntypesindexed = 0;
+}
+
+/**
+ * @internal Search for type with a given HDF type id.
  *
- * @return ::NC_NOERR No error.
+ * The user-defined types are indexed by signature, so only those with
+ * the same signature as the target are compared with H5Tequal(). The
+ * first equal type in the order of alltypes is returned.
+ *
+ * @param h5 File
+ * @param target_hdf_typeid HDF5 type ID to find.
+ *
+ * @return Pointer to type info struct, or NULL if not found.
  * @author Ed Hartnett
  */
-int
-nc4_find_dim_len(NC_GRP_INFO_T *grp, int dimid, size_t **len)
+NC_TYPE_INFO_T *
+nc4_rec_find_hdf_type(NC_FILE_INFO_T *h5, hid_t target_hdf_typeid)
 {
-    NC_VAR_INFO_T *var;
-    int retval;
-    int i;
-
-    assert(grp && len);
-    LOG((3, "%s: grp->name %s dimid %d", __func__, grp->hdr.name, dimid));
+    NC_HDF5_FILE_INFO_T *hdf5_info;
+    NC_TYPE_INFO_T *type, *found = NULL;
+    NCbytes *sig;
+    uintptr_t data;
+    htri_t equal;
+    size_t i;
+
+    assert(h5 && h5->format_file_info);
+    hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+
+    if (!(sig = ncbytesnew()))
+        return NULL;
+    if (type_index_update(h5, sig))
+        goto done;
+
+    /* Compare with the indexed types of the same signature. */
+    ncbytesclear(sig);
+    if (type_signature(target_hdf_typeid, sig))
+        goto done;
+    if (NC_hashmapget(hdf5_info->typeindex, ncbytescontents(sig),
+                      ncbyteslength(sig), &data))
+    {
+        NClist *bucket = (NClist *)data;
 
-    /* If there are any groups, call this function recursively on
-     * them. */
-    for (i = 0; i < ncindexsize(grp->children); i++)
-        if ((retval = nc4_find_dim_len((NC_GRP_INFO_T*)ncindexith(grp->children, i),
-                                       dimid, len)))
-            return retval;
+        for (i = 0; i < nclistlength(bucket); i++)
+        {
+            type = (NC_TYPE_INFO_T*)nclistget(bucket, i);
+            if ((equal = H5Tequal(type_hdf_typeid(type), target_hdf_typeid)) < 0)
+                goto done;
+            if (equal)
+            {
+                found = type;
+                goto done;
+            }
+        }
+    }
 
-    /* For all variables in this group, find the ones that use this
-     * dimension, and remember the max length. */
-    for (i = 0; i < ncindexsize(grp->vars); i++)
+    /* Then with the committed types past the index. */
+    for (i = hdf5_info->ntypesindexed; i < nclistlength(h5->alltypes); i++)
     {
-        size_t mylen;
-        var = (NC_VAR_INFO_T *)ncindexith(grp->vars, i);
-        assert(var);
-
-        /* Find max length of dim in this variable... */
-        if ((retval = find_var_dim_max_length(grp, var->hdr.id, dimid, &mylen)))
-            return retval;
+        hid_t hdf_typeid;
 
-        **len = **len > mylen ? **len : mylen;
+        type = (NC_TYPE_INFO_T*)nclistget(h5->alltypes, i);
+        if (type == NULL || !(hdf_typeid = type_hdf_typeid(type)))
+            continue;
+        if ((equal = H5Tequal(hdf_typeid, target_hdf_typeid)) < 0)
+            goto done;
+        if (equal)
+        {
+            found = type;
+            goto done;
+        }
     }
+    /* Can't find it. Fate, why do you mock me? */
 
-    return NC_NOERR;
+done:
+    ncbytesfree(sig);
+    return found;
 }
 
 /**
@@ -601,6 +601,78 @@ rec_match_dimscales(NC_GRP_INFO_T *grp)
     return retval;
 }
 
+/**
+ * @internal Set the length of each unlimited dimension to the largest
+ * extent along it of the variables that use it, in grp or its
+ * children. This is done once on open; after that the lengths are
+ * kept up to date by the writes that extend datasets, so that
+ * nc_inq_dimlen() need not look at every dataset.
+ *
+ * @param grp Pointer to group info struct.
+ *
+ * @returns NC_NOERR No error.
+ * @returns NC_EHDFERR HDF5 returned an error.
+ */
+static int
+rec_find_unlim_dim_lens(NC_GRP_INFO_T *grp)
+{
+    NC_DIM_INFO_T *dim;
+    NC_VAR_INFO_T *var;
+    int retval;
+    int i, d;
+
+    assert(grp);
+
+    /* The vars of this group and its children can only use the dims
+     * of this group or its parents, so zero this group's unlimited
+     * dims before looking at any of them. */
+    for (i = 0; i < ncindexsize(grp->dim); i++)
+    {
+        dim = (NC_DIM_INFO_T *)ncindexith(grp->dim, i);
+        if (dim && dim->unlimited)
+            dim->len = 0;
+    }
+
+    for (i = 0; i < ncindexsize(grp->children); i++)
+        if ((retval = rec_find_unlim_dim_lens((NC_GRP_INFO_T *)ncindexith(grp->children, i))))
+            return retval;
+
+    for (i = 0; i < ncindexsize(grp->vars); i++)
+    {
+        NC_HDF5_VAR_INFO_T *hdf5_var;
+        hsize_t h5dimlen[H5S_MAX_RANK];
+        hid_t spaceid;
+        int ndims, unlim = 0;
+
+        var = (NC_VAR_INFO_T *)ncindexith(grp->vars, i);
+        assert(var && var->format_var_info);
+        hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+
+        for (d = 0; d < var->ndims; d++)
+            if (var->dim[d] && var->dim[d]->unlimited)
+                unlim++;
+        if (!unlim || !var->created)
+            continue;
+
+        if ((spaceid = H5Dget_space(hdf5_var->hdf_datasetid)) < 0)
+            return NC_EHDFERR;
+        ndims = H5Sget_simple_extent_dims(spaceid, h5dimlen, NULL);
+        if (H5Sclose(spaceid) < 0 || ndims < 0)
+            return NC_EHDFERR;
+        if (ndims != (int)var->ndims)
+            return NC_EHDFERR;
+
+        for (d = 0; d < var->ndims; d++)
+        {
+            dim = var->dim[d];
+            if (dim && dim->unlimited && h5dimlen[d] > dim->len)
+                dim->len = (size_t)h5dimlen[d];
+        }
+    }
+
+    return NC_NOERR;
+}
+
 /**
  * @internal Check for the attribute that indicates that netcdf
  * classic model is in use.
@@ -845,6 +917,10 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
     if ((retval = rec_match_dimscales(nc4_info->root_grp)))
         BAIL(retval);
 
+    /* Find the lengths of the unlimited dimensions. */
+    if ((retval = rec_find_unlim_dim_lens(nc4_info->root_grp)))
+        BAIL(retval);
+
 #ifdef LOGGING
     /* This will print out the names, types, lens, etc of the vars and
        atts in the file, if the logging level is 2 or greater. */
@@ -890,6 +966,9 @@ int
 NC4_open(const char *path, int mode, int basepe, size_t *chunksizehintp,
          void *parameters, const NC_Dispatch *dispatch, int ncid)
 {
+    NC *nc;
+    int retval;
+
     assert(path && dispatch);
 
     LOG((1, "%s: path %s mode %d params %x",
@@ -913,7 +992,13 @@ NC4_open(const char *path, int mode, int basepe, size_t *chunksizehintp,
 #endif /* LOGGING */
 
     /* Open the file. */
-    return nc4_open_file(path, mode, parameters, ncid);
+    if ((retval = nc4_open_file(path, mode, parameters, ncid)))
+        return retval;
+
+    /* Name the storage for nc_inq_perf_stats(). */
+    if (!NC_check_id(ncid, &nc))
+        nc->perf.backend = "hdf5";
+    return NC_NOERR;
 }
 
 /**
@@ -2287,17 +2372,6 @@ read_scale(NC_GRP_INFO_T *grp, hid_t datasetid, const char *obj_name,
         if (!strncmp(dimscale_name_att, DIM_WITHOUT_VARIABLE,
                      strlen(DIM_WITHOUT_VARIABLE)))
         {
-            if (new_dim->unlimited)
-            {
-                size_t len = 0, *lenp = &len;
-
-                /* Find actual length by checking all datasets that use
-                 * this dim. */
-                if ((retval = nc4_find_dim_len(grp, new_dim->hdr.id, &lenp)))
-                    BAIL(retval);
-                new_dim->len = *lenp;
-            }
-
             /* Hold open the dataset, since the dimension doesn't have a
              * coordinate variable */
             new_hdf5_dim->hdf_dimscaleid = datasetid;
@@ -14,6 +14,7 @@
 
 #include "netcdf.h"
 #include "netcdf_filter.h"
+#include "ncperf.h"
 
 /** @internal Default size for unlimited dim chunksize. */
 #define DEFAULT_1D_UNLIM_SIZE (4096)
@@ -503,7 +504,7 @@ NC4_def_var(int ncid, const char *name, nc_type xtype, int ndims,
      * variable type is variable length (NC_STRING or NC_VLEN) or is
      * user-defined type. */
     if (var->type_info->nc_type_class < NC_STRING)
-        var->no_fill = h5->fill_mode;
+        var->no_fill = (h5->fill_mode == NC_NOFILL);
 
     /* Assign dimensions to the variable. At the same time, check to
      * see if this is a coordinate variable. If so, it will have the
@@ -1447,6 +1448,38 @@ set_par_access(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var, hid_t xfer_plistid)
 }
 #endif /* USE_PARALLEL4 */
 
+/**
+ * @internal Count a dataset read or write of the selection in
+ * file_spaceid, and the time since t0, for nc_inq_perf_stats().
+ *
+ * @param h5 Pointer to file info.
+ * @param var Pointer to var info.
+ * @param file_spaceid The file dataspace of the read or write.
+ * @param writing Nonzero for a write.
+ * @param t0 Start time, from NC_PERF_START.
+ */
+static void
+perf_count_h5(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var, hid_t file_spaceid,
+              int writing, double t0)
+{
+    nc_perf_stats_t *stats = &h5->controller->perf;
+    hssize_t npoints = H5Sget_select_npoints(file_spaceid);
+    size_t bytes = npoints > 0 ? (size_t)npoints * var->type_info->size : 0;
+
+    if (writing)
+    {
+        NC_PERF_STOP(stats, h5_write_time, t0);
+        NC_PERF_ADD(stats, h5_writes, 1);
+        NC_PERF_ADD(stats, h5_write_bytes, bytes);
+    }
+    else
+    {
+        NC_PERF_STOP(stats, h5_read_time, t0);
+        NC_PERF_ADD(stats, h5_reads, 1);
+        NC_PERF_ADD(stats, h5_read_bytes, bytes);
+    }
+}
+
 /**
  * @internal Write a strided array of data to a variable. This is
  * called by nc_put_vars() and other nc_put_vars_* functions, for
@@ -1499,6 +1532,7 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     int need_to_convert = 0;
     int zero_count = 0; /* true if a count is zero */
     size_t len = 1;
+    double t0;
 
     /* Find info for this file, group, and var. */
     if ((retval = nc4_hdf5_find_grp_h5_var(ncid, varid, &h5, &grp, &var)))
@@ -1697,6 +1731,12 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
                                                  MPI_UNSIGNED_LONG_LONG, MPI_MAX,
                                                  h5->comm))
                     BAIL(NC_EMPI);
+
+                /* Other processes may have extended the unlimited dims
+                 * further than this one. */
+                for (d2 = 0; d2 < var->ndims; d2++)
+                    if (var->dim[d2]->unlimited && xtend_size[d2] > var->dim[d2]->len)
+                        var->dim[d2]->len = (size_t)xtend_size[d2];
             }
 #endif /* USE_PARALLEL4 */
             /* Convert xtend_size back to hsize_t for use with
@@ -1719,19 +1759,25 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     /* Do we need to convert the data? */
     if (need_to_convert)
     {
+        NC_PERF_START(t0);
         if ((retval = nc4_convert_type(data, bufr, mem_nc_type, var->type_info->hdr.id,
                                        len, &range_error, var->fill_value,
                                        (h5->cmode & NC_CLASSIC_MODEL))))
             BAIL(retval);
+        NC_PERF_STOP(&h5->controller->perf, convert_time, t0);
+        NC_PERF_ADD(&h5->controller->perf, conversions, 1);
+        NC_PERF_ADD(&h5->controller->perf, convert_bytes, len * var->type_info->size);
     }
 
     /* Write the data. At last! */
     LOG((4, "about to H5Dwrite datasetid 0x%x mem_spaceid 0x%x "
          "file_spaceid 0x%x", hdf5_var->hdf_datasetid, mem_spaceid, file_spaceid));
+    NC_PERF_START(t0);
     if (H5Dwrite(hdf5_var->hdf_datasetid,
                  ((NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info)->hdf_typeid,
                  mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
         BAIL(NC_EHDFERR);
+    perf_count_h5(h5, var, file_spaceid, 1, t0);
 
     /* Remember that we have written to this var so that Fill Value
      * can't be set for it. */
@@ -1817,6 +1863,7 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     void *bufr = NULL;
     int need_to_convert = 0;
     size_t len = 1;
+    double t0;
 
     /* Find info for this file, group, and var. */
     if ((retval = nc4_hdf5_find_grp_h5_var(ncid, varid, &h5, &grp, &var)))
@@ -1881,12 +1928,9 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
             endindex = start[d2]; /* fixup for zero read count */
         if (dim->unlimited)
         {
-            size_t ulen;
-
             /* We can't go beyond the largest current extent of
                the unlimited dim. */
-            if ((retval = NC4_inq_dim(ncid, dim->hdr.id, NULL, &ulen)))
-                BAIL(retval);
+            size_t ulen = dim->len;
 
             /* Check for out of bound requests. */
             /* Allow start to equal dim size if count is zero. */
@@ -2018,18 +2062,24 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
 
         /* Read this hyperslab into memory. */
         LOG((5, "About to H5Dread some data..."));
+        NC_PERF_START(t0);
         if (H5Dread(hdf5_var->hdf_datasetid,
                     ((NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info)->native_hdf_typeid,
                     mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
             BAIL(NC_EHDFERR);
+        perf_count_h5(h5, var, file_spaceid, 0, t0);
 
         /* Convert data type if needed. */
         if (need_to_convert)
         {
+            NC_PERF_START(t0);
             if ((retval = nc4_convert_type(bufr, data, var->type_info->hdr.id, mem_nc_type,
                                            len, &range_error, var->fill_value,
                                            (h5->cmode & NC_CLASSIC_MODEL))))
                 BAIL(retval);
+            NC_PERF_STOP(&h5->controller->perf, convert_time, t0);
+            NC_PERF_ADD(&h5->controller->perf, conversions, 1);
+            NC_PERF_ADD(&h5->controller->perf, convert_bytes, len * file_type_size);
 
             /* For strict netcdf-3 rules, ignore erange errors between UBYTE
              * and BYTE types. */
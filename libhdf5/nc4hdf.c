@@ -902,6 +902,19 @@ var_create_dataset(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var, nc_bool_t write_dimid
         }
     }
 
+    /* Quantization is lossy and works on the values, so it has to
+     * come before the shuffle and the compressors. */
+    if(var->filters != NULL) {
+	int j;
+	for(j=0;j<nclistlength(var->filters);j++) {
+	    NC_FILTER_SPEC_HDF5* fi = (NC_FILTER_SPEC_HDF5*)nclistget(var->filters,j);
+	    if(fi->filterid != H5Z_FILTER_QUANTIZE)
+		continue;
+	    if(H5Pset_filter(plistid, H5Z_FILTER_QUANTIZE, H5Z_FLAG_MANDATORY, fi->nparams, fi->params) < 0)
+		BAIL(NC_EFILTER);
+	}
+    }
+
     /* If the user wants to shuffle the data, set that up now. */
     if (var->shuffle) {
         if (H5Pset_shuffle(plistid) < 0)
@@ -922,7 +935,9 @@ var_create_dataset(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var, nc_bool_t write_dimid
 	    unsigned int* params;
 	    nparams = fi->nparams;
 	    params = fi->params;
-            if(fi->filterid == H5Z_FILTER_DEFLATE) {/* Handle zip case here */
+            if(fi->filterid == H5Z_FILTER_QUANTIZE) {/* Already set up */
+                continue;
+            } else if(fi->filterid == H5Z_FILTER_DEFLATE) {/* Handle zip case here */
                 unsigned level;
                 if(nparams != 1)
                     BAIL(NC_EFILTER);
@@ -63,8 +63,8 @@ then you need to fix it everywhere.
 It also initializes appropriate external libraries.
 */
 
-int
-nc_initialize()
+static int
+initialize(void)
 {
     int stat = NC_NOERR;
 
@@ -109,8 +109,8 @@ then you need to fix it everywhere.
 It also finalizes appropriate external libraries.
 */
 
-int
-nc_finalize(void)
+static int
+finalize(void)
 {
     int stat = NC_NOERR;
 
@@ -150,3 +150,26 @@ nc_finalize(void)
 
     return NC_NOERR;
 }
+
+/* Under ENABLE_THREADSAFE, other threads wait on the global lock
+   until (de)initialization is complete. */
+
+int
+nc_initialize()
+{
+    int stat;
+    NCLOCKGLOBAL();
+    stat = initialize();
+    NCUNLOCKGLOBAL();
+    return stat;
+}
+
+int
+nc_finalize(void)
+{
+    int stat;
+    NCLOCKGLOBAL();
+    stat = finalize();
+    NCUNLOCKGLOBAL();
+    return stat;
+}
@@ -0,0 +1,186 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+ * NC_extentarray: a set of byte ranges of a file, kept sorted and
+ * disjoint, with adjacent ranges merged. In NC_LAZYFILL mode it holds
+ * the ranges that still need their fill values written.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "nc3internal.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+void
+free_NC_extentarray(NC_extentarray *ncap)
+{
+	assert(ncap != NULL);
+	free(ncap->value);
+	ncap->value = NULL;
+	ncap->nalloc = 0;
+	ncap->nelems = 0;
+}
+
+/*
+ * Return the index of the first extent that ends after 'offset', or
+ * at 'offset' too if 'touch' is set; ncap->nelems if there is none.
+ */
+static size_t
+find_NC_extent(const NC_extentarray *ncap, off_t offset, int touch)
+{
+	size_t lo = 0;
+	size_t hi = ncap->nelems;
+
+	while(lo < hi)
+	{
+		const size_t mid = lo + (hi - lo) / 2;
+		const off_t end = ncap->value[mid].end;
+		if(end < offset || (end == offset && !touch))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+size_t
+NC_extents_find(const NC_extentarray *ncap, off_t offset)
+{
+	assert(ncap != NULL);
+	return find_NC_extent(ncap, offset, 0);
+}
+
+/*
+ * Make room for 'n' more extents.
+ */
+static int
+grow_NC_extentarray(NC_extentarray *ncap, size_t n)
+{
+	NC_extent *vp;
+	size_t nalloc;
+
+	if(ncap->nelems + n <= ncap->nalloc)
+		return NC_NOERR;
+	nalloc = ncap->nalloc == 0 ? NC_ARRAY_GROWBY : 2 * ncap->nalloc;
+	if(nalloc < ncap->nelems + n)
+		nalloc = ncap->nelems + n;
+	vp = (NC_extent *) realloc(ncap->value, nalloc * sizeof(NC_extent));
+	if(vp == NULL)
+		return NC_ENOMEM;
+	ncap->value = vp;
+	ncap->nalloc = nalloc;
+	return NC_NOERR;
+}
+
+/*
+ * Add the range ['begin', 'end') to the set.
+ */
+int
+NC_extents_add(NC_extentarray *ncap, off_t begin, off_t end)
+{
+	size_t first, last;
+	NC_extent *vp;
+
+	assert(ncap != NULL);
+	if(begin >= end)
+		return NC_NOERR;
+
+	/* The extents from 'first' up to 'last' overlap or touch it */
+	first = find_NC_extent(ncap, begin, 1);
+	for(last = first; last < ncap->nelems; last++)
+	{
+		if(ncap->value[last].begin > end)
+			break;
+	}
+
+	if(first == last)
+	{
+		const int status = grow_NC_extentarray(ncap, 1);
+		if(status != NC_NOERR)
+			return status;
+		vp = &ncap->value[first];
+		(void) memmove(vp + 1, vp,
+			(ncap->nelems - first) * sizeof(NC_extent));
+		vp->begin = begin;
+		vp->end = end;
+		ncap->nelems++;
+		return NC_NOERR;
+	}
+
+	/* Merge them all into the first */
+	vp = &ncap->value[first];
+	if(begin < vp->begin)
+		vp->begin = begin;
+	vp->end = ncap->value[last - 1].end;
+	if(end > vp->end)
+		vp->end = end;
+	(void) memmove(vp + 1, &ncap->value[last],
+		(ncap->nelems - last) * sizeof(NC_extent));
+	ncap->nelems -= last - first - 1;
+	return NC_NOERR;
+}
+
+/*
+ * Remove the range ['begin', 'end') from the set.
+ */
+int
+NC_extents_remove(NC_extentarray *ncap, off_t begin, off_t end)
+{
+	size_t first, last;
+	NC_extent *vp;
+
+	assert(ncap != NULL);
+	if(begin >= end)
+		return NC_NOERR;
+
+	first = find_NC_extent(ncap, begin, 0);
+	if(first == ncap->nelems || ncap->value[first].begin >= end)
+		return NC_NOERR;
+	vp = &ncap->value[first];
+
+	if(vp->begin < begin && vp->end > end)
+	{
+		/* A hole in the middle of one extent: split it */
+		const int status = grow_NC_extentarray(ncap, 1);
+		if(status != NC_NOERR)
+			return status;
+		vp = &ncap->value[first];
+		(void) memmove(vp + 1, vp,
+			(ncap->nelems - first) * sizeof(NC_extent));
+		ncap->nelems++;
+		vp[0].end = begin;
+		vp[1].begin = end;
+		return NC_NOERR;
+	}
+
+	if(vp->begin < begin)
+	{
+		/* Keep the head of the first */
+		vp->end = begin;
+		first++;
+	}
+	for(last = first; last < ncap->nelems; last++)
+	{
+		if(ncap->value[last].end > end)
+			break;
+	}
+	if(last < ncap->nelems && ncap->value[last].begin < end)
+	{
+		/* Keep the tail of the last */
+		ncap->value[last].begin = end;
+	}
+	if(last > first)
+	{
+		(void) memmove(&ncap->value[first], &ncap->value[last],
+			(ncap->nelems - last) * sizeof(NC_extent));
+		ncap->nelems -= last - first;
+	}
+	return NC_NOERR;
+}
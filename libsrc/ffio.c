@@ -38,6 +38,7 @@
 #include "ncio.h"
 #include "fbits.h"
 #include "rnd.h"
+#include "ncperf.h"
 
 #if !defined(NDEBUG) && !defined(X_INT_MAX)
 #define  X_INT_MAX 2147483647
@@ -171,6 +172,8 @@ ffio_pgout(ncio *const nciop,
 		return errno;
 	}
 	*posp += extent;
+	NC_PERF_ADD(nciop->perf, io_writes, 1);
+	NC_PERF_ADD(nciop->perf, io_write_bytes, extent);
 
 	return NC_NOERR;
 }
@@ -201,6 +204,9 @@ ffio_pgin(ncio *const nciop,
 
 	errno = 0;
 	nread = ffread(nciop->fd, vp, extent);
+	NC_PERF_ADD(nciop->perf, io_reads, 1);
+	if(nread > 0)
+		NC_PERF_ADD(nciop->perf, io_read_bytes, nread);
 	if(nread != extent)
 	{
 		status = errno;
@@ -533,6 +539,8 @@ ncio_ffio_new(const char *path, int ioflags)
 
 				/* cast away const */
 	*((void **)&nciop->pvt) = (void *)(nciop->path + sz_path);
+	*((ncio_fillfunc **)&nciop->fill) = NULL; /* cast away const */
+	nciop->perf = NULL;
 
 	ncio_ffio_init(nciop);
 
@@ -35,6 +35,7 @@
 #include "rnd.h"
 #include "ncbytes.h"
 #include "nchttp.h"
+#include "ncperf.h"
 
 #define DEFAULTPAGESIZE 16384
 
@@ -247,6 +248,7 @@ httpio_get(ncio* const nciop, off_t offset, size_t extent, int rflags, void** co
 {
     int status = NC_NOERR;
     NCHTTP* http;
+    double t0;
 
     if(nciop == NULL || nciop->pvt == NULL) {status = NC_EINVAL; goto done;}
     http = (NCHTTP*)nciop->pvt;
@@ -254,8 +256,14 @@ httpio_get(ncio* const nciop, off_t offset, size_t extent, int rflags, void** co
     assert(http->region == NULL);
     http->region = ncbytesnew();
     ncbytessetalloc(http->region,(unsigned long)extent);
-    if((status = nc_http_read(http->curl,nciop->path,offset,extent,http->region)))
+    NC_PERF_START(t0);
+    status = nc_http_read(http->curl,nciop->path,offset,extent,http->region);
+    NC_PERF_STOP(nciop->perf,http_time,t0);
+    NC_PERF_ADD(nciop->perf,http_requests,1);
+    if(status)
 	goto done;
+    NC_PERF_ADD(nciop->perf,io_reads,1);
+    NC_PERF_ADD(nciop->perf,io_read_bytes,extent);
     assert(ncbyteslength(http->region) == extent);
     if(vpp) *vpp = ncbytescontents(http->region);
 done:
@@ -50,6 +50,7 @@ typedef int ssize_t;
 #include "ncio.h"
 #include "fbits.h"
 #include "rnd.h"
+#include "ncperf.h"
 
 /* #define INSTRUMENT 1 */
 #if INSTRUMENT /* debugging */
@@ -92,6 +93,29 @@ reallocx(void* mem, size_t newsize, size_t oldsize)
 }
 #endif
 
+/*
+Diskless files are kept in pages of MEMIO_PAGESIZE bytes rather than
+in one block, so that they grow without realloc() copying all of
+them, and so that nc_sync() and close write to the persisted file
+only the pages changed since the last flush. A page is allocated when
+it is first written; one never written reads as zeros. A get() that
+straddles pages is served from a bounce buffer, which rel() copies
+back if it was modified. In-memory files (NC_INMEMORY) stay in the
+caller's single block.
+*/
+#ifndef MEMIO_PAGESIZE
+#define MEMIO_PAGESIZE ((size_t)1 << 20)
+#endif
+/* The chunk size of a paged file: few gets of this size straddle pages */
+#define MEMIO_PAGEDCHUNK (MEMIO_PAGESIZE / 16)
+
+typedef struct MEMIO_bounce {
+    struct MEMIO_bounce* next;
+    off_t offset;
+    size_t extent;
+    char* buf;
+} MEMIO_bounce;
+
 /* Private data for memio */
 
 typedef struct NCMEMIO {
@@ -105,6 +129,15 @@ typedef struct NCMEMIO {
     /* Convenience flags */
     int diskless;
     int inmemory; /* assert(inmemory iff !diskless */
+    /* Paged files; memory is NULL */
+    int paged;
+    char** pages;          /* NULL for a page never written */
+    unsigned char* dirty;  /* per page: changed since the last flush */
+    size_t npages;         /* allocated length of pages and dirty */
+    MEMIO_bounce* bounces; /* outstanding gets that straddle pages */
+    int fd;                /* the persisted file once flushed, else -1 */
+    off_t disksize;        /* its size */
+    int rewrite;           /* the persisted file must be rewritten whole */
 } NCMEMIO;
 
 /* Forward */
@@ -115,8 +148,15 @@ static int memio_sync(ncio *const nciop);
 static int memio_filesize(ncio* nciop, off_t* filesizep);
 static int memio_pad_length(ncio* nciop, off_t length);
 static int memio_close(ncio* nciop, int);
-static int readfile(const char* path, NC_memio*);
 static int writefile(const char* path, NCMEMIO*);
+static int readpages(const char* path, NCMEMIO*);
+static int memio_flush(ncio* nciop);
+static int paged_resize(NCMEMIO* memio, size_t size);
+static int paged_copy(NCMEMIO* memio, size_t offset, char* buf, size_t n, int write);
+static int paged_get(NCMEMIO* memio, off_t offset, size_t extent, int rflags, void** vpp);
+static int paged_rel(NCMEMIO* memio, off_t offset, int rflags);
+static int paged_move(NCMEMIO* memio, size_t to, size_t from, size_t nbytes);
+static void paged_free(NCMEMIO* memio);
 static int fileiswriteable(const char* path);
 static int fileexists(const char* path);
 
@@ -208,6 +248,8 @@ memio_new(const char* path, int ioflags, off_t initialsize, ncio** nciopp, NCMEM
 	memio->inmemory = 1;
     if(fIsSet(ioflags,NC_PERSIST))
 	memio->persist = 1;
+    memio->paged = memio->diskless;
+    memio->fd = -1;
 
 done:
     return status;
@@ -260,9 +302,17 @@ memio_create(const char* path, int ioflags,
 	    {status = EPERM; goto unwind_open;}	
     }
 
-    /* Allocate the memory for this file */
-    memio->memory = (char*)malloc((size_t)memio->alloc);
-    if(memio->memory == NULL) {status = NC_ENOMEM; goto unwind_open;}
+    /* Allocate the memory for this file; pages come when written */
+    if(memio->paged) {
+	size_t size = memio->size;
+	memio->size = 0;
+	status = paged_resize(memio,size);
+	if(status != NC_NOERR) goto unwind_open;
+	memio->rewrite = 1; /* replaces any existing file */
+    } else {
+        memio->memory = (char*)malloc((size_t)memio->alloc);
+        if(memio->memory == NULL) {status = NC_ENOMEM; goto unwind_open;}
+    }
     memio->locked = 0;
 
 #ifdef DEBUG
@@ -285,7 +335,7 @@ fprintf(stderr,"memio_create: initial memory: %lu/%lu\n",(unsigned long)memio->m
     }
 
     /* Pick a default sizehint */
-    if(sizehintp) *sizehintp = (size_t)pagesize;
+    if(sizehintp) *sizehintp = memio->paged ? MEMIO_PAGEDCHUNK : (size_t)pagesize;
 
     *nciopp = nciop;
     return NC_NOERR;
@@ -348,12 +398,8 @@ memio_open(const char* path,
         if(!locked && fIsSet(ioflags,NC_WRITE)) {
 	    memparams->memory = NULL;	    
 	}	
-    } else { /* read the file into a chunk of memory*/
+    } else /* read the file into pages, below */
 	assert(diskless);
-	status = readfile(path,&meminfo);
-	if(status != NC_NOERR)
-	    {goto unwind_open;}
-    }
 
     /* Fix up initial size */
     initialsize = meminfo.size;
@@ -365,11 +411,16 @@ memio_open(const char* path,
     memio->locked = locked;
 
     /* Initialize the memio memory */
-    memio->memory = meminfo.memory;
+    if(memio->paged) {
+	status = readpages(path,memio);
+	if(status != NC_NOERR)
+	    {goto unwind_open;}
+    } else
+        memio->memory = meminfo.memory;
 
     /* memio_new may have modified the allocated size, in which case,
        reallocate the memory unless the memory is locked. */    
-    if(memio->alloc > meminfo.size) {
+    if(!memio->paged && memio->alloc > meminfo.size) {
 	if(memio->locked)
 	    memio->alloc = meminfo.size; /* force it back to what it was */
 	else {
@@ -398,6 +449,7 @@ fprintf(stderr,"memio_open: initial memory: %lu/%lu\n",(unsigned long)memio->mem
     /* sizehint must be multiple of 8 */
     sizehint = (sizehint / 8) * 8;
     if(sizehint < 8) sizehint = 8;
+    if(memio->paged) sizehint = MEMIO_PAGEDCHUNK;
 
     fd = nc__pseudofd();
     *((int* )&nciop->fd) = fd;
@@ -453,6 +505,8 @@ memio_pad_length(ncio* nciop, off_t length)
 
     if(!fIsSet(nciop->ioflags,NC_WRITE))
         return EPERM; /* attempt to write readonly file*/
+    if(memio->paged)
+	return paged_resize(memio,len);
     if(memio->locked)
 	return NC_EINMEMORY;
 
@@ -513,9 +567,14 @@ memio_close(ncio* nciop, int doUnlink)
     assert(memio != NULL);
 
     /* See if the user wants the contents persisted to a file */
-    if(memio->persist && memio->memory != NULL) {
+    if(memio->persist && memio->paged) {
+	status = memio_flush(nciop);
+	if(memio->fd >= 0) close(memio->fd);
+    } else if(memio->persist && memio->memory != NULL) {
 	status = writefile(nciop->path,memio);		
     }
+    if(memio->paged)
+	paged_free(memio);
 
     /* We only free the memio memory if file is not locked or has been modified */
     if(memio->memory != NULL && (!memio->locked || memio->modified)) {
@@ -534,6 +593,11 @@ guarantee(ncio* nciop, off_t endpoint0)
 {
     NCMEMIO* memio = (NCMEMIO*)nciop->pvt;
     size_t endpoint = (size_t)endpoint0;
+    if(memio->paged) {
+	if(endpoint > memio->size)
+	    return paged_resize(memio,endpoint);
+	return NC_NOERR;
+    }
     if(endpoint > memio->alloc) {
 	/* extend the allocated memory and size */
 	int status = memio_pad_length(nciop,endpoint);
@@ -556,9 +620,12 @@ memio_get(ncio* const nciop, off_t offset, size_t extent, int rflags, void** con
     if(nciop == NULL || nciop->pvt == NULL) return NC_EINVAL;
     memio = (NCMEMIO*)nciop->pvt;
     status = guarantee(nciop, offset+(off_t)extent);
-    memio->locked++;
     if(status != NC_NOERR) return status;
-    if(vpp) *vpp = memio->memory+offset;
+    if(memio->paged) {
+	status = paged_get(memio, offset, extent, rflags, vpp);
+	if(status != NC_NOERR) return status;
+    } else if(vpp) *vpp = memio->memory+offset;
+    memio->locked++;
     return NC_NOERR;
 }
 
@@ -578,6 +645,8 @@ memio_move(ncio* const nciop, off_t to, off_t from, size_t nbytes, int ignored)
        status = guarantee(nciop,to+(off_t)nbytes);
        if(status != NC_NOERR) return status;
     }
+    if(memio->paged)
+	return paged_move(memio,(size_t)to,(size_t)from,nbytes);
     /* check for overlap */
     if((to + (off_t)nbytes) > from || (from + (off_t)nbytes) > to) {
 	/* Ranges overlap */
@@ -623,17 +692,25 @@ memio_rel(ncio* const nciop, off_t offset, int rflags)
     if(nciop == NULL || nciop->pvt == NULL) return NC_EINVAL;
     memio = (NCMEMIO*)nciop->pvt;
     memio->locked--;
-    return NC_NOERR; /* do nothing */
+    if(memio->paged)
+	return paged_rel(memio,offset,rflags);
+    return NC_NOERR;
 }
 
 /*
  * Write out any dirty buffers to disk and
  * ensure that next read will get data from disk.
+ * Only a persisted diskless file has any.
  */
 static int
 memio_sync(ncio* const nciop)
 {
-    return NC_NOERR; /* do nothing */
+    NCMEMIO* memio;
+    if(nciop == NULL || nciop->pvt == NULL) return NC_EINVAL;
+    memio = (NCMEMIO*)nciop->pvt;
+    if(memio->persist && memio->paged)
+	return memio_flush(nciop);
+    return NC_NOERR;
 }
 
 /* "Hidden" Internal function to extract the 
@@ -650,7 +727,14 @@ memio_extract(ncio* const nciop, size_t* sizep, void** memoryp)
     assert(memio != NULL);
     if(sizep) *sizep = memio->size;
 
-    if(memoryp && memio->memory != NULL) {
+    if(memoryp && memio->paged) {
+	/* Put the pages together */
+	char* memory = (char*)malloc(memio->size > 0 ? memio->size : 1);
+	if(memory == NULL) return NC_ENOMEM;
+	status = paged_copy(memio,0,memory,memio->size,0);
+	if(status != NC_NOERR) {free(memory); return status;}
+	*memoryp = memory;
+    } else if(memoryp && memio->memory != NULL) {
 	*memoryp = memio->memory;
 	memio->memory = NULL; /* make sure it does not get free'd */
     }
@@ -697,87 +781,364 @@ fileisreadable(const char* path)
 }
 #endif
 
-/* Read contents of a disk file into a memory chunk */
+/* write contents of a memory chunk back into a disk file */
 static int
-readfile(const char* path, NC_memio* memio)
+writefile(const char* path, NCMEMIO* memio)
 {
     int status = NC_NOERR;
     FILE* f = NULL;
-    size_t filesize = 0;
     size_t count = 0;
-    char* memory = NULL;
     char* p = NULL;
 
-    /* Open the file for reading */
+    /* Open/create the file for writing*/
 #ifdef _MSC_VER
-    f = NCfopen(path,"rb");
+    f = NCfopen(path,"wb");
 #else
-    f = NCfopen(path,"r");
+    f = NCfopen(path,"w");
 #endif
     if(f == NULL)
-	{status = errno; goto done;}
-    /* get current filesize */
-    if(fseek(f,0,SEEK_END) < 0)
-	{status = errno; goto done;}
-    filesize = (size_t)ftell(f);
-    /* allocate memory */
-    memory = malloc((size_t)filesize);
-    if(memory == NULL)
-	{status = NC_ENOMEM; goto done;}
-    /* move pointer back to beginning of file */
+        {status = errno; goto done;}
     rewind(f);
-    count = filesize;
-    p = memory;
+    count = memio->size;
+    p = memio->memory;
     while(count > 0) {
         size_t actual;
-        actual = fread(p,1,count,f);
+        actual = fwrite(p,1,count,f);
 	if(actual == 0 || ferror(f))
 	    {status = NC_EIO; goto done;}	 
 	count -= actual;
 	p += actual;
     }
-    if(memio) {
-	memio->size = (size_t)filesize;
-	memio->memory = memory;
-	memory = NULL;
-    }
-
 done:
-    if(memory != NULL)
-	free(memory);
     if(f != NULL) fclose(f);
     return status;    
 }
 
-/* write contents of a memory chunk back into a disk file */
+/* Paged files */
+
+/* Return page i, allocating it if need be */
+static char*
+paged_page(NCMEMIO* memio, size_t i)
+{
+    assert(i < memio->npages);
+    if(memio->pages[i] == NULL)
+	memio->pages[i] = (char*)calloc(1,MEMIO_PAGESIZE);
+    return memio->pages[i];
+}
+
+/* Make the file size bytes long. Growing only extends the page table,
+   which always has an entry for the page at offset size. Shrinking
+   frees the pages past the end and clears the rest of the last one,
+   so that they read as zeros if the file grows again. */
 static int
-writefile(const char* path, NCMEMIO* memio)
+paged_resize(NCMEMIO* memio, size_t size)
+{
+    size_t need = size / MEMIO_PAGESIZE + 1;
+    size_t used = (size + MEMIO_PAGESIZE - 1) / MEMIO_PAGESIZE;
+    size_t i;
+
+    if(need > memio->npages) {
+	size_t n = (memio->npages == 0 ? 16 : memio->npages);
+	char** pages;
+	unsigned char* dirty;
+	while(n < need) n *= 2;
+	pages = (char**)realloc(memio->pages,n*sizeof(char*));
+	if(pages == NULL) return NC_ENOMEM;
+	memio->pages = pages;
+	dirty = (unsigned char*)realloc(memio->dirty,n);
+	if(dirty == NULL) return NC_ENOMEM;
+	memio->dirty = dirty;
+	memset(pages+memio->npages,0,(n - memio->npages)*sizeof(char*));
+	memset(dirty+memio->npages,0,n - memio->npages);
+	memio->npages = n;
+    }
+    if(size < memio->size) {
+	for(i=used;i<memio->npages;i++) {
+	    free(memio->pages[i]);
+	    memio->pages[i] = NULL;
+	    memio->dirty[i] = 0;
+	}
+	if(size % MEMIO_PAGESIZE != 0 && memio->pages[used-1] != NULL) {
+	    size_t keep = size % MEMIO_PAGESIZE;
+	    memset(memio->pages[used-1]+keep,0,MEMIO_PAGESIZE - keep);
+	    memio->dirty[used-1] = 1;
+	}
+	if((off_t)size < memio->disksize)
+	    memio->rewrite = 1;
+    }
+    memio->size = size;
+    return NC_NOERR;
+}
+
+/* Copy n bytes at offset out of the pages into buf, or into them from
+   buf if write is set */
+static int
+paged_copy(NCMEMIO* memio, size_t offset, char* buf, size_t n, int write)
+{
+    while(n > 0) {
+	size_t i = offset / MEMIO_PAGESIZE;
+	size_t off = offset % MEMIO_PAGESIZE;
+	size_t len = MIN(n,MEMIO_PAGESIZE - off);
+	if(write) {
+	    char* page = paged_page(memio,i);
+	    if(page == NULL) return NC_ENOMEM;
+	    memcpy(page+off,buf,len);
+	    memio->dirty[i] = 1;
+	} else if(memio->pages[i] == NULL)
+	    memset(buf,0,len);
+	else
+	    memcpy(buf,memio->pages[i]+off,len);
+	offset += len;
+	buf += len;
+	n -= len;
+    }
+    return NC_NOERR;
+}
+
+static int
+paged_get(NCMEMIO* memio, off_t offset, size_t extent, int rflags, void** vpp)
+{
+    int status = NC_NOERR;
+    size_t i = (size_t)offset / MEMIO_PAGESIZE;
+    size_t off = (size_t)offset % MEMIO_PAGESIZE;
+    MEMIO_bounce* bounce = NULL;
+
+    if(off + extent <= MEMIO_PAGESIZE) {
+	char* page = paged_page(memio,i);
+	if(page == NULL) return NC_ENOMEM;
+	if(fIsSet(rflags,RGN_WRITE))
+	    memio->dirty[i] = 1;
+	if(vpp) *vpp = page+off;
+	return NC_NOERR;
+    }
+
+    /* It straddles pages */
+    bounce = (MEMIO_bounce*)calloc(1,sizeof(MEMIO_bounce));
+    if(bounce == NULL) return NC_ENOMEM;
+    bounce->buf = (char*)malloc(extent);
+    if(bounce->buf == NULL) {status = NC_ENOMEM; goto done;}
+    status = paged_copy(memio,(size_t)offset,bounce->buf,extent,0);
+    if(status != NC_NOERR) goto done;
+    bounce->offset = offset;
+    bounce->extent = extent;
+    bounce->next = memio->bounces;
+    memio->bounces = bounce;
+    if(vpp) *vpp = bounce->buf;
+    bounce = NULL;
+done:
+    if(bounce != NULL) {
+	free(bounce->buf);
+	free(bounce);
+    }
+    return status;
+}
+
+/* Release a get; copy back a bounce buffer if it was modified */
+static int
+paged_rel(NCMEMIO* memio, off_t offset, int rflags)
+{
+    int status = NC_NOERR;
+    MEMIO_bounce** bp;
+    MEMIO_bounce* bounce;
+
+    for(bp=&memio->bounces;*bp != NULL;bp=&(*bp)->next) {
+	if((*bp)->offset == offset) break;
+    }
+    if((bounce = *bp) == NULL)
+	return NC_NOERR; /* it did not straddle */
+    *bp = bounce->next;
+    if(fIsSet(rflags,RGN_MODIFIED))
+	status = paged_copy(memio,(size_t)offset,bounce->buf,bounce->extent,1);
+    free(bounce->buf);
+    free(bounce);
+    return status;
+}
+
+/* Move one piece within at most one source and one target page */
+static int
+paged_movepiece(NCMEMIO* memio, size_t to, size_t from, size_t len)
+{
+    char* page = paged_page(memio,to / MEMIO_PAGESIZE);
+    const char* src = memio->pages[from / MEMIO_PAGESIZE];
+
+    if(page == NULL) return NC_ENOMEM;
+    if(src == NULL)
+	memset(page + to % MEMIO_PAGESIZE,0,len);
+    else
+	memmove(page + to % MEMIO_PAGESIZE,src + from % MEMIO_PAGESIZE,len);
+    memio->dirty[to / MEMIO_PAGESIZE] = 1;
+    return NC_NOERR;
+}
+
+/* Like memmove(), in pieces that do not cross pages; moving up goes
+   from the end so that overlapping data is not overwritten first */
+static int
+paged_move(NCMEMIO* memio, size_t to, size_t from, size_t nbytes)
+{
+    int status = NC_NOERR;
+
+    if(to < from) {
+	while(nbytes > 0 && status == NC_NOERR) {
+	    size_t len = MIN(nbytes,MEMIO_PAGESIZE - from % MEMIO_PAGESIZE);
+	    len = MIN(len,MEMIO_PAGESIZE - to % MEMIO_PAGESIZE);
+	    status = paged_movepiece(memio,to,from,len);
+	    to += len;
+	    from += len;
+	    nbytes -= len;
+	}
+    } else if(to > from) {
+	while(nbytes > 0 && status == NC_NOERR) {
+	    size_t len = MIN(nbytes,(from + nbytes - 1) % MEMIO_PAGESIZE + 1);
+	    len = MIN(len,(to + nbytes - 1) % MEMIO_PAGESIZE + 1);
+	    nbytes -= len;
+	    status = paged_movepiece(memio,to + nbytes,from + nbytes,len);
+	}
+    }
+    return status;
+}
+
+static void
+paged_free(NCMEMIO* memio)
+{
+    size_t i;
+    while(memio->bounces != NULL) {
+	MEMIO_bounce* bounce = memio->bounces;
+	memio->bounces = bounce->next;
+	free(bounce->buf);
+	free(bounce);
+    }
+    for(i=0;i<memio->npages;i++)
+	free(memio->pages[i]);
+    free(memio->pages);
+    free(memio->dirty);
+    memio->pages = NULL;
+    memio->dirty = NULL;
+    memio->npages = 0;
+}
+
+/* Read a disk file into the pages of a diskless file */
+static int
+readpages(const char* path, NCMEMIO* memio)
 {
     int status = NC_NOERR;
     FILE* f = NULL;
-    size_t count = 0;
-    char* p = NULL;
+    size_t filesize = 0;
+    size_t offset;
+    long pos;
 
-    /* Open/create the file for writing*/
+    /* Open the file for reading */
 #ifdef _MSC_VER
-    f = NCfopen(path,"wb");
+    f = NCfopen(path,"rb");
 #else
-    f = NCfopen(path,"w");
+    f = NCfopen(path,"r");
 #endif
     if(f == NULL)
-        {status = errno; goto done;}
+	{status = errno; goto done;}
+    /* get current filesize */
+    if(fseek(f,0,SEEK_END) < 0 || (pos = ftell(f)) < 0)
+	{status = errno; goto done;}
+    filesize = (size_t)pos;
+    status = paged_resize(memio,filesize);
+    if(status != NC_NOERR) goto done;
+    /* move pointer back to beginning of file */
     rewind(f);
-    count = memio->size;
-    p = memio->memory;
-    while(count > 0) {
-        size_t actual;
-        actual = fwrite(p,1,count,f);
-	if(actual == 0 || ferror(f))
-	    {status = NC_EIO; goto done;}	 
-	count -= actual;
-	p += actual;
+    for(offset=0;offset < filesize;offset += MEMIO_PAGESIZE) {
+	char* p = paged_page(memio,offset / MEMIO_PAGESIZE);
+	size_t count = MIN(MEMIO_PAGESIZE,filesize - offset);
+	if(p == NULL)
+	    {status = NC_ENOMEM; goto done;}
+	while(count > 0) {
+	    size_t actual = fread(p,1,count,f);
+	    if(actual == 0 || ferror(f))
+		{status = NC_EIO; goto done;}
+	    count -= actual;
+	    p += actual;
+	}
     }
+    memio->disksize = (off_t)filesize;
+
 done:
     if(f != NULL) fclose(f);
-    return status;    
+    return status;
+}
+
+/* Write n bytes at offset of a file */
+static int
+writeat(int fd, off_t offset, const char* p, size_t n)
+{
+    if(lseek(fd,offset,SEEK_SET) != offset)
+	return errno;
+    while(n > 0) {
+	ssize_t actual = write(fd,p,n);
+	if(actual < 0) {
+	    if(errno == EINTR) continue;
+	    return errno;
+	}
+	if(actual == 0)
+	    return NC_EIO;
+	p += actual;
+	n -= (size_t)actual;
+    }
+    return NC_NOERR;
+}
+
+/* Write the pages changed since the last flush to the persisted file */
+static int
+memio_flush(ncio* nciop)
+{
+    int status = NC_NOERR;
+    NCMEMIO* memio = (NCMEMIO*)nciop->pvt;
+    size_t used = (memio->size + MEMIO_PAGESIZE - 1) / MEMIO_PAGESIZE;
+    off_t end = 0; /* end of what was written */
+    size_t i;
+
+    if(memio->rewrite) {
+	for(i=0;i<used;i++)
+	    memio->dirty[i] = (memio->pages[i] != NULL);
+    } else {
+	for(i=0;i<used;i++)
+	    if(memio->dirty[i]) break;
+	if(i == used && memio->disksize == (off_t)memio->size)
+	    return NC_NOERR; /* nothing to do */
+    }
+
+    if(memio->fd < 0 || memio->rewrite) {
+	int oflags = O_RDWR|O_CREAT;
+	if(memio->rewrite)
+	    fSet(oflags,O_TRUNC);
+#ifdef O_BINARY
+	fSet(oflags,O_BINARY);
+#endif
+	if(memio->fd >= 0)
+	    close(memio->fd);
+	memio->fd = NCopen3(nciop->path,oflags,OPENMODE);
+	if(memio->fd < 0)
+	    return errno;
+	if(memio->rewrite)
+	    memio->disksize = 0;
+	memio->rewrite = 0;
+    }
+
+    for(i=0;i<used;i++) {
+	off_t offset = (off_t)(i * MEMIO_PAGESIZE);
+	size_t len = MIN(MEMIO_PAGESIZE,memio->size - i * MEMIO_PAGESIZE);
+	if(!memio->dirty[i] || memio->pages[i] == NULL)
+	    continue;
+	status = writeat(memio->fd,offset,memio->pages[i],len);
+	if(status != NC_NOERR)
+	    return status;
+	NC_PERF_ADD(nciop->perf,io_writes,1);
+	NC_PERF_ADD(nciop->perf,io_write_bytes,len);
+	memio->dirty[i] = 0;
+	end = offset + (off_t)len;
+    }
+    /* The file ends in pages never written: extend it with a zero */
+    if(end < (off_t)memio->size && memio->disksize < (off_t)memio->size) {
+	const char zero = 0;
+	status = writeat(memio->fd,(off_t)memio->size - 1,&zero,1);
+	if(status != NC_NOERR)
+	    return status;
+    }
+    memio->disksize = (off_t)memio->size;
+    return NC_NOERR;
 }
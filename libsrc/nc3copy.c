@@ -0,0 +1,261 @@
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+
+/*
+ * Copy the data of one classic file to another as it is stored,
+ * without converting it to and from native types. All classic
+ * formats (CDF-1, CDF-2 and CDF-5) store values the same way, so
+ * only where each variable starts differs between the two files.
+ * The copy is a list of byte ranges, built variable by variable and
+ * record by record in output order; ranges that are adjacent in both
+ * files are merged, so files with the same layout apart from the
+ * header are copied with a single sequential pass.
+ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include "nc3internal.h"
+#include "ncio.h"
+#include "fbits.h"
+#include "nc3dispatch.h"
+
+/* A byte range still to be copied */
+typedef struct Range {
+    off_t in;   /* offset in the input file */
+    off_t out;  /* offset in the output file */
+    off_t len;  /* 0 if none */
+} Range;
+
+/* Copy one byte range through both files' ncio, in pieces no larger
+   than either file's chunk */
+static int
+copy_range(NC3_INFO* in, NC3_INFO* out, const Range* r)
+{
+    int status = NC_NOERR;
+    size_t step = in->chunk < out->chunk ? in->chunk : out->chunk;
+    off_t done = 0;
+
+    while(done < r->len) {
+        size_t extent = step;
+        void* src = NULL;
+        void* dst = NULL;
+        if(r->len - done < (off_t)step)
+            extent = (size_t)(r->len - done);
+        /* Copied over, so no longer to be filled (NC_LAZYFILL) */
+        if(out->unfilled.nelems != 0
+           && (status = NC_extents_remove(&out->unfilled, r->out + done,
+                                          r->out + done + (off_t)extent)))
+            break;
+        status = ncio_get(in->nciop, r->in + done, extent, 0, &src);
+        if(status != NC_NOERR)
+            break;
+        status = ncio_get(out->nciop, r->out + done, extent, RGN_WRITE, &dst);
+        if(status != NC_NOERR) {
+            (void)ncio_rel(in->nciop, r->in + done, 0);
+            break;
+        }
+        memcpy(dst, src, extent);
+        status = ncio_rel(out->nciop, r->out + done, RGN_MODIFIED);
+        (void)ncio_rel(in->nciop, r->in + done, 0);
+        if(status != NC_NOERR)
+            break;
+        done += (off_t)extent;
+    }
+    return status;
+}
+
+/* Append a range to the pending one if it directly follows it in both
+   files, otherwise copy the pending range and start a new one */
+static int
+add_range(NC3_INFO* in, NC3_INFO* out, Range* pending,
+          off_t inoff, off_t outoff, off_t len)
+{
+    int status = NC_NOERR;
+    if(len <= 0)
+        return NC_NOERR;
+    if(pending->len > 0
+       && pending->in + pending->len == inoff
+       && pending->out + pending->len == outoff) {
+        pending->len += len;
+        return NC_NOERR;
+    }
+    if(pending->len > 0 && (status = copy_range(in, out, pending)))
+        return status;
+    pending->in = inoff;
+    pending->out = outoff;
+    pending->len = len;
+    return NC_NOERR;
+}
+
+/* Bytes of one index along the first dimension, without padding */
+static off_t
+slab_size(const NC_var* varp)
+{
+    size_t i;
+    off_t size = (off_t)varp->xsz;
+    for(i = 1; i < varp->ndims; i++)
+        size *= (off_t)varp->shape[i];
+    return size;
+}
+
+/* Bytes of a record variable in one record. A file with a single
+   record variable does not pad its records. */
+static off_t
+rec_size(const NC3_INFO* ncp, const NC_var* varp)
+{
+    return ((off_t)ncp->recsize < varp->len ? (off_t)ncp->recsize : varp->len);
+}
+
+/* Length along the first dimension of the data of an input variable */
+static size_t
+first_len(const NC3_INFO* ncp, const NC_var* varp)
+{
+    if(IS_RECVAR(varp))
+        return NC_get_numrecs(ncp);
+    return (varp->ndims > 0 ? varp->shape[0] : 1);
+}
+
+/* Find the input variable whose data goes to output variable ovarp:
+   same name, type and shape, except that either one may have the
+   record dimension where the other has a fixed dimension of the
+   same length. */
+static int
+match_var(const NC3_INFO* in, const NC_var* ovarp, NC_var** ivarpp)
+{
+    NC_var* ivarp = NULL;
+    size_t i;
+
+    if(NC_findvar(&in->vars, ovarp->name->cp, &ivarp) < 0)
+        return NC_EINVAL;
+    if(ivarp->type != ovarp->type || ivarp->ndims != ovarp->ndims)
+        return NC_EINVAL;
+    for(i = 1; i < ovarp->ndims; i++)
+        if(ivarp->shape[i] != ovarp->shape[i])
+            return NC_EINVAL;
+    if(ovarp->ndims > 0 && !IS_RECVAR(ovarp)
+       && first_len(in, ivarp) != ovarp->shape[0])
+        return NC_EINVAL;
+    *ivarpp = ivarp;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Copy the data of every variable of classic file ncid_out
+ * from the variable of the same name in classic file ncid_in, as
+ * stored bytes. Nothing is written unless every output variable has
+ * a matching input variable.
+ *
+ * @param ncid_in Input file ID.
+ * @param ncid_out Output file ID, in data mode.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL The variables of the files do not match.
+ * @return ::NC_EINDEFINE A file is in define mode.
+ * @return ::NC_EPERM Output file is read-only.
+ */
+int
+NC3_copy_data_raw(int ncid_in, int ncid_out)
+{
+    int status = NC_NOERR;
+    NC *nc;
+    NC3_INFO *in, *out;
+    NC_var **ovars, **ivars = NULL;
+    size_t nvars, i, r, nrecs = 0;
+    int haverecs = 0;
+    Range pending = {0, 0, 0};
+
+    if((status = NC_check_id(ncid_in, &nc)))
+        return status;
+    in = NC3_DATA(nc);
+    if((status = NC_check_id(ncid_out, &nc)))
+        return status;
+    out = NC3_DATA(nc);
+    if(in == out)
+        return NC_EINVAL;
+    if(NC_indef(in) || NC_indef(out))
+        return NC_EINDEFINE;
+    if(NC_readonly(out))
+        return NC_EPERM;
+    /* The fill values put off in the input are to be copied too */
+    if((status = NC_fill_unfilled(in)))
+        return status;
+
+    /* Match up all the variables before writing anything */
+    nvars = out->vars.nelems;
+    ovars = out->vars.value;
+    if(nvars > 0 && (ivars = (NC_var**)calloc(nvars, sizeof(NC_var*))) == NULL)
+        return NC_ENOMEM;
+    for(i = 0; i < nvars; i++) {
+        if((status = match_var(in, ovars[i], &ivars[i])))
+            goto done;
+        if(IS_RECVAR(ovars[i])) {
+            size_t len = first_len(in, ivars[i]);
+            if(haverecs && len != nrecs)
+                {status = NC_EINVAL; goto done;}
+            nrecs = len;
+            haverecs = 1;
+        }
+    }
+
+    /* Fixed size variables */
+    for(i = 0; i < nvars; i++) {
+        NC_var *ovarp = ovars[i], *ivarp = ivars[i];
+        if(IS_RECVAR(ovarp))
+            continue;
+        if(!IS_RECVAR(ivarp)) {
+            off_t len = (ivarp->len < ovarp->len ? ivarp->len : ovarp->len);
+            status = add_range(in, out, &pending, ivarp->begin, ovarp->begin, len);
+        } else {
+            /* a record variable becoming fixed size */
+            off_t slab = slab_size(ovarp);
+            size_t n = first_len(in, ivarp);
+            for(r = 0; status == NC_NOERR && r < n; r++)
+                status = add_range(in, out, &pending,
+                                   ivarp->begin + (off_t)r * (off_t)in->recsize,
+                                   ovarp->begin + (off_t)r * slab, slab);
+        }
+        if(status != NC_NOERR)
+            goto done;
+    }
+
+    /* Record variables, one record at a time */
+    for(r = 0; r < nrecs; r++) {
+        for(i = 0; i < nvars; i++) {
+            NC_var *ovarp = ovars[i], *ivarp = ivars[i];
+            off_t outoff, inoff, len;
+            if(!IS_RECVAR(ovarp))
+                continue;
+            outoff = ovarp->begin + (off_t)r * (off_t)out->recsize;
+            if(IS_RECVAR(ivarp)) {
+                off_t inlen = rec_size(in, ivarp), outlen = rec_size(out, ovarp);
+                inoff = ivarp->begin + (off_t)r * (off_t)in->recsize;
+                len = (inlen < outlen ? inlen : outlen);
+            } else {
+                /* a fixed size variable becoming a record variable */
+                len = slab_size(ovarp);
+                inoff = ivarp->begin + (off_t)r * len;
+            }
+            if((status = add_range(in, out, &pending, inoff, outoff, len)))
+                goto done;
+        }
+    }
+    if(pending.len > 0 && (status = copy_range(in, out, &pending)))
+        goto done;
+
+    if(haverecs && nrecs > NC_get_numrecs(out)) {
+        set_NC_ndirty(out);
+        NC_set_numrecs(out, nrecs);
+        if(NC_doNsync(out))
+            status = write_numrecs(out);
+    }
+
+done:
+    free(ivars);
+    return status;
+}
@@ -172,7 +172,18 @@ const NC_Dispatch* NC3_dispatch_table = NULL; /*!< NC3 Dispatch table, moved her
 int
 NC3_initialize(void)
 {
+    const char* headroom = getenv("NETCDF_HEADER_HEADROOM");
+
     NC3_dispatch_table = &NC3_dispatcher;
+    /* Headroom to leave after the header, in bytes; unset or "auto"
+       for the default policy */
+    NC3_header_headroom = -1;
+    if(headroom != NULL && *headroom != '\0' && strcmp(headroom,"auto") != 0) {
+        char* end = NULL;
+        long long value = strtoll(headroom,&end,10);
+        if(end != NULL && *end == '\0' && value >= 0)
+            NC3_header_headroom = value;
+    }
     return NC_NOERR;
 }
 
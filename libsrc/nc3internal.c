@@ -16,6 +16,7 @@
 
 #include "nc3internal.h"
 #include "netcdf_mem.h"
+#include "ncmemimage.h"
 #include "rnd.h"
 #include "ncx.h"
 #include "ncrc.h"
@@ -41,12 +42,22 @@ free_NC3INFO(NC3_INFO *nc3)
 {
 	if(nc3 == NULL)
 		return;
-	free_NC_dimarrayV(&nc3->dims);
-	free_NC_attrarrayV(&nc3->attrs);
-	free_NC_vararrayV(&nc3->vars);
+	if(!nc3->shared)
+	{
+		free_NC_dimarrayV(&nc3->dims);
+		free_NC_attrarrayV(&nc3->attrs);
+		free_NC_vararrayV(&nc3->vars);
+	}
+	free_NC_extentarray(&nc3->unfilled);
 	free(nc3);
 }
 
+static void
+free_NC3INFO_header(void *header)
+{
+	free_NC3INFO((NC3_INFO *)header);
+}
+
 static NC3_INFO *
 new_NC3INFO(const size_t *chunkp)
 {
@@ -143,6 +154,64 @@ ncx_howmany(nc_type type, size_t xbufsize)
 
 #define	D_RNDUP(x, align) _RNDUP(x, (off_t)(align))
 
+/*
+ * The header headroom policy, set from NETCDF_HEADER_HEADROOM by
+ * NC3_initialize(): the bytes to leave free after the header, or -1
+ * to size them from the data, see NC_headroom().
+ */
+long long NC3_header_headroom = -1;
+
+/* Files with less data than this get no headroom by default */
+#define	NC_HEADROOM_MINDATA	((off_t)1 << 20)
+/* The default headroom is a multiple of this */
+#define	NC_HEADROOM_UNIT	((size_t)4096)
+/* and no more than this */
+#define	NC_HEADROOM_MAX		((size_t)1 << 20)
+
+/*
+ * Return the h_minfree to give NC_begins() when the caller asks for
+ * none: none if the header still fits where it was, so that nothing
+ * moves; else NC3_header_headroom if it is set; else room for the
+ * header to double in size, at least NC_HEADROOM_UNIT, with the
+ * data starting at a multiple of NC_HEADROOM_UNIT, but none if the
+ * file has so little data that moving it later is cheap.
+ */
+static size_t
+NC_headroom(const NC3_INFO* ncp)
+{
+	const size_t sizeof_off_t = (fIsSet(ncp->flags, NC_64BIT_OFFSET)
+		|| fIsSet(ncp->flags, NC_64BIT_DATA)) ? 8 : 4;
+	const size_t xsz = ncx_len_NC(ncp, sizeof_off_t);
+	const size_t numrecs = NC_get_numrecs(ncp);
+	off_t datasize = 0;
+	size_t headroom;
+	size_t ii;
+
+	if(ncp->vars.nelems == 0)
+		return 0;
+	if(ncp->old != NULL && ncp->old->vars.nelems != 0
+		&& (off_t)xsz <= ncp->old->begin_var)
+		return 0;
+	if(NC3_header_headroom >= 0)
+		return (size_t)NC3_header_headroom;
+
+	for(ii = 0; ii < ncp->vars.nelems; ii++)
+	{
+		const NC_var *varp = ncp->vars.value[ii];
+		if(IS_RECVAR(varp))
+			datasize += varp->len * (off_t)(numrecs > 0 ? numrecs : 1);
+		else
+			datasize += varp->len;
+	}
+	if(datasize < NC_HEADROOM_MINDATA)
+		return 0;
+
+	headroom = xsz < NC_HEADROOM_UNIT ? NC_HEADROOM_UNIT : xsz;
+	if(headroom > NC_HEADROOM_MAX)
+		headroom = NC_HEADROOM_MAX;
+	return _RNDUP(xsz + headroom, NC_HEADROOM_UNIT) - xsz;
+}
+
 /*
  * Compute each variable's 'begin' offset,
  * update 'begin_rec' as well.
@@ -595,6 +664,69 @@ fill_added(NC3_INFO *gnu, NC3_INFO *old)
 }
 
 
+/* The most moved by one call of ncio_move() in move_block_r() */
+#define	NC_MOVEPIECE	((size_t)1 << 24)
+
+/*
+ * Move the 'nbytes' at 'old_off' "out" to 'gnu_off', in pieces from
+ * the end, so that none is overwritten before it is moved.
+ */
+static int
+move_block_r(ncio *nciop, off_t gnu_off, off_t old_off, off_t nbytes)
+{
+	assert(gnu_off > old_off);
+	while(nbytes > 0)
+	{
+		const size_t piece = nbytes < (off_t)NC_MOVEPIECE ?
+			(size_t)nbytes : NC_MOVEPIECE;
+		int status;
+
+		nbytes -= (off_t)piece;
+		status = ncio_move(nciop, gnu_off + nbytes, old_off + nbytes,
+			piece, 0);
+		if(status != NC_NOERR)
+			return status;
+	}
+	return NC_NOERR;
+}
+
+/*
+ * If each of the pre-existing variables, record variables if 'recs'
+ * is set or else non-record variables, moves by the same amount,
+ * return that amount, else return 0. Set *lowp and *highp to the
+ * range they cover in 'old'.
+ */
+static off_t
+move_shift(const NC3_INFO *gnu, const NC3_INFO *old, int recs,
+	off_t *lowp, off_t *highp)
+{
+	off_t shift = 0;
+	size_t varid;
+
+	*lowp = *highp = 0;
+	for(varid = 0; varid < old->vars.nelems; varid++)
+	{
+		const NC_var *gnu_varp = gnu->vars.value[varid];
+		const NC_var *old_varp = old->vars.value[varid];
+
+		if(IS_RECVAR(gnu_varp) != recs)
+			continue;
+		if(shift == 0)
+		{
+			shift = gnu_varp->begin - old_varp->begin;
+			*lowp = old_varp->begin;
+			*highp = old_varp->begin + old_varp->len;
+		}
+		else if(gnu_varp->begin - old_varp->begin != shift)
+			return 0;
+		if(old_varp->begin < *lowp)
+			*lowp = old_varp->begin;
+		if(old_varp->begin + old_varp->len > *highp)
+			*highp = old_varp->begin + old_varp->len;
+	}
+	return shift;
+}
+
 /*
  * Move the records "out".
  * Fill as needed.
@@ -612,6 +744,20 @@ move_recs_r(NC3_INFO *gnu, NC3_INFO *old)
 	off_t gnu_off;
 	off_t old_off;
 	const size_t old_nrecs = NC_get_numrecs(old);
+	off_t shift, low, high;
+
+	shift = move_shift(gnu, old, 1, &low, &high);
+	if(gnu->recsize == old->recsize && shift > 0)
+	{
+		/* The records keep their layout, so move them all at once */
+		status = move_block_r(gnu->nciop,
+			old->begin_rec + shift, old->begin_rec,
+			(off_t)old->recsize * (off_t)old_nrecs);
+		if(status != NC_NOERR)
+			return status;
+		NC_set_numrecs(gnu, old_nrecs);
+		return NC_NOERR;
+	}
 
 	/* Don't parallelize this loop */
 	for(recno = (int)old_nrecs -1; recno >= 0; recno--)
@@ -667,6 +813,14 @@ move_vars_r(NC3_INFO *gnu, NC3_INFO *old)
 	NC_var *old_varp;
 	off_t gnu_off;
 	off_t old_off;
+	off_t shift, low, high;
+
+	shift = move_shift(gnu, old, 0, &low, &high);
+	if(shift > 0)
+	{
+		/* They all move by the same amount, so move them at once */
+		return move_block_r(gnu->nciop, low + shift, low, high - low);
+	}
 
 	/* Don't parallelize this loop */
 	for(varid = (int)old->vars.nelems -1;
@@ -852,6 +1006,8 @@ NC_endef(NC3_INFO *ncp,
 	status = NC_check_vlens(ncp);
 	if(status != NC_NOERR)
 	    return status;
+	if(h_minfree == 0)
+	    h_minfree = NC_headroom(ncp);
 	status = NC_begins(ncp, h_minfree, v_align, v_minfree, r_align);
 	if(status != NC_NOERR)
 	    return status;
@@ -1069,6 +1225,8 @@ NC3_create(const char *path, int ioflags, size_t initialsz, int basepe,
 			status = NC_EEXIST;
 		goto unwind_alloc;
 	}
+	nc3->nciop->perf = &nc->perf;
+	nc->perf.backend = ncio_name(ioflags);
 
 	fSet(nc3->flags, NC_CREAT);
 
@@ -1141,6 +1299,55 @@ nc_set_default_format(int format, int *old_formatp)
 }
 #endif
 
+/*
+ * Read the header of a file opened from a shared image (see
+ * ncmemimage.h). The first open parses it and gives it to the image;
+ * the others share its dims, attrs and vars rather than parse them
+ * again. As the image is opened read-only, they never change.
+ */
+static int
+get_shared_NC(NC3_INFO *ncp, NC_memimage *image)
+{
+	NC3_INFO *header = (NC3_INFO *)NC_memimage_set_header(image, NULL, NULL);
+
+	if(header == NULL)
+	{
+		NC3_INFO *kept;
+		const int status = nc_get_NC(ncp);
+		if(status != NC_NOERR)
+			return status;
+		header = new_NC3INFO(NULL);
+		if(header == NULL)
+			return NC_NOERR; /* keep our own */
+		header->flags = ncp->flags & (NC_64BIT_OFFSET|NC_64BIT_DATA);
+		header->xsz = ncp->xsz;
+		header->begin_var = ncp->begin_var;
+		header->begin_rec = ncp->begin_rec;
+		header->recsize = ncp->recsize;
+		NC_set_numrecs(header, NC_get_numrecs(ncp));
+		header->dims = ncp->dims;
+		header->attrs = ncp->attrs;
+		header->vars = ncp->vars;
+		kept = (NC3_INFO *)NC_memimage_set_header(image, header,
+			free_NC3INFO_header);
+		if(kept != header)
+			free_NC3INFO(header); /* and ours with it */
+		header = kept;
+	}
+
+	fSet(ncp->flags, header->flags);
+	ncp->xsz = header->xsz;
+	ncp->begin_var = header->begin_var;
+	ncp->begin_rec = header->begin_rec;
+	ncp->recsize = header->recsize;
+	NC_set_numrecs(ncp, NC_get_numrecs(header));
+	ncp->dims = header->dims;
+	ncp->attrs = header->attrs;
+	ncp->vars = header->vars;
+	ncp->shared = 1;
+	return NC_NOERR;
+}
+
 int
 NC3_open(const char *path, int ioflags, int basepe, size_t *chunksizehintp,
          void *parameters, const NC_Dispatch *dispatch, int ncid)
@@ -1184,6 +1391,8 @@ NC3_open(const char *path, int ioflags, int basepe, size_t *chunksizehintp,
 			       &nc3->nciop, NULL);
 	if(status)
 		goto unwind_alloc;
+	nc3->nciop->perf = &nc->perf;
+	nc->perf.backend = ncio_name(ioflags);
 
 	assert(nc3->flags == 0);
 
@@ -1199,7 +1408,10 @@ NC3_open(const char *path, int ioflags, int basepe, size_t *chunksizehintp,
 		fSet(nc3->flags, NC_NSYNC);
 	}
 
-	status = nc_get_NC(nc3);
+	if(nc->image != NULL)
+		status = get_shared_NC(nc3, nc->image);
+	else
+		status = nc_get_NC(nc3);
 	if(status != NC_NOERR)
 		goto unwind_ioc;
 
@@ -1276,6 +1488,9 @@ NC3_abort(int ncid)
 	}
 	else if(!NC_readonly(nc3))
 	{
+		status = NC_fill_unfilled(nc3);
+		if(status != NC_NOERR)
+			return status;
 		status = NC_sync(nc3);
 		if(status != NC_NOERR)
 			return status;
@@ -1307,6 +1522,8 @@ NC3_close(int ncid, void* params)
 	if(NC_indef(nc3))
 	{
 		status = NC_endef(nc3, 0, 1, 0, 1); /* TODO: defaults */
+		if(status == NC_NOERR)
+			status = NC_fill_unfilled(nc3);
 		if(status != NC_NOERR )
 		{
 			(void) NC3_abort(ncid);
@@ -1315,7 +1532,10 @@ NC3_close(int ncid, void* params)
 	}
 	else if(!NC_readonly(nc3))
 	{
-		status = NC_sync(nc3);
+		/* write the fill values put off in NC_LAZYFILL mode */
+		status = NC_fill_unfilled(nc3);
+		if(status == NC_NOERR)
+			status = NC_sync(nc3);
 		/* flush buffers before any filesize comparisons */
 		(void) ncio_sync(nc3->nciop);
 	}
@@ -1374,6 +1594,10 @@ NC3_redef(int ncid)
 	if(NC_indef(nc3))
 		return NC_EINDEFINE;
 
+	/* variables may move, so write the fill values put off first */
+	status = NC_fill_unfilled(nc3);
+	if(status != NC_NOERR)
+		return status;
 
 	if(fIsSet(nc3->nciop->ioflags, NC_SHARE))
 	{
@@ -1456,10 +1680,18 @@ NC3_sync(int ncid)
 
 	if(NC_readonly(nc3))
 	{
+		/* An NC_CONCURRENT open is a snapshot shared by other
+		   threads without locking, so its header is never reread */
+		if(fIsSet(nc3->nciop->ioflags, NC_CONCURRENT))
+			return NC_NOERR;
 		return read_NC(nc3);
 	}
 	/* else, read/write */
 
+	status = NC_fill_unfilled(nc3);
+	if(status != NC_NOERR)
+		return status;
+
 	status = NC_sync(nc3);
 	if(status != NC_NOERR)
 		return status;
@@ -1499,13 +1731,14 @@ NC3_set_fill(int ncid,
 	if(NC_readonly(nc3))
 		return NC_EPERM;
 
-	oldmode = fIsSet(nc3->flags, NC_NOFILL) ? NC_NOFILL : NC_FILL;
+	oldmode = fIsSet(nc3->flags, NC_NOFILL) ? NC_NOFILL
+		: nc3->lazyfill ? NC_LAZYFILL : NC_FILL;
 
 	if(fillmode == NC_NOFILL)
 	{
 		fSet(nc3->flags, NC_NOFILL);
 	}
-	else if(fillmode == NC_FILL)
+	else if(fillmode == NC_FILL || fillmode == NC_LAZYFILL)
 	{
 		if(fIsSet(nc3->flags, NC_NOFILL))
 		{
@@ -1524,6 +1757,15 @@ NC3_set_fill(int ncid,
 		return NC_EINVAL; /* Invalid fillmode */
 	}
 
+	if(fillmode != NC_LAZYFILL)
+	{
+		/* write the fill values put off so far */
+		status = NC_fill_unfilled(nc3);
+		if(status != NC_NOERR)
+			return status;
+	}
+	nc3->lazyfill = (fillmode == NC_LAZYFILL);
+
 	if(old_mode_ptr != NULL)
 		*old_mode_ptr = oldmode;
 
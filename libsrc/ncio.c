@@ -8,10 +8,12 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "netcdf.h"
 #include "ncio.h"
 #include "fbits.h"
+#include "ncperf.h"
 
 /* With the advent of diskless io, we need to provide
    for multiple ncio packages at the same time,
@@ -77,6 +79,14 @@ ncio_open(const char *path, int ioflags,
     /* Diskless open has the following constraints:
        1. file must be classic version 1 or 2 or 5
      */
+    /* Only posixio can serve concurrent readers; see ncio_rpx_get() */
+    if(fIsSet(ioflags,NC_CONCURRENT)) {
+        if(fIsSet(ioflags,(NC_DISKLESS|NC_INMEMORY|NC_MMAP|NC_HTTP)))
+            return NC_EINVAL;
+#if defined(USE_STDIO) || defined(USE_FFIO)
+        return NC_EINVAL;
+#endif
+    }
     if(fIsSet(ioflags,NC_DISKLESS)) {
         return memio_open(path,ioflags,igeto,igetsz,sizehintp,parameters,iopp,mempp);
     }
@@ -104,6 +114,29 @@ ncio_open(const char *path, int ioflags,
 #endif
 }
 
+/* Must choose the package the same way as ncio_create and ncio_open */
+const char*
+ncio_name(int ioflags)
+{
+    if(fIsSet(ioflags,NC_DISKLESS) || fIsSet(ioflags,NC_INMEMORY))
+        return "memio";
+#ifdef USE_MMAP
+    if(fIsSet(ioflags,NC_MMAP))
+        return "mmapio";
+#endif
+#ifdef ENABLE_BYTERANGE
+    if(fIsSet(ioflags,NC_HTTP))
+        return "httpio";
+#endif
+#ifdef USE_STDIO
+    return "stdio";
+#elif defined(USE_FFIO)
+    return "ffio";
+#else
+    return "posixio";
+#endif
+}
+
 /**************************************************/
 /* wrapper functions for the ncio dispatch table */
 
@@ -117,6 +150,8 @@ int
 ncio_get(ncio* const nciop, off_t offset, size_t extent,
 			int rflags, void **const vpp)
 {
+    NC_PERF_ADD(nciop->perf,io_gets,1);
+    NC_PERF_ADD(nciop->perf,io_get_bytes,extent);
     return nciop->get(nciop,offset,extent,rflags,vpp);
 }
 
@@ -153,3 +188,67 @@ ncio_close(ncio* const nciop, int doUnlink)
     int status = nciop->close(nciop,doUnlink);
     return status;
 }
+
+/*
+ * Copy n bytes of a pattern of patsz bytes repeated, beginning phase
+ * bytes into the pattern, to dst. After the first whole copy of the
+ * pattern, what has been copied is doubled, so that long runs take
+ * few memcpy() calls however short the pattern.
+ */
+void
+ncio_fillpattern(void* dst, size_t n, const void* pattern, size_t patsz,
+                 size_t phase)
+{
+    char* cp = (char*)dst;
+    size_t done, whole, k;
+
+    k = patsz - phase;
+    if(k > n) k = n;
+    memcpy(cp, (const char*)pattern + phase, k);
+    done = k;
+    if(done == n)
+        return;
+    k = patsz;
+    if(k > n - done) k = n - done;
+    memcpy(cp + done, pattern, k);
+    whole = done; /* cp[whole..done) is whole copies of the pattern */
+    done += k;
+    while(done < n) {
+        k = done - whole;
+        if(k > n - done) k = n - done;
+        memcpy(cp + done, cp + whole, k);
+        done += k;
+    }
+}
+
+/*
+ * Fill extent bytes at offset with copies of a pattern, as for
+ * nciop->fill. Large regions go to the package's fill function if it
+ * has one; others, and all regions for packages without one, are
+ * filled through ncio_get() and ncio_rel() in pieces of at most chunk
+ * bytes, the largest extent the package allows to be got at once.
+ */
+int
+ncio_fill(ncio* const nciop, off_t offset, size_t extent,
+          const void* pattern, size_t patsz, size_t chunk)
+{
+    int status = NC_NOERR;
+    size_t done = 0;
+
+    if(nciop->fill != NULL && extent / 4 >= chunk)
+        return nciop->fill(nciop,offset,extent,pattern,patsz);
+
+    while(done < extent) {
+        void* xp;
+        const size_t n = (extent - done < chunk ? extent - done : chunk);
+        status = ncio_get(nciop,offset + (off_t)done,n,RGN_WRITE,&xp);
+        if(status != NC_NOERR)
+            break;
+        ncio_fillpattern(xp,n,pattern,patsz,done % patsz);
+        status = ncio_rel(nciop,offset + (off_t)done,RGN_MODIFIED);
+        if(status != NC_NOERR)
+            break;
+        done += n;
+    }
+    return status;
+}
@@ -87,6 +87,14 @@ typedef int ncio_pad_lengthfunc(ncio* nciop, off_t length);
  */ 
 typedef int ncio_filesizefunc(ncio *nciop, off_t *filesizep);
 
+/*
+ *  Write extent bytes at offset, filled with copies of the patsz
+ *  bytes at pattern, the first copy starting at offset.  Optional:
+ *  packages that set it to NULL are filled through get() and rel().
+ */
+typedef int ncio_fillfunc(ncio *const nciop, off_t offset, size_t extent,
+			const void *pattern, size_t patsz);
+
 /* Write out any dirty buffers and
    ensure that next read will not get cached data.
    Sync any changes, then close the open file associated with the ncio
@@ -132,6 +140,7 @@ struct ncio {
 	ncio_pad_lengthfunc *NCIO_CONST pad_length;
 
 	ncio_filesizefunc *NCIO_CONST filesize;
+	ncio_fillfunc *NCIO_CONST fill;
   
 	ncio_closefunc *NCIO_CONST close;
 
@@ -144,6 +153,12 @@ struct ncio {
 
 	/* implementation private stuff */
 	void *pvt;
+
+	/*
+	 * Where to count the I/O done, set by the owner of the ncio
+	 * after it is opened or created; may be NULL. See ncperf.h.
+	 */
+	nc_perf_stats_t *perf;
 };
 
 #undef NCIO_CONST
@@ -157,6 +172,14 @@ extern int ncio_sync(ncio* const);
 extern int ncio_filesize(ncio* const, off_t*);
 extern int ncio_pad_length(ncio* const, off_t);
 extern int ncio_close(ncio* const, int);
+extern int ncio_fill(ncio* const, off_t, size_t, const void*, size_t, size_t);
+
+/* Copy a repeated pattern, starting phase bytes into it, to a buffer */
+extern void ncio_fillpattern(void* dst, size_t n, const void* pattern,
+                             size_t patsz, size_t phase);
+
+/* The name of the ncio package used for ioflags, for nc_inq_perf_stats() */
+extern const char* ncio_name(int ioflags);
 
 extern int ncio_create(const char *path, int ioflags, size_t initialsz,
                        off_t igeto, size_t igetsz, size_t *sizehintp,
@@ -50,6 +50,7 @@
 #include "ncio.h"
 #include "fbits.h"
 #include "rnd.h"
+#include "ncperf.h"
 
 /* #define INSTRUMENT 1 */
 #if INSTRUMENT /* debugging */
@@ -90,9 +91,21 @@
 /*Forward*/
 static int ncio_px_filesize(ncio *nciop, off_t *filesizep);
 static int ncio_px_pad_length(ncio *nciop, off_t length);
+static int ncio_px_sync(ncio *const nciop);
 static int ncio_px_close(ncio *nciop, int doUnlink);
 static int ncio_spx_close(ncio *nciop, int doUnlink);
 
+/* The rpx ncio, used for NC_CONCURRENT opens, needs pread() and a
+   thread local variable; see ncio_rpx_get().
+*/
+#if defined(HAVE_PREAD) && (defined(__GNUC__) || defined(__clang__))
+#define NCIO_RPX 1
+#define RPX_THREAD_LOCAL __thread
+#endif
+
+#ifdef NCIO_RPX
+static int ncio_rpx_close(ncio *nciop, int doUnlink);
+#endif
 
 /*
  * Define the following for debugging.
@@ -105,6 +118,22 @@ static int ncio_spx_close(ncio *nciop, int doUnlink);
 #define POSIXIO_DEFAULT_PAGESIZE 4096
 #endif
 
+/* The largest write ncio_px_fill() makes */
+#ifndef NCIO_FILLPAGE
+#define NCIO_FILLPAGE (1024 * 1024)
+#endif
+
+/* ncio_px_move() moves regions at least this large directly, by
+   px_bigmove(), in pieces of up to this size through memory */
+#ifndef NCIO_MOVEPAGE
+#define NCIO_MOVEPAGE (4 * 1024 * 1024)
+#endif
+
+#ifdef HAVE_COPY_FILE_RANGE
+  /* Declared by unistd.h only with _GNU_SOURCE */
+  extern ssize_t copy_file_range(int, off_t*, int, off_t*, size_t, unsigned int);
+#endif
+
 /*! Cross-platform file length.
  *
  * Some versions of Visual Studio are throwing errno 132
@@ -286,6 +315,7 @@ px_pgout(ncio *const nciop,
     ssize_t partial;
     size_t nextent;
     char *nvp;
+    double t0;
 #ifdef X_ALIGN
 	assert(offset % X_ALIGN == 0);
 #endif
@@ -307,15 +337,19 @@ px_pgout(ncio *const nciop,
 	/* } */
 	nextent = extent;
         nvp = vp;
+	NC_PERF_START(t0);
 	while((partial = write(nciop->fd, nvp, nextent)) != -1) {
 	    if(partial == nextent)
 		break;
 	    nvp += partial;
 	    nextent -= partial;
 	}
+	NC_PERF_STOP(nciop->perf, io_time, t0);
 	if(partial == -1)
 	    return errno;
 	*posp += extent;
+	NC_PERF_ADD(nciop->perf, io_writes, 1);
+	NC_PERF_ADD(nciop->perf, io_write_bytes, extent);
 
 	return NC_NOERR;
 }
@@ -338,6 +372,7 @@ px_pgin(ncio *const nciop,
 {
 	int status;
 	ssize_t nread;
+	double t0;
 #ifdef X_ALIGN
 	assert(offset % X_ALIGN == 0);
 	assert(extent % X_ALIGN == 0);
@@ -378,9 +413,14 @@ px_pgin(ncio *const nciop,
 
        The case where it's a short read is already handled by the function
        (according to the comment below, at least). */
+    NC_PERF_START(t0);
     do {
       nread = read(nciop->fd,vp,extent);
     } while (nread == -1 && errno == EINTR);
+    NC_PERF_STOP(nciop->perf, io_time, t0);
+    NC_PERF_ADD(nciop->perf, io_reads, 1);
+    if(nread > 0)
+      NC_PERF_ADD(nciop->perf, io_read_bytes, nread);
 
 
     if(nread != (ssize_t)extent) {
@@ -853,6 +893,100 @@ fprintf(stderr, "\tdouble_buffr %ld %ld %ld\n",
 	return status;
 }
 
+/* Copy 'nbytes' at 'from' to 'to', regions which may overlap,
+   through the memory at *bufp, allocated on first use. When they do
+   not overlap, let copy_file_range() copy them in the system
+   instead, which may share their blocks rather than copy them.
+*/
+static int
+px_copy(ncio *const nciop, off_t to, off_t from, size_t nbytes,
+	char **bufp)
+{
+	ncio_px *const pxp = (ncio_px *)nciop->pvt;
+	size_t nread;
+	int status;
+
+#ifdef HAVE_COPY_FILE_RANGE
+	if(from + (off_t)nbytes <= to || to + (off_t)nbytes <= from)
+	{
+		double t0;
+		NC_PERF_START(t0);
+		while(nbytes > 0)
+		{
+			ssize_t copied = copy_file_range(nciop->fd, &from,
+				nciop->fd, &to, nbytes, 0);
+			if(copied <= 0)
+				break; /* unsupported, or at the end of file */
+			nbytes -= (size_t)copied;
+			NC_PERF_ADD(nciop->perf, io_writes, 1);
+			NC_PERF_ADD(nciop->perf, io_write_bytes, copied);
+		}
+		NC_PERF_STOP(nciop->perf, io_time, t0);
+		if(nbytes == 0)
+			return NC_NOERR;
+		/* copy the rest below */
+	}
+#endif
+	if(*bufp == NULL)
+	{
+		*bufp = (char *)malloc(NCIO_MOVEPAGE);
+		if(*bufp == NULL)
+			return ENOMEM;
+	}
+	/* Past the end of file reads as zeros */
+	status = px_pgin(nciop, from, nbytes, *bufp, &nread, &pxp->pos);
+	if(status != NC_NOERR)
+		return status;
+	return px_pgout(nciop, to, nbytes, *bufp, &pxp->pos);
+}
+
+/* Move a large region directly in the file, in pieces of up to
+   NCIO_MOVEPAGE starting from the end that is not overwritten,
+   rather than through the buffers of px_double_buffer().
+*/
+static int
+px_bigmove(ncio *const nciop, off_t to, off_t from, size_t nbytes)
+{
+	ncio_px *const pxp = (ncio_px *)nciop->pvt;
+	char *buf = NULL;
+	size_t done = 0;
+	int status;
+
+	assert(pxp->bf_refcount <= 0);
+	status = ncio_px_sync(nciop);
+	if(status != NC_NOERR)
+		return status;
+	/* The buffers may hold what is moved over */
+	pxp->bf_offset = OFF_NONE;
+	pxp->bf_cnt = 0;
+	if(pxp->slave != NULL)
+	{
+		pxp->slave->bf_offset = OFF_NONE;
+		pxp->slave->bf_cnt = 0;
+	}
+
+	while(done < nbytes)
+	{
+		const size_t n = MIN(nbytes - done, (size_t)NCIO_MOVEPAGE);
+		if(to > from)
+		{
+			/* growing, so from the end */
+			const off_t at = (off_t)(nbytes - done - n);
+			status = px_copy(nciop, to + at, from + at, n, &buf);
+		}
+		else
+		{
+			status = px_copy(nciop, to + (off_t)done,
+				from + (off_t)done, n, &buf);
+		}
+		if(status != NC_NOERR)
+			break;
+		done += n;
+	}
+	free(buf);
+	return status;
+}
+
 /* Like memmove(), safely move possibly overlapping data.
 
    Copy one region to another without making anything available to
@@ -906,6 +1040,9 @@ ncio_px_move(ncio *const nciop, off_t to, off_t from,
 fprintf(stderr, "ncio_px_move %ld %ld %ld %ld %ld\n",
 		 (long)to, (long)from, (long)nbytes, (long)lower, (long)extent);
 #endif
+	if(nbytes >= NCIO_MOVEPAGE)
+		return px_bigmove(nciop, to, from, nbytes);
+
 	if(extent > pxp->blksz)
 	{
 		size_t remaining = nbytes;
@@ -1001,6 +1138,87 @@ ncio_px_sync(ncio *const nciop)
 	return status;
 }
 
+/* Fill a large region of the file with copies of a pattern. Rather
+   than going through the buffer a block at a time, the region is
+   written directly from a page of copies of the pattern, in writes of
+   up to NCIO_FILLPAGE bytes. The buffer is written out first, and
+   dropped if it overlaps the region.
+   This function is used when NC_SHARE is NOT used.
+*/
+static int
+ncio_px_fill(ncio *const nciop, off_t offset, size_t extent,
+	const void *pattern, size_t patsz)
+{
+	ncio_px *const pxp = (ncio_px *)nciop->pvt;
+	size_t pagesz = (NCIO_FILLPAGE / patsz) * patsz;
+	size_t done = 0;
+	char *page;
+	int status;
+	double t0;
+
+	if(!fIsSet(nciop->ioflags, NC_WRITE))
+		return EPERM; /* attempt to write readonly file */
+	assert(pxp->bf_refcount <= 0);
+
+	if(pagesz == 0)
+		pagesz = patsz;
+	if(pagesz > extent)
+		pagesz = extent;
+	page = (char *)malloc(pagesz);
+	if(page == NULL)
+		return ENOMEM;
+	ncio_fillpattern(page, pagesz, pattern, patsz, 0);
+
+	status = ncio_px_sync(nciop);
+	if(status != NC_NOERR)
+		goto done;
+	if(pxp->bf_offset != OFF_NONE
+		&& pxp->bf_offset < offset + (off_t)extent
+		&& offset < pxp->bf_offset + (off_t)pxp->bf_extent)
+	{
+		pxp->bf_offset = OFF_NONE;
+		pxp->bf_cnt = 0;
+	}
+
+	if(pxp->pos != offset)
+	{
+		if(lseek(nciop->fd, offset, SEEK_SET) != offset)
+		{
+			pxp->pos = OFF_NONE;
+			status = errno;
+			goto done;
+		}
+		pxp->pos = offset;
+	}
+	NC_PERF_START(t0);
+	while(done < extent)
+	{
+		/* Every write starts at a whole copy of the page */
+		size_t n = extent - done < pagesz ? extent - done : pagesz;
+		size_t off = 0;
+		while(off < n)
+		{
+			ssize_t partial = write(nciop->fd, page + off, n - off);
+			if(partial == -1)
+			{
+				pxp->pos = OFF_NONE;
+				status = errno;
+				goto done;
+			}
+			off += (size_t)partial;
+		}
+		done += n;
+		pxp->pos += (off_t)n;
+		NC_PERF_ADD(nciop->perf, io_writes, 1);
+		NC_PERF_ADD(nciop->perf, io_write_bytes, n);
+	}
+	NC_PERF_STOP(nciop->perf, io_time, t0);
+
+done:
+	free(page);
+	return status;
+}
+
 /* Internal function called at close to
    free up anything hanging off pvt.
 */
@@ -1099,6 +1317,7 @@ ncio_px_init(ncio *const nciop)
 	*((ncio_movefunc **)&nciop->move) = ncio_px_move; /* cast away const */
 	*((ncio_syncfunc **)&nciop->sync) = ncio_px_sync; /* cast away const */
 	*((ncio_filesizefunc **)&nciop->filesize) = ncio_px_filesize; /* cast away const */
+	*((ncio_fillfunc **)&nciop->fill) = ncio_px_fill; /* cast away const */
 	*((ncio_pad_lengthfunc **)&nciop->pad_length) = ncio_px_pad_length; /* cast away const */
 	*((ncio_closefunc **)&nciop->close) = ncio_px_close; /* cast away const */
 
@@ -1487,6 +1706,186 @@ ncio_spx_init(ncio *const nciop)
 }
 
 
+/* Begin rpx */
+
+#ifdef NCIO_RPX
+
+/* The rpx ncio serves classic files opened read-only with
+   NC_CONCURRENT. It has no buffer and no file position of its own:
+   each get() allocates a buffer for just the requested region and
+   fills it with pread(), and the matching rel() frees it. So any
+   number of threads may get() regions of the same file at once.
+
+   rel() is only told the offset of the region, so the ncio keeps a
+   list of the outstanding regions, each with the offset and the
+   thread that got it. Two threads may get the same offset at once,
+   and one thread may have several regions outstanding. The list is
+   guarded by a spin lock, held only to link and unlink a region.
+*/
+typedef struct ncio_rpx_region {
+	struct ncio_rpx_region *next;
+	const void *owner;	/* the thread that got it */
+	off_t offset;
+	/* the buffer follows */
+} ncio_rpx_region;
+
+typedef struct ncio_rpx {
+	int lock;			/* over regions */
+	ncio_rpx_region *regions;	/* outstanding, newest first */
+} ncio_rpx;
+
+#define RPX_HDRSZ M_RNDUP(sizeof(ncio_rpx_region))
+
+/* Its address tells the threads apart */
+static RPX_THREAD_LOCAL char rpx_thread;
+
+static void
+rpx_lock(ncio_rpx *const rpx)
+{
+	while(__atomic_exchange_n(&rpx->lock, 1, __ATOMIC_ACQUIRE))
+		;
+}
+
+static void
+rpx_unlock(ncio_rpx *const rpx)
+{
+	__atomic_store_n(&rpx->lock, 0, __ATOMIC_RELEASE);
+}
+
+/* Release the newest region this thread got at offset. */
+static int
+ncio_rpx_rel(ncio *const nciop, off_t offset, int rflags)
+{
+	ncio_rpx *const rpx = (ncio_rpx *)nciop->pvt;
+	ncio_rpx_region **rp;
+	ncio_rpx_region *region;
+
+	rpx_lock(rpx);
+	for(rp = &rpx->regions; *rp != NULL; rp = &(*rp)->next)
+	{
+		if((*rp)->owner == &rpx_thread && (*rp)->offset == offset)
+			break;
+	}
+	region = *rp;
+	if(region != NULL)
+		*rp = region->next;
+	rpx_unlock(rpx);
+
+	if(region == NULL)
+		return EINVAL; /* no such region */
+	free(region);
+	if(fIsSet(rflags, RGN_MODIFIED))
+		return EPERM; /* attempt to write readonly file */
+	return NC_NOERR;
+}
+
+/* Read the region (offset, extent) into a new buffer and make it
+   available through *vpp. As with px_pgin(), the part of the region
+   past the end of file reads as zeros.
+*/
+static int
+ncio_rpx_get(ncio *const nciop,
+		off_t offset, size_t extent,
+		int rflags,
+		void **const vpp)
+{
+	ncio_rpx *const rpx = (ncio_rpx *)nciop->pvt;
+	ncio_rpx_region *region;
+	char *base;
+	size_t nread = 0;
+	double t0;
+
+	if(fIsSet(rflags, RGN_WRITE))
+		return EPERM; /* attempt to write readonly file */
+
+	assert(extent != 0);
+	assert(extent < X_INT_MAX); /* sanity check */
+
+	region = (ncio_rpx_region *)malloc(RPX_HDRSZ + extent);
+	if(region == NULL)
+		return ENOMEM;
+	base = (char *)region + RPX_HDRSZ;
+
+	NC_PERF_START(t0);
+	while(nread < extent)
+	{
+		ssize_t n = pread(nciop->fd, base + nread, extent - nread,
+				  offset + (off_t)nread);
+		if(n == -1 && errno == EINTR)
+			continue;
+		if(n < 0)
+		{
+			int status = errno;
+			free(region);
+			return status;
+		}
+		if(n == 0)
+			break; /* end of file */
+		nread += (size_t)n;
+	}
+	NC_PERF_STOP(nciop->perf, io_time, t0);
+	NC_PERF_ADD(nciop->perf, io_reads, 1);
+	NC_PERF_ADD(nciop->perf, io_read_bytes, nread);
+	if(nread < extent)
+		(void) memset(base + nread, 0, extent - nread);
+
+	region->owner = &rpx_thread;
+	region->offset = offset;
+	rpx_lock(rpx);
+	region->next = rpx->regions;
+	rpx->regions = region;
+	rpx_unlock(rpx);
+	*vpp = base;
+	return NC_NOERR;
+}
+
+/*ARGSUSED*/
+static int
+ncio_rpx_move(ncio *const nciop, off_t to, off_t from,
+			size_t nbytes, int rflags)
+{
+	NC_UNUSED(nciop);
+	NC_UNUSED(to);
+	NC_UNUSED(from);
+	NC_UNUSED(nbytes);
+	NC_UNUSED(rflags);
+	return EPERM; /* attempt to write readonly file */
+}
+
+/*ARGSUSED*/
+/* Nothing is buffered between calls, so there is nothing to sync. */
+static int
+ncio_rpx_sync(ncio *const nciop)
+{
+	NC_UNUSED(nciop);
+	/* NOOP */
+	return NC_NOERR;
+}
+
+/* Set the rel, get, move, sync and close function pointers to the
+   NC_CONCURRENT versions (i.e. the ncio_rpx_* functions).
+*/
+static void
+ncio_rpx_init(ncio *const nciop)
+{
+	ncio_rpx *const rpx = (ncio_rpx *)nciop->pvt;
+
+	*((ncio_relfunc **)&nciop->rel) = ncio_rpx_rel; /* cast away const */
+	*((ncio_getfunc **)&nciop->get) = ncio_rpx_get; /* cast away const */
+	*((ncio_movefunc **)&nciop->move) = ncio_rpx_move; /* cast away const */
+	*((ncio_syncfunc **)&nciop->sync) = ncio_rpx_sync; /* cast away const */
+	/* shared with _px_ */
+	*((ncio_filesizefunc **)&nciop->filesize) = ncio_px_filesize; /* cast away const */
+	*((ncio_pad_lengthfunc **)&nciop->pad_length) = ncio_px_pad_length; /* cast away const */
+	*((ncio_closefunc **)&nciop->close) = ncio_rpx_close; /* cast away const */
+
+	rpx->lock = 0;
+	rpx->regions = NULL;
+}
+
+#endif /*NCIO_RPX*/
+
+
 /* */
 
 /* This will call whatever free function is attached to the free
@@ -1531,6 +1930,11 @@ ncio_px_new(const char *path, int ioflags)
 	fSet(ioflags, NC_SHARE);
 #endif
 
+#ifdef NCIO_RPX
+	if(fIsSet(ioflags, NC_CONCURRENT))
+		sz_ncio_pvt = sizeof(ncio_rpx);
+	else
+#endif
 	if(fIsSet(ioflags, NC_SHARE))
 		sz_ncio_pvt = sizeof(ncio_spx);
 	else
@@ -1548,7 +1952,14 @@ ncio_px_new(const char *path, int ioflags)
 
 				/* cast away const */
 	*((void **)&nciop->pvt) = (void *)(nciop->path + sz_path);
+	*((ncio_fillfunc **)&nciop->fill) = NULL; /* cast away const */
+	nciop->perf = NULL;
 
+#ifdef NCIO_RPX
+	if(fIsSet(ioflags, NC_CONCURRENT))
+		ncio_rpx_init(nciop);
+	else
+#endif
 	if(fIsSet(ioflags, NC_SHARE))
 		ncio_spx_init(nciop);
 	else
@@ -1565,6 +1976,10 @@ ncio_px_new(const char *path, int ioflags)
 #ifndef NCIO_MAXBLOCKSIZE
 #define NCIO_MAXBLOCKSIZE 268435456 /* sanity check, about X_SIZE_T_MAX/8 */
 #endif
+#ifndef NCIO_RPX_BLOCKSIZE
+/* Default chunk for NC_CONCURRENT opens; each chunk read is one pread() */
+#define NCIO_RPX_BLOCKSIZE 262144
+#endif
 
 #ifdef S_IRUSR
 #define NC_DEFAULT_CREAT_MODE \
@@ -1750,6 +2165,16 @@ posixio_open(const char *path,
 	if(path == NULL || *path == 0)
 		return EINVAL;
 
+	if(fIsSet(ioflags, NC_CONCURRENT))
+	{
+#ifdef NCIO_RPX
+		if(fIsSet(ioflags, NC_WRITE|NC_SHARE))
+			return NC_EINVAL;
+#else
+		return NC_EINVAL; /* not supported on this platform */
+#endif
+	}
+
 	nciop = ncio_px_new(path, ioflags);
 	if(nciop == NULL)
 		return ENOMEM;
@@ -1774,7 +2199,8 @@ posixio_open(const char *path,
 	if(*sizehintp < NCIO_MINBLOCKSIZE)
 	{
 		/* Use default */
-		*sizehintp = blksize(fd);
+		*sizehintp = fIsSet(ioflags, NC_CONCURRENT)
+			? NCIO_RPX_BLOCKSIZE : blksize(fd);
 	}
 	else if(*sizehintp >= NCIO_MAXBLOCKSIZE)
 	{
@@ -1786,7 +2212,9 @@ posixio_open(const char *path,
 		*sizehintp = M_RNDUP(*sizehintp);
 	}
 
-	if(fIsSet(nciop->ioflags, NC_SHARE))
+	if(fIsSet(nciop->ioflags, NC_CONCURRENT))
+		status = NC_NOERR; /* rpx has no buffer to set up */
+	else if(fIsSet(nciop->ioflags, NC_SHARE))
 		status = ncio_spx_init2(nciop, sizehintp);
 	else
 		status = ncio_px_init2(nciop, sizehintp, 0);
@@ -1916,3 +2344,28 @@ ncio_spx_close(ncio *nciop, int doUnlink)
 	ncio_spx_free(nciop);
 	return status;
 }
+
+#ifdef NCIO_RPX
+static int
+ncio_rpx_close(ncio *nciop, int doUnlink)
+{
+	ncio_rpx *rpx;
+
+	if(nciop == NULL)
+		return EINVAL;
+	/* Regions never released */
+	rpx = (ncio_rpx *)nciop->pvt;
+	while(rpx->regions != NULL)
+	{
+		ncio_rpx_region *region = rpx->regions;
+		rpx->regions = region->next;
+		free(region);
+	}
+	if(nciop->fd > 0)
+		(void) close(nciop->fd);
+	if(doUnlink)
+		(void) unlink(nciop->path);
+	free(nciop);
+	return NC_NOERR;
+}
+#endif
@@ -0,0 +1,15418 @@
+/* Do not edit this file. It is produced from the corresponding .m4 source */
+/*
+ *	Copyright 2018, University Corporation for Atmospheric Research
+ *      See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ */
+/* $Id: putget.m4 2783 2014-10-26 05:19:35Z wkliao $ */
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "netcdf.h"
+#include "nc3dispatch.h"
+#include "nc3internal.h"
+#include "ncx.h"
+#include "fbits.h"
+#include "onstack.h"
+#include "ncodom.h"
+#include "ncperf.h"
+
+#undef MIN  /* system may define MIN somewhere and complain */
+#define MIN(mm,nn) (((mm) < (nn)) ? (mm) : (nn))
+#undef MAX
+#define MAX(mm,nn) (((mm) > (nn)) ? (mm) : (nn))
+
+static int
+readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+        const size_t nelems, void* value, const nc_type memtype);
+static int
+writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+         const size_t nelems, const void* value, const nc_type memtype);
+
+
+/* #define ODEBUG 1 */
+
+#if ODEBUG
+#include <stdio.h>
+/*
+ * Print the values of an array of size_t
+ */
+void
+arrayp(const char *label, size_t count, const size_t *array)
+{
+	(void) fprintf(stderr, "%s", label);
+	(void) fputc('\t',stderr);
+	for(; count > 0; count--, array++)
+		(void) fprintf(stderr," %lu", (unsigned long)*array);
+	(void) fputc('\n',stderr);
+}
+#endif /* ODEBUG */
+
+
+/* Begin fill */
+/*
+ * This is tunable parameter.
+ * It essentially controls the tradeoff between the number of times
+ * memcpy() gets called to copy the external data to fill
+ * a large buffer vs the number of times its called to
+ * prepare the external data.
+ */
+#if	_SX
+/* NEC SX specific optimization */
+#define	NFILL	2048
+#else
+#define	NFILL	16
+#endif
+
+
+
+/*
+ * Next 6 type specific functions
+ * Fill a some memory with the default special value.
+ * Formerly
+NC_arrayfill()
+ */
+static int
+NC_fill_schar(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	schar fillp[NFILL * sizeof(double)/X_SIZEOF_CHAR];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		schar *vp = fillp;	/* lower bound of area to be filled */
+		const schar *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_BYTE;
+		}
+	}
+	return ncx_putn_schar_schar(xpp, nelems, fillp ,NULL);
+}
+
+static int
+NC_fill_char(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	char fillp[NFILL * sizeof(double)/X_SIZEOF_CHAR];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		char *vp = fillp;	/* lower bound of area to be filled */
+		const char *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_CHAR;
+		}
+	}
+	return ncx_putn_char_char(xpp, nelems, fillp );
+}
+
+static int
+NC_fill_short(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	short fillp[NFILL * sizeof(double)/X_SIZEOF_SHORT];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		short *vp = fillp;	/* lower bound of area to be filled */
+		const short *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_SHORT;
+		}
+	}
+	return ncx_putn_short_short(xpp, nelems, fillp ,NULL);
+}
+
+
+#if (SIZEOF_INT >= X_SIZEOF_INT)
+static int
+NC_fill_int(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	int fillp[NFILL * sizeof(double)/X_SIZEOF_INT];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		int *vp = fillp;	/* lower bound of area to be filled */
+		const int *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_INT;
+		}
+	}
+	return ncx_putn_int_int(xpp, nelems, fillp ,NULL);
+}
+
+#elif SIZEOF_LONG == X_SIZEOF_INT
+static int
+NC_fill_int(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	long fillp[NFILL * sizeof(double)/X_SIZEOF_INT];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		long *vp = fillp;	/* lower bound of area to be filled */
+		const long *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_INT;
+		}
+	}
+	return ncx_putn_int_long(xpp, nelems, fillp ,NULL);
+}
+
+#else
+#error "NC_fill_int implementation"
+#endif
+
+static int
+NC_fill_float(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	float fillp[NFILL * sizeof(double)/X_SIZEOF_FLOAT];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		float *vp = fillp;	/* lower bound of area to be filled */
+		const float *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_FLOAT;
+		}
+	}
+	return ncx_putn_float_float(xpp, nelems, fillp ,NULL);
+}
+
+static int
+NC_fill_double(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	double fillp[NFILL * sizeof(double)/X_SIZEOF_DOUBLE];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		double *vp = fillp;	/* lower bound of area to be filled */
+		const double *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_DOUBLE;
+		}
+	}
+	return ncx_putn_double_double(xpp, nelems, fillp ,NULL);
+}
+
+
+static int
+NC_fill_uchar(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	uchar fillp[NFILL * sizeof(double)/X_SIZEOF_UBYTE];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		uchar *vp = fillp;	/* lower bound of area to be filled */
+		const uchar *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_UBYTE;
+		}
+	}
+	return ncx_putn_uchar_uchar(xpp, nelems, fillp ,NULL);
+}
+
+static int
+NC_fill_ushort(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	ushort fillp[NFILL * sizeof(double)/X_SIZEOF_USHORT];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		ushort *vp = fillp;	/* lower bound of area to be filled */
+		const ushort *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_USHORT;
+		}
+	}
+	return ncx_putn_ushort_ushort(xpp, nelems, fillp ,NULL);
+}
+
+static int
+NC_fill_uint(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	uint fillp[NFILL * sizeof(double)/X_SIZEOF_UINT];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		uint *vp = fillp;	/* lower bound of area to be filled */
+		const uint *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_UINT;
+		}
+	}
+	return ncx_putn_uint_uint(xpp, nelems, fillp ,NULL);
+}
+
+static int
+NC_fill_longlong(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	longlong fillp[NFILL * sizeof(double)/X_SIZEOF_LONGLONG];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		longlong *vp = fillp;	/* lower bound of area to be filled */
+		const longlong *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_INT64;
+		}
+	}
+	return ncx_putn_longlong_longlong(xpp, nelems, fillp ,NULL);
+}
+
+static int
+NC_fill_ulonglong(
+	void **xpp,
+	size_t nelems)	/* how many */
+{
+	ulonglong fillp[NFILL * sizeof(double)/X_SIZEOF_ULONGLONG];
+
+	assert(nelems <= sizeof(fillp)/sizeof(fillp[0]));
+
+	{
+		ulonglong *vp = fillp;	/* lower bound of area to be filled */
+		const ulonglong *const end = vp + nelems;
+		while(vp < end)
+		{
+			*vp++ = NC_FILL_UINT64;
+		}
+	}
+	return ncx_putn_ulonglong_ulonglong(xpp, nelems, fillp ,NULL);
+}
+
+
+
+
+/*
+ * Fills are written in pieces of at most this many bytes, so that
+ * each piece fits in a size_t.
+ */
+#define	FILL_MAXPIECE	((size_t)1 << 30)
+
+/*
+ * Records no larger than this are filled by NCfillrecords() with
+ * copies of one record built in memory.
+ */
+#define	FILL_MAXRECORD	((size_t)4 << 20)
+
+/*
+ * Put copies of the fill value of variable 'varp', in external
+ * representation, in the NFILL * X_SIZEOF_DOUBLE bytes at 'xfillp'.
+ * Set *xszp to the number of bytes used, a whole number of values.
+ */
+static int
+fill_NC_value(const NC_var *varp, char *xfillp, size_t *xszp)
+{
+	const size_t step = varp->xsz;
+	const size_t nelems = (NFILL * X_SIZEOF_DOUBLE)/step;
+	const size_t xsz = varp->xsz * nelems;
+	NC_attr **attrpp = NULL;
+
+	void *xp;
+	int status = NC_NOERR;
+
+	*xszp = xsz;
+
+	/*
+	 * Set up fill value
+	 */
+	attrpp = NC_findattr(&varp->attrs, _FillValue);
+	if( attrpp != NULL )
+	{
+		/* User defined fill value */
+		if( (*attrpp)->type != varp->type || (*attrpp)->nelems != 1 )
+		{
+			return NC_EBADTYPE;
+		}
+		else
+		{
+			/* Use the user defined value */
+			char *cp = xfillp;
+			const char *const end = &xfillp[xsz];
+
+			assert(step <= (*attrpp)->xsz);
+
+			for( /*NADA*/; cp < end; cp += step)
+			{
+				(void) memcpy(cp, (*attrpp)->xvalue, step);
+			}
+		}
+	}
+	else
+	{
+		/* use the default */
+
+		assert(xsz % X_ALIGN == 0);
+		assert(xsz <= NFILL * X_SIZEOF_DOUBLE);
+
+		xp = xfillp;
+
+		switch(varp->type){
+		case NC_BYTE :
+			status = NC_fill_schar(&xp, nelems);
+			break;
+		case NC_CHAR :
+			status = NC_fill_char(&xp, nelems);
+			break;
+		case NC_SHORT :
+			status = NC_fill_short(&xp, nelems);
+			break;
+		case NC_INT :
+			status = NC_fill_int(&xp, nelems);
+			break;
+		case NC_FLOAT :
+			status = NC_fill_float(&xp, nelems);
+			break;
+		case NC_DOUBLE :
+			status = NC_fill_double(&xp, nelems);
+			break;
+                case NC_UBYTE :
+                        status = NC_fill_uchar(&xp, nelems);
+                        break;
+                case NC_USHORT :
+                        status = NC_fill_ushort(&xp, nelems);
+                        break;
+                case NC_UINT :
+                        status = NC_fill_uint(&xp, nelems);
+                        break;
+                case NC_INT64 :
+                        status = NC_fill_longlong(&xp, nelems);
+                        break;
+                case NC_UINT64 :
+                        status = NC_fill_ulonglong(&xp, nelems);
+                        break;
+		default :
+			assert("fill_NC_var invalid type" == 0);
+			status = NC_EBADTYPE;
+			break;
+		}
+		if(status != NC_NOERR)
+			return status;
+
+		assert(xp == xfillp + xsz);
+	}
+	return NC_NOERR;
+}
+
+/*
+ * Write 'size' bytes at 'offset' filled with copies of the 'patsz'
+ * bytes at 'pattern', the first copy starting at 'offset'.
+ */
+static int
+fill_NC_region(NC3_INFO* ncp, off_t offset, long long size,
+	const void *pattern, size_t patsz)
+{
+	/* Each piece starts with a whole copy of the pattern */
+	const size_t maxpiece = (FILL_MAXPIECE / patsz) * patsz;
+	int status = NC_NOERR;
+
+	assert(patsz <= FILL_MAXPIECE);
+	while(size > 0)
+	{
+		const size_t piece = (size_t)MIN(size, (long long)maxpiece);
+
+		status = ncio_fill(ncp->nciop, offset, piece,
+				pattern, patsz, ncp->chunk);
+		if(status != NC_NOERR)
+			break;
+		offset += (off_t)piece;
+		size -= (long long)piece;
+	}
+	return status;
+}
+
+/*
+ * Fill the external space for variable 'varp' values at 'recno' with
+ * the appropriate value. If 'varp' is not a record variable, fill the
+ * whole thing.  For the special case when 'varp' is the only record
+ * variable and it is of type byte, char, or short, varsize should be
+ * ncp->recsize, otherwise it should be varp->len. In that special
+ * case, varsize may also be a multiple of ncp->recsize, to fill that
+ * many records from 'recno' on.
+ * In NC_LAZYFILL mode the space is only noted in ncp->unfilled, to be
+ * filled by NC_fill_unfilled() unless it is written first.
+ * Formerly
+xdr_NC_fill()
+ */
+int
+fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
+{
+	char xfillp[NFILL * X_SIZEOF_DOUBLE];
+	size_t xsz;
+	off_t offset;
+	int status;
+
+	status = fill_NC_value(varp, xfillp, &xsz);
+	if(status != NC_NOERR)
+		return status;
+
+	/*
+	 * copyout:
+	 * xfillp now contains xsz bytes of the fill value
+	 * in external representation.
+	 */
+
+	offset = varp->begin;
+	if(IS_RECVAR(varp))
+	{
+		offset += (off_t)ncp->recsize * recno;
+	}
+
+	assert(varsize > 0);
+	if(ncp->lazyfill)
+		return NC_extents_add(&ncp->unfilled, offset, offset + (off_t)varsize);
+	return fill_NC_region(ncp, offset, varsize, xfillp, xsz);
+}
+/* End fill */
+
+
+/*
+ * Add a record containing the fill values.
+ */
+static int
+NCfillrecord(NC3_INFO* ncp, const NC_var *const *varpp, size_t recno)
+{
+	size_t ii = 0;
+	for(; ii < ncp->vars.nelems; ii++, varpp++)
+	{
+		if( !IS_RECVAR(*varpp) )
+		{
+			continue;	/* skip non-record variables */
+		}
+		{
+		const int status = fill_NC_var(ncp, *varpp, (*varpp)->len, recno);
+		if(status != NC_NOERR)
+			return status;
+		}
+	}
+	return NC_NOERR;
+}
+
+
+/*
+ * Set *imagep to a new record containing the fill values of all the
+ * record variables, or to NULL if the records are too large for that
+ * or not laid out as expected.
+ */
+static int
+fill_NC_recimage(const NC3_INFO* ncp, char **imagep)
+{
+	const NC_var *const *varpp = (const NC_var *const *)ncp->vars.value;
+	const size_t recsize = (size_t)ncp->recsize;
+	char *image = NULL;
+	size_t ii;
+	int status = NC_NOERR;
+
+	if((off_t)recsize == (off_t)ncp->recsize && recsize <= FILL_MAXRECORD)
+		image = (char *)calloc(1, recsize);
+	for(ii = 0; image != NULL && ii < ncp->vars.nelems; ii++)
+	{
+		const NC_var *varp = varpp[ii];
+		char xfillp[NFILL * X_SIZEOF_DOUBLE];
+		size_t xsz;
+		off_t at;
+
+		if( !IS_RECVAR(varp) )
+		{
+			continue;	/* skip non-record variables */
+		}
+		at = varp->begin - ncp->begin_rec;
+		if(at < 0 || varp->len < 0 || at + varp->len > (off_t)recsize)
+		{
+			/* Not laid out as expected */
+			free(image);
+			image = NULL;
+			break;
+		}
+		status = fill_NC_value(varp, xfillp, &xsz);
+		if(status != NC_NOERR)
+		{
+			free(image);
+			image = NULL;
+			break;
+		}
+		ncio_fillpattern(image + at, (size_t)varp->len, xfillp, xsz, 0);
+	}
+	*imagep = image;
+	return status;
+}
+
+
+/*
+ * Add the records from 'recno' up to 'numrecs' containing the fill
+ * values, when there is more than one record variable. Unless the
+ * records are very large, one record is filled in memory and copies
+ * of it written out in one pass, rather than filling each variable of
+ * each record in turn.
+ */
+static int
+NCfillrecords(NC3_INFO* ncp, const NC_var *const *varpp, size_t recno,
+	size_t numrecs)
+{
+	const size_t recsize = (size_t)ncp->recsize;
+	char *image = NULL;
+	int status = NC_NOERR;
+
+	if(ncp->lazyfill)
+	{
+		status = NC_extents_add(&ncp->unfilled,
+			ncp->begin_rec + (off_t)ncp->recsize * (off_t)recno,
+			ncp->begin_rec + (off_t)ncp->recsize * (off_t)numrecs);
+		if(status == NC_NOERR)
+			NC_increase_numrecs(ncp, numrecs);
+		return status;
+	}
+
+	status = fill_NC_recimage(ncp, &image);
+	if(status != NC_NOERR)
+		goto done;
+	if(image != NULL)
+	{
+		status = fill_NC_region(ncp,
+			ncp->begin_rec + (off_t)recsize * (off_t)recno,
+			(long long)recsize * (long long)(numrecs - recno),
+			image, recsize);
+		if(status == NC_NOERR)
+			NC_increase_numrecs(ncp, numrecs);
+		goto done;
+	}
+
+	for(; recno < numrecs; recno++)
+	{
+		status = NCfillrecord(ncp, varpp, recno);
+		if(status != NC_NOERR)
+			break;
+		NC_increase_numrecs(ncp, recno + 1);
+	}
+
+done:
+	free(image);
+	return status;
+}
+
+
+/*
+ * Add 'nrecs' records from 'recno' on containing the fill values in
+ * the special case when there is exactly one record variable, where
+ * we don't require each record to be four-byte aligned (no record
+ * padding), so the records are one contiguous region.
+ */
+static int
+NCfillspecialrecords(NC3_INFO* ncp, const NC_var *varp, size_t recno,
+	size_t nrecs)
+{
+    int status;
+    assert(IS_RECVAR(varp));
+    status = fill_NC_var(ncp, varp,
+	(long long)ncp->recsize * (long long)nrecs, recno);
+    if(status != NC_NOERR)
+	return status;
+    return NC_NOERR;
+}
+
+
+/*
+ * Fill the part of the 'len' bytes at 'at' that lies in
+ * ['begin', 'end') with copies of 'pattern'. The part begins at a
+ * whole value, so the pattern needs no shift.
+ */
+static int
+fill_NC_overlap(NC3_INFO* ncp, off_t at, off_t len, off_t begin, off_t end,
+	const char *pattern, size_t patsz)
+{
+	const off_t lo = MAX(at, begin);
+	const off_t hi = MIN(at + len, end);
+
+	if(lo >= hi)
+		return NC_NOERR;
+	return fill_NC_region(ncp, lo, (long long)(hi - lo), pattern, patsz);
+}
+
+
+/*
+ * Fill the variables in ['begin', 'end'), given the fill values
+ * 'xfills' and their sizes 'xszs' for each variable, and 'image', a
+ * record of fill values or NULL.
+ */
+static int
+fill_NC_extent(NC3_INFO* ncp, const char *xfills, const size_t *xszs,
+	const char *image, off_t begin, off_t end)
+{
+	const NC_var *const *varpp = (const NC_var *const *)ncp->vars.value;
+	const off_t recsize = (off_t)ncp->recsize;
+	const size_t numrecs = NC_get_numrecs(ncp);
+	size_t nrecvars = 0;
+	size_t ii, recno;
+	int status = NC_NOERR;
+
+	for(ii = 0; ii < ncp->vars.nelems; ii++)
+	{
+		if(IS_RECVAR(varpp[ii]))
+		{
+			nrecvars++;
+			continue;
+		}
+		status = fill_NC_overlap(ncp, varpp[ii]->begin, varpp[ii]->len,
+			begin, end, &xfills[ii * NFILL * X_SIZEOF_DOUBLE], xszs[ii]);
+		if(status != NC_NOERR)
+			return status;
+	}
+	if(nrecvars == 0 || recsize <= 0 || end <= ncp->begin_rec)
+		return NC_NOERR;
+
+	recno = begin > ncp->begin_rec ?
+		(size_t)((begin - ncp->begin_rec) / recsize) : 0;
+	for(; recno < numrecs; recno++)
+	{
+		const off_t recbegin = ncp->begin_rec + recsize * (off_t)recno;
+
+		if(recbegin >= end)
+			break;
+		if(image != NULL && recbegin >= begin && recbegin + recsize <= end)
+		{
+			/* Whole records, at once */
+			size_t nrecs = (size_t)((end - recbegin) / recsize);
+			if(nrecs > numrecs - recno)
+				nrecs = numrecs - recno;
+			status = fill_NC_region(ncp, recbegin,
+				(long long)recsize * (long long)nrecs,
+				image, (size_t)recsize);
+			if(status != NC_NOERR)
+				return status;
+			recno += nrecs - 1;
+			continue;
+		}
+		for(ii = 0; ii < ncp->vars.nelems; ii++)
+		{
+			const NC_var *varp = varpp[ii];
+
+			if( !IS_RECVAR(varp) )
+				continue;
+			status = fill_NC_overlap(ncp,
+				varp->begin + recsize * (off_t)recno,
+				nrecvars == 1 ? recsize : varp->len,
+				begin, end,
+				&xfills[ii * NFILL * X_SIZEOF_DOUBLE], xszs[ii]);
+			if(status != NC_NOERR)
+				return status;
+		}
+	}
+	return NC_NOERR;
+}
+
+
+/*
+ * In NC_LAZYFILL mode, write the fill values that were put off: those
+ * of all the ranges in ncp->unfilled, then empty it.
+ */
+int
+NC_fill_unfilled(NC3_INFO* ncp)
+{
+	const size_t nvars = ncp->vars.nelems;
+	char *xfills = NULL;
+	size_t *xszs = NULL;
+	char *image = NULL;
+	size_t ii;
+	int status = NC_NOERR;
+
+	if(ncp->unfilled.nelems == 0)
+		return NC_NOERR;
+
+	xfills = (char *)malloc(nvars * NFILL * X_SIZEOF_DOUBLE + 1);
+	xszs = (size_t *)malloc(nvars * sizeof(size_t) + 1);
+	if(xfills == NULL || xszs == NULL)
+	{
+		status = NC_ENOMEM;
+		goto done;
+	}
+	for(ii = 0; ii < nvars; ii++)
+	{
+		status = fill_NC_value(ncp->vars.value[ii],
+			&xfills[ii * NFILL * X_SIZEOF_DOUBLE], &xszs[ii]);
+		if(status != NC_NOERR)
+			goto done;
+	}
+	status = fill_NC_recimage(ncp, &image);
+	if(status != NC_NOERR)
+		goto done;
+
+	for(ii = 0; ii < ncp->unfilled.nelems; ii++)
+	{
+		status = fill_NC_extent(ncp, xfills, xszs, image,
+			ncp->unfilled.value[ii].begin, ncp->unfilled.value[ii].end);
+		if(status != NC_NOERR)
+			goto done;
+	}
+	free_NC_extentarray(&ncp->unfilled);
+
+done:
+	free(image);
+	free(xszs);
+	free(xfills);
+	return status;
+}
+
+
+/*
+ * In NC_LAZYFILL mode, if any of the 'extent' bytes at 'offset' of
+ * variable 'varp', which were just got at *xpp, are yet to be
+ * filled, copy them to a new buffer with those bytes set to the fill
+ * value instead, and point *xpp and *bufp at it. Otherwise set *bufp
+ * to NULL.
+ */
+static int
+NC_fill_unread(const NC3_INFO* ncp, const NC_var *varp, off_t offset,
+	size_t extent, const void **xpp, void **bufp)
+{
+	const off_t end = offset + (off_t)extent;
+	size_t ii = NC_extents_find(&ncp->unfilled, offset);
+	char xfillp[NFILL * X_SIZEOF_DOUBLE];
+	size_t xsz;
+	char *buf;
+	int status;
+
+	*bufp = NULL;
+	if(ii == ncp->unfilled.nelems || ncp->unfilled.value[ii].begin >= end)
+		return NC_NOERR;
+
+	status = fill_NC_value(varp, xfillp, &xsz);
+	if(status != NC_NOERR)
+		return status;
+	buf = (char *)malloc(extent);
+	if(buf == NULL)
+		return NC_ENOMEM;
+	(void) memcpy(buf, *xpp, extent);
+	for(; ii < ncp->unfilled.nelems; ii++)
+	{
+		const NC_extent *ep = &ncp->unfilled.value[ii];
+		off_t lo, hi;
+
+		if(ep->begin >= end)
+			break;
+		lo = MAX(ep->begin, offset);
+		hi = MIN(ep->end, end);
+		ncio_fillpattern(buf + (lo - offset), (size_t)(hi - lo),
+			xfillp, xsz, 0);
+	}
+	*xpp = buf;
+	*bufp = buf;
+	return NC_NOERR;
+}
+
+
+/*
+ * It is advantageous to
+ * #define TOUCH_LAST
+ * when using memory mapped io.
+ */
+#if TOUCH_LAST
+/*
+ * Grow the file to a size which can contain recno
+ */
+static int
+NCtouchlast(NC3_INFO* ncp, const NC_var *const *varpp, size_t recno)
+{
+	int status = NC_NOERR;
+	const NC_var *varp = NULL;
+
+	{
+	size_t ii = 0;
+	for(; ii < ncp->vars.nelems; ii++, varpp++)
+	{
+		if( !IS_RECVAR(*varpp) )
+		{
+			continue;	/* skip non-record variables */
+		}
+		varp = *varpp;
+	}
+	}
+	assert(varp != NULL);
+	assert( IS_RECVAR(varp) );
+	{
+		const off_t offset = varp->begin
+				+ (off_t)(recno-1) * (off_t)ncp->recsize
+				+ (off_t)(varp->len - varp->xsz);
+		void *xp;
+
+
+		status = ncio_get(ncp->nciop, offset, varp->xsz,
+				 RGN_WRITE, &xp);
+		if(status != NC_NOERR)
+			return status;
+		(void)memset(xp, 0, varp->xsz);
+		status = ncio_rel(ncp->nciop, offset, RGN_MODIFIED);
+	}
+	return status;
+}
+#endif /* TOUCH_LAST */
+
+
+/*
+ * Ensure that the netcdf file has 'numrecs' records,
+ * add records and fill as necessary.
+ */
+static int
+NCvnrecs(NC3_INFO* ncp, size_t numrecs)
+{
+	int status = NC_NOERR;
+
+	if(numrecs > NC_get_numrecs(ncp))
+	{
+
+
+#if TOUCH_LAST
+		status = NCtouchlast(ncp,
+			(const NC_var *const*)ncp->vars.value,
+			numrecs);
+		if(status != NC_NOERR)
+			goto common_return;
+#endif /* TOUCH_LAST */
+
+		set_NC_ndirty(ncp);
+
+		if(!NC_dofill(ncp))
+		{
+			/* Simply set the new numrecs value */
+			NC_set_numrecs(ncp, numrecs);
+		}
+		else
+		{
+		    /* Treat two cases differently:
+		        - exactly one record variable (no padding)
+                        - multiple record variables (each record padded
+                          to 4-byte alignment)
+		    */
+		    NC_var **vpp = (NC_var **)ncp->vars.value;
+		    NC_var *const *const end = &vpp[ncp->vars.nelems];
+		    NC_var *recvarp = NULL;	/* last record var */
+		    int numrecvars = 0;
+		    size_t cur_nrecs;
+
+		    /* determine how many record variables */
+		    for( /*NADA*/; vpp < end; vpp++) {
+			if(IS_RECVAR(*vpp)) {
+			    recvarp = *vpp;
+			    numrecvars++;
+			}
+		    }
+
+		    cur_nrecs = NC_get_numrecs(ncp);
+		    if (numrecvars != 1) { /* usual case */
+			/* Fill the records out to numrecs */
+			status = NCfillrecords(ncp,
+				(const NC_var *const*)ncp->vars.value,
+				cur_nrecs, numrecs);
+			if(status != NC_NOERR)
+				goto common_return;
+		    } else {	/* special case */
+			/* The records are contiguous, so fill them
+			 * out to numrecs all at once */
+			status = NCfillspecialrecords(ncp,
+				recvarp, cur_nrecs, numrecs - cur_nrecs);
+			if(status != NC_NOERR)
+				goto common_return;
+			NC_increase_numrecs(ncp, numrecs);
+		    }
+		}
+
+		if(NC_doNsync(ncp))
+		{
+			status = write_numrecs(ncp);
+		}
+
+	}
+common_return:
+	return status;
+}
+
+
+/*
+ * Check whether 'coord' values are valid for the variable.
+ */
+static int
+NCcoordck(NC3_INFO* ncp, const NC_var *varp, const size_t *coord)
+{
+	const size_t *ip;
+	size_t *up;
+
+	if(varp->ndims == 0)
+		return NC_NOERR;	/* 'scalar' variable */
+
+	if(IS_RECVAR(varp))
+	{
+		if(*coord > X_UINT_MAX) /* rkr: bug fix from previous X_INT_MAX */
+			return NC_EINVALCOORDS; /* sanity check */
+		if(NC_readonly(ncp) && *coord > NC_get_numrecs(ncp))
+		{
+			if(!NC_doNsync(ncp))
+				return NC_EINVALCOORDS;
+			/* else */
+			{
+				/* Update from disk and check again */
+				const int status = read_numrecs(ncp);
+				if(status != NC_NOERR)
+					return status;
+				if(*coord > NC_get_numrecs(ncp))
+					return NC_EINVALCOORDS;
+			}
+		}
+		ip = coord + 1;
+		up = varp->shape + 1;
+	}
+	else
+	{
+		ip = coord;
+		up = varp->shape;
+	}
+
+#ifdef CDEBUG
+fprintf(stderr,"	NCcoordck: coord %ld, count %d, ip %ld\n",
+		coord, varp->ndims, ip );
+#endif /* CDEBUG */
+
+	for(; ip < coord + varp->ndims; ip++, up++)
+	{
+
+#ifdef CDEBUG
+fprintf(stderr,"	NCcoordck: ip %p, *ip %ld, up %p, *up %lu\n",
+			ip, *ip, up, *up );
+#endif /* CDEBUG */
+
+		/* cast needed for braindead systems with signed size_t */
+		if((unsigned long) *ip > (unsigned long) *up )
+			return NC_EINVALCOORDS;
+	}
+
+	return NC_NOERR;
+}
+
+
+/*
+ * Check whether 'edges' are valid for the variable and 'start'
+ */
+/*ARGSUSED*/
+static int
+NCedgeck(const NC3_INFO* ncp, const NC_var *varp,
+	 const size_t *start, const size_t *edges)
+{
+	const size_t *const end = start + varp->ndims;
+	const size_t *shp = varp->shape;
+
+	if(varp->ndims == 0)
+		return NC_NOERR;	/* 'scalar' variable */
+
+	if(IS_RECVAR(varp))
+	{
+		if (NC_readonly(ncp) &&
+                    (start[0] == NC_get_numrecs(ncp) && edges[0] > 0))
+			return(NC_EINVALCOORDS);
+		start++;
+		edges++;
+		shp++;
+	}
+
+	for(; start < end; start++, edges++, shp++)
+	{
+		if ((unsigned long) *start == *shp && *edges > 0)
+			return(NC_EINVALCOORDS);
+		/* cast needed for braindead systems with signed size_t */
+		if((unsigned long) *edges > *shp ||
+			(unsigned long) *start + (unsigned long) *edges > *shp)
+		{
+			return(NC_EEDGE);
+		}
+	}
+	return NC_NOERR;
+}
+
+
+/*
+ * Translate the (variable, coord) pair into a seek index
+ */
+static off_t
+NC_varoffset(const NC3_INFO* ncp, const NC_var *varp, const size_t *coord)
+{
+	if(varp->ndims == 0) /* 'scalar' variable */
+		return varp->begin;
+
+	if(varp->ndims == 1)
+	{
+		if(IS_RECVAR(varp))
+			return varp->begin +
+				 (off_t)(*coord) * (off_t)ncp->recsize;
+		/* else */
+		return varp->begin + (off_t)(*coord) * (off_t)varp->xsz;
+	}
+	/* else */
+	{
+		off_t lcoord = (off_t)coord[varp->ndims -1];
+
+		off_t *up = varp->dsizes +1;
+		const size_t *ip = coord;
+		const off_t *const end = varp->dsizes + varp->ndims;
+
+		if(IS_RECVAR(varp))
+			up++, ip++;
+
+		for(; up < end; up++, ip++)
+			lcoord += (off_t)(*up) * (off_t)(*ip);
+
+		lcoord *= varp->xsz;
+
+		if(IS_RECVAR(varp))
+			lcoord += (off_t)(*coord) * ncp->recsize;
+
+		lcoord += varp->begin;
+		return lcoord;
+	}
+}
+
+
+
+static int
+putNCvx_char_char(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const char *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_char_char(&xp, nput, value );
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(char));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_schar_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_schar_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_schar_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_short_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_short_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_short_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_int_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_int_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_int_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_float_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_float_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_float_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_double_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_double_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_double_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_uchar_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uchar_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uchar_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_ushort_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ushort_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ushort_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_uint_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_uint_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_uint_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_longlong_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_longlong_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_longlong_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+static int
+putNCvx_ulonglong_schar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_schar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_uchar(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_uchar(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_short(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_short(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_int(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_int(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_float(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_float(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_double(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_double(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_longlong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_longlong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_ushort(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_ushort(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_uint(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_uint(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+static int
+putNCvx_ulonglong_ulonglong(NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, const ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	void *xp;
+        void *fillp=NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+#ifdef ERANGE_FILL
+        fillp = malloc(varp->xsz);
+        status = NC3_inq_var_fill(varp, fillp);
+#endif
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
+				 RGN_WRITE, &xp);
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		NC_PERF_START(t0);
+		lstatus = ncx_putn_ulonglong_ulonglong(&xp, nput, value ,fillp);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+		{
+			/* not fatal to the loop */
+			status = lstatus;
+		}
+
+		(void) ncio_rel(ncp->nciop, offset,
+				 RGN_MODIFIED);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nput;
+
+	}
+#ifdef ERANGE_FILL
+        free(fillp);
+#endif
+
+	return status;
+}
+
+
+
+static int
+getNCvx_char_char(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, char *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_char_char(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(char));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_schar_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_schar_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_short_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_short_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_short_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_int_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_int_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_int_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_float_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_float_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_float_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_double_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_double_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_double_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_uchar_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uchar_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uchar_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_ushort_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ushort_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ushort_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_uint_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_uint_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_uint_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_longlong_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_longlong_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_longlong_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+static int
+getNCvx_ulonglong_schar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, schar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_schar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(schar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_short(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, short *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_short(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(short));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_int(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, int *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_int(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(int));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_float(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, float *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_float(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(float));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_double(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, double *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_double(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(double));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_longlong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, longlong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_longlong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(longlong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_uint(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uint *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_uint(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uint));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_ulonglong(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ulonglong *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_ulonglong(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ulonglong));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+static int
+getNCvx_ulonglong_ushort(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, ushort *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_ulonglong_ushort(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(ushort));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+
+#ifdef NOTUSED
+static int
+getNCvx_schar_uchar(const NC3_INFO* ncp, const NC_var *varp,
+		 const size_t *start, size_t nelems, uchar *value)
+{
+	off_t offset = NC_varoffset(ncp, varp, start);
+	size_t remaining = varp->xsz * nelems;
+	int status = NC_NOERR;
+	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
+
+	if(nelems == 0)
+		return NC_NOERR;
+
+	assert(value != NULL);
+
+	for(;;)
+	{
+		size_t extent = MIN(remaining, ncp->chunk);
+		size_t nget = ncx_howmany(varp->type, extent);
+
+		int lstatus = ncio_get(ncp->nciop, offset, extent,
+				 0, (void **)&xp);	/* cast away const */
+		if(lstatus != NC_NOERR)
+			return lstatus;
+
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
+		lstatus = ncx_getn_schar_uchar(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof(uchar));
+		if(lstatus != NC_NOERR && status == NC_NOERR)
+			status = lstatus;
+
+		free(unfilledp);
+		unfilledp = NULL;
+		(void) ncio_rel(ncp->nciop, offset, 0);
+
+		remaining -= extent;
+		if(remaining == 0)
+			break; /* normal loop exit */
+		offset += (off_t)extent;
+		value += nget;
+	}
+
+	return status;
+}
+
+#endif /*NOTUSED*/
+
+
+
+
+/* Define a macro to allow hash on two type values */
+#define CASE(nc1,nc2) (nc1*256+nc2)
+
+static int
+readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+        const size_t nelems, void* value, const nc_type memtype)
+{
+    int status = NC_NOERR;
+    switch (CASE(varp->type,memtype)) {
+
+    case CASE(NC_CHAR,NC_CHAR):
+    case CASE(NC_CHAR,NC_UBYTE):
+    return getNCvx_schar_schar(ncp,varp,start,nelems,(signed char*)value);
+    break;
+    case CASE(NC_BYTE,NC_BYTE):
+        return getNCvx_schar_schar(ncp,varp,start,nelems, (schar*)value);
+	break;
+    case CASE(NC_BYTE,NC_UBYTE):
+        if (fIsSet(ncp->flags,NC_64BIT_DATA))
+            return getNCvx_schar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        else
+            /* for CDF-1 and CDF-2, NC_BYTE is treated the same type as uchar memtype */
+            return getNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_BYTE,NC_SHORT):
+        return getNCvx_schar_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_BYTE,NC_INT):
+        return getNCvx_schar_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_BYTE,NC_FLOAT):
+        return getNCvx_schar_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_BYTE,NC_DOUBLE):
+        return getNCvx_schar_double(ncp,varp,start,nelems,(double *)value);
+	break;
+    case CASE(NC_BYTE,NC_INT64):
+        return getNCvx_schar_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_BYTE,NC_UINT):
+        return getNCvx_schar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_BYTE,NC_UINT64):
+        return getNCvx_schar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+    	break;
+    case CASE(NC_BYTE,NC_USHORT):
+        return getNCvx_schar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_SHORT,NC_BYTE):
+        return getNCvx_short_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_SHORT,NC_UBYTE):
+        return getNCvx_short_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_SHORT,NC_SHORT):
+        return getNCvx_short_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_SHORT,NC_INT):
+        return getNCvx_short_int(ncp,varp,start,nelems,(int*)value);
+	break;
+   case CASE(NC_SHORT,NC_FLOAT):
+        return getNCvx_short_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_SHORT,NC_DOUBLE):
+        return getNCvx_short_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_SHORT,NC_INT64):
+        return getNCvx_short_longlong(ncp,varp,start,nelems,(long long*)value);
+   	break;
+    case CASE(NC_SHORT,NC_UINT):
+        return getNCvx_short_uint(ncp,varp,start,nelems,(unsigned int*)value);
+    	break;
+    case CASE(NC_SHORT,NC_UINT64):
+        return getNCvx_short_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_SHORT,NC_USHORT):
+        return getNCvx_short_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_INT,NC_BYTE):
+        return getNCvx_int_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_INT,NC_UBYTE):
+        return getNCvx_int_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_INT,NC_SHORT):
+        return getNCvx_int_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_INT,NC_INT):
+        return getNCvx_int_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_INT,NC_FLOAT):
+        return getNCvx_int_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_INT,NC_DOUBLE):
+        return getNCvx_int_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_INT,NC_INT64):
+        return getNCvx_int_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_INT,NC_UINT):
+        return getNCvx_int_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_INT,NC_UINT64):
+        return getNCvx_int_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_INT,NC_USHORT):
+        return getNCvx_int_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_FLOAT,NC_BYTE):
+        return getNCvx_float_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_FLOAT,NC_UBYTE):
+        return getNCvx_float_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_FLOAT,NC_SHORT):
+        return getNCvx_float_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_FLOAT,NC_INT):
+        return getNCvx_float_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_FLOAT,NC_FLOAT):
+        return getNCvx_float_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_FLOAT,NC_DOUBLE):
+        return getNCvx_float_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_FLOAT,NC_INT64):
+        return getNCvx_float_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_FLOAT,NC_UINT):
+        return getNCvx_float_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_FLOAT,NC_UINT64):
+        return getNCvx_float_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_FLOAT,NC_USHORT):
+        return getNCvx_float_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_DOUBLE,NC_BYTE):
+        return getNCvx_double_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_UBYTE):
+        return getNCvx_double_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_SHORT):
+        return getNCvx_double_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_INT):
+        return getNCvx_double_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_FLOAT):
+        return getNCvx_double_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_DOUBLE):
+        return getNCvx_double_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_INT64):
+        return getNCvx_double_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_UINT):
+        return getNCvx_double_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_UINT64):
+        return getNCvx_double_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_USHORT):
+        return getNCvx_double_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_UBYTE,NC_UBYTE):
+        return getNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_UBYTE,NC_BYTE):
+        return getNCvx_uchar_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_UBYTE,NC_SHORT):
+        return getNCvx_uchar_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_UBYTE,NC_INT):
+        return getNCvx_uchar_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_UBYTE,NC_FLOAT):
+        return getNCvx_uchar_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_UBYTE,NC_DOUBLE):
+        return getNCvx_uchar_double(ncp,varp,start,nelems,(double *)value);
+	break;
+    case CASE(NC_UBYTE,NC_INT64):
+        return getNCvx_uchar_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_UBYTE,NC_UINT):
+        return getNCvx_uchar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_UBYTE,NC_UINT64):
+        return getNCvx_uchar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_UBYTE,NC_USHORT):
+        return getNCvx_uchar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_USHORT,NC_BYTE):
+        return getNCvx_ushort_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_USHORT,NC_UBYTE):
+        return getNCvx_ushort_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_USHORT,NC_SHORT):
+        return getNCvx_ushort_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_USHORT,NC_INT):
+        return getNCvx_ushort_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_USHORT,NC_FLOAT):
+        return getNCvx_ushort_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_USHORT,NC_DOUBLE):
+        return getNCvx_ushort_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_USHORT,NC_INT64):
+        return getNCvx_ushort_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_USHORT,NC_UINT):
+        return getNCvx_ushort_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_USHORT,NC_UINT64):
+        return getNCvx_ushort_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_USHORT,NC_USHORT):
+        return getNCvx_ushort_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_UINT,NC_BYTE):
+        return getNCvx_uint_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_UINT,NC_UBYTE):
+        return getNCvx_uint_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_UINT,NC_SHORT):
+        return getNCvx_uint_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_UINT,NC_INT):
+        return getNCvx_uint_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_UINT,NC_FLOAT):
+        return getNCvx_uint_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_UINT,NC_DOUBLE):
+        return getNCvx_uint_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_UINT,NC_INT64):
+        return getNCvx_uint_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_UINT,NC_UINT):
+        return getNCvx_uint_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_UINT,NC_UINT64):
+        return getNCvx_uint_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_UINT,NC_USHORT):
+        return getNCvx_uint_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_INT64,NC_BYTE):
+        return getNCvx_longlong_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_INT64,NC_UBYTE):
+        return getNCvx_longlong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_INT64,NC_SHORT):
+        return getNCvx_longlong_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_INT64,NC_INT):
+        return getNCvx_longlong_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_INT64,NC_FLOAT):
+        return getNCvx_longlong_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_INT64,NC_DOUBLE):
+        return getNCvx_longlong_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_INT64,NC_INT64):
+        return getNCvx_longlong_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_INT64,NC_UINT):
+        return getNCvx_longlong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_INT64,NC_UINT64):
+        return getNCvx_longlong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_INT64,NC_USHORT):
+        return getNCvx_longlong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    case CASE(NC_UINT64,NC_BYTE):
+        return getNCvx_ulonglong_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_UINT64,NC_UBYTE):
+        return getNCvx_ulonglong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_UINT64,NC_SHORT):
+        return getNCvx_ulonglong_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_UINT64,NC_INT):
+        return getNCvx_ulonglong_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_UINT64,NC_FLOAT):
+        return getNCvx_ulonglong_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_UINT64,NC_DOUBLE):
+        return getNCvx_ulonglong_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_UINT64,NC_INT64):
+        return getNCvx_ulonglong_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_UINT64,NC_UINT):
+        return getNCvx_ulonglong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_UINT64,NC_UINT64):
+        return getNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_UINT64,NC_USHORT):
+        return getNCvx_ulonglong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    default:
+	return NC_EBADTYPE;
+	break;
+    }
+    return status;
+}
+
+
+static int
+writeNCv(NC3_INFO* ncp, const NC_var* varp, const size_t* start,
+         const size_t nelems, const void* value, const nc_type memtype)
+{
+    int status = NC_NOERR;
+    switch (CASE(varp->type,memtype)) {
+
+    case CASE(NC_CHAR,NC_CHAR):
+    case CASE(NC_CHAR,NC_UBYTE):
+        return putNCvx_char_char(ncp,varp,start,nelems,(char*)value);
+	break;
+    case CASE(NC_BYTE,NC_BYTE):
+        return putNCvx_schar_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_BYTE,NC_UBYTE):
+        if (fIsSet(ncp->flags,NC_64BIT_DATA))
+            return putNCvx_schar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+        else
+            /* for CDF-1 and CDF-2, NC_BYTE is treated the same type as uchar memtype */
+            return putNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_BYTE,NC_SHORT):
+        return putNCvx_schar_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_BYTE,NC_INT):
+        return putNCvx_schar_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_BYTE,NC_FLOAT):
+        return putNCvx_schar_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_BYTE,NC_DOUBLE):
+        return putNCvx_schar_double(ncp,varp,start,nelems,(double *)value);
+	break;
+    case CASE(NC_BYTE,NC_INT64):
+        return putNCvx_schar_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_BYTE,NC_UINT):
+        return putNCvx_schar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_BYTE,NC_UINT64):
+        return putNCvx_schar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_BYTE,NC_USHORT):
+        return putNCvx_schar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_SHORT,NC_BYTE):
+        return putNCvx_short_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_SHORT,NC_UBYTE):
+        return putNCvx_short_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_SHORT,NC_SHORT):
+        return putNCvx_short_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_SHORT,NC_INT):
+        return putNCvx_short_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_SHORT,NC_FLOAT):
+        return putNCvx_short_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_SHORT,NC_DOUBLE):
+        return putNCvx_short_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_SHORT,NC_INT64):
+        return putNCvx_short_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_SHORT,NC_UINT):
+        return putNCvx_short_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_SHORT,NC_UINT64):
+        return putNCvx_short_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_SHORT,NC_USHORT):
+        return putNCvx_short_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_INT,NC_BYTE):
+        return putNCvx_int_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_INT,NC_UBYTE):
+        return putNCvx_int_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_INT,NC_SHORT):
+        return putNCvx_int_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_INT,NC_INT):
+        return putNCvx_int_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_INT,NC_FLOAT):
+        return putNCvx_int_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_INT,NC_DOUBLE):
+        return putNCvx_int_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_INT,NC_INT64):
+        return putNCvx_int_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_INT,NC_UINT):
+        return putNCvx_int_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_INT,NC_UINT64):
+        return putNCvx_int_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_INT,NC_USHORT):
+        return putNCvx_int_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_FLOAT,NC_BYTE):
+        return putNCvx_float_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_FLOAT,NC_UBYTE):
+        return putNCvx_float_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_FLOAT,NC_SHORT):
+        return putNCvx_float_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_FLOAT,NC_INT):
+        return putNCvx_float_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_FLOAT,NC_FLOAT):
+        return putNCvx_float_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_FLOAT,NC_DOUBLE):
+        return putNCvx_float_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_FLOAT,NC_INT64):
+        return putNCvx_float_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_FLOAT,NC_UINT):
+        return putNCvx_float_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_FLOAT,NC_UINT64):
+        return putNCvx_float_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_FLOAT,NC_USHORT):
+        return putNCvx_float_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_BYTE):
+        return putNCvx_double_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_UBYTE):
+        return putNCvx_double_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_SHORT):
+        return putNCvx_double_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_INT):
+        return putNCvx_double_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_FLOAT):
+        return putNCvx_double_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_DOUBLE):
+        return putNCvx_double_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_INT64):
+        return putNCvx_double_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_UINT):
+        return putNCvx_double_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_UINT64):
+        return putNCvx_double_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_DOUBLE,NC_USHORT):
+        return putNCvx_double_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_UBYTE,NC_UBYTE):
+        return putNCvx_uchar_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_UBYTE,NC_BYTE):
+        return putNCvx_uchar_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_UBYTE,NC_SHORT):
+        return putNCvx_uchar_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_UBYTE,NC_INT):
+        return putNCvx_uchar_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_UBYTE,NC_FLOAT):
+        return putNCvx_uchar_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_UBYTE,NC_DOUBLE):
+        return putNCvx_uchar_double(ncp,varp,start,nelems,(double *)value);
+	break;
+    case CASE(NC_UBYTE,NC_INT64):
+        return putNCvx_uchar_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_UBYTE,NC_UINT):
+        return putNCvx_uchar_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_UBYTE,NC_UINT64):
+        return putNCvx_uchar_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_UBYTE,NC_USHORT):
+        return putNCvx_uchar_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_USHORT,NC_BYTE):
+        return putNCvx_ushort_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_USHORT,NC_UBYTE):
+        return putNCvx_ushort_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_USHORT,NC_SHORT):
+        return putNCvx_ushort_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_USHORT,NC_INT):
+        return putNCvx_ushort_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_USHORT,NC_FLOAT):
+        return putNCvx_ushort_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_USHORT,NC_DOUBLE):
+        return putNCvx_ushort_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_USHORT,NC_INT64):
+        return putNCvx_ushort_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_USHORT,NC_UINT):
+        return putNCvx_ushort_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_USHORT,NC_UINT64):
+        return putNCvx_ushort_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_USHORT,NC_USHORT):
+        return putNCvx_ushort_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_UINT,NC_BYTE):
+        return putNCvx_uint_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_UINT,NC_UBYTE):
+        return putNCvx_uint_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_UINT,NC_SHORT):
+        return putNCvx_uint_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_UINT,NC_INT):
+        return putNCvx_uint_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_UINT,NC_FLOAT):
+        return putNCvx_uint_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_UINT,NC_DOUBLE):
+        return putNCvx_uint_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_UINT,NC_INT64):
+        return putNCvx_uint_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_UINT,NC_UINT):
+        return putNCvx_uint_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_UINT,NC_UINT64):
+        return putNCvx_uint_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_UINT,NC_USHORT):
+        return putNCvx_uint_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_INT64,NC_BYTE):
+        return putNCvx_longlong_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_INT64,NC_UBYTE):
+        return putNCvx_longlong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_INT64,NC_SHORT):
+        return putNCvx_longlong_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_INT64,NC_INT):
+        return putNCvx_longlong_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_INT64,NC_FLOAT):
+        return putNCvx_longlong_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_INT64,NC_DOUBLE):
+        return putNCvx_longlong_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_INT64,NC_INT64):
+        return putNCvx_longlong_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_INT64,NC_UINT):
+        return putNCvx_longlong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_INT64,NC_UINT64):
+        return putNCvx_longlong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_INT64,NC_USHORT):
+        return putNCvx_longlong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+    case CASE(NC_UINT64,NC_BYTE):
+        return putNCvx_ulonglong_schar(ncp,varp,start,nelems,(schar*)value);
+	break;
+    case CASE(NC_UINT64,NC_UBYTE):
+        return putNCvx_ulonglong_uchar(ncp,varp,start,nelems,(unsigned char*)value);
+	break;
+    case CASE(NC_UINT64,NC_SHORT):
+        return putNCvx_ulonglong_short(ncp,varp,start,nelems,(short*)value);
+	break;
+    case CASE(NC_UINT64,NC_INT):
+        return putNCvx_ulonglong_int(ncp,varp,start,nelems,(int*)value);
+	break;
+    case CASE(NC_UINT64,NC_FLOAT):
+        return putNCvx_ulonglong_float(ncp,varp,start,nelems,(float*)value);
+	break;
+    case CASE(NC_UINT64,NC_DOUBLE):
+        return putNCvx_ulonglong_double(ncp,varp,start,nelems,(double*)value);
+	break;
+    case CASE(NC_UINT64,NC_INT64):
+        return putNCvx_ulonglong_longlong(ncp,varp,start,nelems,(long long*)value);
+	break;
+    case CASE(NC_UINT64,NC_UINT):
+        return putNCvx_ulonglong_uint(ncp,varp,start,nelems,(unsigned int*)value);
+	break;
+    case CASE(NC_UINT64,NC_UINT64):
+        return putNCvx_ulonglong_ulonglong(ncp,varp,start,nelems,(unsigned long long*)value);
+	break;
+    case CASE(NC_UINT64,NC_USHORT):
+        return putNCvx_ulonglong_ushort(ncp,varp,start,nelems,(unsigned short*)value);
+	break;
+
+    default:
+	return NC_EBADTYPE;
+	break;
+    }
+    return status;
+}
+
+/**************************************************/
+
+int
+NC3_get_vara(int ncid, int varid,
+	    const size_t *start, const size_t *edges0,
+            void *value0,
+	    nc_type memtype)
+{
+    int status = NC_NOERR;
+    NC* nc;
+    NC3_INFO* nc3;
+    NC_var *varp;
+    NCodometer odom;
+    size_t memtypelen;
+    signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
+    const size_t* edges = edges0; /* so we can modify for special cases */
+    size_t modedges[NC_MAX_VAR_DIMS];
+
+    status = NC_check_id(ncid, &nc);
+    if(status != NC_NOERR)
+        return status;
+    nc3 = NC3_DATA(nc);
+
+    if(NC_indef(nc3))
+        return NC_EINDEFINE;
+
+    status = NC_lookupvar(nc3, varid, &varp);
+    if(status != NC_NOERR)
+        return status;
+
+    if(memtype == NC_NAT) memtype=varp->type;
+
+    if(memtype == NC_CHAR && varp->type != NC_CHAR)
+        return NC_ECHAR;
+    else if(memtype != NC_CHAR && varp->type == NC_CHAR)
+        return NC_ECHAR;
+
+    /* If edges is NULL, then this was called from nc_get_var() */
+    if(edges == NULL && varp->ndims > 0) {
+	/* If this is a record variable, then we have to
+           substitute the number of records into dimension 0. */
+	if(varp->shape[0] == 0) {
+	    (void)memcpy((void*)modedges,(void*)varp->shape,
+                          sizeof(size_t)*varp->ndims);
+	    modedges[0] = NC_get_numrecs(nc3);
+	    edges = modedges;
+	} else
+	    edges = varp->shape;
+    }
+
+    status = NCcoordck(nc3, varp, start);
+    if(status != NC_NOERR)
+        return status;
+
+    status = NCedgeck(nc3, varp, start, edges);
+    if(status != NC_NOERR)
+        return status;
+
+    /* Get the size of the memtype */
+    memtypelen = nctypelen(memtype);
+
+    if(varp->ndims == 0) /* scalar variable */
+    {
+        return( readNCv(nc3, varp, start, 1, (void*)value, memtype) );
+    }
+
+    if(IS_RECVAR(varp))
+    {
+        if(*start + *edges > NC_get_numrecs(nc3))
+            return NC_EEDGE;
+        if(varp->ndims == 1 && nc3->recsize <= varp->len)
+        {
+            /* one dimensional && the only record variable  */
+            return( readNCv(nc3, varp, start, *edges, (void*)value, memtype) );
+        }
+    }
+
+    /*
+     * Walk the largest contiguous runs of the selection; dimension 0
+     * of a record variable is not contiguous with those inside it,
+     * unless it is the only record variable.
+     */
+    status = NC_odom_init(&odom, (int)varp->ndims, varp->shape, start, edges,
+                          NULL, NULL, IS_RECVAR(varp) && nc3->recsize > varp->len
+                                      ? NC_ODOM_RECORDS : 0);
+    if(status != NC_NOERR)
+        return status;
+
+    for(;NC_odom_more(&odom);NC_odom_next(&odom))
+    {
+        const int lstatus = readNCv(nc3, varp, odom.index, odom.runlen, (void*)value, memtype);
+        if(lstatus != NC_NOERR)
+        {
+            if(lstatus != NC_ERANGE)
+            {
+                status = lstatus;
+                /* fatal for the loop */
+                break;
+            }
+            /* else NC_ERANGE, not fatal for the loop */
+            if(status == NC_NOERR)
+                status = lstatus;
+        }
+        value += (odom.runlen * memtypelen);
+    }
+    NC_odom_free(&odom);
+
+    return status;
+}
+
+int
+NC3_put_vara(int ncid, int varid,
+	    const size_t *start, const size_t *edges0,
+            const void *value0,
+	    nc_type memtype)
+{
+    int status = NC_NOERR;
+    NC *nc;
+    NC3_INFO* nc3;
+    NC_var *varp;
+    NCodometer odom;
+    size_t memtypelen;
+    signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
+    const size_t* edges = edges0; /* so we can modify for special cases */
+    size_t modedges[NC_MAX_VAR_DIMS];
+
+    status = NC_check_id(ncid, &nc);
+    if(status != NC_NOERR)
+        return status;
+    nc3 = NC3_DATA(nc);
+
+    if(NC_readonly(nc3))
+        return NC_EPERM;
+
+    if(NC_indef(nc3))
+        return NC_EINDEFINE;
+
+    status = NC_lookupvar(nc3, varid, &varp);
+    if(status != NC_NOERR)
+       return status; /*invalid varid */
+
+
+    if(memtype == NC_NAT) memtype=varp->type;
+
+    if(memtype == NC_CHAR && varp->type != NC_CHAR)
+        return NC_ECHAR;
+    else if(memtype != NC_CHAR && varp->type == NC_CHAR)
+        return NC_ECHAR;
+
+    /* Get the size of the memtype */
+    memtypelen = nctypelen(memtype);
+
+    /* If edges is NULL, then this was called from nc_get_var() */
+    if(edges == NULL && varp->ndims > 0) {
+	/* If this is a record variable, then we have to
+           substitute the number of records into dimension 0. */
+	if(varp->shape[0] == 0) {
+	    (void)memcpy((void*)modedges,(void*)varp->shape,
+                          sizeof(size_t)*varp->ndims);
+	    modedges[0] = NC_get_numrecs(nc3);
+	    edges = modedges;
+	} else
+	    edges = varp->shape;
+    }
+
+    status = NCcoordck(nc3, varp, start);
+    if(status != NC_NOERR)
+        return status;
+    status = NCedgeck(nc3, varp, start, edges);
+    if(status != NC_NOERR)
+        return status;
+
+    if(varp->ndims == 0) /* scalar variable */
+    {
+        return( writeNCv(nc3, varp, start, 1, (void*)value, memtype) );
+    }
+
+    if(IS_RECVAR(varp))
+    {
+        status = NCvnrecs(nc3, *start + *edges);
+        if(status != NC_NOERR)
+            return status;
+
+        if(varp->ndims == 1
+            && nc3->recsize <= varp->len)
+        {
+            /* one dimensional && the only record variable  */
+            return( writeNCv(nc3, varp, start, *edges, (void*)value, memtype) );
+        }
+    }
+
+    /*
+     * Walk the largest contiguous runs of the selection; dimension 0
+     * of a record variable is not contiguous with those inside it,
+     * unless it is the only record variable.
+     */
+    status = NC_odom_init(&odom, (int)varp->ndims, varp->shape, start, edges,
+                          NULL, NULL, IS_RECVAR(varp) && nc3->recsize > varp->len
+                                      ? NC_ODOM_RECORDS : 0);
+    if(status != NC_NOERR)
+        return status;
+
+    for(;NC_odom_more(&odom);NC_odom_next(&odom))
+    {
+        const int lstatus = writeNCv(nc3, varp, odom.index, odom.runlen, (void*)value, memtype);
+        if(lstatus != NC_NOERR)
+        {
+            if(lstatus != NC_ERANGE)
+            {
+                status = lstatus;
+                /* fatal for the loop */
+                break;
+            }
+            /* else NC_ERANGE, not fatal for the loop */
+            if(status == NC_NOERR)
+                status = lstatus;
+        }
+        value += (odom.runlen * memtypelen);
+    }
+    NC_odom_free(&odom);
+
+    return status;
+}
@@ -28,9 +28,13 @@ dnl
 #include "ncx.h"
 #include "fbits.h"
 #include "onstack.h"
+#include "ncodom.h"
+#include "ncperf.h"
 
 #undef MIN  /* system may define MIN somewhere and complain */
 #define MIN(mm,nn) (((mm) < (nn)) ? (mm) : (nn))
+#undef MAX
+#define MAX(mm,nn) (((mm) > (nn)) ? (mm) : (nn))
 
 static int
 readNCv(const NC3_INFO* ncp, const NC_var* varp, const size_t* start,
@@ -131,28 +135,35 @@ NCFILL(ulonglong, ulonglong, X_SIZEOF_ULONGLONG, NC_FILL_UINT64)
 
 
 /*
- * Fill the external space for variable 'varp' values at 'recno' with
- * the appropriate value. If 'varp' is not a record variable, fill the
- * whole thing.  For the special case when 'varp' is the only record
- * variable and it is of type byte, char, or short, varsize should be
- * ncp->recsize, otherwise it should be varp->len.
- * Formerly
-xdr_NC_fill()
+ * Fills are written in pieces of at most this many bytes, so that
+ * each piece fits in a size_t.
  */
-int
-fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
+#define	FILL_MAXPIECE	((size_t)1 << 30)
+
+/*
+ * Records no larger than this are filled by NCfillrecords() with
+ * copies of one record built in memory.
+ */
+#define	FILL_MAXRECORD	((size_t)4 << 20)
+
+/*
+ * Put copies of the fill value of variable 'varp', in external
+ * representation, in the NFILL * X_SIZEOF_DOUBLE bytes at 'xfillp'.
+ * Set *xszp to the number of bytes used, a whole number of values.
+ */
+static int
+fill_NC_value(const NC_var *varp, char *xfillp, size_t *xszp)
 {
-	char xfillp[NFILL * X_SIZEOF_DOUBLE];
 	const size_t step = varp->xsz;
-	const size_t nelems = sizeof(xfillp)/step;
+	const size_t nelems = (NFILL * X_SIZEOF_DOUBLE)/step;
 	const size_t xsz = varp->xsz * nelems;
 	NC_attr **attrpp = NULL;
-	off_t offset;
-	long long remaining = varsize;
 
 	void *xp;
 	int status = NC_NOERR;
 
+	*xszp = xsz;
+
 	/*
 	 * Set up fill value
 	 */
@@ -168,7 +179,7 @@ fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
 		{
 			/* Use the user defined value */
 			char *cp = xfillp;
-			const char *const end = &xfillp[sizeof(xfillp)];
+			const char *const end = &xfillp[xsz];
 
 			assert(step <= (*attrpp)->xsz);
 
@@ -183,7 +194,7 @@ fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
 		/* use the default */
 
 		assert(xsz % X_ALIGN == 0);
-		assert(xsz <= sizeof(xfillp));
+		assert(xsz <= NFILL * X_SIZEOF_DOUBLE);
 
 		xp = xfillp;
 
@@ -231,93 +242,310 @@ fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
 
 		assert(xp == xfillp + xsz);
 	}
+	return NC_NOERR;
+}
+
+/*
+ * Write 'size' bytes at 'offset' filled with copies of the 'patsz'
+ * bytes at 'pattern', the first copy starting at 'offset'.
+ */
+static int
+fill_NC_region(NC3_INFO* ncp, off_t offset, long long size,
+	const void *pattern, size_t patsz)
+{
+	/* Each piece starts with a whole copy of the pattern */
+	const size_t maxpiece = (FILL_MAXPIECE / patsz) * patsz;
+	int status = NC_NOERR;
+
+	assert(patsz <= FILL_MAXPIECE);
+	while(size > 0)
+	{
+		const size_t piece = (size_t)MIN(size, (long long)maxpiece);
+
+		status = ncio_fill(ncp->nciop, offset, piece,
+				pattern, patsz, ncp->chunk);
+		if(status != NC_NOERR)
+			break;
+		offset += (off_t)piece;
+		size -= (long long)piece;
+	}
+	return status;
+}
+
+/*
+ * Fill the external space for variable 'varp' values at 'recno' with
+ * the appropriate value. If 'varp' is not a record variable, fill the
+ * whole thing.  For the special case when 'varp' is the only record
+ * variable and it is of type byte, char, or short, varsize should be
+ * ncp->recsize, otherwise it should be varp->len. In that special
+ * case, varsize may also be a multiple of ncp->recsize, to fill that
+ * many records from 'recno' on.
+ * In NC_LAZYFILL mode the space is only noted in ncp->unfilled, to be
+ * filled by NC_fill_unfilled() unless it is written first.
+ * Formerly
+xdr_NC_fill()
+ */
+int
+fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
+{
+	char xfillp[NFILL * X_SIZEOF_DOUBLE];
+	size_t xsz;
+	off_t offset;
+	int status;
+
+	status = fill_NC_value(varp, xfillp, &xsz);
+	if(status != NC_NOERR)
+		return status;
 
 	/*
 	 * copyout:
-	 * xfillp now contains 'nelems' elements of the fill value
+	 * xfillp now contains xsz bytes of the fill value
 	 * in external representation.
 	 */
 
-	/*
-	 * Copy it out.
-	 */
-
 	offset = varp->begin;
 	if(IS_RECVAR(varp))
 	{
 		offset += (off_t)ncp->recsize * recno;
 	}
 
-	assert(remaining > 0);
-	for(;;)
-	{
-		const size_t chunksz = MIN(remaining, ncp->chunk);
-		size_t ii;
+	assert(varsize > 0);
+	if(ncp->lazyfill)
+		return NC_extents_add(&ncp->unfilled, offset, offset + (off_t)varsize);
+	return fill_NC_region(ncp, offset, varsize, xfillp, xsz);
+}
+/* End fill */
 
-		status = ncio_get(ncp->nciop, offset, chunksz,
-				 RGN_WRITE, &xp);
-		if(status != NC_NOERR)
+
+/*
+ * Add a record containing the fill values.
+ */
+static int
+NCfillrecord(NC3_INFO* ncp, const NC_var *const *varpp, size_t recno)
+{
+	size_t ii = 0;
+	for(; ii < ncp->vars.nelems; ii++, varpp++)
+	{
+		if( !IS_RECVAR(*varpp) )
 		{
+			continue;	/* skip non-record variables */
+		}
+		{
+		const int status = fill_NC_var(ncp, *varpp, (*varpp)->len, recno);
+		if(status != NC_NOERR)
 			return status;
 		}
+	}
+	return NC_NOERR;
+}
+
+
+/*
+ * Set *imagep to a new record containing the fill values of all the
+ * record variables, or to NULL if the records are too large for that
+ * or not laid out as expected.
+ */
+static int
+fill_NC_recimage(const NC3_INFO* ncp, char **imagep)
+{
+	const NC_var *const *varpp = (const NC_var *const *)ncp->vars.value;
+	const size_t recsize = (size_t)ncp->recsize;
+	char *image = NULL;
+	size_t ii;
+	int status = NC_NOERR;
 
-		/*
-		 * fill the chunksz buffer in units  of xsz
-		 */
-		for(ii = 0; ii < chunksz/xsz; ii++)
+	if((off_t)recsize == (off_t)ncp->recsize && recsize <= FILL_MAXRECORD)
+		image = (char *)calloc(1, recsize);
+	for(ii = 0; image != NULL && ii < ncp->vars.nelems; ii++)
+	{
+		const NC_var *varp = varpp[ii];
+		char xfillp[NFILL * X_SIZEOF_DOUBLE];
+		size_t xsz;
+		off_t at;
+
+		if( !IS_RECVAR(varp) )
 		{
-			(void) memcpy(xp, xfillp, xsz);
-			xp = (char *)xp + xsz;
+			continue;	/* skip non-record variables */
 		}
-		/*
-		 * Deal with any remainder
-		 */
+		at = varp->begin - ncp->begin_rec;
+		if(at < 0 || varp->len < 0 || at + varp->len > (off_t)recsize)
 		{
-			const size_t rem = chunksz % xsz;
-			if(rem != 0)
-			{
-				(void) memcpy(xp, xfillp, rem);
-				/* xp = (char *)xp + xsz; */
-			}
-
+			/* Not laid out as expected */
+			free(image);
+			image = NULL;
+			break;
 		}
-
-		status = ncio_rel(ncp->nciop, offset, RGN_MODIFIED);
-
+		status = fill_NC_value(varp, xfillp, &xsz);
 		if(status != NC_NOERR)
 		{
+			free(image);
+			image = NULL;
 			break;
 		}
+		ncio_fillpattern(image + at, (size_t)varp->len, xfillp, xsz, 0);
+	}
+	*imagep = image;
+	return status;
+}
 
-		remaining -= chunksz;
-		if(remaining == 0)
-			break;	/* normal loop exit */
-		offset += chunksz;
 
+/*
+ * Add the records from 'recno' up to 'numrecs' containing the fill
+ * values, when there is more than one record variable. Unless the
+ * records are very large, one record is filled in memory and copies
+ * of it written out in one pass, rather than filling each variable of
+ * each record in turn.
+ */
+static int
+NCfillrecords(NC3_INFO* ncp, const NC_var *const *varpp, size_t recno,
+	size_t numrecs)
+{
+	const size_t recsize = (size_t)ncp->recsize;
+	char *image = NULL;
+	int status = NC_NOERR;
+
+	if(ncp->lazyfill)
+	{
+		status = NC_extents_add(&ncp->unfilled,
+			ncp->begin_rec + (off_t)ncp->recsize * (off_t)recno,
+			ncp->begin_rec + (off_t)ncp->recsize * (off_t)numrecs);
+		if(status == NC_NOERR)
+			NC_increase_numrecs(ncp, numrecs);
+		return status;
 	}
 
+	status = fill_NC_recimage(ncp, &image);
+	if(status != NC_NOERR)
+		goto done;
+	if(image != NULL)
+	{
+		status = fill_NC_region(ncp,
+			ncp->begin_rec + (off_t)recsize * (off_t)recno,
+			(long long)recsize * (long long)(numrecs - recno),
+			image, recsize);
+		if(status == NC_NOERR)
+			NC_increase_numrecs(ncp, numrecs);
+		goto done;
+	}
+
+	for(; recno < numrecs; recno++)
+	{
+		status = NCfillrecord(ncp, varpp, recno);
+		if(status != NC_NOERR)
+			break;
+		NC_increase_numrecs(ncp, recno + 1);
+	}
+
+done:
+	free(image);
 	return status;
 }
-/* End fill */
 
 
 /*
- * Add a record containing the fill values.
+ * Add 'nrecs' records from 'recno' on containing the fill values in
+ * the special case when there is exactly one record variable, where
+ * we don't require each record to be four-byte aligned (no record
+ * padding), so the records are one contiguous region.
  */
 static int
-NCfillrecord(NC3_INFO* ncp, const NC_var *const *varpp, size_t recno)
+NCfillspecialrecords(NC3_INFO* ncp, const NC_var *varp, size_t recno,
+	size_t nrecs)
 {
-	size_t ii = 0;
-	for(; ii < ncp->vars.nelems; ii++, varpp++)
+    int status;
+    assert(IS_RECVAR(varp));
+    status = fill_NC_var(ncp, varp,
+	(long long)ncp->recsize * (long long)nrecs, recno);
+    if(status != NC_NOERR)
+	return status;
+    return NC_NOERR;
+}
+
+
+/*
+ * Fill the part of the 'len' bytes at 'at' that lies in
+ * ['begin', 'end') with copies of 'pattern'. The part begins at a
+ * whole value, so the pattern needs no shift.
+ */
+static int
+fill_NC_overlap(NC3_INFO* ncp, off_t at, off_t len, off_t begin, off_t end,
+	const char *pattern, size_t patsz)
+{
+	const off_t lo = MAX(at, begin);
+	const off_t hi = MIN(at + len, end);
+
+	if(lo >= hi)
+		return NC_NOERR;
+	return fill_NC_region(ncp, lo, (long long)(hi - lo), pattern, patsz);
+}
+
+
+/*
+ * Fill the variables in ['begin', 'end'), given the fill values
+ * 'xfills' and their sizes 'xszs' for each variable, and 'image', a
+ * record of fill values or NULL.
+ */
+static int
+fill_NC_extent(NC3_INFO* ncp, const char *xfills, const size_t *xszs,
+	const char *image, off_t begin, off_t end)
+{
+	const NC_var *const *varpp = (const NC_var *const *)ncp->vars.value;
+	const off_t recsize = (off_t)ncp->recsize;
+	const size_t numrecs = NC_get_numrecs(ncp);
+	size_t nrecvars = 0;
+	size_t ii, recno;
+	int status = NC_NOERR;
+
+	for(ii = 0; ii < ncp->vars.nelems; ii++)
 	{
-		if( !IS_RECVAR(*varpp) )
+		if(IS_RECVAR(varpp[ii]))
 		{
-			continue;	/* skip non-record variables */
+			nrecvars++;
+			continue;
 		}
-		{
-		const int status = fill_NC_var(ncp, *varpp, (*varpp)->len, recno);
+		status = fill_NC_overlap(ncp, varpp[ii]->begin, varpp[ii]->len,
+			begin, end, &xfills[ii * NFILL * X_SIZEOF_DOUBLE], xszs[ii]);
 		if(status != NC_NOERR)
 			return status;
+	}
+	if(nrecvars == 0 || recsize <= 0 || end <= ncp->begin_rec)
+		return NC_NOERR;
+
+	recno = begin > ncp->begin_rec ?
+		(size_t)((begin - ncp->begin_rec) / recsize) : 0;
+	for(; recno < numrecs; recno++)
+	{
+		const off_t recbegin = ncp->begin_rec + recsize * (off_t)recno;
+
+		if(recbegin >= end)
+			break;
+		if(image != NULL && recbegin >= begin && recbegin + recsize <= end)
+		{
+			/* Whole records, at once */
+			size_t nrecs = (size_t)((end - recbegin) / recsize);
+			if(nrecs > numrecs - recno)
+				nrecs = numrecs - recno;
+			status = fill_NC_region(ncp, recbegin,
+				(long long)recsize * (long long)nrecs,
+				image, (size_t)recsize);
+			if(status != NC_NOERR)
+				return status;
+			recno += nrecs - 1;
+			continue;
+		}
+		for(ii = 0; ii < ncp->vars.nelems; ii++)
+		{
+			const NC_var *varp = varpp[ii];
+
+			if( !IS_RECVAR(varp) )
+				continue;
+			status = fill_NC_overlap(ncp,
+				varp->begin + recsize * (off_t)recno,
+				nrecvars == 1 ? recsize : varp->len,
+				begin, end,
+				&xfills[ii * NFILL * X_SIZEOF_DOUBLE], xszs[ii]);
+			if(status != NC_NOERR)
+				return status;
 		}
 	}
 	return NC_NOERR;
@@ -325,19 +553,101 @@ NCfillrecord(NC3_INFO* ncp, const NC_var *const *varpp, size_t recno)
 
 
 /*
- * Add a record containing the fill values in the special case when
- * there is exactly one record variable, where we don't require each
- * record to be four-byte aligned (no record padding).
+ * In NC_LAZYFILL mode, write the fill values that were put off: those
+ * of all the ranges in ncp->unfilled, then empty it.
  */
-static int
-NCfillspecialrecord(NC3_INFO* ncp, const NC_var *varp, size_t recno)
+int
+NC_fill_unfilled(NC3_INFO* ncp)
 {
-    int status;
-    assert(IS_RECVAR(varp));
-    status = fill_NC_var(ncp, varp, ncp->recsize, recno);
-    if(status != NC_NOERR)
+	const size_t nvars = ncp->vars.nelems;
+	char *xfills = NULL;
+	size_t *xszs = NULL;
+	char *image = NULL;
+	size_t ii;
+	int status = NC_NOERR;
+
+	if(ncp->unfilled.nelems == 0)
+		return NC_NOERR;
+
+	xfills = (char *)malloc(nvars * NFILL * X_SIZEOF_DOUBLE + 1);
+	xszs = (size_t *)malloc(nvars * sizeof(size_t) + 1);
+	if(xfills == NULL || xszs == NULL)
+	{
+		status = NC_ENOMEM;
+		goto done;
+	}
+	for(ii = 0; ii < nvars; ii++)
+	{
+		status = fill_NC_value(ncp->vars.value[ii],
+			&xfills[ii * NFILL * X_SIZEOF_DOUBLE], &xszs[ii]);
+		if(status != NC_NOERR)
+			goto done;
+	}
+	status = fill_NC_recimage(ncp, &image);
+	if(status != NC_NOERR)
+		goto done;
+
+	for(ii = 0; ii < ncp->unfilled.nelems; ii++)
+	{
+		status = fill_NC_extent(ncp, xfills, xszs, image,
+			ncp->unfilled.value[ii].begin, ncp->unfilled.value[ii].end);
+		if(status != NC_NOERR)
+			goto done;
+	}
+	free_NC_extentarray(&ncp->unfilled);
+
+done:
+	free(image);
+	free(xszs);
+	free(xfills);
 	return status;
-    return NC_NOERR;
+}
+
+
+/*
+ * In NC_LAZYFILL mode, if any of the 'extent' bytes at 'offset' of
+ * variable 'varp', which were just got at *xpp, are yet to be
+ * filled, copy them to a new buffer with those bytes set to the fill
+ * value instead, and point *xpp and *bufp at it. Otherwise set *bufp
+ * to NULL.
+ */
+static int
+NC_fill_unread(const NC3_INFO* ncp, const NC_var *varp, off_t offset,
+	size_t extent, const void **xpp, void **bufp)
+{
+	const off_t end = offset + (off_t)extent;
+	size_t ii = NC_extents_find(&ncp->unfilled, offset);
+	char xfillp[NFILL * X_SIZEOF_DOUBLE];
+	size_t xsz;
+	char *buf;
+	int status;
+
+	*bufp = NULL;
+	if(ii == ncp->unfilled.nelems || ncp->unfilled.value[ii].begin >= end)
+		return NC_NOERR;
+
+	status = fill_NC_value(varp, xfillp, &xsz);
+	if(status != NC_NOERR)
+		return status;
+	buf = (char *)malloc(extent);
+	if(buf == NULL)
+		return NC_ENOMEM;
+	(void) memcpy(buf, *xpp, extent);
+	for(; ii < ncp->unfilled.nelems; ii++)
+	{
+		const NC_extent *ep = &ncp->unfilled.value[ii];
+		off_t lo, hi;
+
+		if(ep->begin >= end)
+			break;
+		lo = MAX(ep->begin, offset);
+		hi = MIN(ep->end, end);
+		ncio_fillpattern(buf + (lo - offset), (size_t)(hi - lo),
+			xfillp, xsz, 0);
+	}
+	*xpp = buf;
+	*bufp = buf;
+	return NC_NOERR;
 }
 
 
@@ -437,37 +747,22 @@ NCvnrecs(NC3_INFO* ncp, size_t numrecs)
 			}
 		    }
 
+		    cur_nrecs = NC_get_numrecs(ncp);
 		    if (numrecvars != 1) { /* usual case */
-			/* Fill each record out to numrecs */
-			while((cur_nrecs = NC_get_numrecs(ncp)) < numrecs)
-			    {
-				status = NCfillrecord(ncp,
-					(const NC_var *const*)ncp->vars.value,
-					cur_nrecs);
-				if(status != NC_NOERR)
-				{
-					break;
-				}
-				NC_increase_numrecs(ncp, cur_nrecs +1);
-			}
+			/* Fill the records out to numrecs */
+			status = NCfillrecords(ncp,
+				(const NC_var *const*)ncp->vars.value,
+				cur_nrecs, numrecs);
 			if(status != NC_NOERR)
 				goto common_return;
 		    } else {	/* special case */
-			/* Fill each record out to numrecs */
-			while((cur_nrecs = NC_get_numrecs(ncp)) < numrecs)
-			    {
-				status = NCfillspecialrecord(ncp,
-					recvarp,
-					cur_nrecs);
-				if(status != NC_NOERR)
-				{
-					break;
-				}
-				NC_increase_numrecs(ncp, cur_nrecs +1);
-			}
+			/* The records are contiguous, so fill them
+			 * out to numrecs all at once */
+			status = NCfillspecialrecords(ncp,
+				recvarp, cur_nrecs, numrecs - cur_nrecs);
 			if(status != NC_NOERR)
 				goto common_return;
-
+			NC_increase_numrecs(ncp, numrecs);
 		    }
 		}
 
@@ -643,6 +938,7 @@ putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
 	int status = NC_NOERR;
 	void *xp;
         void *fillp=NULL;
+	double t0;
 
 	if(nelems == 0)
 		return NC_NOERR;
@@ -658,13 +954,30 @@ putNCvx_$1_$2(NC3_INFO* ncp, const NC_var *varp,
 	{
 		size_t extent = MIN(remaining, ncp->chunk);
 		size_t nput = ncx_howmany(varp->type, extent);
+		int lstatus;
 
-		int lstatus = ncio_get(ncp->nciop, offset, extent,
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Written now, so no longer to be filled */
+			lstatus = NC_extents_remove(&ncp->unfilled, offset,
+					offset + (off_t)extent);
+			if(lstatus != NC_NOERR)
+			{
+				status = lstatus;
+				break;
+			}
+		}
+
+		lstatus = ncio_get(ncp->nciop, offset, extent,
 				 RGN_WRITE, &xp);
 		if(lstatus != NC_NOERR)
 			return lstatus;
 
+		NC_PERF_START(t0);
 		lstatus = ncx_putn_$1_$2(&xp, nput, value ifelse(`$1',`char',,`,fillp'));
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nput * sizeof($2));
 		if(lstatus != NC_NOERR && status == NC_NOERR)
 		{
 			/* not fatal to the loop */
@@ -814,6 +1127,8 @@ getNCvx_$1_$2(const NC3_INFO* ncp, const NC_var *varp,
 	size_t remaining = varp->xsz * nelems;
 	int status = NC_NOERR;
 	const void *xp;
+	void *unfilledp = NULL;
+	double t0;
 
 	if(nelems == 0)
 		return NC_NOERR;
@@ -830,10 +1145,28 @@ getNCvx_$1_$2(const NC3_INFO* ncp, const NC_var *varp,
 		if(lstatus != NC_NOERR)
 			return lstatus;
 
+		if(ncp->unfilled.nelems != 0)
+		{
+			/* Read fill values where they are yet to be written */
+			lstatus = NC_fill_unread(ncp, varp, offset, extent,
+					&xp, &unfilledp);
+			if(lstatus != NC_NOERR)
+			{
+				(void) ncio_rel(ncp->nciop, offset, 0);
+				return lstatus;
+			}
+		}
+
+		NC_PERF_START(t0);
 		lstatus = ncx_getn_$1_$2(&xp, nget, value);
+		NC_PERF_STOP(ncp->nciop->perf, convert_time, t0);
+		NC_PERF_ADD(ncp->nciop->perf, conversions, 1);
+		NC_PERF_ADD(ncp->nciop->perf, convert_bytes, nget * sizeof($2));
 		if(lstatus != NC_NOERR && status == NC_NOERR)
 			status = lstatus;
 
+		free(unfilledp);
+		unfilledp = NULL;
 		(void) ncio_rel(ncp->nciop, offset, 0);
 
 		remaining -= extent;
@@ -964,147 +1297,6 @@ dnl Following are not currently uses
 GETNCVX(schar, uchar)
 #endif /*NOTUSED*/
 
-/*
- *  For ncvar{put,get},
- *  find the largest contiguous block from within 'edges'.
- *  returns the index to the left of this (which may be -1).
- *  Compute the number of contiguous elements and return
- *  that in *iocountp.
- *  The presence of "record" variables makes this routine
- *  overly subtle.
- */
-static int
-NCiocount(const NC3_INFO* const ncp, const NC_var *const varp,
-	const size_t *const edges,
-	size_t *const iocountp)
-{
-	const size_t *edp0 = edges;
-	const size_t *edp = edges + varp->ndims;
-	const size_t *shp = varp->shape + varp->ndims;
-
-	if(IS_RECVAR(varp))
-	{
-		if(varp->ndims == 1 && ncp->recsize <= varp->len)
-		{
-			/* one dimensional && the only 'record' variable */
-			*iocountp = *edges;
-			return(0);
-		}
-		/* else */
-		edp0++;
-	}
-
-	assert(edges != NULL);
-
-	/* find max contiguous */
-	while(edp > edp0)
-	{
-		shp--; edp--;
-		if(*edp < *shp )
-		{
-			const size_t *zedp = edp;
-			while(zedp >= edp0)
-			{
-				if(*zedp == 0)
-				{
-					*iocountp = 0;
-					goto done;
-				}
-				/* Tip of the hat to segmented architectures */
-				if(zedp == edp0)
-					break;
-				zedp--;
-			}
-			break;
-		}
-		assert(*edp == *shp);
-	}
-
-	/*
-	 * edp, shp reference rightmost index s.t. *(edp +1) == *(shp +1)
-	 *
-	 * Or there is only one dimension.
-	 * If there is only one dimension and it is 'non record' dimension,
-	 * 	edp is &edges[0] and we will return -1.
-	 * If there is only one dimension and and it is a "record dimension",
-	 *	edp is &edges[1] (out of bounds) and we will return 0;
-	 */
-	assert(shp >= varp->shape + varp->ndims -1
-		|| *(edp +1) == *(shp +1));
-
-	/* now accumulate max count for a single io operation */
-	for(*iocountp = 1, edp0 = edp;
-		 	edp0 < edges + varp->ndims;
-			edp0++)
-	{
-		*iocountp *= *edp0;
-	}
-
-done:
-	return((int)(edp - edges) - 1);
-}
-
-
-/*
- * Set the elements of the array 'upp' to
- * the sum of the corresponding elements of
- * 'stp' and 'edp'. 'end' should be &stp[nelems].
- */
-static void
-set_upper(size_t *upp, /* modified on return */
-	const size_t *stp,
-	const size_t *edp,
-	const size_t *const end)
-{
-	while(upp < end) {
-		*upp++ = *stp++ + *edp++;
-	}
-}
-
-
-/*
- * The infamous and oft-discussed odometer code.
- *
- * 'start[]' is the starting coordinate.
- * 'upper[]' is the upper bound s.t. start[ii] < upper[ii].
- * 'coord[]' is the register, the current coordinate value.
- * For some ii,
- * upp == &upper[ii]
- * cdp == &coord[ii]
- *
- * Running this routine increments *cdp.
- *
- * If after the increment, *cdp is equal to *upp
- * (and cdp is not the leftmost dimension),
- * *cdp is "zeroed" to the starting value and
- * we need to "carry", eg, increment one place to
- * the left.
- *
- * TODO: Some architectures hate recursion?
- * 	Reimplement non-recursively.
- */
-static void
-odo1(const size_t *const start, const size_t *const upper,
-	size_t *const coord, /* modified on return */
-	const size_t *upp,
-	size_t *cdp)
-{
-	assert(coord <= cdp && cdp <= coord + NC_MAX_VAR_DIMS);
-	assert(upper <= upp && upp <= upper + NC_MAX_VAR_DIMS);
-	assert(upp - upper == cdp - coord);
-
-	assert(*cdp <= *upp);
-
-	(*cdp)++;
-	if(cdp != coord && *cdp >= *upp)
-	{
-		*cdp = start[cdp - coord];
-		odo1(start, upper, coord, upp -1, cdp -1);
-	}
-}
-#ifdef _CRAYC
-#pragma _CRI noinline odo1
-#endif
 
 
 dnl
@@ -1794,8 +1986,7 @@ NC3_get_vara(int ncid, int varid,
     NC* nc;
     NC3_INFO* nc3;
     NC_var *varp;
-    int ii;
-    size_t iocount;
+    NCodometer odom;
     size_t memtypelen;
     signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
     const size_t* edges = edges0; /* so we can modify for special cases */
@@ -1861,34 +2052,20 @@ NC3_get_vara(int ncid, int varid,
     }
 
     /*
-     * find max contiguous
-     *   and accumulate max count for a single io operation
+     * Walk the largest contiguous runs of the selection; dimension 0
+     * of a record variable is not contiguous with those inside it,
+     * unless it is the only record variable.
      */
-    ii = NCiocount(nc3, varp, edges, &iocount);
-
-    if(ii == -1)
-    {
-        return( readNCv(nc3, varp, start, iocount, (void*)value, memtype) );
-    }
-
-    assert(ii >= 0);
-
-    { /* inline */
-    ALLOC_ONSTACK(coord, size_t, varp->ndims);
-    ALLOC_ONSTACK(upper, size_t, varp->ndims);
-    const size_t index = ii;
-
-    /* copy in starting indices */
-    (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
-
-    /* set up in maximum indices */
-    set_upper(upper, start, edges, &upper[varp->ndims]);
+    status = NC_odom_init(&odom, (int)varp->ndims, varp->shape, start, edges,
+                          NULL, NULL, IS_RECVAR(varp) && nc3->recsize > varp->len
+                                      ? NC_ODOM_RECORDS : 0);
+    if(status != NC_NOERR)
+        return status;
 
-    /* ripple counter */
-    while(*coord < *upper)
+    for(;NC_odom_more(&odom);NC_odom_next(&odom))
     {
-        const int lstatus = readNCv(nc3, varp, coord, iocount, (void*)value, memtype);
-	if(lstatus != NC_NOERR)
+        const int lstatus = readNCv(nc3, varp, odom.index, odom.runlen, (void*)value, memtype);
+        if(lstatus != NC_NOERR)
         {
             if(lstatus != NC_ERANGE)
             {
@@ -1900,13 +2077,9 @@ NC3_get_vara(int ncid, int varid,
             if(status == NC_NOERR)
                 status = lstatus;
         }
-        value += (iocount * memtypelen);
-        odo1(start, upper, coord, &upper[index], &coord[index]);
+        value += (odom.runlen * memtypelen);
     }
-
-    FREE_ONSTACK(upper);
-    FREE_ONSTACK(coord);
-    } /* end inline */
+    NC_odom_free(&odom);
 
     return status;
 }
@@ -1921,8 +2094,7 @@ NC3_put_vara(int ncid, int varid,
     NC *nc;
     NC3_INFO* nc3;
     NC_var *varp;
-    int ii;
-    size_t iocount;
+    NCodometer odom;
     size_t memtypelen;
     signed char* value = (signed char*) value0; /* legally allow ptr arithmetic */
     const size_t* edges = edges0; /* so we can modify for special cases */
@@ -1994,33 +2166,19 @@ NC3_put_vara(int ncid, int varid,
     }
 
     /*
-     * find max contiguous
-     *   and accumulate max count for a single io operation
+     * Walk the largest contiguous runs of the selection; dimension 0
+     * of a record variable is not contiguous with those inside it,
+     * unless it is the only record variable.
      */
-    ii = NCiocount(nc3, varp, edges, &iocount);
-
-    if(ii == -1)
-    {
-        return( writeNCv(nc3, varp, start, iocount, (void*)value, memtype) );
-    }
-
-    assert(ii >= 0);
-
-    { /* inline */
-    ALLOC_ONSTACK(coord, size_t, varp->ndims);
-    ALLOC_ONSTACK(upper, size_t, varp->ndims);
-    const size_t index = ii;
-
-    /* copy in starting indices */
-    (void) memcpy(coord, start, varp->ndims * sizeof(size_t));
-
-    /* set up in maximum indices */
-    set_upper(upper, start, edges, &upper[varp->ndims]);
+    status = NC_odom_init(&odom, (int)varp->ndims, varp->shape, start, edges,
+                          NULL, NULL, IS_RECVAR(varp) && nc3->recsize > varp->len
+                                      ? NC_ODOM_RECORDS : 0);
+    if(status != NC_NOERR)
+        return status;
 
-    /* ripple counter */
-    while(*coord < *upper)
+    for(;NC_odom_more(&odom);NC_odom_next(&odom))
     {
-        const int lstatus = writeNCv(nc3, varp, coord, iocount, (void*)value, memtype);
+        const int lstatus = writeNCv(nc3, varp, odom.index, odom.runlen, (void*)value, memtype);
         if(lstatus != NC_NOERR)
         {
             if(lstatus != NC_ERANGE)
@@ -2033,13 +2191,9 @@ NC3_put_vara(int ncid, int varid,
             if(status == NC_NOERR)
                 status = lstatus;
         }
-        value += (iocount * memtypelen);
-        odo1(start, upper, coord, &upper[index], &coord[index]);
+        value += (odom.runlen * memtypelen);
     }
-
-    FREE_ONSTACK(upper);
-    FREE_ONSTACK(coord);
-    } /* end inline */
+    NC_odom_free(&odom);
 
     return status;
 }
@@ -230,6 +230,8 @@ NCP_set_fill(int ncid, int fillmode, int *old_mode_ptr)
     NC *nc;
     int status = NC_check_id(ncid, &nc);
     if (status != NC_NOERR) return status;
+    /* PnetCDF fills each variable on its own, no need to defer it */
+    if (fillmode == NC_LAZYFILL) fillmode = NC_FILL;
 #if (PNETCDF_VERSION_MAJOR*10000 + PNETCDF_VERSION_MINOR*100 + PNETCDF_VERSION_SUB >= 10601)
     /* ncmpi_set_fill was first implemented in PnetCDF 1.6.1 */
     return ncmpi_set_fill(nc->int_ncid, fillmode, old_mode_ptr);
@@ -0,0 +1,175 @@
+/*
+Copyright 2019, UCAR/Unidata
+See COPYRIGHT file for copying and redistribution conditions.
+
+Micro-benchmarks for the hyperslab odometer in libdispatch/ncodom.c.
+
+The first set copies selections out of an in-memory array, once an
+element at a time and once a run at a time, which is the difference
+between the old odometers and the new one. The second set times
+nc_get_vara/nc_get_vars on a classic file, whose read paths are built
+on the odometer, and nc_get_varm on the same file.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "ncodom.h"
+
+#define FILE_NAME "bm_odom.nc"
+#define NREPS 5
+#define NT 64
+#define NY 128
+#define NX 128
+
+/* Milliseconds since some point in the past */
+static double
+now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+/* Copy a selection out of src with the given flags; returns the
+   number of runs. */
+static size_t
+copy_sel(const float* src, float* dst, int rank, const size_t* shape,
+         const size_t* start, const size_t* count, const ptrdiff_t* stride,
+         int flags)
+{
+    NCodometer odom;
+    size_t nruns = 0;
+    if(NC_odom_init(&odom, rank, shape, start, count, stride, NULL, flags))
+        return 0;
+    for(; NC_odom_more(&odom); NC_odom_next(&odom)) {
+        memcpy(dst + odom.memoffset, src + odom.offset, odom.runlen * sizeof(float));
+        nruns++;
+    }
+    NC_odom_free(&odom);
+    return nruns;
+}
+
+static int
+bench_iterator(void)
+{
+    static const struct Case {
+        const char* name;
+        size_t start[3], count[3];
+        ptrdiff_t stride[3];
+    } cases[] = {
+        {"whole variable", {0, 0, 0}, {NT, NY, NX}, {1, 1, 1}},
+        {"time slab", {8, 0, 0}, {16, NY, NX}, {1, 1, 1}},
+        {"interior box", {8, 16, 16}, {32, 64, 64}, {1, 1, 1}},
+        {"every other time", {0, 0, 0}, {NT/2, NY, NX}, {2, 1, 1}},
+        {"every other x", {0, 0, 0}, {NT, NY, NX/2}, {1, 1, 2}},
+    };
+    size_t shape[3] = {NT, NY, NX};
+    size_t n = NT * NY * NX, i;
+    float *src, *dst;
+    int c;
+
+    if(!(src = malloc(n * sizeof(float)))) ERR;
+    if(!(dst = malloc(n * sizeof(float)))) ERR;
+    for(i = 0; i < n; i++) src[i] = (float)i;
+
+    printf("%-18s %12s %12s %12s %12s\n", "selection", "elem runs", "elem ms",
+           "runs", "run ms");
+    for(c = 0; c < (int)(sizeof(cases)/sizeof(cases[0])); c++) {
+        const struct Case* k = &cases[c];
+        double t0, telem, trun;
+        size_t nelem = 0, nrun = 0;
+        int r;
+        t0 = now();
+        for(r = 0; r < NREPS; r++)
+            nelem = copy_sel(src, dst, 3, shape, k->start, k->count, k->stride,
+                             NC_ODOM_ELEMENTS);
+        telem = (now() - t0) / NREPS;
+        t0 = now();
+        for(r = 0; r < NREPS; r++)
+            nrun = copy_sel(src, dst, 3, shape, k->start, k->count, k->stride, 0);
+        trun = (now() - t0) / NREPS;
+        if(nelem == 0 || nrun == 0) ERR;
+        printf("%-18s %12lu %12.3f %12lu %12.3f\n", k->name, (unsigned long)nelem,
+               telem, (unsigned long)nrun, trun);
+    }
+    free(src);
+    free(dst);
+    return 0;
+}
+
+static int
+bench_classic(void)
+{
+    int ncid, dimids[3], varid, r;
+    size_t start[3] = {0, 0, 0}, count[3] = {NT, NY, NX};
+    ptrdiff_t stride[3] = {1, 1, 1};
+    ptrdiff_t fmap[3] = {1, NT, NT * NY};
+    size_t n = NT * NY * NX, i;
+    float *data;
+    double t0;
+
+    if(!(data = malloc(n * sizeof(float)))) ERR;
+    for(i = 0; i < n; i++) data[i] = (float)i;
+    if(nc_create(FILE_NAME, NC_CLOBBER, &ncid)) ERR;
+    if(nc_def_dim(ncid, "t", NC_UNLIMITED, &dimids[0])) ERR;
+    if(nc_def_dim(ncid, "y", NY, &dimids[1])) ERR;
+    if(nc_def_dim(ncid, "x", NX, &dimids[2])) ERR;
+    if(nc_def_var(ncid, "v", NC_FLOAT, 3, dimids, &varid)) ERR;
+    if(nc_enddef(ncid)) ERR;
+    if(nc_put_vara_float(ncid, varid, start, count, data)) ERR;
+    if(nc_close(ncid)) ERR;
+
+    if(nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+    printf("%-30s %12s\n", "classic read", "ms");
+
+    t0 = now();
+    for(r = 0; r < NREPS; r++)
+        if(nc_get_vara_float(ncid, varid, start, count, data)) ERR;
+    printf("%-30s %12.3f\n", "get_vara all records", (now() - t0) / NREPS);
+
+    count[1] = NY / 2; count[2] = NX / 2;
+    start[1] = NY / 4; start[2] = NX / 4;
+    t0 = now();
+    for(r = 0; r < NREPS; r++)
+        if(nc_get_vara_float(ncid, varid, start, count, data)) ERR;
+    printf("%-30s %12.3f\n", "get_vara interior box", (now() - t0) / NREPS);
+
+    start[1] = start[2] = 0;
+    count[0] = NT / 2; count[1] = NY; count[2] = NX;
+    stride[0] = 2;
+    t0 = now();
+    for(r = 0; r < NREPS; r++)
+        if(nc_get_vars_float(ncid, varid, start, count, stride, data)) ERR;
+    printf("%-30s %12.3f\n", "get_vars every other record", (now() - t0) / NREPS);
+
+    count[0] = NT; count[2] = NX / 2;
+    stride[0] = 1; stride[2] = 2;
+    t0 = now();
+    for(r = 0; r < NREPS; r++)
+        if(nc_get_vars_float(ncid, varid, start, count, stride, data)) ERR;
+    printf("%-30s %12.3f\n", "get_vars every other x", (now() - t0) / NREPS);
+
+    start[0] = 0; count[0] = NT;
+    count[2] = NX; stride[2] = 1;
+    t0 = now();
+    for(r = 0; r < NREPS; r++)
+        if(nc_get_varm_float(ncid, varid, start, count, stride, fmap, data)) ERR;
+    printf("%-30s %12.3f\n", "get_varm Fortran order", (now() - t0) / NREPS);
+
+    if(nc_close(ncid)) ERR;
+    free(data);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Benchmarking the hyperslab odometer.\n");
+    if(bench_iterator()) ERR;
+    if(bench_classic()) ERR;
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
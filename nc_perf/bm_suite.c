@@ -0,0 +1,719 @@
+/*
+  Copyright 2019, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This program runs a matrix of benchmark scenarios (file format x
+  access pattern x compression x file size x warm or cold cache),
+  repeating each one several times, and reports the minimum, median,
+  90th percentile and maximum times, the median throughput and the
+  compression ratio of each scenario as CSV or JSON.
+
+  The compressions are deflate levels, and chains of filters given
+  as to nccopy -F, such as "blockshuffle|zstd,3"; the filter plugins
+  are found through HDF5_PLUGIN_PATH. In the CSV output the commas of
+  a filter chain are written as colons.
+
+  Given the CSV output of an earlier run (for example, with an
+  earlier release of netCDF) as a baseline, it also flags each
+  scenario whose median time got slower than the baseline by more
+  than a threshold, and exits with status 1 if any did.
+
+  The access patterns, on a 3D float variable data(t, y, x) with
+  t unlimited:
+
+  write  - create the file and write it one record at a time.
+  read   - read the whole variable one record at a time.
+  xsect  - read the time series at a number of (y, x) points.
+  random - read small boxes from random records and places.
+
+  The cold cache scenarios ask the operating system to drop the
+  cached pages of the file before each repetition, with
+  posix_fadvise(), where that is available. Each repetition opens
+  and closes the file, so the HDF5 chunk cache is always cold.
+*/
+
+#include <nc_tests.h> /* The ERR macro is here... */
+#include <err_macros.h>
+#include <time.h>
+#include <sys/time.h> /* Extra high precision time info. */
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <netcdf_filter.h>
+
+#define MILLION 1000000
+#define MAX_LIST 16             /* Max entries in a list option. */
+#define NY 256
+#define NX 256
+#define RECS_PER_MIB 4          /* NY*NX floats are 1/4 MiB. */
+#define NPOINTS 64              /* Time series read by xsect. */
+#define NBOXES 256              /* Boxes read by random. */
+#define BOX 32
+#define MAX_LINE 1024
+#define MAX_BASE 1024           /* Max scenarios in a baseline. */
+#define MAX_PATH 4096
+
+/* This macro prints an error message with line number and name of
+ * test program. */
+#define ERR1(n) do {                                                    \
+        fflush(stdout); /* Make sure our stdout is synced with stderr. */ \
+        fprintf(stderr, "Sorry! Unexpected result, %s, line: %d - %s\n", \
+                __FILE__, __LINE__, nc_strerror(n));                    \
+        return n;                                                       \
+    } while (0)
+
+int nc4_timeval_subtract(struct timeval *result, struct timeval *x,
+                         struct timeval *y);
+
+/* The file formats, by the names ncdump -k and nccopy -k use, and
+ * their create modes. */
+static const char *format_names[] = {"nc3", "nc6", "nc5", "nc4", "nc7", NULL};
+static const struct {
+    int mode;
+    int hdf5;                   /* Can be compressed. */
+} formats[] = {
+    {NC_CLOBBER, 0},
+    {NC_CLOBBER|NC_64BIT_OFFSET, 0},
+    {NC_CLOBBER|NC_64BIT_DATA, 0},
+    {NC_CLOBBER|NC_NETCDF4, 1},
+    {NC_CLOBBER|NC_NETCDF4|NC_CLASSIC_MODEL, 1}
+};
+static const char *patterns[] = {"write", "read", "xsect", "random", NULL};
+
+/* One scenario of the matrix, and its results. */
+typedef struct {
+    int format, pattern, deflate, size;
+    const char *filter;         /* Filter chain, or NULL. */
+    int cold;
+    size_t bytes;               /* Bytes written or read per repetition. */
+    double ratio;               /* Size of the data over size of the file. */
+    double min, p50, p90, max;  /* Seconds. */
+    double base_p50;            /* From the baseline, or < 0. */
+    int regression;
+} SCENARIO_T;
+
+/* A baseline scenario, as read from CSV. */
+typedef struct {
+    char key[MAX_LINE];
+    double p50;
+} BASE_T;
+
+static void
+usage(void)
+{
+    fprintf(stderr, "bm_suite -- run a matrix of netCDF benchmarks\n"
+            "usage: bm_suite [-f formats] [-p patterns] [-z levels] [-F filters]\n"
+            "                [-s sizes] [-m caches] [-r reps] [-o csv|json]\n"
+            "                [-b baseline.csv] [-T percent] [-d dir]\n"
+            "  -f  comma separated formats: nc3,nc6,nc5,nc4,nc7 (default nc3,nc4)\n"
+            "  -p  access patterns: write,read,xsect,random (default all)\n"
+            "  -z  deflate levels, ignored for classic formats (default 0,1)\n"
+            "  -F  a filter chain to compare with them, as for nccopy -F,\n"
+            "      such as 'blockshuffle|zstd,3'; may be repeated\n"
+            "  -s  sizes of the variable in MiB (default 16)\n"
+            "  -m  caches for the reads: warm,cold (default both)\n"
+            "  -r  repetitions of each scenario (default 5)\n"
+            "  -o  output format (default csv)\n"
+            "  -b  CSV output of an earlier run to compare with\n"
+            "  -T  percent slower than the baseline that is a regression\n"
+            "      (default 10)\n"
+            "  -d  directory for the benchmark files (default .)\n");
+}
+
+/* Parse a comma separated list of names into indexes in table, or of
+ * numbers if table is NULL. Return the number of entries, or -1. */
+static int
+parse_list(const char *arg, const char **table, int *list)
+{
+    char buf[MAX_LINE], *tok, *save = NULL;
+    int n = 0, i;
+
+    strncpy(buf, arg, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    for (tok = strtok_r(buf, ",", &save); tok; tok = strtok_r(NULL, ",", &save))
+    {
+        if (n == MAX_LIST)
+            return -1;
+        if (table)
+        {
+            for (i = 0; table[i]; i++)
+                if (!strcmp(tok, table[i]))
+                    break;
+            if (!table[i])
+                return -1;
+            list[n++] = i;
+        }
+        else
+        {
+            char *end;
+            long v = strtol(tok, &end, 10);
+            if (*end || v < 0)
+                return -1;
+            list[n++] = (int)v;
+        }
+    }
+    return n;
+}
+
+static double
+elapsed(struct timeval *start)
+{
+    struct timeval end, diff;
+
+    gettimeofday(&end, NULL);
+    nc4_timeval_subtract(&diff, &end, start);
+    return (double)diff.tv_sec + (double)diff.tv_usec / MILLION;
+}
+
+/* Drop the cached pages of a file, so it is read from the disk. Return
+ * 0 if that is not possible here. */
+static int
+drop_cache(const char *path)
+{
+#ifdef POSIX_FADV_DONTNEED
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return 0;
+    fsync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/* Add a chain of filters, in nccopy -F syntax, to a variable. */
+static int
+def_filters(int ncid, int varid, const char *spec)
+{
+    NC4_Filterspec **filters = NULL;
+    size_t nfilters = 0, i;
+    int format, ret;
+
+    if ((ret = NC_parsefilterlist(spec, &format, &nfilters,
+                                  (NC_Filterspec ***)&filters)))
+        ERR1(ret);
+    for (i = 0; i < nfilters; i++)
+        if (!ret)
+            ret = nc_def_var_filter(ncid, varid, filters[i]->filterid,
+                                    filters[i]->nparams, filters[i]->params);
+    for (i = 0; i < nfilters; i++)
+    {
+        free(filters[i]->params);
+        free(filters[i]);
+    }
+    free(filters);
+    if (ret)
+        ERR1(ret);
+    return NC_NOERR;
+}
+
+/* Create the file and write the variable a record at a time. */
+static int
+run_write(const char *path, int format, int deflate, const char *filter,
+          size_t nrecs, size_t *bytes)
+{
+    int ncid, dimids[3], varid, ret;
+    size_t start[3] = {0, 0, 0}, count[3] = {1, NY, NX};
+    size_t chunks[3] = {16, 64, 64};
+    float *data;
+    size_t r, i;
+
+    if (!(data = malloc(NY * NX * sizeof(float))))
+        ERR1(NC_ENOMEM);
+    if ((ret = nc_create(path, formats[format].mode, &ncid)))
+        ERR1(ret);
+    if ((ret = nc_def_dim(ncid, "t", NC_UNLIMITED, &dimids[0])) ||
+        (ret = nc_def_dim(ncid, "y", NY, &dimids[1])) ||
+        (ret = nc_def_dim(ncid, "x", NX, &dimids[2])) ||
+        (ret = nc_def_var(ncid, "data", NC_FLOAT, 3, dimids, &varid)))
+        ERR1(ret);
+    if (formats[format].hdf5)
+    {
+        if ((ret = nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunks)))
+            ERR1(ret);
+        if (deflate && (ret = nc_def_var_deflate(ncid, varid, 1, 1, deflate)))
+            ERR1(ret);
+        if (filter && (ret = def_filters(ncid, varid, filter)))
+            return ret;
+    }
+    if ((ret = nc_enddef(ncid)))
+        ERR1(ret);
+    for (r = 0; r < nrecs; r++)
+    {
+        /* Smooth fields with some noise, so they compress somewhat. */
+        for (i = 0; i < NY * NX; i++)
+            data[i] = (float)r + (float)(i / NX) * 0.01f + (float)(i % NX) * 0.0001f
+                + (float)((i * 2654435761u + r) % 1000) * 1e-6f;
+        start[0] = r;
+        if ((ret = nc_put_vara_float(ncid, varid, start, count, data)))
+            ERR1(ret);
+    }
+    if ((ret = nc_close(ncid)))
+        ERR1(ret);
+    free(data);
+    *bytes = nrecs * NY * NX * sizeof(float);
+    return NC_NOERR;
+}
+
+/* Open the file and read it with one of the read patterns. */
+static int
+run_read(const char *path, int pattern, size_t nrecs, size_t *bytes)
+{
+    int ncid, varid, ret;
+    size_t start[3] = {0, 0, 0}, count[3];
+    unsigned int seed = 1;
+    float *data;
+    size_t i;
+
+    if (!(data = malloc((nrecs > NY * NX ? nrecs : NY * NX) * sizeof(float))))
+        ERR1(NC_ENOMEM);
+    if ((ret = nc_open(path, NC_NOWRITE, &ncid)))
+        ERR1(ret);
+    if ((ret = nc_inq_varid(ncid, "data", &varid)))
+        ERR1(ret);
+    *bytes = 0;
+    if (!strcmp(patterns[pattern], "read"))
+    {
+        count[0] = 1; count[1] = NY; count[2] = NX;
+        for (i = 0; i < nrecs; i++)
+        {
+            start[0] = i;
+            if ((ret = nc_get_vara_float(ncid, varid, start, count, data)))
+                ERR1(ret);
+        }
+        *bytes = nrecs * NY * NX * sizeof(float);
+    }
+    else if (!strcmp(patterns[pattern], "xsect"))
+    {
+        count[0] = nrecs; count[1] = 1; count[2] = 1;
+        for (i = 0; i < NPOINTS; i++)
+        {
+            start[1] = (i * 97) % NY;
+            start[2] = (i * 61 + 13) % NX;
+            if ((ret = nc_get_vara_float(ncid, varid, start, count, data)))
+                ERR1(ret);
+        }
+        *bytes = NPOINTS * nrecs * sizeof(float);
+    }
+    else
+    {
+        /* The same boxes in each repetition. */
+        count[0] = 1; count[1] = BOX; count[2] = BOX;
+        for (i = 0; i < NBOXES; i++)
+        {
+            seed = seed * 1103515245u + 12345u;
+            start[0] = (seed >> 8) % nrecs;
+            seed = seed * 1103515245u + 12345u;
+            start[1] = (seed >> 8) % (NY - BOX + 1);
+            seed = seed * 1103515245u + 12345u;
+            start[2] = (seed >> 8) % (NX - BOX + 1);
+            if ((ret = nc_get_vara_float(ncid, varid, start, count, data)))
+                ERR1(ret);
+        }
+        *bytes = NBOXES * BOX * BOX * sizeof(float);
+    }
+    if ((ret = nc_close(ncid)))
+        ERR1(ret);
+    free(data);
+    return NC_NOERR;
+}
+
+static int
+cmpdouble(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+/* The nearest rank percentile of sorted times. */
+static double
+percentile(const double *t, int n, int pct)
+{
+    int rank = (pct * n + 99) / 100;
+    return t[rank > 0 ? rank - 1 : 0];
+}
+
+/* Writes start with no file, so have no cache to be warm or cold. */
+static const char *
+cache_name(const SCENARIO_T *s)
+{
+    if (!strcmp(patterns[s->pattern], "write"))
+        return "none";
+    return s->cold ? "cold" : "warm";
+}
+
+/* The size of the data over the size of the file. */
+static double
+file_ratio(const char *path, size_t bytes)
+{
+    struct stat st;
+
+    if (stat(path, &st) || st.st_size <= 0)
+        return 0;
+    return (double)bytes / (double)st.st_size;
+}
+
+static void
+scenario_key(const SCENARIO_T *s, char *key, size_t len)
+{
+    char compress[MAX_LINE / 2];
+    char *c;
+
+    if (s->filter)
+    {
+        /* Keep the CSV columns. */
+        strncpy(compress, s->filter, sizeof(compress) - 1);
+        compress[sizeof(compress) - 1] = '\0';
+        for (c = compress; *c; c++)
+            if (*c == ',')
+                *c = ':';
+    }
+    else
+        snprintf(compress, sizeof(compress), "%d", s->deflate);
+    snprintf(key, len, "%s,%s,%s,%d,%s", format_names[s->format],
+             patterns[s->pattern], compress, s->size, cache_name(s));
+}
+
+/* Read the scenarios and median times from an earlier CSV output. */
+static int
+read_baseline(const char *path, BASE_T *base, int *nbase)
+{
+    FILE *fp;
+    char line[MAX_LINE];
+    int p50col = -1;
+
+    if (!(fp = fopen(path, "r")))
+    {
+        fprintf(stderr, "bm_suite: cannot open %s\n", path);
+        return NC_EINVAL;
+    }
+    *nbase = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        char *tok, *save = NULL, *key;
+        int col;
+
+        line[strcspn(line, "\r\n")] = '\0';
+        if (p50col < 0)
+        {
+            /* The header. */
+            for (col = 0, tok = strtok_r(line, ",", &save); tok;
+                 col++, tok = strtok_r(NULL, ",", &save))
+                if (!strcmp(tok, "p50_s"))
+                    p50col = col;
+            if (p50col < 5)
+                break;
+            continue;
+        }
+        if (*nbase == MAX_BASE)
+            break;
+        key = base[*nbase].key;
+        key[0] = '\0';
+        for (col = 0, tok = strtok_r(line, ",", &save); tok;
+             col++, tok = strtok_r(NULL, ",", &save))
+        {
+            if (col < 5)
+            {
+                if (col)
+                    strcat(key, ",");
+                strncat(key, tok, MAX_LINE / 8);
+            }
+            else if (col == p50col)
+            {
+                base[*nbase].p50 = atof(tok);
+                (*nbase)++;
+                break;
+            }
+        }
+    }
+    fclose(fp);
+    if (p50col < 5)
+    {
+        fprintf(stderr, "bm_suite: %s is not bm_suite CSV output\n", path);
+        return NC_EINVAL;
+    }
+    return NC_NOERR;
+}
+
+static void
+print_csv_header(void)
+{
+    printf("format,pattern,compress,size_mib,cache,reps,bytes,min_s,p50_s,"
+           "p90_s,max_s,mb_per_s,base_p50_s,regression,ratio\n");
+}
+
+static void
+print_csv(const SCENARIO_T *s, int reps)
+{
+    char key[MAX_LINE];
+
+    scenario_key(s, key, sizeof(key));
+    printf("%s,%d,%zu,%.6f,%.6f,%.6f,%.6f,%.2f,", key, reps, s->bytes,
+           s->min, s->p50, s->p90, s->max, (double)s->bytes / s->p50 / 1e6);
+    if (s->base_p50 >= 0)
+        printf("%.6f,%d,", s->base_p50, s->regression);
+    else
+        printf(",,");
+    printf("%.3f\n", s->ratio);
+}
+
+static void
+print_json(const SCENARIO_T *s, int reps, int first)
+{
+    printf("%s    {\"format\": \"%s\", \"pattern\": \"%s\", \"deflate\": %d, ",
+           first ? "" : ",\n", format_names[s->format], patterns[s->pattern],
+           s->deflate);
+    if (s->filter)
+        printf("\"filter\": \"%s\", ", s->filter);
+    else
+        printf("\"filter\": null, ");
+    printf("\"size_mib\": %d, \"cache\": \"%s\", \"reps\": %d, \"bytes\": %zu,\n"
+           "     \"min_s\": %.6f, \"p50_s\": %.6f, \"p90_s\": %.6f, "
+           "\"max_s\": %.6f, \"mb_per_s\": %.2f, \"ratio\": %.3f",
+           s->size, cache_name(s), reps, s->bytes,
+           s->min, s->p50, s->p90, s->max, (double)s->bytes / s->p50 / 1e6,
+           s->ratio);
+    if (s->base_p50 >= 0)
+        printf(", \"base_p50_s\": %.6f, \"regression\": %s}", s->base_p50,
+               s->regression ? "true" : "false");
+    else
+        printf(", \"base_p50_s\": null, \"regression\": null}");
+}
+
+int
+main(int argc, char **argv)
+{
+    int fmtlist[MAX_LIST] = {0, 3}, nfmt = 2;
+    int patlist[MAX_LIST] = {0, 1, 2, 3}, npat = 4;
+    int zlist[MAX_LIST] = {0, 1}, nz = 2;
+    const char *filterlist[MAX_LIST];
+    int nfilter = 0;
+    int sizelist[MAX_LIST] = {16}, nsize = 1;
+    int cachelist[MAX_LIST] = {0, 1}, ncache = 2;
+    static const char *caches[] = {"warm", "cold", NULL};
+    int reps = 5, json = 0, threshold = 10;
+    char *baseline = NULL, *dir = ".";
+    static BASE_T base[MAX_BASE];
+    int nbase = 0, nout = 0, nregress = 0, warned = 0;
+    double *times;
+    int f, p, z, s, c, r, opt;
+    int ret;
+
+    while ((opt = getopt(argc, argv, "f:p:z:F:s:m:r:o:b:T:d:h")) != EOF)
+        switch (opt)
+        {
+        case 'f':
+            if ((nfmt = parse_list(optarg, format_names, fmtlist)) < 1)
+            {
+                usage();
+                return 1;
+            }
+            break;
+        case 'p':
+            if ((npat = parse_list(optarg, patterns, patlist)) < 1)
+            {
+                usage();
+                return 1;
+            }
+            break;
+        case 'z':
+            if ((nz = parse_list(optarg, NULL, zlist)) < 1)
+            {
+                usage();
+                return 1;
+            }
+            break;
+        case 'F':
+            if (nfilter == MAX_LIST)
+            {
+                usage();
+                return 1;
+            }
+            filterlist[nfilter++] = optarg;
+            break;
+        case 's':
+            if ((nsize = parse_list(optarg, NULL, sizelist)) < 1)
+            {
+                usage();
+                return 1;
+            }
+            break;
+        case 'm':
+            if ((ncache = parse_list(optarg, caches, cachelist)) < 1)
+            {
+                usage();
+                return 1;
+            }
+            break;
+        case 'r':
+            if ((reps = atoi(optarg)) < 1)
+            {
+                usage();
+                return 1;
+            }
+            break;
+        case 'o':
+            if (!strcmp(optarg, "json"))
+                json = 1;
+            else if (strcmp(optarg, "csv"))
+            {
+                usage();
+                return 1;
+            }
+            break;
+        case 'b':
+            baseline = optarg;
+            break;
+        case 'T':
+            threshold = atoi(optarg);
+            break;
+        case 'd':
+            dir = optarg;
+            break;
+        case 'h':
+        default:
+            usage();
+            return opt != 'h';
+        }
+
+    if (baseline && (ret = read_baseline(baseline, base, &nbase)))
+        return 1;
+    if (!(times = malloc((size_t)reps * sizeof(double))))
+        ERR;
+
+    if (json)
+        printf("{\"netcdf_version\": \"%s\", \"reps\": %d, \"results\": [\n",
+               nc_inq_libvers(), reps);
+    else
+        print_csv_header();
+
+    for (f = 0; f < nfmt; f++)
+    {
+        /* The deflate levels, then the filter chains. */
+        for (z = 0; z < nz + nfilter; z++)
+        {
+            int deflate = z < nz ? zlist[z] : 0;
+            const char *filter = z < nz ? NULL : filterlist[z - nz];
+
+            /* Classic formats cannot be compressed. */
+            if (!formats[fmtlist[f]].hdf5 && (deflate != 0 || filter))
+                continue;
+            for (s = 0; s < nsize; s++)
+            {
+                char path[MAX_PATH];
+                size_t nrecs = (size_t)sizelist[s] * RECS_PER_MIB;
+                SCENARIO_T sc;
+                int written = 0;
+                double ratio = 0;
+
+                if (!nrecs)
+                    continue;
+                snprintf(path, sizeof(path), "%s/bm_suite_%s_%s%d_%d.nc", dir,
+                         format_names[fmtlist[f]], filter ? "F" : "",
+                         filter ? z - nz : deflate, sizelist[s]);
+                for (p = 0; p < npat; p++)
+                {
+                    for (c = 0; c < ncache; c++)
+                    {
+                        int write = !strcmp(patterns[patlist[p]], "write");
+
+                        /* Writes always start with a new file. */
+                        if (write && c > 0)
+                            continue;
+                        memset(&sc, 0, sizeof(sc));
+                        sc.format = fmtlist[f];
+                        sc.pattern = patlist[p];
+                        sc.deflate = deflate;
+                        sc.filter = filter;
+                        sc.size = sizelist[s];
+                        sc.cold = !write && cachelist[c];
+                        sc.base_p50 = -1;
+
+                        /* Read patterns need the file. */
+                        if (!write && !written)
+                        {
+                            if ((ret = run_write(path, fmtlist[f], deflate, filter,
+                                                 nrecs, &sc.bytes)))
+                                return 1;
+                            ratio = file_ratio(path, sc.bytes);
+                            written = 1;
+                        }
+                        for (r = 0; r < reps; r++)
+                        {
+                            struct timeval start;
+
+                            if (sc.cold && !drop_cache(path))
+                            {
+                                if (!warned++)
+                                    fprintf(stderr, "bm_suite: cannot drop cached "
+                                            "pages here, cold cache scenarios "
+                                            "are skipped\n");
+                                break;
+                            }
+                            gettimeofday(&start, NULL);
+                            if (write)
+                                ret = run_write(path, fmtlist[f], deflate, filter,
+                                                nrecs, &sc.bytes);
+                            else
+                                ret = run_read(path, patlist[p], nrecs, &sc.bytes);
+                            times[r] = elapsed(&start);
+                            if (ret)
+                                return 1;
+                        }
+                        if (r < reps)
+                            continue;
+                        if (write)
+                            ratio = file_ratio(path, sc.bytes);
+                        sc.ratio = ratio;
+                        written = 1;
+
+                        qsort(times, (size_t)reps, sizeof(double), cmpdouble);
+                        sc.min = times[0];
+                        sc.p50 = percentile(times, reps, 50);
+                        sc.p90 = percentile(times, reps, 90);
+                        sc.max = times[reps - 1];
+                        if (sc.p50 <= 0)
+                            sc.p50 = 1e-6;
+                        if (nbase)
+                        {
+                            char key[MAX_LINE];
+                            int b;
+
+                            scenario_key(&sc, key, sizeof(key));
+                            for (b = 0; b < nbase; b++)
+                                if (!strcmp(key, base[b].key))
+                                    break;
+                            if (b < nbase)
+                            {
+                                sc.base_p50 = base[b].p50;
+                                if (sc.p50 > sc.base_p50 * (1 + threshold / 100.0))
+                                {
+                                    sc.regression = 1;
+                                    nregress++;
+                                    fprintf(stderr, "bm_suite: regression %s: "
+                                            "median %.6f s, baseline %.6f s\n",
+                                            key, sc.p50, sc.base_p50);
+                                }
+                            }
+                        }
+                        if (json)
+                            print_json(&sc, reps, !nout);
+                        else
+                            print_csv(&sc, reps);
+                        nout++;
+                        fflush(stdout);
+                    }
+                }
+                unlink(path);
+            }
+        }
+    }
+    if (json)
+        printf("\n]}\n");
+    free(times);
+    return nregress ? 1 : 0;
+}
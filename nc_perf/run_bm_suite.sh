@@ -0,0 +1,44 @@
+#!/bin/sh
+
+# This shell script runs a small matrix of scenarios with the
+# bm_suite benchmark harness, then runs it again with the first
+# results as the baseline.
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+set -e
+
+echo ""
+echo "*** Running bm_suite on a small scenario matrix..."
+${execdir}/bm_suite -f nc3,nc4 -z 0,1 -s 1 -r 2 > tst_bm_suite.csv
+cat tst_bm_suite.csv
+# A header, then 7 scenarios each for nc3, nc4 and nc4 with deflate,
+# less the cold ones where the cache cannot be dropped.
+test `grep -c '^nc[34],' tst_bm_suite.csv` -ge 12
+
+echo "*** Comparing with the baseline..."
+${execdir}/bm_suite -f nc3,nc4 -z 0,1 -s 1 -r 2 -o json \
+    -b tst_bm_suite.csv -T 100000 > tst_bm_suite.json
+grep -q '"regression": false' tst_bm_suite.json
+if grep -q '"regression": true' tst_bm_suite.json ; then
+    echo "*** FAIL: regression reported"
+    exit 1
+fi
+
+# Compare a filter chain with deflate, where the plugins were built.
+if test -f ${top_builddir}/nc_test4/findplugin.sh ; then
+    . ${top_builddir}/nc_test4/findplugin.sh
+    if findplugin h5blockshuffle >/dev/null ; then
+        echo "*** Running bm_suite with a filter chain..."
+        export HDF5_PLUGIN_PATH
+        ${execdir}/bm_suite -f nc4 -p write,read -z 1 -F "blockshuffle|deflate,1" \
+            -s 1 -r 1 -m warm > tst_bm_suite.csv
+        cat tst_bm_suite.csv
+        grep -q '^nc4,read,blockshuffle|deflate:1,1,warm,' tst_bm_suite.csv
+    fi
+fi
+
+rm -f tst_bm_suite.csv tst_bm_suite.json
+echo '*** SUCCESS!!!'
+exit 0
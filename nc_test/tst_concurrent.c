@@ -0,0 +1,130 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test the NC_CONCURRENT open mode for classic files: reads must see
+  the same data as an ordinary open, every kind of change must fail,
+  and the mode must be refused where it cannot be honored.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <string.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_concurrent.nc"
+#define NREC 5
+#define NX 3000
+#define ATT_NAME "title"
+#define ATT_TEXT "concurrent read test"
+
+static int
+make_file(int format)
+{
+    int ncid, dimids[2], fixid, recid;
+    int fix[NX], rec[NX];
+    size_t start[2] = {0, 0}, count[2] = {1, NX};
+    int i, r;
+
+    if (nc_create(FILE_NAME, NC_CLOBBER|format, &ncid)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimids[0])) ERR;
+    if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+    if (nc_def_var(ncid, "fix", NC_INT, 1, &dimids[1], &fixid)) ERR;
+    if (nc_def_var(ncid, "rec", NC_INT, 2, dimids, &recid)) ERR;
+    if (nc_put_att_text(ncid, NC_GLOBAL, ATT_NAME, strlen(ATT_TEXT), ATT_TEXT)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    for (i = 0; i < NX; i++)
+        fix[i] = -i;
+    if (nc_put_var_int(ncid, fixid, fix)) ERR;
+    for (r = 0; r < NREC; r++)
+    {
+        for (i = 0; i < NX; i++)
+            rec[i] = r * NX + i;
+        start[0] = r;
+        if (nc_put_vara_int(ncid, recid, start, count, rec)) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+static int
+check_file(int format)
+{
+    int ncid, fixid, recid, i, r;
+    int fix[NX], rec[NREC][NX], strided[NX / 7 + 1];
+    size_t len, start[2] = {0, 0}, count[2] = {NREC, NX};
+    size_t sizehint = 1024;
+    ptrdiff_t stride[2] = {1, 7};
+    char text[sizeof(ATT_TEXT)];
+
+    if (make_file(format)) ERR;
+
+    /* NC_CONCURRENT is for reading only. */
+    if (nc_open(FILE_NAME, NC_CONCURRENT|NC_WRITE, &ncid) != NC_EINVAL) ERR;
+    if (nc_open(FILE_NAME, NC_CONCURRENT|NC_SHARE, &ncid) != NC_EINVAL) ERR;
+    if (nc_open(FILE_NAME, NC_CONCURRENT|NC_DISKLESS, &ncid) != NC_EINVAL) ERR;
+
+    /* Use a small chunk so reads span several pread calls. */
+    if (nc__open(FILE_NAME, NC_CONCURRENT, &sizehint, &ncid)) ERR;
+    if (nc_inq_dimlen(ncid, 0, &len)) ERR;
+    if (len != NREC) ERR;
+    if (nc_get_att_text(ncid, NC_GLOBAL, ATT_NAME, text)) ERR;
+    if (strncmp(text, ATT_TEXT, strlen(ATT_TEXT))) ERR;
+    if (nc_inq_varid(ncid, "fix", &fixid)) ERR;
+    if (nc_inq_varid(ncid, "rec", &recid)) ERR;
+    if (nc_get_var_int(ncid, fixid, fix)) ERR;
+    for (i = 0; i < NX; i++)
+        if (fix[i] != -i) ERR;
+    if (nc_get_vara_int(ncid, recid, start, count, &rec[0][0])) ERR;
+    for (r = 0; r < NREC; r++)
+        for (i = 0; i < NX; i++)
+            if (rec[r][i] != r * NX + i) ERR;
+    start[0] = 2;
+    count[0] = 1;
+    count[1] = NX / 7 + 1;
+    if (nc_get_vars_int(ncid, recid, start, count, stride, strided)) ERR;
+    for (i = 0; i < NX / 7 + 1; i++)
+        if (strided[i] != 2 * NX + 7 * i) ERR;
+    start[0] = NREC + 1;
+    count[0] = 1;
+    count[1] = NX;
+    if (nc_get_vara_int(ncid, recid, start, count, &rec[0][0]) != NC_EINVALCOORDS) ERR;
+
+    /* Nothing may change, and sync leaves the header alone. */
+    if (nc_put_var1_int(ncid, fixid, start + 1, &i) != NC_EPERM) ERR;
+    if (nc_redef(ncid) != NC_EPERM) ERR;
+    if (nc_set_fill(ncid, NC_NOFILL, &i) != NC_EPERM) ERR;
+    if (nc_sync(ncid)) ERR;
+    if (nc_inq_dimlen(ncid, 0, &len)) ERR;
+    if (len != NREC) ERR;
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing NC_CONCURRENT open mode.\n");
+    printf("*** testing classic file...");
+    if (check_file(0)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing 64-bit offset file...");
+    if (check_file(NC_64BIT_OFFSET)) ERR;
+    SUMMARIZE_ERR;
+#ifdef ENABLE_CDF5
+    printf("*** testing CDF5 file...");
+    if (check_file(NC_CDF5)) ERR;
+    SUMMARIZE_ERR;
+#endif
+    printf("*** testing that NC_CONCURRENT is refused by nc_create...");
+    {
+        int ncid;
+        if (nc_create(FILE_NAME, NC_CLOBBER|NC_CONCURRENT, &ncid) != NC_EINVAL) ERR;
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
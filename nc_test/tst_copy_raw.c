@@ -0,0 +1,259 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test nc_copy_data_raw(): copying the stored data of classic files
+  to files of other classic formats and header sizes, with record
+  variables becoming fixed size and the other way round.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_copy_raw.nc"
+#define FILE_NAME2 "tst_copy_raw2.nc"
+#define NREC 7
+#define NX 5    /* odd, so byte and short variables are padded */
+#define NY 33
+
+/* Create the input file: fixed and record variables of several
+   types. If onerec, there is a single record variable, so records
+   are not padded. */
+static int
+create_input(int format, int onerec)
+{
+    int ncid, recdim, xdim, ydim, dimids[2];
+    int bvarid, svarid, dvarid, rsvarid, rdvarid;
+    signed char b[NX];
+    short s[NREC][NX];
+    double d[NY], rd[NREC][NY];
+    size_t start[2] = {0, 0}, count[2] = {NREC, NX};
+    int i, j;
+
+    for (i = 0; i < NX; i++)
+        b[i] = (signed char)(i - 2);
+    for (i = 0; i < NY; i++)
+        d[i] = i * 0.5;
+    for (i = 0; i < NREC; i++) {
+        for (j = 0; j < NX; j++)
+            s[i][j] = (short)(i * 100 + j);
+        for (j = 0; j < NY; j++)
+            rd[i][j] = i * 1000.0 + j;
+    }
+
+    if (nc_create(FILE_NAME, NC_CLOBBER|format, &ncid)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &recdim)) ERR;
+    if (nc_def_dim(ncid, "x", NX, &xdim)) ERR;
+    if (nc_def_dim(ncid, "y", NY, &ydim)) ERR;
+    if (nc_def_var(ncid, "b", NC_BYTE, 1, &xdim, &bvarid)) ERR;
+    dimids[0] = recdim;
+    dimids[1] = xdim;
+    if (nc_def_var(ncid, "rs", NC_SHORT, 2, dimids, &rsvarid)) ERR;
+    if (nc_def_var(ncid, "d", NC_DOUBLE, 1, &ydim, &dvarid)) ERR;
+    if (!onerec) {
+        dimids[1] = ydim;
+        if (nc_def_var(ncid, "rd", NC_DOUBLE, 2, dimids, &rdvarid)) ERR;
+    }
+    if (nc_def_var(ncid, "s", NC_SHORT, 0, NULL, &svarid)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    if (nc_put_var_schar(ncid, bvarid, b)) ERR;
+    if (nc_put_var_double(ncid, dvarid, d)) ERR;
+    if (nc_put_var1_short(ncid, svarid, NULL, &s[1][1])) ERR;
+    if (nc_put_vara_short(ncid, rsvarid, start, count, &s[0][0])) ERR;
+    if (!onerec) {
+        count[1] = NY;
+        if (nc_put_vara_double(ncid, rdvarid, start, count, &rd[0][0])) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+/* Define in the output file the variables of the input file, with
+   record variables fixed size if fixrec. headroom bytes are left free
+   after the header. */
+static int
+create_output(int ncid_in, int format, int fixrec, size_t headroom,
+              int *ncidp)
+{
+    int ncid, ndims, nvars, d, v;
+
+    if (nc_create(FILE_NAME2, NC_CLOBBER|format, &ncid)) ERR;
+    if (nc_inq_ndims(ncid_in, &ndims)) ERR;
+    for (d = 0; d < ndims; d++) {
+        char name[NC_MAX_NAME + 1];
+        size_t len;
+        int dimid, unlimid;
+        if (nc_inq_dim(ncid_in, d, name, &len)) ERR;
+        if (nc_inq_unlimdim(ncid_in, &unlimid)) ERR;
+        if (d == unlimid && fixrec)
+            len = NREC;
+        if (nc_def_dim(ncid, name, len, &dimid)) ERR;
+    }
+    if (nc_inq_nvars(ncid_in, &nvars)) ERR;
+    for (v = 0; v < nvars; v++) {
+        char name[NC_MAX_NAME + 1];
+        nc_type xtype;
+        int vndims, dimids[NC_MAX_VAR_DIMS], varid;
+        if (nc_inq_var(ncid_in, v, name, &xtype, &vndims, dimids, NULL)) ERR;
+        if (nc_def_var(ncid, name, xtype, vndims, dimids, &varid)) ERR;
+    }
+    if (nc__enddef(ncid, headroom, 4, 0, 4)) ERR;
+    *ncidp = ncid;
+    return 0;
+}
+
+/* Check that every variable of FILE_NAME2 has the data of the
+   variable of the same name in FILE_NAME. */
+static int
+compare_files(void)
+{
+    int ncid_in, ncid_out, nvars, v;
+
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid_in)) ERR;
+    if (nc_open(FILE_NAME2, NC_NOWRITE, &ncid_out)) ERR;
+    if (nc_inq_nvars(ncid_out, &nvars)) ERR;
+    for (v = 0; v < nvars; v++) {
+        char name[NC_MAX_NAME + 1];
+        int varid_in;
+        double in[NREC * NY], out[NREC * NY];
+        size_t i, n = 1;
+        int ndims, dimids[NC_MAX_VAR_DIMS], d;
+
+        if (nc_inq_var(ncid_out, v, name, NULL, &ndims, dimids, NULL)) ERR;
+        for (d = 0; d < ndims; d++) {
+            size_t len;
+            if (nc_inq_dimlen(ncid_out, dimids[d], &len)) ERR;
+            n *= len;
+        }
+        if (nc_inq_varid(ncid_in, name, &varid_in)) ERR;
+        if (nc_get_var_double(ncid_in, varid_in, in)) ERR;
+        if (nc_get_var_double(ncid_out, v, out)) ERR;
+        for (i = 0; i < n; i++)
+            if (in[i] != out[i]) ERR;
+    }
+    if (nc_close(ncid_in)) ERR;
+    if (nc_close(ncid_out)) ERR;
+    return 0;
+}
+
+/* Copy FILE_NAME to a new FILE_NAME2 of the given format. */
+static int
+copy_to(int format, int fixrec, size_t headroom)
+{
+    int ncid_in, ncid_out;
+    size_t nrecs;
+
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid_in)) ERR;
+    if (create_output(ncid_in, format, fixrec, headroom, &ncid_out)) ERR;
+    if (nc_copy_data_raw(ncid_in, ncid_out)) ERR;
+    if (!fixrec) {
+        if (nc_inq_dimlen(ncid_out, 0, &nrecs)) ERR;
+        if (nrecs != NREC) ERR;
+    }
+    if (nc_close(ncid_in)) ERR;
+    if (nc_close(ncid_out)) ERR;
+    return compare_files();
+}
+
+static int
+test_formats(int format_in, int onerec)
+{
+    int formats[] = {0, NC_64BIT_OFFSET,
+#ifdef ENABLE_CDF5
+                     NC_64BIT_DATA
+#endif
+    };
+    int f;
+
+    if (create_input(format_in, onerec)) ERR;
+    for (f = 0; f < (int)(sizeof(formats)/sizeof(formats[0])); f++) {
+        if (copy_to(formats[f], 0, 0)) ERR;
+        if (copy_to(formats[f], 0, 1000)) ERR;
+        if (copy_to(formats[f], 1, 0)) ERR;
+    }
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing nc_copy_data_raw.\n");
+    printf("**** testing copies between classic formats...");
+    if (test_formats(0, 0)) ERR;
+    if (test_formats(NC_64BIT_OFFSET, 0)) ERR;
+#ifdef ENABLE_CDF5
+    if (test_formats(NC_64BIT_DATA, 0)) ERR;
+#endif
+    SUMMARIZE_ERR;
+    printf("**** testing a single record variable...");
+    if (test_formats(0, 1)) ERR;
+    SUMMARIZE_ERR;
+    printf("**** testing a fixed size variable becoming a record variable...");
+    {
+        int ncid_in, ncid_out, dimid, varid;
+        short s[NX] = {1, -2, 3, -4, 5};
+
+        if (nc_create(FILE_NAME, NC_CLOBBER, &ncid_in)) ERR;
+        if (nc_def_dim(ncid_in, "x", NX, &dimid)) ERR;
+        if (nc_def_var(ncid_in, "s", NC_SHORT, 1, &dimid, &varid)) ERR;
+        if (nc_enddef(ncid_in)) ERR;
+        if (nc_put_var_short(ncid_in, varid, s)) ERR;
+        /* x unlimited in the output */
+        if (nc_create(FILE_NAME2, NC_CLOBBER, &ncid_out)) ERR;
+        if (nc_def_dim(ncid_out, "x", NC_UNLIMITED, &dimid)) ERR;
+        if (nc_def_var(ncid_out, "s", NC_SHORT, 1, &dimid, &varid)) ERR;
+        if (nc_enddef(ncid_out)) ERR;
+        if (nc_copy_data_raw(ncid_in, ncid_out)) ERR;
+        if (nc_close(ncid_in)) ERR;
+        if (nc_close(ncid_out)) ERR;
+        if (compare_files()) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("**** testing files that do not match...");
+    {
+        int ncid_in, ncid_out, dimid, varid;
+        size_t index[1] = {0};
+        signed char b;
+
+        if (create_input(0, 0)) ERR;
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid_in)) ERR;
+
+        /* A variable missing from the input. */
+        if (create_output(ncid_in, 0, 0, 0, &ncid_out)) ERR;
+        if (nc_redef(ncid_out)) ERR;
+        if (nc_copy_data_raw(ncid_in, ncid_out) != NC_EINDEFINE) ERR;
+        if (nc_def_var(ncid_out, "extra", NC_SHORT, 0, NULL, &varid)) ERR;
+        if (nc_enddef(ncid_out)) ERR;
+        if (nc_copy_data_raw(ncid_in, ncid_out) != NC_EINVAL) ERR;
+        /* Nothing was written. */
+        if (nc_get_var1_schar(ncid_out, 0, index, &b)) ERR;
+        if (b != NC_FILL_BYTE) ERR;
+        if (nc_close(ncid_out)) ERR;
+
+        /* A fixed dimension of the wrong length. */
+        if (nc_create(FILE_NAME2, NC_CLOBBER, &ncid_out)) ERR;
+        if (nc_def_dim(ncid_out, "x", NX + 1, &dimid)) ERR;
+        if (nc_def_var(ncid_out, "b", NC_BYTE, 1, &dimid, &varid)) ERR;
+        if (nc_enddef(ncid_out)) ERR;
+        if (nc_copy_data_raw(ncid_in, ncid_out) != NC_EINVAL) ERR;
+        /* Writing to a read-only file. */
+        if (nc_copy_data_raw(ncid_out, ncid_in) != NC_EPERM) ERR;
+        if (nc_copy_data_raw(ncid_in, ncid_in) != NC_EINVAL) ERR;
+        if (nc_close(ncid_out)) ERR;
+
+#ifdef USE_NETCDF4
+        if (nc_create(FILE_NAME2, NC_CLOBBER|NC_NETCDF4, &ncid_out)) ERR;
+        if (nc_copy_data_raw(ncid_in, ncid_out) != NC_ENOTNC3) ERR;
+        if (nc_close(ncid_out)) ERR;
+#endif
+        if (nc_close(ncid_in)) ERR;
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
@@ -0,0 +1,144 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test the flushing of persisted diskless files: nc_sync() and close
+  write only what has changed since the last flush.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_diskless_flush.nc"
+#define BIG_LEN 1500000
+#define X_LEN 1001
+#define NREC 300
+/* Diskless files flush whole pages of up to a MB */
+#define MAX_PAGES_WRITE 2100000
+
+static float fbuf[BIG_LEN];
+static int ibuf[NREC * X_LEN];
+
+/* Check the data written by main(), with value changed at index. */
+static int
+check_data(int ncid, size_t index, float value)
+{
+    int varid;
+    size_t len, i;
+
+    if (nc_inq_varid(ncid, "f", &varid)) ERR;
+    if (nc_get_var_float(ncid, varid, fbuf)) ERR;
+    for (i = 0; i < BIG_LEN; i++)
+        if (fbuf[i] != (i == index ? value : (float)i)) ERR;
+    if (nc_inq_dimlen(ncid, 1, &len)) ERR;
+    if (len != NREC) ERR;
+    if (nc_inq_varid(ncid, "r", &varid)) ERR;
+    if (nc_get_var_int(ncid, varid, ibuf)) ERR;
+    for (i = 0; i < NREC * X_LEN; i++)
+        if (ibuf[i] != (int)i) ERR;
+    return 0;
+}
+
+/* Return the bytes written to ncid since the last call. */
+static unsigned long long
+written(int ncid)
+{
+    static unsigned long long last = 0;
+    nc_perf_stats_t stats;
+    unsigned long long n;
+
+    if (nc_inq_perf_stats(ncid, &stats)) return (unsigned long long)-1;
+    n = stats.io_write_bytes - last;
+    last = stats.io_write_bytes;
+    return n;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, dimids[2], fvarid, rvarid;
+    size_t start[2] = {0, 0}, count[2] = {1, X_LEN}, index = BIG_LEN / 2;
+    float value = -1;
+    size_t i;
+
+    printf("\n*** Testing the flushing of persisted diskless files.\n");
+    printf("*** testing nc_sync...");
+    {
+        for (i = 0; i < BIG_LEN; i++)
+            fbuf[i] = (float)i;
+        for (i = 0; i < NREC * X_LEN; i++)
+            ibuf[i] = (int)i;
+        if (nc_create(FILE_NAME, NC_CLOBBER|NC_DISKLESS|NC_PERSIST, &ncid)) ERR;
+        if (nc_def_dim(ncid, "big", BIG_LEN, &dimids[0])) ERR;
+        if (nc_def_var(ncid, "f", NC_FLOAT, 1, dimids, &fvarid)) ERR;
+        if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimids[0])) ERR;
+        if (nc_def_dim(ncid, "x", X_LEN, &dimids[1])) ERR;
+        if (nc_def_var(ncid, "r", NC_INT, 2, dimids, &rvarid)) ERR;
+        if (nc_enddef(ncid)) ERR;
+        (void)written(ncid);
+        if (nc_put_var_float(ncid, fvarid, fbuf)) ERR;
+        /* One record at a time, so the file grows page by page. */
+        for (start[0] = 0; start[0] < NREC; start[0]++)
+            if (nc_put_vara_int(ncid, rvarid, start, count, &ibuf[start[0] * X_LEN])) ERR;
+        if (check_data(ncid, 0, 0)) ERR;
+
+        /* The first sync writes everything, */
+        if (nc_sync(ncid)) ERR;
+        if (written(ncid) < BIG_LEN * sizeof(float) + NREC * X_LEN * sizeof(int)) ERR;
+        /* the next nothing, */
+        if (nc_sync(ncid)) ERR;
+        if (written(ncid) != 0) ERR;
+        /* and then only what changed. */
+        if (nc_put_var1_float(ncid, fvarid, &index, &value)) ERR;
+        if (nc_sync(ncid)) ERR;
+        if (written(ncid) > MAX_PAGES_WRITE) ERR;
+        if (check_data(ncid, index, value)) ERR;
+        {
+            int ncid2;
+
+            if (nc_open(FILE_NAME, NC_NOWRITE, &ncid2)) ERR;
+            if (check_data(ncid2, index, value)) ERR;
+            if (nc_close(ncid2)) ERR;
+        }
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing changes to an existing file...");
+    {
+        long size;
+        FILE *fp;
+
+        if (!(fp = fopen(FILE_NAME, "rb"))) ERR;
+        if (fseek(fp, 0, SEEK_END)) ERR;
+        size = ftell(fp);
+        fclose(fp);
+
+        /* Reading it changes nothing. */
+        if (nc_open(FILE_NAME, NC_DISKLESS|NC_PERSIST, &ncid)) ERR;
+        if (check_data(ncid, index, value)) ERR;
+        if (nc_close(ncid)) ERR;
+
+        value = -2;
+        if (nc_open(FILE_NAME, NC_WRITE|NC_DISKLESS|NC_PERSIST, &ncid)) ERR;
+        if (nc_inq_varid(ncid, "f", &fvarid)) ERR;
+        if (nc_put_var1_float(ncid, fvarid, &index, &value)) ERR;
+        if (nc_close(ncid)) ERR;
+
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (check_data(ncid, index, value)) ERR;
+        if (nc_close(ncid)) ERR;
+        if (!(fp = fopen(FILE_NAME, "rb"))) ERR;
+        if (fseek(fp, 0, SEEK_END)) ERR;
+        if (ftell(fp) != size) ERR;
+        fclose(fp);
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
@@ -0,0 +1,115 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test the fill values written by the classic library: for large
+  fixed size variables, and for many records skipped at once, with
+  one and with several record variables, in each classic format and
+  with each I/O layer.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_fill_recs.nc"
+#define BIG_LEN 300000
+#define X_LEN 3
+#define Y_LEN 1000
+#define NREC 200
+#define USER_FILL 42
+
+static int formats[] = {0, NC_64BIT_OFFSET
+#ifdef ENABLE_CDF5
+                        , NC_64BIT_DATA
+#endif
+};
+static int modes[] = {0, NC_SHARE, NC_DISKLESS};
+#define NFORMATS (sizeof(formats)/sizeof(formats[0]))
+#define NMODES (sizeof(modes)/sizeof(modes[0]))
+
+static float fbuf[BIG_LEN];
+static int ibuf[NREC * Y_LEN];
+
+/* A big fixed size float and int var, and record vars of bytes and
+ * of ints with a fill value, or only the bytes if onerec. */
+static int
+test_fill(int cmode, int onerec)
+{
+    int ncid, bigdim, xdim, ydim, recdim, dimids[2];
+    int fvarid, ivarid, bvarid, rvarid = -1;
+    int fill = USER_FILL;
+    signed char bytes[X_LEN] = {1, 2, 3}, bin[NREC * X_LEN];
+    size_t start[2] = {NREC - 1, 0}, count[2] = {1, X_LEN};
+    size_t i;
+
+    if (nc_create(FILE_NAME, NC_CLOBBER|cmode, &ncid)) ERR;
+    if (nc_def_dim(ncid, "big", BIG_LEN, &bigdim)) ERR;
+    if (nc_def_dim(ncid, "x", X_LEN, &xdim)) ERR;
+    if (nc_def_dim(ncid, "y", Y_LEN, &ydim)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &recdim)) ERR;
+    if (nc_def_var(ncid, "f", NC_FLOAT, 1, &bigdim, &fvarid)) ERR;
+    if (nc_def_var(ncid, "i", NC_INT, 1, &bigdim, &ivarid)) ERR;
+    if (nc_put_att_int(ncid, ivarid, _FillValue, NC_INT, 1, &fill)) ERR;
+    dimids[0] = recdim;
+    dimids[1] = xdim;
+    if (nc_def_var(ncid, "b", NC_BYTE, 2, dimids, &bvarid)) ERR;
+    if (!onerec)
+    {
+        dimids[1] = ydim;
+        if (nc_def_var(ncid, "r", NC_INT, 2, dimids, &rvarid)) ERR;
+        if (nc_put_att_int(ncid, rvarid, _FillValue, NC_INT, 1, &fill)) ERR;
+    }
+    if (nc_enddef(ncid)) ERR;
+
+    /* Write the last record only, so the others are filled. */
+    if (nc_put_vara_schar(ncid, bvarid, start, count, bytes)) ERR;
+
+    if (nc_get_var_float(ncid, fvarid, fbuf)) ERR;
+    for (i = 0; i < BIG_LEN; i++)
+        if (fbuf[i] != NC_FILL_FLOAT) ERR;
+    if (nc_get_var_int(ncid, ivarid, (int *)fbuf)) ERR;
+    for (i = 0; i < BIG_LEN; i++)
+        if (((int *)fbuf)[i] != USER_FILL) ERR;
+    if (nc_get_var_schar(ncid, bvarid, bin)) ERR;
+    for (i = 0; i < (NREC - 1) * X_LEN; i++)
+        if (bin[i] != NC_FILL_BYTE) ERR;
+    if (memcmp(&bin[(NREC - 1) * X_LEN], bytes, X_LEN)) ERR;
+    if (!onerec)
+    {
+        if (nc_get_var_int(ncid, rvarid, ibuf)) ERR;
+        for (i = 0; i < NREC * Y_LEN; i++)
+            if (ibuf[i] != USER_FILL) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t f, m;
+
+    printf("\n*** Testing fill values of big variables and skipped records.\n");
+    for (f = 0; f < NFORMATS; f++)
+    {
+        for (m = 0; m < NMODES; m++)
+        {
+            printf("*** testing format 0x%x mode 0x%x, several record vars...",
+                   formats[f], modes[m]);
+            if (test_fill(formats[f]|modes[m], 0)) ERR;
+            SUMMARIZE_ERR;
+            printf("*** testing format 0x%x mode 0x%x, one record var...",
+                   formats[f], modes[m]);
+            if (test_fill(formats[f]|modes[m], 1)) ERR;
+            SUMMARIZE_ERR;
+        }
+    }
+    FINAL_RESULTS;
+}
@@ -0,0 +1,168 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test the room left after the header of classic files: attributes
+  added later fit in it without moving the data, and when they do
+  not, the data is moved intact and room is left again.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_header_room.nc"
+#define BIG_LEN 1500000
+#define Y_LEN 1000
+#define NREC 1100
+#define SMALL_ATT 1000
+#define BIG_ATT 20000
+/* Diskless files flush whole pages of up to a MB */
+#define MAX_WRITE(cmode) ((cmode) & NC_DISKLESS ? 2000000 : 4 * BIG_ATT)
+
+static int formats[] = {0
+#ifdef ENABLE_CDF5
+                        , NC_64BIT_DATA
+#endif
+};
+static int modes[] = {0, NC_SHARE, NC_DISKLESS|NC_PERSIST};
+#define NFORMATS (sizeof(formats)/sizeof(formats[0]))
+#define NMODES (sizeof(modes)/sizeof(modes[0]))
+
+static float fbuf[BIG_LEN];
+static int ibuf[NREC * Y_LEN];
+static char att[BIG_ATT];
+
+/* Check the data of the big fixed size var and the record vars. */
+static int
+check_data(int ncid)
+{
+    int varid;
+    size_t i;
+
+    if (nc_inq_varid(ncid, "f", &varid)) ERR;
+    if (nc_get_var_float(ncid, varid, fbuf)) ERR;
+    for (i = 0; i < BIG_LEN; i++)
+        if (fbuf[i] != (float)i) ERR;
+    if (nc_inq_varid(ncid, "r", &varid)) ERR;
+    if (nc_get_var_int(ncid, varid, ibuf)) ERR;
+    for (i = 0; i < NREC * Y_LEN; i++)
+        if (ibuf[i] != (int)i) ERR;
+    if (nc_inq_varid(ncid, "s", &varid)) ERR;
+    if (nc_get_var_int(ncid, varid, ibuf)) ERR;
+    for (i = 0; i < NREC; i++)
+        if (ibuf[i] != -(int)i) ERR;
+    return 0;
+}
+
+/* Add a global attribute of len bytes, and return the bytes written
+ * to do so. */
+static int
+add_att(int ncid, const char *name, size_t len, unsigned long long *writtenp)
+{
+    nc_perf_stats_t before, after;
+
+    if (nc_inq_perf_stats(ncid, &before)) ERR;
+    if (nc_redef(ncid)) ERR;
+    if (nc_put_att_text(ncid, NC_GLOBAL, name, len, att)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    if (nc_inq_perf_stats(ncid, &after)) ERR;
+    *writtenp = after.io_write_bytes - before.io_write_bytes;
+    return 0;
+}
+
+static int
+test_room(int cmode)
+{
+    int ncid, bigdim, ydim, recdim, dimids[2], fvarid, rvarid, svarid;
+    unsigned long long written;
+    size_t i;
+
+    for (i = 0; i < BIG_LEN; i++)
+        fbuf[i] = (float)i;
+    if (nc_create(FILE_NAME, NC_CLOBBER|cmode, &ncid)) ERR;
+    if (nc_def_dim(ncid, "big", BIG_LEN, &bigdim)) ERR;
+    if (nc_def_dim(ncid, "y", Y_LEN, &ydim)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &recdim)) ERR;
+    if (nc_def_var(ncid, "f", NC_FLOAT, 1, &bigdim, &fvarid)) ERR;
+    dimids[0] = recdim;
+    dimids[1] = ydim;
+    if (nc_def_var(ncid, "r", NC_INT, 2, dimids, &rvarid)) ERR;
+    if (nc_def_var(ncid, "s", NC_INT, 1, dimids, &svarid)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    if (nc_put_var_float(ncid, fvarid, fbuf)) ERR;
+    for (i = 0; i < NREC * Y_LEN; i++)
+        ibuf[i] = (int)i;
+    {
+        size_t start[2] = {0, 0}, count[2] = {NREC, Y_LEN};
+        if (nc_put_vara_int(ncid, rvarid, start, count, ibuf)) ERR;
+        for (i = 0; i < NREC; i++)
+            ibuf[i] = -(int)i;
+        if (nc_put_vara_int(ncid, svarid, start, count, ibuf)) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+
+    if (nc_open(FILE_NAME, NC_WRITE|cmode, &ncid)) ERR;
+    /* A small attribute fits after the header. */
+    if (add_att(ncid, "small", SMALL_ATT, &written)) ERR;
+    if (written > MAX_WRITE(cmode)) ERR;
+    if (check_data(ncid)) ERR;
+
+    /* A big one moves the data, intact, */
+    if (add_att(ncid, "big", BIG_ATT, &written)) ERR;
+    if (!(cmode & NC_DISKLESS) && written < BIG_LEN * sizeof(float)) ERR;
+    if (check_data(ncid)) ERR;
+
+    /* and leaves room for another. */
+    if (add_att(ncid, "small2", SMALL_ATT, &written)) ERR;
+    if (written > MAX_WRITE(cmode)) ERR;
+    if (check_data(ncid)) ERR;
+    if (nc_close(ncid)) ERR;
+
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+    if (check_data(ncid)) ERR;
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t f, m;
+
+    memset(att, 'x', sizeof(att));
+    printf("\n*** Testing the room after the header of classic files.\n");
+    for (f = 0; f < NFORMATS; f++)
+    {
+        for (m = 0; m < NMODES; m++)
+        {
+            printf("*** testing format 0x%x mode 0x%x...", formats[f], modes[m]);
+            if (test_room(formats[f]|modes[m])) ERR;
+            SUMMARIZE_ERR;
+        }
+    }
+    printf("*** testing that small files get no room...");
+    {
+        int ncid, dimid, varid;
+        FILE *fp;
+        long size;
+
+        if (nc_create(FILE_NAME, NC_CLOBBER, &ncid)) ERR;
+        if (nc_def_dim(ncid, "x", Y_LEN, &dimid)) ERR;
+        if (nc_def_var(ncid, "v", NC_INT, 1, &dimid, &varid)) ERR;
+        if (nc_close(ncid)) ERR;
+        if (!(fp = fopen(FILE_NAME, "rb"))) ERR;
+        if (fseek(fp, 0, SEEK_END)) ERR;
+        size = ftell(fp);
+        fclose(fp);
+        if (size >= Y_LEN * 4 + 4096) ERR;
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
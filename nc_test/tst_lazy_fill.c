@@ -0,0 +1,239 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test the NC_LAZYFILL fill mode: unwritten data reads as fill values
+  while the file is open, and has them on disk after sync, redef and
+  close, but data written in the meantime is kept.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_lazy_fill.nc"
+#define BIG_LEN 100000
+#define X_LEN 3
+#define Y_LEN 1000
+#define NREC 50
+#define USER_FILL 42
+#define START 1000
+#define COUNT 5000
+
+static int formats[] = {0, NC_64BIT_OFFSET
+#ifdef ENABLE_CDF5
+                        , NC_64BIT_DATA
+#endif
+};
+static int modes[] = {0, NC_SHARE, NC_DISKLESS|NC_PERSIST};
+#define NFORMATS (sizeof(formats)/sizeof(formats[0]))
+#define NMODES (sizeof(modes)/sizeof(modes[0]))
+
+static float fbuf[BIG_LEN];
+static int ibuf[(NREC + 20) * Y_LEN];
+
+/* Check the data written by test_lazy(), and the fixed size var
+ * "g" added later if there is one. */
+static int
+check_file(int ncid, int onerec, size_t nrec)
+{
+    int varid;
+    signed char bytes[X_LEN] = {1, 2, 3};
+    static signed char bin[(NREC + 20) * X_LEN];
+    size_t i;
+
+    if (nc_inq_varid(ncid, "f", &varid)) ERR;
+    if (nc_get_var_float(ncid, varid, fbuf)) ERR;
+    for (i = 0; i < BIG_LEN; i++)
+        if (fbuf[i] != (i >= START && i < START + COUNT ? (float)i : NC_FILL_FLOAT)) ERR;
+    if (nc_inq_varid(ncid, "i", &varid)) ERR;
+    if (nc_get_var_int(ncid, varid, (int *)fbuf)) ERR;
+    for (i = 0; i < BIG_LEN; i++)
+        if (((int *)fbuf)[i] != USER_FILL) ERR;
+
+    if (nc_inq_varid(ncid, "b", &varid)) ERR;
+    if (nc_get_var_schar(ncid, varid, bin)) ERR;
+    for (i = 0; i < nrec * X_LEN; i++)
+    {
+        if (i / X_LEN == NREC - 1)
+        {
+            if (bin[i] != bytes[i % X_LEN]) ERR;
+        }
+        else if (bin[i] != NC_FILL_BYTE) ERR;
+    }
+    if (!onerec)
+    {
+        if (nc_inq_varid(ncid, "r", &varid)) ERR;
+        if (nc_get_var_int(ncid, varid, ibuf)) ERR;
+        for (i = 0; i < NREC * Y_LEN; i++)
+            if (ibuf[i] != (i >= 5 * Y_LEN && i < 5 * Y_LEN + Y_LEN / 2 ? (int)i : USER_FILL)) ERR;
+    }
+    if (nc_inq_varid(ncid, "g", &varid) == NC_NOERR)
+    {
+        if (nc_get_var_int(ncid, varid, (int *)fbuf)) ERR;
+        for (i = 0; i < X_LEN; i++)
+            if (((int *)fbuf)[i] != (i == 1 ? -1 : NC_FILL_INT)) ERR;
+    }
+    return 0;
+}
+
+/* A big fixed size float and int var, and record vars of bytes and
+ * of ints with a fill value, or only the bytes if onerec, written in
+ * part in NC_LAZYFILL mode. */
+static int
+test_lazy(int cmode, int onerec)
+{
+    int ncid, bigdim, xdim, ydim, recdim, dimids[2];
+    int fvarid, ivarid, bvarid, rvarid = -1, gvarid;
+    int fill = USER_FILL, old_mode, minus = -1;
+    signed char bytes[X_LEN] = {1, 2, 3};
+    size_t start[2] = {NREC - 1, 0}, count[2] = {1, X_LEN};
+    size_t i, one = 1;
+
+    if (nc_create(FILE_NAME, NC_CLOBBER|cmode, &ncid)) ERR;
+    if (nc_set_fill(ncid, NC_LAZYFILL, &old_mode)) ERR;
+    if (old_mode != NC_FILL) ERR;
+    if (nc_def_dim(ncid, "big", BIG_LEN, &bigdim)) ERR;
+    if (nc_def_dim(ncid, "x", X_LEN, &xdim)) ERR;
+    if (nc_def_dim(ncid, "y", Y_LEN, &ydim)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &recdim)) ERR;
+    if (nc_def_var(ncid, "f", NC_FLOAT, 1, &bigdim, &fvarid)) ERR;
+    if (nc_def_var(ncid, "i", NC_INT, 1, &bigdim, &ivarid)) ERR;
+    if (nc_put_att_int(ncid, ivarid, _FillValue, NC_INT, 1, &fill)) ERR;
+    dimids[0] = recdim;
+    dimids[1] = xdim;
+    if (nc_def_var(ncid, "b", NC_BYTE, 2, dimids, &bvarid)) ERR;
+    if (!onerec)
+    {
+        dimids[1] = ydim;
+        if (nc_def_var(ncid, "r", NC_INT, 2, dimids, &rvarid)) ERR;
+        if (nc_put_att_int(ncid, rvarid, _FillValue, NC_INT, 1, &fill)) ERR;
+    }
+    if (nc_enddef(ncid)) ERR;
+
+    /* Write part of f, the last record of b, half a record of r. */
+    for (i = 0; i < BIG_LEN; i++)
+        fbuf[i] = (float)i;
+    start[0] = START;
+    count[0] = COUNT;
+    if (nc_put_vara_float(ncid, fvarid, start, count, &fbuf[START])) ERR;
+    start[0] = NREC - 1;
+    count[0] = 1;
+    if (nc_put_vara_schar(ncid, bvarid, start, count, bytes)) ERR;
+    if (!onerec)
+    {
+        for (i = 0; i < NREC * Y_LEN; i++)
+            ibuf[i] = (int)i;
+        start[0] = 5;
+        count[1] = Y_LEN / 2;
+        if (nc_put_vara_int(ncid, rvarid, start, count, &ibuf[5 * Y_LEN])) ERR;
+    }
+
+    /* Fill values read back before they are written. */
+    if (check_file(ncid, onerec, NREC)) ERR;
+    if (nc_set_fill(ncid, NC_LAZYFILL, &old_mode)) ERR;
+    if (old_mode != NC_LAZYFILL) ERR;
+    if (nc_sync(ncid)) ERR;
+    if (check_file(ncid, onerec, NREC)) ERR;
+
+    /* Add a fixed size var, and write one value of it. */
+    if (nc_redef(ncid)) ERR;
+    if (nc_def_var(ncid, "g", NC_INT, 1, &xdim, &gvarid)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    if (nc_put_var1_int(ncid, gvarid, &one, &minus)) ERR;
+    if (check_file(ncid, onerec, NREC)) ERR;
+    if (nc_close(ncid)) ERR;
+
+    /* The fill values are on disk. */
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+    if (check_file(ncid, onerec, NREC)) ERR;
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+/* Leave NC_LAZYFILL mode with records yet to be filled. */
+static int
+test_switch(int onerec)
+{
+    int ncid, varid, old_mode;
+    signed char bytes[X_LEN] = {4, 5, 6};
+    size_t start[2] = {NREC + 19, 0}, count[2] = {1, X_LEN};
+
+    if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+    if (nc_set_fill(ncid, NC_LAZYFILL, &old_mode)) ERR;
+    if (old_mode != NC_FILL) ERR;
+    if (nc_inq_varid(ncid, "b", &varid)) ERR;
+    if (nc_put_vara_schar(ncid, varid, start, count, bytes)) ERR;
+    if (nc_set_fill(ncid, NC_NOFILL, &old_mode)) ERR;
+    if (old_mode != NC_LAZYFILL) ERR;
+    if (nc_set_fill(ncid, 0x400, NULL) != NC_EINVAL) ERR;
+    if (nc_close(ncid)) ERR;
+
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+    if (check_file(ncid, onerec, NREC)) ERR;
+    {
+        static signed char bin[(NREC + 20) * X_LEN];
+        size_t i;
+
+        if (nc_get_var_schar(ncid, varid, bin)) ERR;
+        for (i = NREC * X_LEN; i < (NREC + 19) * X_LEN; i++)
+            if (bin[i] != NC_FILL_BYTE) ERR;
+        if (memcmp(&bin[(NREC + 19) * X_LEN], bytes, X_LEN)) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t f, m;
+
+    printf("\n*** Testing NC_LAZYFILL mode.\n");
+    for (f = 0; f < NFORMATS; f++)
+    {
+        for (m = 0; m < NMODES; m++)
+        {
+            printf("*** testing format 0x%x mode 0x%x, several record vars...",
+                   formats[f], modes[m]);
+            if (test_lazy(formats[f]|modes[m], 0)) ERR;
+            if (test_switch(0)) ERR;
+            SUMMARIZE_ERR;
+            printf("*** testing format 0x%x mode 0x%x, one record var...",
+                   formats[f], modes[m]);
+            if (test_lazy(formats[f]|modes[m], 1)) ERR;
+            if (test_switch(1)) ERR;
+            SUMMARIZE_ERR;
+        }
+    }
+#ifdef USE_HDF5
+    printf("*** testing NC_LAZYFILL mode of netCDF-4 files...");
+    {
+        int ncid, dimid, varid, old_mode;
+        int data[X_LEN];
+        size_t i;
+
+        if (nc_create(FILE_NAME, NC_CLOBBER|NC_NETCDF4, &ncid)) ERR;
+        if (nc_set_fill(ncid, NC_LAZYFILL, &old_mode)) ERR;
+        if (old_mode != NC_FILL) ERR;
+        if (nc_def_dim(ncid, "x", X_LEN, &dimid)) ERR;
+        if (nc_def_var(ncid, "v", NC_INT, 1, &dimid, &varid)) ERR;
+        if (nc_set_fill(ncid, NC_FILL, &old_mode)) ERR;
+        if (old_mode != NC_LAZYFILL) ERR;
+        if (nc_close(ncid)) ERR;
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (nc_get_var_int(ncid, varid, data)) ERR;
+        for (i = 0; i < X_LEN; i++)
+            if (data[i] != NC_FILL_INT) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+#endif
+    FINAL_RESULTS;
+}
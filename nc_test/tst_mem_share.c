@@ -0,0 +1,177 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test shared in-memory images: nc_mem_register() and
+  nc_mem_unregister(), and many opens of one image at once.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+#include <netcdf_mem.h>
+
+#define FILE_NAME "tst_mem_share.nc"
+#define IMAGE "tst_mem_share_image"
+#define NREC 3
+#define NX 100
+#define NOPEN 20
+#define TITLE "shared image"
+
+/* Create a file with a record variable and a fixed size one. */
+static int
+create_file(int cmode)
+{
+    int ncid, dimids[2], rvarid, fvarid;
+    int data[NREC * NX];
+    size_t start[2] = {0, 0}, count[2] = {NREC, NX};
+    int i;
+
+    for (i = 0; i < NREC * NX; i++)
+        data[i] = i;
+    if (nc_create(FILE_NAME, NC_CLOBBER|cmode, &ncid)) ERR;
+    if (nc_put_att_text(ncid, NC_GLOBAL, "title", strlen(TITLE), TITLE)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimids[0])) ERR;
+    if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+    if (nc_def_var(ncid, "r", NC_INT, 2, dimids, &rvarid)) ERR;
+    if (nc_def_var(ncid, "f", NC_INT, 1, &dimids[1], &fvarid)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    if (nc_put_vara_int(ncid, rvarid, start, count, data)) ERR;
+    if (nc_put_var_int(ncid, fvarid, data)) ERR;
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+/* Read the file into malloc'd memory. */
+static int
+read_file(void **memoryp, size_t *sizep)
+{
+    FILE *fp;
+    long size;
+
+    if (!(fp = fopen(FILE_NAME, "rb"))) ERR;
+    if (fseek(fp, 0, SEEK_END)) ERR;
+    if ((size = ftell(fp)) <= 0) ERR;
+    rewind(fp);
+    if (!(*memoryp = malloc((size_t)size))) ERR;
+    if (fread(*memoryp, 1, (size_t)size, fp) != (size_t)size) ERR;
+    fclose(fp);
+    *sizep = (size_t)size;
+    return 0;
+}
+
+/* Check the contents of an open of the image. */
+static int
+check_file(int ncid)
+{
+    int varid, ndims, nvars, unlimdimid;
+    int data[NREC * NX];
+    char title[sizeof(TITLE)];
+    size_t len;
+    int i;
+
+    if (nc_inq(ncid, &ndims, &nvars, NULL, &unlimdimid)) ERR;
+    if (ndims != 2 || nvars != 2 || unlimdimid != 0) ERR;
+    if (nc_inq_dimlen(ncid, unlimdimid, &len)) ERR;
+    if (len != NREC) ERR;
+    if (nc_inq_attlen(ncid, NC_GLOBAL, "title", &len)) ERR;
+    if (len != strlen(TITLE)) ERR;
+    if (nc_get_att_text(ncid, NC_GLOBAL, "title", title)) ERR;
+    if (strncmp(title, TITLE, len)) ERR;
+    if (nc_inq_varid(ncid, "r", &varid)) ERR;
+    if (nc_get_var_int(ncid, varid, data)) ERR;
+    for (i = 0; i < NREC * NX; i++)
+        if (data[i] != i) ERR;
+    if (nc_inq_varid(ncid, "f", &varid)) ERR;
+    if (nc_get_var_int(ncid, varid, data)) ERR;
+    for (i = 0; i < NX; i++)
+        if (data[i] != i) ERR;
+    return 0;
+}
+
+static int
+test_share(int cmode)
+{
+    int ncids[NOPEN], ncid, i;
+    void *memory;
+    size_t size;
+
+    if (create_file(cmode)) ERR;
+    if (read_file(&memory, &size)) ERR;
+
+    /* The library takes the memory over. */
+    if (nc_mem_register(IMAGE, size, memory, 0)) ERR;
+    if (nc_mem_register(IMAGE, size, memory, 0) != NC_ENAMEINUSE) ERR;
+
+    /* Open it many times at once, by both calls. */
+    for (i = 0; i < NOPEN; i++)
+    {
+        if (i % 2)
+        {
+            if (nc_open(IMAGE, NC_NOWRITE|NC_INMEMORY, &ncids[i])) ERR;
+        }
+        else if (nc_open_mem(IMAGE, NC_NOWRITE, 0, NULL, &ncids[i])) ERR;
+    }
+    for (i = 0; i < NOPEN; i++)
+        if (check_file(ncids[i])) ERR;
+    if (nc_open_mem(IMAGE, NC_WRITE, 0, NULL, &ncid) != NC_EPERM) ERR;
+    if (nc_redef(ncids[0]) != NC_EPERM) ERR;
+
+    /* Close some, unregister, and the rest still work. */
+    for (i = 0; i < NOPEN / 2; i++)
+        if (nc_close(ncids[i])) ERR;
+    if (nc_mem_unregister(IMAGE)) ERR;
+    if (nc_mem_unregister(IMAGE) != NC_ENOTFOUND) ERR;
+    if (nc_open_mem(IMAGE, NC_NOWRITE, 0, NULL, &ncid) != NC_ENOTFOUND) ERR;
+    for (i = NOPEN / 2; i < NOPEN; i++)
+    {
+        if (check_file(ncids[i])) ERR;
+        if (nc_close(ncids[i])) ERR;
+    }
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing shared in-memory images.\n");
+    printf("*** testing classic images...");
+    if (test_share(0)) ERR;
+    if (test_share(NC_64BIT_OFFSET)) ERR;
+    SUMMARIZE_ERR;
+#ifdef USE_HDF5
+    printf("*** testing netCDF-4 images...");
+    if (test_share(NC_NETCDF4|NC_CLASSIC_MODEL)) ERR;
+    SUMMARIZE_ERR;
+#endif
+    printf("*** testing images kept by the caller...");
+    {
+        int ncid, ncid2;
+        void *memory;
+        size_t size;
+
+        if (create_file(0)) ERR;
+        if (read_file(&memory, &size)) ERR;
+        if (nc_mem_register(NULL, size, memory, 0) != NC_EINVAL) ERR;
+        if (nc_mem_register(IMAGE, 0, memory, 0) != NC_EINVAL) ERR;
+        if (nc_mem_register(IMAGE, size, memory, 0x100) != NC_EINVAL) ERR;
+        if (nc_mem_register(IMAGE, size, memory, NC_MEMIO_LOCKED)) ERR;
+        if (nc_open_mem(IMAGE, NC_NOWRITE, 0, NULL, &ncid)) ERR;
+        if (nc_open_mem(IMAGE, NC_NOWRITE, 0, NULL, &ncid2)) ERR;
+        if (nc_mem_unregister(IMAGE)) ERR;
+        if (nc_close(ncid)) ERR;
+        if (check_file(ncid2)) ERR;
+        if (nc_close(ncid2)) ERR;
+        /* Still ours. */
+        if (memcmp(memory, "CDF", 3)) ERR;
+        free(memory);
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
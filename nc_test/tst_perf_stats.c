@@ -0,0 +1,117 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test nc_inq_perf_stats(): the I/O counters of classic files on
+  disk and in memory, and of netCDF-4 files.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_perf_stats.nc"
+#define NREC 10
+#define NX 1000
+
+/* Create a file with a float record variable. */
+static int
+create_file(int mode)
+{
+    int ncid, dimids[2], varid;
+    float data[NX];
+    size_t start[2] = {0, 0}, count[2] = {1, NX};
+    nc_perf_stats_t stats;
+    int i;
+
+    for (i = 0; i < NX; i++)
+        data[i] = (float)i;
+    if (nc_create(FILE_NAME, NC_CLOBBER|mode, &ncid)) ERR;
+    if (nc_def_dim(ncid, "rec", NC_UNLIMITED, &dimids[0])) ERR;
+    if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+    if (nc_def_var(ncid, "f", NC_FLOAT, 2, dimids, &varid)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    for (start[0] = 0; start[0] < NREC; start[0]++)
+        if (nc_put_vara_float(ncid, varid, start, count, data)) ERR;
+    if (nc_inq_perf_stats(ncid, &stats)) ERR;
+    if (!stats.backend) ERR;
+    if (!(mode & NC_NETCDF4) && stats.conversions < NREC) ERR;
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, varid;
+    static double data[NREC * NX];
+    size_t start[2] = {0, 0}, count[2] = {NREC, NX};
+    nc_perf_stats_t stats;
+
+    printf("\n*** Testing nc_inq_perf_stats.\n");
+    printf("*** testing classic file counters...");
+    {
+        if (create_file(0)) ERR;
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_perf_stats(ncid, &stats)) ERR;
+        if (strcmp(stats.backend, "posixio")) ERR;
+        /* The header has been read. */
+        if (!stats.io_reads || !stats.io_read_bytes) ERR;
+        if (stats.io_writes || stats.io_write_bytes) ERR;
+        if (stats.h5_reads || stats.mdc_hit_rate != -1) ERR;
+
+        if (nc_inq_varid(ncid, "f", &varid)) ERR;
+        if (nc_get_vara_double(ncid, varid, start, count, data)) ERR;
+        if (data[NREC * NX - 1] != NX - 1) ERR;
+        if (nc_inq_perf_stats(ncid, &stats)) ERR;
+        /* f is the only record variable, so its records are
+         * contiguous and are read together. */
+        if (!stats.io_gets) ERR;
+        if (stats.io_get_bytes < NREC * NX * sizeof(float)) ERR;
+        if (stats.io_read_bytes < NREC * NX * sizeof(float)) ERR;
+        if (!stats.conversions) ERR;
+        if (stats.convert_bytes != NREC * NX * sizeof(double)) ERR;
+        if (stats.http_requests) ERR;
+        if (nc_inq_perf_stats(ncid, NULL) != NC_EINVAL) ERR;
+        if (nc_close(ncid)) ERR;
+        if (nc_inq_perf_stats(ncid, &stats) != NC_EBADID) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing in-memory file counters...");
+    {
+        if (nc_open(FILE_NAME, NC_NOWRITE|NC_DISKLESS, &ncid)) ERR;
+        if (nc_inq_varid(ncid, "f", &varid)) ERR;
+        if (nc_get_vara_double(ncid, varid, start, count, data)) ERR;
+        if (nc_inq_perf_stats(ncid, &stats)) ERR;
+        if (strcmp(stats.backend, "memio")) ERR;
+        if (!stats.io_gets || stats.io_reads || stats.io_read_bytes) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+#ifdef USE_HDF5
+    printf("*** testing netCDF-4 file counters...");
+    {
+        if (create_file(NC_NETCDF4)) ERR;
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_varid(ncid, "f", &varid)) ERR;
+        if (nc_get_vara_double(ncid, varid, start, count, data)) ERR;
+        if (data[NREC * NX - 1] != NX - 1) ERR;
+        if (nc_inq_perf_stats(ncid, &stats)) ERR;
+        if (strcmp(stats.backend, "hdf5")) ERR;
+        if (stats.h5_reads != 1) ERR;
+        if (stats.h5_read_bytes != NREC * NX * sizeof(float)) ERR;
+        if (stats.conversions != 1) ERR;
+        if (stats.mdc_hit_rate < 0 || stats.mdc_hit_rate > 1) ERR;
+        if (stats.io_gets || stats.io_reads) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+#endif
+    FINAL_RESULTS;
+}
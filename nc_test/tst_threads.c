@@ -0,0 +1,179 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Stress test for the thread-safe build (ENABLE_THREADSAFE). Several
+  threads each create, write, reopen and read their own classic file,
+  then all threads read one shared ncid at the same time, both with
+  an ordinary read-only open and with NC_CONCURRENT. With
+  netCDF-4, the threads also work on their own netCDF-4 files, which
+  are serialized on the global lock.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <netcdf.h>
+
+#define NTHREADS 8
+#define NLOOPS 20
+#define NROWS 64
+#define NCOLS 256
+
+/* Data value of element (row,col) written by thread t */
+#define VALUE(t,r,c) ((t)*100000 + (r)*NCOLS + (c))
+
+typedef struct Work {
+    int thread;
+    int format; /* cmode flags for nc_create */
+    int ncid; /* shared ncid, for read_shared */
+    int status;
+} Work;
+
+static int
+write_and_read(int thread, int format)
+{
+    char file_name[NC_MAX_NAME + 1];
+    int ncid, dimids[2], varid, loop, r, c;
+    int data[NCOLS];
+    size_t start[2] = {0, 0}, count[2] = {1, NCOLS};
+
+    snprintf(file_name, sizeof(file_name), "tst_threads_%d_%s.nc", thread,
+             (format & NC_NETCDF4) ? "nc4" : "nc3");
+    for (loop = 0; loop < NLOOPS; loop++)
+    {
+        if (nc_create(file_name, NC_CLOBBER|format, &ncid)) ERR;
+        if (nc_def_dim(ncid, "rows", NC_UNLIMITED, &dimids[0])) ERR;
+        if (nc_def_dim(ncid, "cols", NCOLS, &dimids[1])) ERR;
+        if (nc_def_var(ncid, "data", NC_INT, 2, dimids, &varid)) ERR;
+        if (nc_put_att_int(ncid, varid, "thread", NC_INT, 1, &thread)) ERR;
+        if (nc_enddef(ncid)) ERR;
+        for (r = 0; r < NROWS; r++)
+        {
+            for (c = 0; c < NCOLS; c++)
+                data[c] = VALUE(thread, r, c);
+            start[0] = r;
+            if (nc_put_vara_int(ncid, varid, start, count, data)) ERR;
+        }
+        if (nc_close(ncid)) ERR;
+
+        if (nc_open(file_name, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_varid(ncid, "data", &varid)) ERR;
+        if (nc_get_att_int(ncid, varid, "thread", &c)) ERR;
+        if (c != thread) ERR;
+        for (r = 0; r < NROWS; r++)
+        {
+            start[0] = r;
+            if (nc_get_vara_int(ncid, varid, start, count, data)) ERR;
+            for (c = 0; c < NCOLS; c++)
+                if (data[c] != VALUE(thread, r, c)) ERR;
+        }
+        if (nc_close(ncid)) ERR;
+    }
+    return 0;
+}
+
+static int
+read_shared(int ncid)
+{
+    int varid, loop, r, c;
+    int data[NCOLS];
+    size_t start[2] = {0, 0}, count[2] = {1, NCOLS};
+
+    if (nc_inq_varid(ncid, "data", &varid)) ERR;
+    for (loop = 0; loop < NLOOPS; loop++)
+        for (r = 0; r < NROWS; r++)
+        {
+            start[0] = r;
+            if (nc_get_vara_int(ncid, varid, start, count, data)) ERR;
+            for (c = 0; c < NCOLS; c++)
+                if (data[c] != VALUE(0, r, c)) ERR;
+        }
+    return 0;
+}
+
+static void*
+run_write_and_read(void* arg)
+{
+    Work* work = (Work*)arg;
+    work->status = write_and_read(work->thread, work->format);
+    return NULL;
+}
+
+static void*
+run_read_shared(void* arg)
+{
+    Work* work = (Work*)arg;
+    work->status = read_shared(work->ncid);
+    return NULL;
+}
+
+/* Run fcn on NTHREADS threads and return the number that failed */
+static int
+run_threads(void* (*fcn)(void*), int format, int ncid)
+{
+    pthread_t threads[NTHREADS];
+    Work work[NTHREADS];
+    int t, failed = 0;
+
+    for (t = 0; t < NTHREADS; t++)
+    {
+        work[t].thread = t;
+        work[t].format = format;
+        work[t].ncid = ncid;
+        work[t].status = -1;
+        if (pthread_create(&threads[t], NULL, fcn, &work[t])) return NTHREADS;
+    }
+    for (t = 0; t < NTHREADS; t++)
+    {
+        if (pthread_join(threads[t], NULL)) failed++;
+        else if (work[t].status) failed++;
+    }
+    return failed;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing thread-safe netCDF API.\n");
+    printf("*** testing concurrent use of separate classic files...");
+    {
+        if (run_threads(run_write_and_read, 0, -1)) ERR;
+        if (run_threads(run_write_and_read, NC_64BIT_OFFSET, -1)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing concurrent reads of one shared ncid...");
+    {
+        int ncid;
+
+        if (write_and_read(0, 0)) ERR;
+        if (nc_open("tst_threads_0_nc3.nc", NC_NOWRITE, &ncid)) ERR;
+        if (run_threads(run_read_shared, 0, ncid)) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+#ifdef HAVE_PREAD
+    printf("*** testing concurrent reads of one NC_CONCURRENT ncid...");
+    {
+        int ncid;
+
+        if (nc_open("tst_threads_0_nc3.nc", NC_CONCURRENT, &ncid)) ERR;
+        if (run_threads(run_read_shared, 0, ncid)) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+#endif
+#ifdef USE_NETCDF4
+    printf("*** testing concurrent use of separate netCDF-4 files...");
+    {
+        if (run_threads(run_write_and_read, NC_NETCDF4, -1)) ERR;
+    }
+    SUMMARIZE_ERR;
+#endif
+    FINAL_RESULTS;
+}
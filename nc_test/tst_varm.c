@@ -0,0 +1,123 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  This is part of netCDF.
+
+  Test mapped (varm) reads and writes of classic files: Fortran order
+  transposes, strided maps and maps with gaps, including selections
+  big enough to be moved in several staging blocks.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_varm.nc"
+#define NT 20
+#define NY 200
+#define NX 300
+
+/* Value stored at (t,y,x) */
+#define VAL(t,y,x) ((int)(((t) * NY + (y)) * NX + (x)))
+
+static int
+check_format(int format)
+{
+    int ncid, dimids[3], varid, dvarid;
+    size_t n = (size_t)NT * NY * NX, i;
+    size_t start[3] = {0, 0, 0}, count[3] = {NT, NY, NX};
+    ptrdiff_t stride[3] = {1, 1, 1};
+    ptrdiff_t fmap[3] = {1, NT, NT * NY}; /* Fortran order */
+    int *data, t, y, x;
+    double *ddata;
+
+    if (!(data = malloc(n * sizeof(int)))) ERR;
+    if (!(ddata = malloc(n * sizeof(double)))) ERR;
+
+    /* Write the whole variable in Fortran order. */
+    for (t = 0; t < NT; t++)
+        for (y = 0; y < NY; y++)
+            for (x = 0; x < NX; x++)
+                data[t + NT * (y + NY * x)] = VAL(t, y, x);
+    if (nc_create(FILE_NAME, NC_CLOBBER|format, &ncid)) ERR;
+    if (nc_def_dim(ncid, "t", NC_UNLIMITED, &dimids[0])) ERR;
+    if (nc_def_dim(ncid, "y", NY, &dimids[1])) ERR;
+    if (nc_def_dim(ncid, "x", NX, &dimids[2])) ERR;
+    if (nc_def_var(ncid, "v", NC_INT, 3, dimids, &varid)) ERR;
+    if (nc_def_var(ncid, "d", NC_DOUBLE, 3, dimids, &dvarid)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    if (nc_put_varm_int(ncid, varid, start, count, stride, fmap, data)) ERR;
+    if (nc_put_varm_int(ncid, dvarid, start, count, stride, fmap, data)) ERR;
+    if (nc_close(ncid)) ERR;
+
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+
+    /* The file is in C order. */
+    if (nc_get_vara_int(ncid, varid, start, count, data)) ERR;
+    for (i = 0; i < n; i++)
+        if (data[i] != (int)i) ERR;
+
+    /* Read it back in Fortran order, converting to double. */
+    if (nc_get_varm_double(ncid, varid, start, count, stride, fmap, ddata)) ERR;
+    for (t = 0; t < NT; t++)
+        for (y = 0; y < NY; y++)
+            for (x = 0; x < NX; x++)
+                if (ddata[t + NT * (y + NY * x)] != VAL(t, y, x)) ERR;
+
+    /* A strided, swapped y/x read into a buffer with gaps. */
+    {
+        size_t st[3] = {3, 5, 1}, ct[3] = {5, 40, 70};
+        ptrdiff_t sd[3] = {3, 4, 4};
+        ptrdiff_t map[3] = {1, 5 * 71, 5}; /* x has room for 71 */
+        size_t len = 5 * 71 * 40;
+        int tt, yy, xx;
+        for (i = 0; i < len; i++)
+            data[i] = -1;
+        if (nc_get_varm_int(ncid, dvarid, st, ct, sd, map, data)) ERR;
+        for (tt = 0; tt < 5; tt++)
+            for (yy = 0; yy < 40; yy++)
+                for (xx = 0; xx < 70; xx++)
+                    if (data[tt + 5 * xx + 5 * 71 * yy] !=
+                        VAL(3 + 3 * tt, 5 + 4 * yy, 1 + 4 * xx)) ERR;
+        /* and the gaps are untouched */
+        for (tt = 0; tt < 5; tt++)
+            for (yy = 0; yy < 40; yy++)
+                if (data[tt + 5 * 70 + 5 * 71 * yy] != -1) ERR;
+    }
+
+    /* A map that is just the packed layout behaves like vars. */
+    {
+        size_t st[3] = {1, 0, 0}, ct[3] = {2, NY, NX};
+        ptrdiff_t sd[3] = {2, 1, 1};
+        ptrdiff_t map[3] = {NY * NX, NX, 1};
+        if (nc_get_varm_int(ncid, varid, st, ct, sd, map, data)) ERR;
+        for (i = 0; i < 2 * NY * NX; i++)
+            if (data[i] != (int)(i + (i >= NY * NX ? 2 : 1) * NY * NX)) ERR;
+    }
+    if (nc_close(ncid)) ERR;
+    free(data);
+    free(ddata);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing mapped array access.\n");
+    printf("*** testing classic file...");
+    if (check_format(0)) ERR;
+    SUMMARIZE_ERR;
+    printf("*** testing 64-bit offset file...");
+    if (check_format(NC_64BIT_OFFSET)) ERR;
+    SUMMARIZE_ERR;
+#ifdef USE_NETCDF4
+    printf("*** testing netCDF-4 file...");
+    if (check_format(NC_NETCDF4)) ERR;
+    SUMMARIZE_ERR;
+#endif
+    FINAL_RESULTS;
+}
@@ -0,0 +1,170 @@
+/* This is part of the netCDF package.
+   Copyright 2019 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test raw chunk access with nc_get_var_chunk_raw() and
+   nc_put_var_chunk_raw(): chunks moved between two compressed
+   variables read back as the original data.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf_filter.h"
+#include <hdf5.h>
+
+/* HDF5 has had direct chunk I/O since 1.10.3; only older versions may
+ * leave raw chunk access not built. */
+#if H5_VERSION_GE(1,10,3)
+#define SKIP_NOTBUILT(ret) 0
+#else
+#define SKIP_NOTBUILT(ret) ((ret) == NC_ENOTBUILT)
+#endif
+
+#define FILE_NAME "tst_chunks_raw.nc"
+#define FILE_NAME2 "tst_chunks_raw2.nc"
+#define NDIMS 2
+#define NT 10
+#define NX 12
+#define CT 4
+#define CX 6
+
+/* Create a file with a deflated, shuffled record variable. */
+static int
+create(const char *name, int *ncidp, int *varidp)
+{
+   int dimids[NDIMS];
+   size_t chunks[NDIMS] = {CT, CX};
+
+   if (nc_create(name, NC_CLOBBER|NC_NETCDF4, ncidp)) ERR;
+   if (nc_def_dim(*ncidp, "t", NC_UNLIMITED, &dimids[0])) ERR;
+   if (nc_def_dim(*ncidp, "x", NX, &dimids[1])) ERR;
+   if (nc_def_var(*ncidp, "v", NC_INT, NDIMS, dimids, varidp)) ERR;
+   if (nc_def_var_chunking(*ncidp, *varidp, NC_CHUNKED, chunks)) ERR;
+   if (nc_def_var_deflate(*ncidp, *varidp, 1, 1, 5)) ERR;
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing raw chunk access.\n");
+   printf("**** testing copying compressed chunks...");
+   {
+      int ncid, ncid2, varid, varid2, ret;
+      int data[NT][NX], back[NT][NX];
+      size_t start[NDIMS] = {0, 0}, count[NDIMS] = {NT, NX};
+      size_t offsets[NDIMS] = {0, 0}, last[NDIMS] = {NT - 1, NX - 1};
+      size_t size = 0, bufsize = 0, nchunks = 0;
+      unsigned int mask;
+      void *buf = NULL;
+      int t, x;
+
+      for (t = 0; t < NT; t++)
+         for (x = 0; x < NX; x++)
+            data[t][x] = t * 1000 + x;
+
+      if (create(FILE_NAME, &ncid, &varid)) ERR;
+
+      /* Not allowed in define mode. */
+      ret = nc_get_var_chunk_raw(ncid, varid, offsets, &mask, &size, NULL);
+      if (ret != NC_EINDEFINE && !SKIP_NOTBUILT(ret)) ERR;
+      if (nc_enddef(ncid)) ERR;
+      if (nc_put_vara_int(ncid, varid, start, count, &data[0][0])) ERR;
+      if (nc_close(ncid)) ERR;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      ret = nc_get_var_chunk_raw(ncid, varid, offsets, &mask, &size, NULL);
+      if (SKIP_NOTBUILT(ret)) {
+         /* HDF5 is too old for direct chunk access. */
+         if (nc_close(ncid)) ERR;
+         printf("skipped...");
+      } else {
+         if (ret) ERR;
+         /* Compressed smaller than a whole chunk of ints. */
+         if (size == 0 || size >= CT * CX * sizeof(int)) ERR;
+
+         /* Offsets must be on chunk boundaries. */
+         offsets[1] = 1;
+         if (nc_get_var_chunk_raw(ncid, varid, offsets, &mask, &size, NULL) != NC_EINVAL) ERR;
+         offsets[1] = 0;
+
+         /* A buffer that is too small is refused. */
+         {
+            char small[1];
+            size = 1;
+            if (nc_get_var_chunk_raw(ncid, varid, offsets, &mask, &size, small) != NC_EINVAL) ERR;
+         }
+
+         if (create(FILE_NAME2, &ncid2, &varid2)) ERR;
+         if (nc_enddef(ncid2)) ERR;
+         /* Extend the record variable by writing its last value. */
+         if (nc_put_var1_int(ncid2, varid2, last, &data[NT - 1][NX - 1])) ERR;
+
+         for (offsets[0] = 0; offsets[0] < NT; offsets[0] += CT) {
+            for (offsets[1] = 0; offsets[1] < NX; offsets[1] += CX) {
+               if (nc_get_var_chunk_raw(ncid, varid, offsets, &mask, &size, NULL)) ERR;
+               if (size == 0) ERR;
+               if (size > bufsize) {
+                  free(buf);
+                  if (!(buf = malloc(size))) ERR;
+                  bufsize = size;
+               }
+               if (nc_get_var_chunk_raw(ncid, varid, offsets, &mask, &size, buf)) ERR;
+               if (nc_put_var_chunk_raw(ncid2, varid2, offsets, mask, size, buf)) ERR;
+               nchunks++;
+            }
+         }
+         if (nchunks != ((NT + CT - 1) / CT) * (NX / CX)) ERR;
+
+         /* Read-only files can not be written. */
+         offsets[0] = offsets[1] = 0;
+         if (nc_put_var_chunk_raw(ncid, varid, offsets, mask, size, buf) != NC_EPERM) ERR;
+         if (nc_close(ncid)) ERR;
+         if (nc_close(ncid2)) ERR;
+         free(buf);
+
+         /* The copy decompresses to the original data. */
+         if (nc_open(FILE_NAME2, NC_NOWRITE, &ncid2)) ERR;
+         if (nc_get_vara_int(ncid2, varid2, start, count, &back[0][0])) ERR;
+         for (t = 0; t < NT; t++)
+            for (x = 0; x < NX; x++)
+               if (back[t][x] != data[t][x]) ERR;
+         if (nc_close(ncid2)) ERR;
+      }
+   }
+   SUMMARIZE_ERR;
+   printf("**** testing chunks that were never written...");
+   {
+      int ncid, varid, ret;
+      int val = 42;
+      size_t index[NDIMS] = {CT, CX};
+      size_t offsets[NDIMS] = {0, 0};
+      size_t size = 99;
+      unsigned int mask;
+
+      if (create(FILE_NAME, &ncid, &varid)) ERR;
+      if (nc_enddef(ncid)) ERR;
+      if (nc_put_var1_int(ncid, varid, index, &val)) ERR;
+      ret = nc_get_var_chunk_raw(ncid, varid, offsets, &mask, &size, NULL);
+      if (!SKIP_NOTBUILT(ret)) {
+         if (ret) ERR;
+         if (size != 0) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   printf("**** testing classic files have no raw chunks...");
+   {
+      int ncid, dimid, varid;
+      size_t offsets[1] = {0}, size;
+
+      if (nc_create(FILE_NAME, NC_CLOBBER, &ncid)) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimid)) ERR;
+      if (nc_def_var(ncid, "v", NC_INT, 1, &dimid, &varid)) ERR;
+      if (nc_enddef(ncid)) ERR;
+      if (nc_get_var_chunk_raw(ncid, varid, offsets, NULL, &size, NULL) != NC_ENOTNC4) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
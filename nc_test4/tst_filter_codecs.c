@@ -0,0 +1,133 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  Test the compression filter plugins: write variables through the
+  filters given on the command line, in nccopy -F syntax, and read
+  them back. HDF5_PLUGIN_PATH must point at the plugins; see
+  tst_filter_codecs.sh.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+#include <netcdf_filter.h>
+
+#define FILE_NAME "tst_filter_codecs.nc"
+#define NDIMS 2
+#define NY 100
+#define NX 150
+#define CY 30 /* chunks not dividing the dimensions */
+#define CX 70
+#define BLOCKSHUFFLE 32769
+
+static float fdata[NY * NX];
+static int idata[NY * NX];
+static double ddata[NY * NX];
+
+/* Write the variables through the filters, and read them back. */
+static int
+test_filters(const char* spec)
+{
+    int ncid, dimids[NDIMS], varids[3], format, v;
+    size_t chunks[NDIMS] = {CY, CX};
+    size_t nfilters, i, j, k, nids;
+    NC4_Filterspec** filters = NULL;
+    unsigned int ids[8];
+    static float fin[NY * NX];
+    static int iin[NY * NX];
+    static double din[NY * NX];
+
+    if (NC_parsefilterlist(spec, &format, &nfilters, (NC_Filterspec***)&filters)) ERR;
+    if (format != NC_FILTER_FORMAT_HDF5 || nfilters < 1 || nfilters > 8) ERR;
+
+    if (nc_create(FILE_NAME, NC_CLOBBER|NC_NETCDF4, &ncid)) ERR;
+    if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+    if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+    if (nc_def_var(ncid, "f", NC_FLOAT, NDIMS, dimids, &varids[0])) ERR;
+    if (nc_def_var(ncid, "i", NC_INT, NDIMS, dimids, &varids[1])) ERR;
+    if (nc_def_var(ncid, "d", NC_DOUBLE, NDIMS, dimids, &varids[2])) ERR;
+    for (v = 0; v < 3; v++)
+    {
+        if (nc_def_var_chunking(ncid, varids[v], NC_CHUNKED, chunks)) ERR;
+        for (i = 0; i < nfilters; i++)
+            if (nc_def_var_filter(ncid, varids[v], filters[i]->filterid,
+                                  filters[i]->nparams, filters[i]->params)) ERR;
+    }
+    if (nc_put_var_float(ncid, varids[0], fdata)) ERR;
+    if (nc_put_var_int(ncid, varids[1], idata)) ERR;
+    if (nc_put_var_double(ncid, varids[2], ddata)) ERR;
+    if (nc_close(ncid)) ERR;
+
+    if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+    for (v = 0; v < 3; v++)
+    {
+        if (nc_inq_var_filterids(ncid, varids[v], &nids, ids)) ERR;
+        if (nids != nfilters) ERR;
+        for (i = 0; i < nfilters; i++)
+        {
+            unsigned int params[16];
+            size_t nparams;
+
+            if (ids[i] != filters[i]->filterid) ERR;
+            if (nc_inq_var_filter_info(ncid, varids[v], ids[i], &nparams, params)) ERR;
+            if (ids[i] == BLOCKSHUFFLE)
+            {
+                /* The element size is added, and the defaults. */
+                static const size_t size[3] = {sizeof(float), sizeof(int), sizeof(double)};
+                if (nparams != 3 || params[2] != size[v]) ERR;
+                for (k = 0; k < filters[i]->nparams && k < 2; k++)
+                    if (filters[i]->params[k] && params[k] != filters[i]->params[k]) ERR;
+            }
+            else
+            {
+                if (nparams != filters[i]->nparams) ERR;
+                for (k = 0; k < nparams; k++)
+                    if (params[k] != filters[i]->params[k]) ERR;
+            }
+        }
+    }
+    if (nc_get_var_float(ncid, varids[0], fin)) ERR;
+    if (nc_get_var_int(ncid, varids[1], iin)) ERR;
+    if (nc_get_var_double(ncid, varids[2], din)) ERR;
+    for (j = 0; j < NY * NX; j++)
+        if (fin[j] != fdata[j] || iin[j] != idata[j] || din[j] != ddata[j]) ERR;
+    if (nc_close(ncid)) ERR;
+
+    for (i = 0; i < nfilters; i++)
+    {
+        free(filters[i]->params);
+        free(filters[i]);
+    }
+    free(filters);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int a;
+    size_t j;
+
+    /* Smooth fields, with a little noise. */
+    for (j = 0; j < NY * NX; j++)
+    {
+        fdata[j] = 280.0f + (float)(j / NX) * 0.1f + (float)(j % NX) * 0.01f
+            + (float)((j * 2654435761u) % 100) * 1e-4f;
+        idata[j] = (int)(j / 7) - 1000;
+        ddata[j] = 1e5 + (double)j * 0.5 + (double)((j * 2654435761u) % 1000) * 1e-6;
+    }
+
+    printf("\n*** Testing compression filter plugins.\n");
+    for (a = 1; a < argc; a++)
+    {
+        printf("*** testing %s...", argv[a]);
+        if (test_filters(argv[a])) ERR;
+        SUMMARIZE_ERR;
+    }
+    FINAL_RESULTS;
+}
@@ -0,0 +1,253 @@
+/*
+  Copyright 2018, UCAR/Unidata
+  See COPYRIGHT file for copying and redistribution conditions.
+
+  Test the quantize filter plugin: the data comes back within the
+  error of the quantization, the fill value, infinities and NaNs come
+  back as they were, the quantization is recorded in an attribute,
+  the quantization runs before the shuffle and the compressor, and
+  the data compresses better. HDF5_PLUGIN_PATH must point at the
+  plugin; see tst_filter_codecs.sh.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <netcdf.h>
+#include <netcdf_filter.h>
+
+#define FILE_NAME "tst_quantize.nc"
+#define FILE_NAME_RAW "tst_quantize_raw.nc"
+#define NDIMS 2
+#define NY 60
+#define NX 80
+#define NWRITTEN (NY * NX - NX) /* the last row is left to the fill value */
+#define NSB 9 /* bits for BitRound */
+#define NSD 3 /* digits for BitGroom */
+
+static float fdata[NY * NX];
+static double ddata[NY * NX];
+
+/* Check that the floats read back are within the error of BitRound
+ * to NSB bits, and that the fill value, infinities and NaNs are
+ * kept. */
+static int
+check_bitround(const float *fin)
+{
+    size_t j;
+
+    for (j = 0; j < NWRITTEN; j++)
+    {
+        /* Rounding to NSB bits is good to half a unit in the last
+         * bit kept. */
+        if (isnan(fdata[j]) || isinf(fdata[j]))
+        {
+            if (memcmp(&fin[j], &fdata[j], sizeof(float))) ERR;
+        }
+        else if (fabs(fin[j] - fdata[j]) > fabs(fdata[j]) * ldexp(1.0, -NSB - 1)) ERR;
+    }
+    for (j = NWRITTEN; j < NY * NX; j++)
+        if (fin[j] != NC_FILL_FLOAT) ERR;
+    return 0;
+}
+
+/* Return the size of a file, or -1. */
+static long
+file_size(const char *path)
+{
+    FILE *fp;
+    long size = -1;
+
+    if ((fp = fopen(path, "rb")) == NULL)
+        return -1;
+    if (!fseek(fp, 0, SEEK_END))
+        size = ftell(fp);
+    fclose(fp);
+    return size;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, dimids[NDIMS], fvarid, dvarid, ivarid, keep;
+    size_t chunks[NDIMS] = {NY / 2, NX};
+    size_t start[NDIMS] = {0, 0}, count[NDIMS] = {NY - 1, NX};
+    size_t j;
+    unsigned int bitround[2] = {NC_QUANTIZE_BITROUND, NSB};
+    unsigned int bitgroom[2] = {NC_QUANTIZE_BITGROOM, NSD};
+    unsigned int level = 1;
+    static float fin[NY * NX];
+    static double din[NY * NX];
+
+    for (j = 0; j < NY * NX; j++)
+    {
+        fdata[j] = 280.0f + (float)(j / NX) * 0.1f + (float)(j % NX) * 0.01f
+            + (float)((j * 2654435761u) % 100) * 1e-4f;
+        ddata[j] = (double)fdata[j] * 1e-3 - 0.14;
+    }
+    fdata[1] = INFINITY;
+    fdata[2] = NAN;
+    fdata[3] = 0.0f;
+    ddata[3] = -INFINITY;
+    ddata[4] = 0.0;
+
+    printf("\n*** Testing quantize filter.\n");
+    printf("*** testing quantize parameters...");
+    {
+        if (nc_create(FILE_NAME, NC_CLOBBER|NC_NETCDF4, &ncid)) ERR;
+        if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+        if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+        if (nc_def_var(ncid, "f", NC_FLOAT, NDIMS, dimids, &fvarid)) ERR;
+        if (nc_def_var(ncid, "i", NC_INT, NDIMS, dimids, &ivarid)) ERR;
+
+        /* Only for floating point */
+        if (nc_def_var_filter(ncid, ivarid, H5Z_FILTER_QUANTIZE, 2, bitround) != NC_EINVAL) ERR;
+        /* Bits and digits must be in range */
+        bitround[1] = NC_QUANTIZE_MAX_FLOAT_NSB + 1;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitround) != NC_EINVAL) ERR;
+        bitround[1] = 0;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitround) != NC_EINVAL) ERR;
+        bitgroom[1] = NC_QUANTIZE_MAX_FLOAT_NSD + 1;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitgroom) != NC_EINVAL) ERR;
+        bitround[0] = 3;
+        bitround[1] = NSB;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitround) != NC_EINVAL) ERR;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 1, bitround) != NC_EFILTER) ERR;
+        bitround[0] = NC_QUANTIZE_BITROUND;
+        bitgroom[1] = NSD;
+
+        /* Changing the quantization changes the attribute, and
+         * removing it removes the attribute. */
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitgroom)) ERR;
+        if (nc_get_att_int(ncid, fvarid, NC_QUANTIZE_BITGROOM_ATT_NAME, &keep)) ERR;
+        if (keep != NSD) ERR;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitround)) ERR;
+        if (nc_inq_attid(ncid, fvarid, NC_QUANTIZE_BITGROOM_ATT_NAME, NULL) != NC_ENOTATT) ERR;
+        if (nc_get_att_int(ncid, fvarid, NC_QUANTIZE_BITROUND_ATT_NAME, &keep)) ERR;
+        if (keep != NSB) ERR;
+        if (nc_var_filter_remove(ncid, fvarid, H5Z_FILTER_QUANTIZE)) ERR;
+        if (nc_inq_attid(ncid, fvarid, NC_QUANTIZE_BITROUND_ATT_NAME, NULL) != NC_ENOTATT) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing quantized data...");
+    {
+        unsigned int ids[4], params[8];
+        size_t nids, nparams;
+
+        if (nc_create(FILE_NAME, NC_CLOBBER|NC_NETCDF4, &ncid)) ERR;
+        if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+        if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+        if (nc_def_var(ncid, "f", NC_FLOAT, NDIMS, dimids, &fvarid)) ERR;
+        if (nc_def_var(ncid, "d", NC_DOUBLE, NDIMS, dimids, &dvarid)) ERR;
+        if (nc_def_var_chunking(ncid, fvarid, NC_CHUNKED, chunks)) ERR;
+        if (nc_def_var_chunking(ncid, dvarid, NC_CHUNKED, chunks)) ERR;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitround)) ERR;
+        if (nc_def_var_filter(ncid, fvarid, H5Z_FILTER_DEFLATE, 1, &level)) ERR;
+        if (nc_def_var_filter(ncid, dvarid, H5Z_FILTER_QUANTIZE, 2, bitgroom)) ERR;
+        if (nc_def_var_filter(ncid, dvarid, H5Z_FILTER_DEFLATE, 1, &level)) ERR;
+        if (nc_put_vara_float(ncid, fvarid, start, count, fdata)) ERR;
+        if (nc_put_vara_double(ncid, dvarid, start, count, ddata)) ERR;
+        if (nc_close(ncid)) ERR;
+
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_var_filterids(ncid, fvarid, &nids, ids)) ERR;
+        if (nids != 2 || ids[0] != H5Z_FILTER_QUANTIZE || ids[1] != H5Z_FILTER_DEFLATE) ERR;
+        /* The element size, byte order and fill value are added */
+        if (nc_inq_var_filter_info(ncid, fvarid, H5Z_FILTER_QUANTIZE, &nparams, params)) ERR;
+        if (nparams != 6 || params[0] != NC_QUANTIZE_BITROUND || params[1] != NSB) ERR;
+        if (params[2] != sizeof(float)) ERR;
+        if (nc_inq_var_filter_info(ncid, dvarid, H5Z_FILTER_QUANTIZE, &nparams, params)) ERR;
+        if (nparams != 6 || params[0] != NC_QUANTIZE_BITGROOM || params[1] != NSD) ERR;
+        if (params[2] != sizeof(double)) ERR;
+        if (nc_get_att_int(ncid, fvarid, NC_QUANTIZE_BITROUND_ATT_NAME, &keep)) ERR;
+        if (keep != NSB) ERR;
+        if (nc_get_att_int(ncid, dvarid, NC_QUANTIZE_BITGROOM_ATT_NAME, &keep)) ERR;
+        if (keep != NSD) ERR;
+
+        if (nc_get_var_float(ncid, fvarid, fin)) ERR;
+        if (nc_get_var_double(ncid, dvarid, din)) ERR;
+        if (check_bitround(fin)) ERR;
+        for (j = 0; j < NWRITTEN; j++)
+        {
+            /* BitGroom keeps at least NSD digits. */
+            if (isinf(ddata[j]))
+            {
+                if (din[j] != ddata[j]) ERR;
+            }
+            else if (fabs(din[j] - ddata[j]) > fabs(ddata[j]) * 0.5 * pow(10.0, 1 - NSD)) ERR;
+        }
+        /* The fill value is kept */
+        for (j = NWRITTEN; j < NY * NX; j++)
+            if (din[j] != NC_FILL_DOUBLE) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing quantize with shuffle and deflate...");
+    {
+        unsigned int ids[4];
+        size_t nids;
+        int svarid, tvarid, shuffle, deflate, deflate_level;
+
+        if (nc_create(FILE_NAME, NC_CLOBBER|NC_NETCDF4, &ncid)) ERR;
+        if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+        if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+        if (nc_def_var(ncid, "s", NC_FLOAT, NDIMS, dimids, &svarid)) ERR;
+        if (nc_def_var(ncid, "t", NC_FLOAT, NDIMS, dimids, &tvarid)) ERR;
+        if (nc_def_var_chunking(ncid, svarid, NC_CHUNKED, chunks)) ERR;
+        if (nc_def_var_chunking(ncid, tvarid, NC_CHUNKED, chunks)) ERR;
+        /* Whichever is defined first, the quantization runs before
+         * the shuffle and the compressor. */
+        if (nc_def_var_deflate(ncid, svarid, 1, 1, level)) ERR;
+        if (nc_def_var_filter(ncid, svarid, H5Z_FILTER_QUANTIZE, 2, bitround)) ERR;
+        if (nc_def_var_filter(ncid, tvarid, H5Z_FILTER_QUANTIZE, 2, bitround)) ERR;
+        if (nc_def_var_deflate(ncid, tvarid, 1, 1, level)) ERR;
+        if (nc_inq_var_filterids(ncid, svarid, &nids, ids)) ERR;
+        if (nids != 2 || ids[0] != H5Z_FILTER_QUANTIZE || ids[1] != H5Z_FILTER_DEFLATE) ERR;
+        if (nc_put_vara_float(ncid, svarid, start, count, fdata)) ERR;
+        if (nc_put_vara_float(ncid, tvarid, start, count, fdata)) ERR;
+        if (nc_close(ncid)) ERR;
+
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_var_filterids(ncid, svarid, &nids, ids)) ERR;
+        if (nids != 2 || ids[0] != H5Z_FILTER_QUANTIZE || ids[1] != H5Z_FILTER_DEFLATE) ERR;
+        if (nc_inq_var_filterids(ncid, tvarid, &nids, ids)) ERR;
+        if (nids != 2 || ids[0] != H5Z_FILTER_QUANTIZE || ids[1] != H5Z_FILTER_DEFLATE) ERR;
+        if (nc_inq_var_deflate(ncid, svarid, &shuffle, &deflate, &deflate_level)) ERR;
+        if (!shuffle || !deflate || deflate_level != (int)level) ERR;
+        if (nc_get_var_float(ncid, svarid, fin)) ERR;
+        if (check_bitround(fin)) ERR;
+        if (nc_get_var_float(ncid, tvarid, fin)) ERR;
+        if (check_bitround(fin)) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing quantized data compresses better...");
+    {
+        const char *names[2] = {FILE_NAME, FILE_NAME_RAW};
+        long sizes[2];
+        int f;
+
+        /* The same data, deflated, with and without the quantization. */
+        for (f = 0; f < 2; f++)
+        {
+            if (nc_create(names[f], NC_CLOBBER|NC_NETCDF4, &ncid)) ERR;
+            if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+            if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+            if (nc_def_var(ncid, "f", NC_FLOAT, NDIMS, dimids, &fvarid)) ERR;
+            if (nc_def_var_chunking(ncid, fvarid, NC_CHUNKED, chunks)) ERR;
+            if (f == 0 && nc_def_var_filter(ncid, fvarid, H5Z_FILTER_QUANTIZE, 2, bitround)) ERR;
+            if (nc_def_var_deflate(ncid, fvarid, 1, 1, level)) ERR;
+            if (nc_put_vara_float(ncid, fvarid, start, count, fdata)) ERR;
+            if (nc_close(ncid)) ERR;
+            if ((sizes[f] = file_size(names[f])) <= 0) ERR;
+        }
+        if (sizes[0] >= sizes[1]) ERR;
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
@@ -0,0 +1,144 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata See COPYRIGHT file for
+   conditions of use.
+
+   Test that the variables and attributes of a file with many
+   user-defined types get the right types when the file is opened,
+   including after new types are defined.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <string.h>
+
+#define FILE_NAME "tst_type_lookup.nc"
+#define NCMP 150
+#define NENUM 50
+#define DIM_LEN 3
+
+struct s
+{
+    int x;
+    float v;
+};
+
+static int
+check_types(int ncid, int nextra)
+{
+    char name[NC_MAX_NAME + 1], expected[NC_MAX_NAME + 1];
+    nc_type xtype;
+    int varid, class, nvars;
+    size_t size;
+
+    if (nc_inq_nvars(ncid, &nvars)) ERR;
+    if (nvars != NCMP + NENUM + 1 + nextra) ERR;
+    for (varid = 0; varid < NCMP + NENUM; varid++)
+    {
+        if (nc_inq_vartype(ncid, varid, &xtype)) ERR;
+        if (nc_inq_user_type(ncid, xtype, name, &size, NULL, NULL, &class)) ERR;
+        if (varid < NCMP)
+        {
+            snprintf(expected, sizeof(expected), "cmp%d", varid);
+            if (class != NC_COMPOUND || size != sizeof(struct s)) ERR;
+        }
+        else
+        {
+            snprintf(expected, sizeof(expected), "enum%d", varid - NCMP);
+            if (class != NC_ENUM) ERR;
+        }
+        if (strcmp(name, expected)) ERR;
+
+        /* The attribute has the same type as the variable. */
+        if (nc_inq_atttype(ncid, varid, "att", &xtype)) ERR;
+        if (nc_inq_user_type(ncid, xtype, name, NULL, NULL, NULL, NULL)) ERR;
+        if (strcmp(name, expected)) ERR;
+    }
+    if (nc_inq_vartype(ncid, NCMP + NENUM, &xtype)) ERR;
+    if (nc_inq_user_type(ncid, xtype, name, NULL, NULL, NULL, &class)) ERR;
+    if (class != NC_VLEN || strcmp(name, "vlen")) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing user-defined type lookup.\n");
+    printf("*** testing many compound and enum types...");
+    {
+        int ncid, dimid, varid, i;
+        nc_type xtype, vlen_type;
+        char name[NC_MAX_NAME + 1];
+        struct s data[DIM_LEN];
+        signed char val;
+
+        memset(data, 0, sizeof(data));
+        if (nc_create(FILE_NAME, NC_CLOBBER|NC_NETCDF4, &ncid)) ERR;
+        if (nc_def_dim(ncid, "d", DIM_LEN, &dimid)) ERR;
+
+        /* Compound types of the same size, told apart by the name of
+         * their second member. */
+        for (i = 0; i < NCMP; i++)
+        {
+            snprintf(name, sizeof(name), "cmp%d", i);
+            if (nc_def_compound(ncid, sizeof(struct s), name, &xtype)) ERR;
+            if (nc_insert_compound(ncid, xtype, "x", NC_COMPOUND_OFFSET(struct s, x),
+                                   NC_INT)) ERR;
+            snprintf(name, sizeof(name), "v%d", i);
+            if (nc_insert_compound(ncid, xtype, name, NC_COMPOUND_OFFSET(struct s, v),
+                                   NC_FLOAT)) ERR;
+            if (nc_def_var(ncid, name, xtype, 1, &dimid, &varid)) ERR;
+            if (nc_put_att(ncid, varid, "att", xtype, 1, data)) ERR;
+        }
+        /* Enum types of the same base type and number of members. */
+        for (i = 0; i < NENUM; i++)
+        {
+            snprintf(name, sizeof(name), "enum%d", i);
+            if (nc_def_enum(ncid, NC_BYTE, name, &xtype)) ERR;
+            val = 0;
+            snprintf(name, sizeof(name), "zero%d", i);
+            if (nc_insert_enum(ncid, xtype, name, &val)) ERR;
+            val = 1;
+            snprintf(name, sizeof(name), "one%d", i);
+            if (nc_insert_enum(ncid, xtype, name, &val)) ERR;
+            snprintf(name, sizeof(name), "e%d", i);
+            if (nc_def_var(ncid, name, xtype, 1, &dimid, &varid)) ERR;
+            if (nc_put_att(ncid, varid, "att", xtype, 1, &val)) ERR;
+        }
+        if (nc_def_vlen(ncid, "vlen", NC_INT, &vlen_type)) ERR;
+        if (nc_def_var(ncid, "vl", vlen_type, 1, &dimid, &varid)) ERR;
+        if (nc_close(ncid)) ERR;
+
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (check_types(ncid, 0)) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** testing types defined after the file is opened...");
+    {
+        int ncid, dimid, varid;
+        nc_type xtype, newtype;
+        char name[NC_MAX_NAME + 1];
+        long long data[DIM_LEN] = {1, 2, 3};
+
+        if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+        if (nc_inq_dimid(ncid, "d", &dimid)) ERR;
+        /* A new type, not committed yet, while the attributes are
+         * read. */
+        if (nc_def_compound(ncid, sizeof(long long), "new", &newtype)) ERR;
+        if (nc_insert_compound(ncid, newtype, "y", 0, NC_INT64)) ERR;
+        if (check_types(ncid, 0)) ERR;
+        if (nc_def_var(ncid, "n", newtype, 1, &dimid, &varid)) ERR;
+        if (nc_put_var(ncid, varid, data)) ERR;
+        if (nc_close(ncid)) ERR;
+
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (check_types(ncid, 1)) ERR;
+        if (nc_inq_varid(ncid, "n", &varid)) ERR;
+        if (nc_inq_vartype(ncid, varid, &xtype)) ERR;
+        if (nc_inq_user_type(ncid, xtype, name, NULL, NULL, NULL, NULL)) ERR;
+        if (strcmp(name, "new")) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
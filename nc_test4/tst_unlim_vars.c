@@ -265,5 +265,62 @@ main(int argc, char **argv)
         if (nc_close(ncid)) ERR;
     }
     SUMMARIZE_ERR;
+    printf("*** Testing unlimited dimension length with vars in child groups...");
+    {
+#define GRP_NAME "child"
+#define X_NAME "x"
+#define X_LEN 5
+        int ncid, grpid, dimid, xdimid, v1id, v2id;
+        int dimids[NDIM2];
+        size_t start[NDIM2] = {0, 0}, count[NDIM2] = {1, X_LEN};
+        int data[X_LEN] = {1, 2, 3, 4, 5};
+        size_t len_in;
+
+        /* The unlimited dim has no coordinate var; v1 in the root
+         * group gets 2 records, v2 in a child group gets 7. */
+        if (nc_create(FILE_NAME, NC_NETCDF4|NC_CLOBBER, &ncid)) ERR;
+        if (nc_def_dim(ncid, TIME_NAME, NC_UNLIMITED, &dimid)) ERR;
+        if (nc_def_dim(ncid, X_NAME, X_LEN, &xdimid)) ERR;
+        dimids[0] = dimid;
+        dimids[1] = xdimid;
+        if (nc_def_var(ncid, "v1", NC_INT, NDIM2, dimids, &v1id)) ERR;
+        if (nc_def_grp(ncid, GRP_NAME, &grpid)) ERR;
+        if (nc_def_var(grpid, "v2", NC_INT, NDIM2, dimids, &v2id)) ERR;
+        if (nc_inq_dimlen(ncid, dimid, &len_in)) ERR;
+        if (len_in != 0) ERR;
+        start[0] = 1;
+        if (nc_put_vara_int(ncid, v1id, start, count, data)) ERR;
+        if (nc_inq_dimlen(grpid, dimid, &len_in)) ERR;
+        if (len_in != 2) ERR;
+        start[0] = 6;
+        if (nc_put_vara_int(grpid, v2id, start, count, data)) ERR;
+        if (nc_inq_dimlen(ncid, dimid, &len_in)) ERR;
+        if (len_in != 7) ERR;
+        if (nc_close(ncid)) ERR;
+
+        /* Reopen, the length is found again, and kept up to date by
+         * further writes. */
+        if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+        if (nc_inq_ncid(ncid, GRP_NAME, &grpid)) ERR;
+        if (nc_inq_dimlen(ncid, dimid, &len_in)) ERR;
+        if (len_in != 7) ERR;
+        if (nc_get_vara_int(ncid, v1id, start, count, data)) ERR;
+        if (data[0] != NC_FILL_INT) ERR;
+        start[0] = 7;
+        if (nc_get_vara_int(ncid, v1id, start, count, data) != NC_EINVALCOORDS) ERR;
+        start[0] = 9;
+        if (nc_put_vara_int(ncid, v1id, start, count, data)) ERR;
+        if (nc_inq_dimlen(grpid, dimid, &len_in)) ERR;
+        if (len_in != 10) ERR;
+        if (nc_get_vara_int(grpid, v2id, start, count, data)) ERR;
+        if (data[0] != NC_FILL_INT) ERR;
+        if (nc_close(ncid)) ERR;
+
+        if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_dimlen(ncid, dimid, &len_in)) ERR;
+        if (len_in != 10) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
     FINAL_RESULTS;
 }
@@ -0,0 +1,454 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Worker pool for nccopy -t; see copypool.h */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include "netcdf.h"
+#include "netcdf_filter.h"
+#include "copypool.h"
+
+#ifdef ENABLE_THREADSAFE
+
+#include <pthread.h>
+#ifdef HAVE_ZLIB_H
+#include <zlib.h>
+#endif
+
+/* Pieces that may wait in the queue, per worker */
+#define QUEUE_PER_THREAD 2
+
+typedef struct Task {
+    int igrp, varid, ogrp, ovarid;
+    int rank;
+    size_t *start;		/* start and count, rank each, one allocation */
+    size_t *count;
+    size_t nvals;
+    size_t nbytes;
+    int freekind;
+    int encoded;		/* nonzero to store chunks as encode says */
+    copypool_encode_t encode;	/* dims and chunks follow start and count */
+} Task;
+
+/* Buffers of a worker: the piece, and two for encoding chunks */
+#define NBUFS 3
+
+static struct Pool {
+    int nthreads;
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t notempty;	/* signalled when a task is queued */
+    pthread_cond_t notfull;	/* signalled when a task is dequeued */
+    pthread_cond_t idle;	/* signalled when a task is finished */
+    Task *queue;		/* circular queue */
+    int qsize, qhead, qlen;
+    int busy;			/* tasks dequeued but not finished */
+    int stopping;
+    int stat;			/* first error */
+} pool;
+
+static int
+reserve(void **bufp, size_t *sizep, size_t size)
+{
+    if(size > *sizep) {
+	void *nbuf = realloc(*bufp, size);
+	if(nbuf == NULL)
+	    return NC_ENOMEM;
+	*bufp = nbuf;
+	*sizep = size;
+    }
+    return NC_NOERR;
+}
+
+/* Copy the values of region (rstart,rcount) from src, an array of
+ * shape sshape at sorigin, to dst, an array of shape dshape at
+ * dorigin, a row at a time. */
+static void
+copy_region(int rank, size_t value_size,
+	    const size_t *rstart, const size_t *rcount,
+	    const unsigned char *src, const size_t *sorigin, const size_t *sshape,
+	    unsigned char *dst, const size_t *dorigin, const size_t *dshape)
+{
+    size_t idx[NC_MAX_VAR_DIMS];
+    size_t row = rcount[rank - 1] * value_size;
+    int d;
+
+    for(d = 0; d < rank; d++)
+	idx[d] = 0;
+    for(;;) {
+	size_t soff = 0, doff = 0;
+	for(d = 0; d < rank; d++) {
+	    soff = soff * sshape[d] + (rstart[d] + idx[d] - sorigin[d]);
+	    doff = doff * dshape[d] + (rstart[d] + idx[d] - dorigin[d]);
+	}
+	memcpy(dst + doff * value_size, src + soff * value_size, row);
+	for(d = rank - 2; d >= 0; d--) {
+	    if(++idx[d] < rcount[d])
+		break;
+	    idx[d] = 0;
+	}
+	if(d < 0)
+	    break;
+    }
+}
+
+/* Put the n bytes of a chunk in bufs[1] through the steps of enc, as
+ * the HDF5 shuffle and deflate filters would, and return the result
+ * in *outp and *sizep. */
+static int
+encode_chunk(const copypool_encode_t *enc, size_t n, void **bufs, size_t *sizes,
+	     void **outp, size_t *sizep)
+{
+    int in = 1, out = 2;
+    int k, stat;
+
+    for(k = 0; k < enc->nsteps; k++) {
+	if(enc->steps[k] == COPYPOOL_SHUFFLE) {
+	    size_t vs = enc->value_size, nelems = n / vs, i, j;
+	    const unsigned char *src;
+	    unsigned char *dst;
+	    if(vs <= 1 || nelems <= 1)
+		continue;	/* HDF5 leaves these as they are */
+	    if((stat = reserve(&bufs[out], &sizes[out], n)))
+		return stat;
+	    src = (const unsigned char *)bufs[in];
+	    dst = (unsigned char *)bufs[out];
+	    for(j = 0; j < nelems; j++)
+		for(i = 0; i < vs; i++)
+		    dst[i * nelems + j] = src[j * vs + i];
+	} else if(enc->steps[k] == COPYPOOL_DEFLATE) {
+#ifdef HAVE_ZLIB_H
+	    uLongf zn = compressBound((uLong)n);
+	    if((stat = reserve(&bufs[out], &sizes[out], (size_t)zn)))
+		return stat;
+	    if(compress2((Bytef *)bufs[out], &zn, (const Bytef *)bufs[in],
+			 (uLong)n, enc->levels[k]) != Z_OK)
+		return NC_EFILTER;
+	    n = (size_t)zn;
+#else
+	    return NC_ENOTBUILT;
+#endif
+	} else {
+	    return NC_EINVAL;
+	}
+	in = out;
+	out = 3 - out;
+    }
+    *outp = bufs[in];
+    *sizep = n;
+    return NC_NOERR;
+}
+
+/* Return true if some chunk lies wholly within the piece of t */
+static int
+has_whole_chunk(const Task *t)
+{
+    const copypool_encode_t *enc = &t->encode;
+    int d;
+    for(d = 0; d < t->rank; d++) {
+	size_t ch = enc->chunks[d];
+	size_t pend = t->start[d] + t->count[d];
+	size_t cstart = (t->start[d] + ch - 1) / ch * ch;
+	size_t cend = cstart + ch < enc->dims[d] ? cstart + ch : enc->dims[d];
+	if(cstart >= pend || cend > pend)
+	    return 0;
+    }
+    return 1;
+}
+
+/* Write the piece of t, read into bufs[0], storing each chunk it
+ * covers wholly with nc_put_var_chunk_raw() and the rest of it with
+ * nc_put_vara(). */
+static int
+put_piece_chunks(Task *t, void **bufs, size_t *sizes)
+{
+    const copypool_encode_t *enc = &t->encode;
+    size_t first[NC_MAX_VAR_DIMS], idx[NC_MAX_VAR_DIMS], cstart[NC_MAX_VAR_DIMS];
+    size_t rstart[NC_MAX_VAR_DIMS], rcount[NC_MAX_VAR_DIMS];
+    size_t chunkbytes = enc->value_size;
+    int rank = t->rank;
+    int d, stat;
+
+    if(!has_whole_chunk(t))
+	return nc_put_vara(t->ogrp, t->ovarid, t->start, t->count, bufs[0]);
+    for(d = 0; d < rank; d++) {
+	chunkbytes *= enc->chunks[d];
+	first[d] = idx[d] = t->start[d] / enc->chunks[d];
+    }
+    /* visit each chunk the piece touches, last dimension fastest */
+    for(;;) {
+	int whole = 1;
+	size_t nbytes = enc->value_size;
+	for(d = 0; d < rank; d++) {
+	    size_t pend = t->start[d] + t->count[d];
+	    size_t cend;
+	    cstart[d] = idx[d] * enc->chunks[d];
+	    cend = cstart[d] + enc->chunks[d];
+	    if(cend > enc->dims[d])
+		cend = enc->dims[d];
+	    if(cstart[d] < t->start[d] || cend > pend)
+		whole = 0;
+	    rstart[d] = cstart[d] < t->start[d] ? t->start[d] : cstart[d];
+	    rcount[d] = (cend < pend ? cend : pend) - rstart[d];
+	    nbytes *= rcount[d];
+	}
+	if(whole) {
+	    void *out;
+	    size_t size;
+	    /* edge chunks are stored full size too */
+	    if((stat = reserve(&bufs[1], &sizes[1], chunkbytes)))
+		return stat;
+	    memset(bufs[1], 0, chunkbytes);
+	    copy_region(rank, enc->value_size, rstart, rcount,
+			(const unsigned char *)bufs[0], t->start, t->count,
+			(unsigned char *)bufs[1], cstart, enc->chunks);
+	    if((stat = encode_chunk(enc, chunkbytes, bufs, sizes, &out, &size)))
+		return stat;
+	    if((stat = nc_put_var_chunk_raw(t->ogrp, t->ovarid, cstart, 0, size, out)))
+		return stat;
+	} else {
+	    if((stat = reserve(&bufs[1], &sizes[1], nbytes)))
+		return stat;
+	    copy_region(rank, enc->value_size, rstart, rcount,
+			(const unsigned char *)bufs[0], t->start, t->count,
+			(unsigned char *)bufs[1], rstart, rcount);
+	    if((stat = nc_put_vara(t->ogrp, t->ovarid, rstart, rcount, bufs[1])))
+		return stat;
+	}
+	for(d = rank - 1; d >= 0; d--) {
+	    if(++idx[d] * enc->chunks[d] < t->start[d] + t->count[d])
+		break;
+	    idx[d] = first[d];
+	}
+	if(d < 0)
+	    break;
+    }
+    return NC_NOERR;
+}
+
+/* Copy one piece; runs without the pool lock */
+static int
+copy_piece(Task *t, void **bufs, size_t *sizes)
+{
+    int stat;
+    if((stat = reserve(&bufs[0], &sizes[0], t->nbytes)))
+	return stat;
+    stat = nc_get_vara(t->igrp, t->varid, t->start, t->count, bufs[0]);
+    if(stat == NC_NOERR && t->encoded)
+	stat = put_piece_chunks(t, bufs, sizes);
+    else if(stat == NC_NOERR)
+	stat = nc_put_vara(t->ogrp, t->ovarid, t->start, t->count, bufs[0]);
+    /* we have to explicitly free values for strings and vlens */
+#ifdef USE_NETCDF4
+    if(stat == NC_NOERR && t->freekind == COPYPOOL_FREE_STRINGS)
+	stat = nc_free_string(t->nvals, (char **)bufs[0]);
+    else if(stat == NC_NOERR && t->freekind == COPYPOOL_FREE_VLENS)
+	stat = nc_free_vlens(t->nvals, (nc_vlen_t *)bufs[0]);
+#endif
+    return stat;
+}
+
+static void*
+worker(void *arg)
+{
+    void *bufs[NBUFS] = {NULL, NULL, NULL};
+    size_t sizes[NBUFS] = {0, 0, 0};
+    int i;
+    (void)arg;
+
+    pthread_mutex_lock(&pool.lock);
+    for(;;) {
+	Task t;
+	int stat;
+	while(pool.qlen == 0 && !pool.stopping)
+	    pthread_cond_wait(&pool.notempty, &pool.lock);
+	if(pool.qlen == 0)
+	    break; /* stopping and nothing left to do */
+	t = pool.queue[pool.qhead];
+	pool.qhead = (pool.qhead + 1) % pool.qsize;
+	pool.qlen--;
+	pool.busy++;
+	pthread_cond_signal(&pool.notfull);
+	/* after an error, just drain the queue */
+	stat = pool.stat;
+	pthread_mutex_unlock(&pool.lock);
+
+	if(stat == NC_NOERR)
+	    stat = copy_piece(&t, bufs, sizes);
+	free(t.start);
+
+	pthread_mutex_lock(&pool.lock);
+	if(pool.stat == NC_NOERR)
+	    pool.stat = stat;
+	pool.busy--;
+	if(pool.qlen == 0 && pool.busy == 0)
+	    pthread_cond_broadcast(&pool.idle);
+    }
+    pthread_mutex_unlock(&pool.lock);
+    for(i = 0; i < NBUFS; i++)
+	free(bufs[i]);
+    return NULL;
+}
+
+int
+copypool_start(int nthreads)
+{
+    int i;
+    if(pool.nthreads > 0 || nthreads < 1)
+	return NC_EINVAL;
+    memset(&pool, 0, sizeof(pool));
+    pool.qsize = QUEUE_PER_THREAD * nthreads;
+    pool.queue = (Task *)calloc((size_t)pool.qsize, sizeof(Task));
+    pool.threads = (pthread_t *)calloc((size_t)nthreads, sizeof(pthread_t));
+    if(pool.queue == NULL || pool.threads == NULL) {
+	free(pool.queue);
+	free(pool.threads);
+	return NC_ENOMEM;
+    }
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.notempty, NULL);
+    pthread_cond_init(&pool.notfull, NULL);
+    pthread_cond_init(&pool.idle, NULL);
+    for(i = 0; i < nthreads; i++) {
+	if(pthread_create(&pool.threads[i], NULL, worker, NULL) != 0)
+	    break;
+    }
+    pool.nthreads = i;
+    if(i == 0) {
+	copypool_stop();
+	return NC_ENOMEM;
+    }
+    return NC_NOERR;
+}
+
+int
+copypool_submit(int igrp, int varid, int ogrp, int ovarid,
+		int rank, const size_t *start, const size_t *count,
+		size_t nvals, size_t nbytes, int freekind,
+		const copypool_encode_t *encode)
+{
+    Task t;
+    int stat;
+    size_t n = (size_t)(rank > 0 ? rank : 1);
+
+    t.start = (size_t *)malloc(4 * n * sizeof(size_t));
+    if(t.start == NULL)
+	return NC_ENOMEM;
+    t.count = t.start + n;
+    if(rank > 0) {
+	memcpy(t.start, start, n * sizeof(size_t));
+	memcpy(t.count, count, n * sizeof(size_t));
+    }
+    t.encoded = (encode != NULL && rank > 0);
+    if(t.encoded) {
+	t.encode = *encode;
+	t.encode.dims = t.count + n;
+	t.encode.chunks = t.count + 2 * n;
+	memcpy(t.count + n, encode->dims, n * sizeof(size_t));
+	memcpy(t.count + 2 * n, encode->chunks, n * sizeof(size_t));
+    }
+    t.igrp = igrp;
+    t.varid = varid;
+    t.ogrp = ogrp;
+    t.ovarid = ovarid;
+    t.rank = rank;
+    t.nvals = nvals;
+    t.nbytes = nbytes;
+    t.freekind = freekind;
+
+    pthread_mutex_lock(&pool.lock);
+    while(pool.qlen == pool.qsize && pool.stat == NC_NOERR)
+	pthread_cond_wait(&pool.notfull, &pool.lock);
+    stat = pool.stat;
+    if(stat == NC_NOERR) {
+	pool.queue[(pool.qhead + pool.qlen) % pool.qsize] = t;
+	pool.qlen++;
+	pthread_cond_signal(&pool.notempty);
+    }
+    pthread_mutex_unlock(&pool.lock);
+    if(stat != NC_NOERR)
+	free(t.start);
+    return stat;
+}
+
+int
+copypool_wait(void)
+{
+    int stat;
+    if(pool.nthreads == 0)
+	return NC_NOERR;
+    pthread_mutex_lock(&pool.lock);
+    while(pool.qlen > 0 || pool.busy > 0)
+	pthread_cond_wait(&pool.idle, &pool.lock);
+    stat = pool.stat;
+    pthread_mutex_unlock(&pool.lock);
+    return stat;
+}
+
+void
+copypool_stop(void)
+{
+    int i;
+    if(pool.queue == NULL)
+	return;
+    pthread_mutex_lock(&pool.lock);
+    pool.stopping = 1;
+    pthread_cond_broadcast(&pool.notempty);
+    pthread_mutex_unlock(&pool.lock);
+    for(i = 0; i < pool.nthreads; i++)
+	pthread_join(pool.threads[i], NULL);
+    pthread_mutex_destroy(&pool.lock);
+    pthread_cond_destroy(&pool.notempty);
+    pthread_cond_destroy(&pool.notfull);
+    pthread_cond_destroy(&pool.idle);
+    free(pool.queue);
+    free(pool.threads);
+    memset(&pool, 0, sizeof(pool));
+}
+
+int
+copypool_nthreads(void)
+{
+    return pool.nthreads;
+}
+
+#else /*!ENABLE_THREADSAFE*/
+
+int
+copypool_start(int nthreads)
+{
+    (void)nthreads;
+    return NC_ENOTBUILT;
+}
+
+int
+copypool_submit(int igrp, int varid, int ogrp, int ovarid,
+		int rank, const size_t *start, const size_t *count,
+		size_t nvals, size_t nbytes, int freekind,
+		const copypool_encode_t *encode)
+{
+    return NC_ENOTBUILT;
+}
+
+int
+copypool_wait(void)
+{
+    return NC_NOERR;
+}
+
+void
+copypool_stop(void)
+{
+}
+
+int
+copypool_nthreads(void)
+{
+    return 0;
+}
+
+#endif /*ENABLE_THREADSAFE*/
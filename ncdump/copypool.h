@@ -0,0 +1,83 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/*
+ * A pool of worker threads for nccopy -t. The main thread walks the
+ * variables and submits one task per piece of a variable (as chosen
+ * by nc_next_iter) to a bounded queue; each worker reads its piece
+ * from the input and writes it to the output. So reading, the
+ * conversion done inside the library, and writing overlap across
+ * pieces and across variables, as far as the locks of a thread-safe
+ * library allow.
+ *
+ * The library holds its lock while it compresses a netCDF-4 chunk,
+ * so compression inside nc_put_vara() is done one chunk at a time
+ * however many workers there are. Where the output filters are only
+ * shuffle and deflate, the workers instead shuffle and deflate the
+ * chunks of their piece themselves and store them with
+ * nc_put_var_chunk_raw(); see copypool_encode_t.
+ *
+ * Only available when the library is built with ENABLE_THREADSAFE;
+ * otherwise copypool_start() fails and nccopy copies serially.
+ */
+
+#ifndef _COPYPOOL_H_
+#define _COPYPOOL_H_
+
+#include "netcdf.h"
+
+/* How values of a piece must be freed after writing */
+#define COPYPOOL_FREE_NONE 0
+#define COPYPOOL_FREE_STRINGS 1
+#define COPYPOOL_FREE_VLENS 2
+
+/* Filters the workers can apply to a chunk themselves */
+#define COPYPOOL_SHUFFLE 1
+#define COPYPOOL_DEFLATE 2
+#define COPYPOOL_MAX_STEPS 4
+
+/* How the workers store the chunks of a netCDF-4 output variable
+ * themselves. Chunks that lie wholly within a piece (up to the end
+ * of the variable) are padded to the full chunk shape, put through
+ * the steps in the order of the variable's HDF5 filter pipeline, and
+ * written with nc_put_var_chunk_raw(); the parts of a piece in
+ * chunks it only partly covers are written with nc_put_vara(). The
+ * output variable must already be as long as the input one, and of
+ * the same native type. dims and chunks have rank lengths each. */
+typedef struct copypool_encode_t {
+    const size_t *dims;		/* shape of the variable */
+    const size_t *chunks;	/* shape of its chunks */
+    size_t value_size;
+    int nsteps;
+    int steps[COPYPOOL_MAX_STEPS];	/* COPYPOOL_SHUFFLE or COPYPOOL_DEFLATE */
+    int levels[COPYPOOL_MAX_STEPS];	/* deflate level of each step */
+} copypool_encode_t;
+
+/* Start nthreads workers. Returns NC_NOERR, or NC_ENOTBUILT if
+ * the library is not thread-safe. */
+extern int copypool_start(int nthreads);
+
+/* Queue a copy of the (start,count) piece of input variable
+ * (igrp,varid) to output variable (ogrp,ovarid). The piece has
+ * nvals values and needs a buffer of nbytes. If encode is not NULL,
+ * the worker stores the output chunks itself as it describes. start,
+ * count and encode are copied. Blocks while the queue is full.
+ * Returns the first error reported by any worker so far, if any. */
+extern int copypool_submit(int igrp, int varid, int ogrp, int ovarid,
+			   int rank, const size_t *start, const size_t *count,
+			   size_t nvals, size_t nbytes, int freekind,
+			   const copypool_encode_t *encode);
+
+/* Wait until every submitted piece has been written. Returns the
+ * first error reported by any worker. */
+extern int copypool_wait(void);
+
+/* Stop the workers and free their buffers. */
+extern void copypool_stop(void);
+
+/* Number of workers, 0 if the pool is not running */
+extern int copypool_nthreads(void);
+
+#endif /*_COPYPOOL_H_*/
@@ -27,6 +27,7 @@
 #include "ncdump.h"
 #include "isnan.h"
 #include "nctime0.h"
+#include "numfmt.h"
 
 static float float_eps;
 static double double_eps;
@@ -176,7 +177,7 @@ sbuf_cpy(safebuf_t *sb, const char *s2) {
     assert(SAFEBUF_CHECK(sb));
     s2len = strlen(s2);
     sbuf_grow(sb, 1 + s2len);
-    strncpy(sb->buf, s2, sb->len);
+    memcpy(sb->buf, s2, s2len + 1);
     sb->cl = s2len;
     assert(SAFEBUF_CHECK(sb));
 }
@@ -185,12 +186,10 @@ sbuf_cpy(safebuf_t *sb, const char *s2) {
 void
 sbuf_cat(safebuf_t *sb, const char *s2) {
     size_t s2len;
-    size_t res;
     assert(SAFEBUF_CHECK(sb));
     s2len = strlen(s2);
     sbuf_grow(sb, 1 + sb->cl + s2len);
-    res = strlcat(sb->buf + sb->cl, s2, sb->len);
-    assert( res < sb->len );
+    memcpy(sb->buf + sb->cl, s2, s2len + 1);
     sb->cl += s2len;
     assert(SAFEBUF_CHECK(sb));
 }
@@ -1145,7 +1144,10 @@ int
 ncbyte_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(signed char *)valp);
+    if(NCSTREQ(varp->fmt, "%d"))
+	res = numfmt_lld(sout, *(signed char *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(signed char *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1165,7 +1167,10 @@ int
 ncshort_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(short *)valp);
+    if(NCSTREQ(varp->fmt, "%d"))
+	res = numfmt_lld(sout, *(short *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(short *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1175,7 +1180,10 @@ int
 ncint_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(int *)valp);
+    if(NCSTREQ(varp->fmt, "%d"))
+	res = numfmt_lld(sout, *(int *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(int *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1187,7 +1195,10 @@ ncfloat_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     float vv = *(float *)valp;
     if(isfinite(vv)) {
 	int res;
-	res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
+	/* "%.Ng" without snprintf where it can, N as set by -p */
+	res = numfmt_g(sout, vv, numfmt_g_digits(varp->fmt));
+	if(res < 0)
+	    res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
 	assert(res < PRIM_LEN);
     } else {
 	float_special_tostring(vv, sout);
@@ -1202,7 +1213,10 @@ ncdouble_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     double vv = *(double *)valp;
     if(isfinite(vv)) {
 	int res;
-	res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
+	/* "%.Ng" without snprintf where it can, N as set by -p */
+	res = numfmt_g(sout, vv, numfmt_g_digits(varp->fmt));
+	if(res < 0)
+	    res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
 	assert(res < PRIM_LEN);
     } else {
 	double_special_tostring(vv, sout);
@@ -1284,7 +1298,10 @@ int
 ncubyte_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned char *)valp);
+    if(NCSTREQ(varp->fmt, "%u"))
+	res = numfmt_llu(sout, *(unsigned char *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned char *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1294,7 +1311,10 @@ int
 ncushort_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned short *)valp);
+    if(NCSTREQ(varp->fmt, "%u"))
+	res = numfmt_llu(sout, *(unsigned short *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned short *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1304,7 +1324,10 @@ int
 ncuint_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned int *)valp);
+    if(NCSTREQ(varp->fmt, "%u"))
+	res = numfmt_llu(sout, *(unsigned int *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned int *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1314,7 +1337,10 @@ int
 ncint64_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(long long *)valp);
+    if(NCSTREQ(varp->fmt, "%lld"))
+	res = numfmt_lld(sout, *(long long *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(long long *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1324,7 +1350,10 @@ int
 ncuint64_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned long long *)valp);
+    if(NCSTREQ(varp->fmt, "%llu"))
+	res = numfmt_llu(sout, *(unsigned long long *)valp);
+    else
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned long long *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
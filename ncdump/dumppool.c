@@ -0,0 +1,391 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Worker pool for ncdump -j; see dumppool.h */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include "netcdf.h"
+#include "utils.h"
+#include "nccomps.h"
+#include "dumplib.h"
+#include "dumppool.h"
+
+#ifdef ENABLE_THREADSAFE
+
+#include <pthread.h>
+
+/* Blocks that may be read and formatted ahead of the output, per
+ * worker */
+#define SLOTS_PER_THREAD 2
+
+/* Blocks are at most this many values, but small enough that each
+ * worker gets a few blocks of a variable */
+#define MAX_BLOCK_VALS 65536
+#define BLOCKS_PER_THREAD 4
+
+/* State of a slot */
+#define SLOT_FREE 0
+#define SLOT_QUEUED 1
+#define SLOT_DONE 2
+
+typedef struct Slot {
+    size_t *start;		/* start and count, rank each, one allocation */
+    size_t *count;
+    size_t nvals;
+    int state;
+    int stat;			/* error reading the block */
+    char *text;			/* formatted values, each ended by a null */
+    size_t textsize;
+} Slot;
+
+static struct Pool {
+    int nthreads;
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t queued;	/* signalled when a block is queued */
+    pthread_cond_t done;	/* signalled when a block is formatted */
+    Slot *slots;		/* block number n is in slot n % nslots */
+    int nslots;
+    size_t submitted;		/* blocks queued so far */
+    size_t taken;		/* blocks taken by a worker so far */
+    size_t consumed;		/* blocks given back to the caller so far */
+    int busy;			/* blocks taken but not formatted */
+    int handed;			/* block consumed-1 is still with the caller */
+    int stopping;
+    /* the variable being dumped, set by dumppool_begin() */
+    int ncid, varid, rank;
+    const ncvar_t *vp;
+    dumppool_fmt_func fmt;
+    size_t *dims;		/* dims, next start and block shape, rank each */
+    size_t *next;
+    size_t *shape;
+    int more;			/* next is a block still to queue */
+} pool;
+
+/* Read block s of the current variable and format its values into
+ * s->text; runs without the pool lock */
+static int
+format_block(Slot *s, void **valsp, size_t *valsizep, safebuf_t *sb)
+{
+    size_t size = pool.vp->tinfo->size;
+    size_t textlen = 0;
+    const char *valp;
+    size_t i;
+    int stat;
+
+    if(s->nvals * size > *valsizep) {
+	void *nvals = realloc(*valsp, s->nvals * size);
+	if(nvals == NULL)
+	    return NC_ENOMEM;
+	*valsp = nvals;
+	*valsizep = s->nvals * size;
+    }
+    stat = nc_get_vara(pool.ncid, pool.varid, s->start, s->count, *valsp);
+    if(stat != NC_NOERR)
+	return stat;
+    valp = (const char *)*valsp;
+    for(i = 0; i < s->nvals; i++) {
+	size_t len;
+	pool.fmt(sb, pool.vp, valp);
+	len = sbuf_len(sb) + 1;
+	if(textlen + len > s->textsize) {
+	    size_t nsize = 2 * (textlen + len) + 8 * (s->nvals - i);
+	    char *ntext = (char *)realloc(s->text, nsize);
+	    if(ntext == NULL)
+		return NC_ENOMEM;
+	    s->text = ntext;
+	    s->textsize = nsize;
+	}
+	memcpy(s->text + textlen, sbuf_str(sb), len);
+	textlen += len;
+	valp += size;
+    }
+    return NC_NOERR;
+}
+
+static void*
+worker(void *arg)
+{
+    void *vals = NULL;
+    size_t valsize = 0;
+    safebuf_t *sb = sbuf_new();
+    (void)arg;
+
+    pthread_mutex_lock(&pool.lock);
+    for(;;) {
+	Slot *s;
+	int stat;
+	while(pool.taken == pool.submitted && !pool.stopping)
+	    pthread_cond_wait(&pool.queued, &pool.lock);
+	if(pool.taken == pool.submitted)
+	    break; /* stopping and nothing left to do */
+	s = &pool.slots[pool.taken % (size_t)pool.nslots];
+	pool.taken++;
+	pool.busy++;
+	pthread_mutex_unlock(&pool.lock);
+
+	stat = format_block(s, &vals, &valsize, sb);
+
+	pthread_mutex_lock(&pool.lock);
+	s->stat = stat;
+	s->state = SLOT_DONE;
+	pool.busy--;
+	pthread_cond_broadcast(&pool.done);
+    }
+    pthread_mutex_unlock(&pool.lock);
+    sbuf_free(sb);
+    free(vals);
+    return NULL;
+}
+
+/* Queue blocks while there are free slots; called with the lock */
+static void
+queue_blocks(void)
+{
+    int rank = pool.rank;
+    int d;
+
+    while(pool.more && pool.submitted - pool.consumed < (size_t)pool.nslots) {
+	Slot *s = &pool.slots[pool.submitted % (size_t)pool.nslots];
+	s->nvals = 1;
+	for(d = 0; d < rank; d++) {
+	    s->start[d] = pool.next[d];
+	    s->count[d] = pool.dims[d] - pool.next[d];
+	    if(s->count[d] > pool.shape[d])
+		s->count[d] = pool.shape[d];
+	    s->nvals *= s->count[d];
+	}
+	s->state = SLOT_QUEUED;
+	s->stat = NC_NOERR;
+	pool.submitted++;
+	/* next block, last dimension fastest */
+	for(d = rank - 1; d >= 0; d--) {
+	    pool.next[d] += pool.shape[d];
+	    if(pool.next[d] < pool.dims[d])
+		break;
+	    pool.next[d] = 0;
+	}
+	if(d < 0)
+	    pool.more = 0;
+	pthread_cond_signal(&pool.queued);
+    }
+}
+
+int
+dumppool_start(int nthreads)
+{
+    int i;
+    if(pool.nthreads > 0 || nthreads < 1)
+	return NC_EINVAL;
+    memset(&pool, 0, sizeof(pool));
+    pool.nslots = SLOTS_PER_THREAD * nthreads + 1;
+    pool.slots = (Slot *)calloc((size_t)pool.nslots, sizeof(Slot));
+    pool.threads = (pthread_t *)calloc((size_t)nthreads, sizeof(pthread_t));
+    if(pool.slots == NULL || pool.threads == NULL) {
+	free(pool.slots);
+	free(pool.threads);
+	return NC_ENOMEM;
+    }
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.queued, NULL);
+    pthread_cond_init(&pool.done, NULL);
+    for(i = 0; i < nthreads; i++) {
+	if(pthread_create(&pool.threads[i], NULL, worker, NULL) != 0)
+	    break;
+    }
+    pool.nthreads = i;
+    if(i == 0) {
+	dumppool_stop();
+	return NC_ENOMEM;
+    }
+    return NC_NOERR;
+}
+
+int
+dumppool_begin(int ncid, int varid, const ncvar_t *vp, const size_t *vdims,
+	       dumppool_fmt_func fmt)
+{
+    int rank = vp->ndims;
+    size_t n = (size_t)rank;
+    size_t nels = 1, target, blk;
+    int d, i;
+
+    if(pool.nthreads == 0 || rank < 1)
+	return NC_EINVAL;
+    pool.ncid = ncid;
+    pool.varid = varid;
+    pool.rank = rank;
+    pool.vp = vp;
+    pool.fmt = fmt;
+    pool.dims = (size_t *)emalloc(3 * n * sizeof(size_t));
+    pool.next = pool.dims + n;
+    pool.shape = pool.next + n;
+    for(d = 0; d < rank; d++) {
+	pool.dims[d] = vdims[d];
+	pool.next[d] = 0;
+	nels *= vdims[d];
+    }
+    for(i = 0; i < pool.nslots; i++) {
+	Slot *s = &pool.slots[i];
+	s->start = (size_t *)emalloc(2 * n * sizeof(size_t));
+	s->count = s->start + n;
+	s->state = SLOT_FREE;
+    }
+
+    /* Blocks take whole rows of the inner dimensions while they fit,
+     * then part of the next one, so their values follow each other
+     * in the order they are printed */
+    target = nels / (size_t)(BLOCKS_PER_THREAD * pool.nthreads);
+    if(target > MAX_BLOCK_VALS)
+	target = MAX_BLOCK_VALS;
+    if(target < 1)
+	target = 1;
+    blk = 1;
+    for(d = rank - 1; d >= 0; d--) {
+	if(pool.dims[d] <= target / blk) {
+	    pool.shape[d] = pool.dims[d];
+	    blk *= pool.dims[d];
+	} else {
+	    pool.shape[d] = (target / blk > 0 ? target / blk : 1);
+	    for(d--; d >= 0; d--)
+		pool.shape[d] = 1;
+	    break;
+	}
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.submitted = pool.taken = pool.consumed = 0;
+    pool.handed = 0;
+    pool.more = (nels > 0);
+    queue_blocks();
+    pthread_mutex_unlock(&pool.lock);
+    return NC_NOERR;
+}
+
+int
+dumppool_next(const char **textp, size_t *nvalsp)
+{
+    Slot *s;
+    int stat;
+
+    pthread_mutex_lock(&pool.lock);
+    if(pool.handed) {
+	pool.slots[(pool.consumed - 1) % (size_t)pool.nslots].state = SLOT_FREE;
+	pool.handed = 0;
+    }
+    queue_blocks();
+    if(pool.consumed == pool.submitted) {
+	pthread_mutex_unlock(&pool.lock);
+	*textp = NULL;
+	*nvalsp = 0;
+	return NC_NOERR;
+    }
+    s = &pool.slots[pool.consumed % (size_t)pool.nslots];
+    while(s->state != SLOT_DONE)
+	pthread_cond_wait(&pool.done, &pool.lock);
+    pool.consumed++;
+    pool.handed = 1;
+    stat = s->stat;
+    pthread_mutex_unlock(&pool.lock);
+    *textp = s->text;
+    *nvalsp = s->nvals;
+    return stat;
+}
+
+void
+dumppool_end(void)
+{
+    int i;
+    if(pool.dims == NULL)
+	return;
+    /* drop blocks not yet taken, and wait for the rest */
+    pthread_mutex_lock(&pool.lock);
+    pool.more = 0;
+    pool.submitted = pool.taken;
+    while(pool.busy > 0)
+	pthread_cond_wait(&pool.done, &pool.lock);
+    pthread_mutex_unlock(&pool.lock);
+    for(i = 0; i < pool.nslots; i++) {
+	free(pool.slots[i].start);
+	pool.slots[i].start = pool.slots[i].count = NULL;
+	pool.slots[i].state = SLOT_FREE;
+    }
+    free(pool.dims);
+    pool.dims = pool.next = pool.shape = NULL;
+    pool.vp = NULL;
+}
+
+void
+dumppool_stop(void)
+{
+    int i;
+    if(pool.slots == NULL)
+	return;
+    dumppool_end();
+    pthread_mutex_lock(&pool.lock);
+    pool.stopping = 1;
+    pthread_cond_broadcast(&pool.queued);
+    pthread_mutex_unlock(&pool.lock);
+    for(i = 0; i < pool.nthreads; i++)
+	pthread_join(pool.threads[i], NULL);
+    pthread_mutex_destroy(&pool.lock);
+    pthread_cond_destroy(&pool.queued);
+    pthread_cond_destroy(&pool.done);
+    for(i = 0; i < pool.nslots; i++)
+	free(pool.slots[i].text);
+    free(pool.slots);
+    free(pool.threads);
+    memset(&pool, 0, sizeof(pool));
+}
+
+int
+dumppool_nthreads(void)
+{
+    return pool.nthreads;
+}
+
+#else /*!ENABLE_THREADSAFE*/
+
+int
+dumppool_start(int nthreads)
+{
+    (void)nthreads;
+    return NC_ENOTBUILT;
+}
+
+int
+dumppool_begin(int ncid, int varid, const ncvar_t *vp, const size_t *vdims,
+	       dumppool_fmt_func fmt)
+{
+    return NC_ENOTBUILT;
+}
+
+int
+dumppool_next(const char **textp, size_t *nvalsp)
+{
+    *textp = NULL;
+    *nvalsp = 0;
+    return NC_ENOTBUILT;
+}
+
+void
+dumppool_end(void)
+{
+}
+
+void
+dumppool_stop(void)
+{
+}
+
+int
+dumppool_nthreads(void)
+{
+    return 0;
+}
+
+#endif /*ENABLE_THREADSAFE*/
@@ -0,0 +1,51 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/*
+ * A pool of worker threads for ncdump -j. The data of a variable is
+ * split into blocks of whole rows, or pieces of a row, in the order
+ * ncdump prints them. Workers read and format blocks ahead of the
+ * output; the main thread takes the formatted blocks back in order,
+ * through a small ring of slots, and does the layout (line wrapping,
+ * delimiters and annotations) exactly as for a serial dump.
+ *
+ * Only available when the library is built with ENABLE_THREADSAFE;
+ * otherwise dumppool_start() fails and ncdump prints serially.
+ */
+
+#ifndef _DUMPPOOL_H_
+#define _DUMPPOOL_H_
+
+#include "netcdf.h"
+
+/* Formats one value of a variable into a safebuf */
+typedef void (*dumppool_fmt_func)(safebuf_t *sb, const ncvar_t *vp,
+				  const void *valp);
+
+/* Start nthreads workers. Returns NC_NOERR, or NC_ENOTBUILT if
+ * the library is not thread-safe. */
+extern int dumppool_start(int nthreads);
+
+/* Begin reading and formatting all the values of variable varid,
+ * with vp->ndims > 0 dimensions of lengths vdims, using fmt. */
+extern int dumppool_begin(int ncid, int varid, const ncvar_t *vp,
+			  const size_t *vdims, dumppool_fmt_func fmt);
+
+/* Get the next block of formatted values, in order: *nvalsp strings,
+ * each ended by a null, one after another from *textp. They stay
+ * valid until the next call. *nvalsp is 0 after the last block.
+ * Returns the error, if any, reading the block. */
+extern int dumppool_next(const char **textp, size_t *nvalsp);
+
+/* Finish with the current variable */
+extern void dumppool_end(void);
+
+/* Stop the workers and free their buffers. */
+extern void dumppool_stop(void);
+
+/* Number of workers, 0 if the pool is not running */
+extern int dumppool_nthreads(void);
+
+#endif /*_DUMPPOOL_H_*/
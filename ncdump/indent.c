@@ -40,10 +40,10 @@ indent_out(){		/*  output current indent */
 
     int ind = indent;
     while (ind > indent_small) {
-	(void) printf("%s", indents[indent_small]);
+	(void) fputs(indents[indent_small], stdout);
 	ind -= indent_small;
     }
-    (void) printf("%s", indents[ind]);
+    (void) fputs(indents[ind], stdout);
 }
 
 void 
@@ -24,6 +24,8 @@
 #include "dimmap.h"
 #include "nccomps.h"
 #include "list.h"
+#include "copypool.h"
+#include "rechunk.h"
 
 #undef DEBUGFILTER
 
@@ -150,8 +152,10 @@ static int option_nlvars = 0; /* Number of variables specified with -v * option
 static char** option_lvars = 0;		/* list of variable names specified with -v
 					 * option on command line */
 static bool_t option_varstruct = false;	  /* if -v set, copy structure for non-selected vars */
+static int option_nthreads = 1;	/* default, copy data in the main thread */
 static int option_compute_chunkcaches = 0; /* default, don't try still flaky estimate of
 					    * chunk cache for each variable */
+static char *rechunk_tmpbase = NULL; /* temporary file for two pass rechunking, less a unique suffix */
 
 /* get group id in output corresponding to group igrp in input,
  * given parent group id (or root group id) parid in output. */
@@ -992,6 +996,9 @@ copy_chunking(int igrp, int i_varid, int ogrp, int o_varid, int ndims, int inkin
                 /* If the -c set a chunk size for this dimension, use it */
                 dimlens[idim] = dimchunkspec_size(idimid); /* Save it */
 		ocontig = NC_CHUNKED; /* force chunking */
+		/* ... in preference to the input chunk size */
+		if(ochunkp[idim] == 0)
+		    ochunkp[idim] = dimlens[idim];
 	    }
 
             /* Default for unlimited is max(4 megabytes, current dim size) */
@@ -1015,8 +1022,10 @@ copy_chunking(int igrp, int i_varid, int ogrp, int o_varid, int ndims, int inkin
             /* compute on-going dimension product */
             csprod *= ochunkp[idim];
 	}
-        /* if total chunksize is too small (and dim is not unlimited) => do not chunk */
-        if(csprod < option_min_chunk_bytes && !is_unlimited)
+        /* if total chunksize is too small (and dim is not unlimited) => do not chunk,
+           unless -c asked for this variable's chunking by name */
+        if(csprod < option_min_chunk_bytes && !is_unlimited
+           && !varchunkspec_exists(igrp,i_varid))
             ocontig = NC_CONTIGUOUS; /* Force contiguous */
     }
 
@@ -1523,6 +1532,369 @@ inq_nvals(int igrp, int varid, long long *nvalsp) {
     return stat;
 }
 
+#ifdef USE_NETCDF4
+/* Return true if the filters, with their parameters, and the shuffle
+ * and fletcher32 settings are the same on both variables. */
+static int
+same_filters(int igrp, int ivarid, int ogrp, int ovarid)
+{
+    size_t infilters, onfilters, k;
+    unsigned int *iids = NULL, *oids = NULL;
+    int ishuffle, oshuffle, ifletcher, ofletcher;
+    int same = 0;
+
+    NC_CHECK(nc_inq_var_deflate(igrp, ivarid, &ishuffle, NULL, NULL));
+    NC_CHECK(nc_inq_var_deflate(ogrp, ovarid, &oshuffle, NULL, NULL));
+    NC_CHECK(nc_inq_var_fletcher32(igrp, ivarid, &ifletcher));
+    NC_CHECK(nc_inq_var_fletcher32(ogrp, ovarid, &ofletcher));
+    if(ishuffle != oshuffle || ifletcher != ofletcher)
+	return 0;
+    NC_CHECK(nc_inq_var_filterids(igrp, ivarid, &infilters, NULL));
+    NC_CHECK(nc_inq_var_filterids(ogrp, ovarid, &onfilters, NULL));
+    if(infilters != onfilters)
+	return 0;
+    if(infilters == 0)
+	return 1;
+    iids = (unsigned int *) emalloc(infilters * sizeof(unsigned int));
+    oids = (unsigned int *) emalloc(onfilters * sizeof(unsigned int));
+    NC_CHECK(nc_inq_var_filterids(igrp, ivarid, &infilters, iids));
+    NC_CHECK(nc_inq_var_filterids(ogrp, ovarid, &onfilters, oids));
+    for(k = 0; k < infilters; k++) {
+	size_t inparams, onparams;
+	unsigned int *iparams, *oparams;
+	int differ;
+	if(iids[k] != oids[k])
+	    goto done;
+	NC_CHECK(nc_inq_var_filter_info(igrp, ivarid, iids[k], &inparams, NULL));
+	NC_CHECK(nc_inq_var_filter_info(ogrp, ovarid, oids[k], &onparams, NULL));
+	if(inparams != onparams)
+	    goto done;
+	iparams = (unsigned int *) emalloc((inparams + 1) * sizeof(unsigned int));
+	oparams = (unsigned int *) emalloc((onparams + 1) * sizeof(unsigned int));
+	NC_CHECK(nc_inq_var_filter_info(igrp, ivarid, iids[k], NULL, iparams));
+	NC_CHECK(nc_inq_var_filter_info(ogrp, ovarid, oids[k], NULL, oparams));
+	differ = memcmp(iparams, oparams, inparams * sizeof(unsigned int));
+	free(iparams);
+	free(oparams);
+	if(differ)
+	    goto done;
+    }
+    same = 1;
+done:
+    free(iids);
+    free(oids);
+    return same;
+}
+
+/* Return true if the stored chunks of an input variable can be
+ * copied to the output variable as they are, without decompressing
+ * and recompressing them: both files are netCDF-4, and the type,
+ * endianness, chunk shape and filters all match. */
+static int
+can_copy_chunks_raw(int igrp, int varid, int ogrp, int ovarid)
+{
+    int imodel, omodel, ndims, ondims, icontig, ocontig, iendian, oendian, dim;
+    nc_type itype, otype;
+    size_t *ichunks, *ochunks;
+    int same;
+
+    NC_CHECK(nc_inq_format_extended(igrp, &imodel, NULL));
+    NC_CHECK(nc_inq_format_extended(ogrp, &omodel, NULL));
+    if(imodel != NC_FORMATX_NC4 || omodel != NC_FORMATX_NC4)
+	return 0;
+    /* Stored bytes of strings, vlens and user types refer to things
+     * in their own file. */
+    NC_CHECK(nc_inq_vartype(igrp, varid, &itype));
+    NC_CHECK(nc_inq_vartype(ogrp, ovarid, &otype));
+    if(itype != otype || itype > NC_MAX_ATOMIC_TYPE || itype == NC_STRING)
+	return 0;
+    NC_CHECK(nc_inq_var_endian(igrp, varid, &iendian));
+    NC_CHECK(nc_inq_var_endian(ogrp, ovarid, &oendian));
+    if(iendian != oendian)
+	return 0;
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    NC_CHECK(nc_inq_varndims(ogrp, ovarid, &ondims));
+    if(ndims == 0 || ndims != ondims)
+	return 0;
+    ichunks = (size_t *) emalloc(ndims * sizeof(size_t));
+    ochunks = (size_t *) emalloc(ndims * sizeof(size_t));
+    NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, ichunks));
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, ochunks));
+    same = (icontig == NC_CHUNKED && ocontig == NC_CHUNKED);
+    for(dim = 0; same && dim < ndims; dim++)
+	same = (ichunks[dim] == ochunks[dim]);
+    free(ichunks);
+    free(ochunks);
+    return same && same_filters(igrp, varid, ogrp, ovarid);
+}
+
+/* A record variable in the output is only as long as what has been
+ * written to it, which is less than the length of its unlimited
+ * dimension if another variable was written further, so before its
+ * chunks of shape chunks are written directly, copy its last chunk
+ * the usual way. */
+static int
+extend_output_var(int igrp, int varid, int ogrp, int ovarid, const size_t *chunks)
+{
+    int ndims, dim;
+    int *dimids;
+    size_t *start, *count;
+    size_t nvals = 1;
+    void *buf;
+
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    if(ndims == 0 || !isrecvar(ogrp, ovarid))
+	return NC_NOERR;
+    dimids = (int *) emalloc(ndims * sizeof(int));
+    start = (size_t *) emalloc(2 * ndims * sizeof(size_t));
+    count = start + ndims;
+    NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+    for(dim = 0; dim < ndims; dim++) {
+	size_t len;
+	NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &len));
+	start[dim] = len > 0 ? (len - 1) / chunks[dim] * chunks[dim] : 0;
+	count[dim] = len - start[dim];
+	nvals *= count[dim];
+    }
+    if(nvals > 0) {
+	buf = emalloc(nvals * val_size(igrp, varid));
+	NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
+	NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, buf));
+	free(buf);
+    }
+    free(dimids);
+    free(start);
+    return NC_NOERR;
+}
+
+/* Copy the data of a variable for which can_copy_chunks_raw() is
+ * true, moving the stored chunk bytes from input to output.  Chunks
+ * that were never written in the input are not written in the
+ * output either.  Returns NC_ENOTBUILT, before any chunk is copied,
+ * if the library has no raw chunk access. */
+static int
+copy_var_chunks_raw(int igrp, int varid, int ogrp, int ovarid)
+{
+    int stat = NC_NOERR;
+    int ndims, dim;
+    int *dimids;
+    size_t *dimlens, *chunks, *offsets;
+    void *buf = NULL;
+    size_t bufsize = 0;
+
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    dimids = (int *) emalloc(ndims * sizeof(int));
+    dimlens = (size_t *) emalloc(ndims * sizeof(size_t));
+    chunks = (size_t *) emalloc(ndims * sizeof(size_t));
+    offsets = (size_t *) emalloc(ndims * sizeof(size_t));
+    NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+    NC_CHECK(nc_inq_var_chunking(igrp, varid, NULL, chunks));
+    for(dim = 0; dim < ndims; dim++) {
+	NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &dimlens[dim]));
+	offsets[dim] = 0;
+    }
+    /* the raw copy below replaces the last chunk if it is stored */
+    NC_CHECK(extend_output_var(igrp, varid, ogrp, ovarid, chunks));
+    /* visit each chunk in the input, last dimension fastest */
+    for(;;) {
+	unsigned int mask;
+	size_t size;
+	if((stat = nc_get_var_chunk_raw(igrp, varid, offsets, &mask, &size, NULL)))
+	    goto done;
+	if(size > 0) {
+	    if(size > bufsize) {
+		free(buf);
+		buf = emalloc(size);
+		bufsize = size;
+	    }
+	    NC_CHECK(nc_get_var_chunk_raw(igrp, varid, offsets, &mask, &size, buf));
+	    NC_CHECK(nc_put_var_chunk_raw(ogrp, ovarid, offsets, mask, size, buf));
+	}
+	for(dim = ndims - 1; dim >= 0; dim--) {
+	    offsets[dim] += chunks[dim];
+	    if(offsets[dim] < dimlens[dim])
+		break;
+	    offsets[dim] = 0;
+	}
+	if(dim < 0)
+	    break;
+    }
+done:
+    free(buf);
+    free(dimids);
+    free(dimlens);
+    free(chunks);
+    free(offsets);
+    return stat;
+}
+
+/* With nccopy -t, the library compresses the chunks of an output
+ * variable under its lock, one at a time. Decide whether the workers
+ * can store them themselves instead (see copypool_encode_t): the
+ * output is a chunked netCDF-4 variable of the input's fixed size
+ * atomic type in native byte order, and its only filters are shuffle
+ * and deflate. If so, make the output variable as long as the input
+ * one, fill in *enc and set *encodedp; enc->chunks shares the
+ * allocation of enc->dims, which the caller frees. */
+static int
+chunk_encoding(int igrp, int varid, int ogrp, int ovarid,
+	       copypool_encode_t *enc, int *encodedp)
+{
+    int stat = NC_NOERR;
+    int one = 1;
+    int native = *(char *)&one ? NC_ENDIAN_LITTLE : NC_ENDIAN_BIG;
+    int omodel, ndims, contig, endian, fletcher32, shuffle, dim;
+    int *dimids;
+    nc_type itype, otype;
+    size_t nfilters, k, size;
+    size_t *dims, *offsets;
+    unsigned int *ids, mask;
+
+    *encodedp = 0;
+    memset(enc, 0, sizeof(*enc));
+#ifndef HAVE_ZLIB_H
+    return stat;		/* the workers cannot deflate */
+#endif
+    if(copypool_nthreads() == 0)
+	return stat;
+    NC_CHECK(nc_inq_format_extended(ogrp, &omodel, NULL));
+    if(omodel != NC_FORMATX_NC4)
+	return stat;
+    NC_CHECK(nc_inq_vartype(igrp, varid, &itype));
+    NC_CHECK(nc_inq_vartype(ogrp, ovarid, &otype));
+    if(itype != otype || otype > NC_MAX_ATOMIC_TYPE || otype == NC_STRING)
+	return stat;
+    NC_CHECK(nc_inq_var_endian(ogrp, ovarid, &endian));
+    if(endian != NC_ENDIAN_NATIVE && endian != native)
+	return stat;
+    NC_CHECK(nc_inq_varndims(ogrp, ovarid, &ndims));
+    if(ndims == 0)
+	return stat;
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &contig, NULL));
+    NC_CHECK(nc_inq_var_fletcher32(ogrp, ovarid, &fletcher32));
+    if(contig != NC_CHUNKED || fletcher32)
+	return stat;
+    /* HDF5 applies shuffle before the other filters */
+    NC_CHECK(nc_inq_var_deflate(ogrp, ovarid, &shuffle, NULL, NULL));
+    if(shuffle)
+	enc->steps[enc->nsteps++] = COPYPOOL_SHUFFLE;
+    NC_CHECK(nc_inq_var_filterids(ogrp, ovarid, &nfilters, NULL));
+    if(nfilters == 0 || nfilters + (size_t)enc->nsteps > COPYPOOL_MAX_STEPS)
+	return stat;
+    ids = (unsigned int *) emalloc(nfilters * sizeof(unsigned int));
+    NC_CHECK(nc_inq_var_filterids(ogrp, ovarid, &nfilters, ids));
+    for(k = 0; k < nfilters; k++) {
+	size_t nparams;
+	unsigned int level;
+	if(ids[k] != H5Z_FILTER_DEFLATE)
+	    break;
+	NC_CHECK(nc_inq_var_filter_info(ogrp, ovarid, ids[k], &nparams, NULL));
+	if(nparams != 1)
+	    break;
+	NC_CHECK(nc_inq_var_filter_info(ogrp, ovarid, ids[k], NULL, &level));
+	enc->steps[enc->nsteps] = COPYPOOL_DEFLATE;
+	enc->levels[enc->nsteps++] = (int)level;
+    }
+    free(ids);
+    if(k < nfilters)
+	return stat;
+
+    dimids = (int *) emalloc(ndims * sizeof(int));
+    dims = (size_t *) emalloc(3 * ndims * sizeof(size_t));
+    offsets = dims + 2 * ndims;
+    NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+    for(dim = 0; dim < ndims; dim++) {
+	NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &dims[dim]));
+	if(dims[dim] == 0)
+	    goto done;
+	offsets[dim] = 0;
+    }
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, NULL, dims + ndims));
+    NC_CHECK(extend_output_var(igrp, varid, ogrp, ovarid, dims + ndims));
+    /* Is there raw chunk access at all? */
+    stat = nc_get_var_chunk_raw(ogrp, ovarid, offsets, &mask, &size, NULL);
+    if(stat == NC_ENOTBUILT) {
+	stat = NC_NOERR;
+	goto done;
+    }
+    NC_CHECK(stat);
+    enc->dims = dims;
+    enc->chunks = dims + ndims;
+    enc->value_size = val_size(ogrp, ovarid);
+    *encodedp = 1;
+    dims = NULL;
+done:
+    free(dimids);
+    free(dims);
+    return stat;
+}
+#endif	/* USE_NETCDF4 */
+
+#ifdef USE_NETCDF4
+/* If output variable ovarid is chunked differently from input
+ * variable varid, copy it in the blocks of a rechunking plan, which
+ * reads each input chunk and writes each output chunk once within
+ * the copy buffer size (see rechunk.h), and set *donep. A contiguous
+ * input variable can be read in any shape, so it counts as having
+ * chunks of one value. */
+static int
+copy_var_rechunked(int igrp, int varid, int ogrp, int ovarid, int *donep)
+{
+    int stat = NC_NOERR;
+    int ndims, dim, same;
+    int icontig = NC_CONTIGUOUS, ocontig = NC_CONTIGUOUS;
+    int *dimids;
+    size_t *dims, *ichunks, *ochunks;
+    size_t budget = option_copy_buffer_size;
+    rechunk_plan_t plan;
+
+    *donep = 0;
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    if(ndims == 0)
+	return stat;
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, NULL));
+    if(ocontig != NC_CHUNKED)
+	return stat;
+    dimids = (int *) emalloc(ndims * sizeof(int));
+    dims = (size_t *) emalloc(3 * ndims * sizeof(size_t));
+    ichunks = dims + ndims;
+    ochunks = ichunks + ndims;
+    NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+    for(dim = 0; dim < ndims; dim++) {
+	NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &dims[dim]));
+	ichunks[dim] = 1;
+    }
+    NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, NULL));
+    if(icontig == NC_CHUNKED)
+	NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, ichunks));
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, ochunks));
+    same = (icontig == NC_CHUNKED);
+    for(dim = 0; dim < ndims; dim++)
+	if(ichunks[dim] != ochunks[dim])
+	    same = 0;
+    if(!same) {
+	copypool_encode_t enc;
+	int encoded;
+	/* each worker of nccopy -t holds a block */
+	if(copypool_nthreads() > 0)
+	    budget /= (size_t)copypool_nthreads();
+	NC_CHECK(rechunk_plan(ndims, dims, ichunks, ochunks,
+			      val_size(igrp, varid), budget, &plan));
+	NC_CHECK(chunk_encoding(igrp, varid, ogrp, ovarid, &enc, &encoded));
+	stat = rechunk_copy(igrp, varid, ogrp, ovarid, &plan, rechunk_tmpbase,
+			    encoded ? &enc : NULL);
+	rechunk_plan_free(&plan);
+	if(encoded)
+	    free((size_t *)enc.dims);
+	NC_CHECK(stat);
+	*donep = 1;
+    }
+    free(dimids);
+    free(dims);
+    return stat;
+}
+#endif	/* USE_NETCDF4 */
+
 /* Copy data from variable varid in group igrp to corresponding group
  * ogrp. */
 static int
@@ -1539,6 +1911,8 @@ copy_var_data(int igrp, int varid, int ogrp) {
     size_t *count;
     nciter_t *iterp;		/* opaque structure for iteration status */
     int do_realloc = 0;
+    size_t iter_size;		/* bytes of values to access per iteration */
+    int freekind = COPYPOOL_FREE_NONE;
 #ifdef USE_NETCDF4
     int okind;
     size_t chunksize;
@@ -1551,6 +1925,17 @@ copy_var_data(int igrp, int varid, int ogrp) {
     NC_CHECK(nc_inq_varname(igrp, varid, varname));
     NC_CHECK(nc_inq_varid(ogrp, varname, &ovarid));
     NC_CHECK(nc_inq_vartype(igrp, varid, &vartype));
+#ifdef USE_NETCDF4
+    /* Unchanged chunks are copied as stored, skipping the filters. */
+    if(can_copy_chunks_raw(igrp, varid, ogrp, ovarid)) {
+	stat = copy_var_chunks_raw(igrp, varid, ogrp, ovarid);
+	if(stat != NC_ENOTBUILT) {
+	    NC_CHECK(stat);
+	    return stat;
+	}
+	stat = NC_NOERR;	/* no raw chunk access, copy values */
+    }
+#endif	/* USE_NETCDF4 */
     value_size = val_size(igrp, varid);
     if(value_size > option_copy_buffer_size) {
 	option_copy_buffer_size = value_size;
@@ -1595,7 +1980,56 @@ copy_var_data(int igrp, int varid, int ogrp) {
 	    do_realloc = 1;
 	}
     }
+    /* A variable that changes chunk shape is copied in planned blocks */
+    if(vartype <= NC_MAX_ATOMIC_TYPE && vartype != NC_STRING) {
+	int done = 0;
+	NC_CHECK(copy_var_rechunked(igrp, varid, ogrp, ovarid, &done));
+	if(done)
+	    return stat;
+    }
+    /* we have to explicitly free values for strings and vlens */
+    if(vartype == NC_STRING) {
+	freekind = COPYPOOL_FREE_STRINGS;
+    } else if(vartype > NC_STRING) { /* user-defined type */
+	nc_type vclass;
+	NC_CHECK(nc_inq_user_type(igrp, vartype, NULL, NULL, NULL, NULL, &vclass));
+	if(vclass == NC_VLEN)
+	    freekind = COPYPOOL_FREE_VLENS;
+    }
+#endif	/* USE_NETCDF4 */
+
+    if(copypool_nthreads() > 0) {
+	copypool_encode_t enc;
+	int encoded = 0;
+	/* Each worker holds one piece, so split the copy buffer
+	 * between them, but a piece is never smaller than a value or
+	 * an input chunk. */
+	iter_size = option_copy_buffer_size / (size_t)copypool_nthreads();
+	if(iter_size < value_size)
+	    iter_size = value_size;
+#ifdef USE_NETCDF4
+	if(iter_size < chunksize)
+	    iter_size = chunksize;
+#endif	/* USE_NETCDF4 */
+#ifdef USE_NETCDF4
+	NC_CHECK(chunk_encoding(igrp, varid, ogrp, ovarid, &enc, &encoded));
 #endif	/* USE_NETCDF4 */
+	NC_CHECK(nc_get_iter(igrp, varid, iter_size, &iterp));
+	start = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
+	count = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
+	while((ntoget = nc_next_iter(iterp, start, count)) > 0) {
+	    NC_CHECK(copypool_submit(igrp, varid, ogrp, ovarid, iterp->rank,
+				     start, count, ntoget, ntoget * value_size,
+				     freekind, encoded ? &enc : NULL));
+	}
+	if(encoded)
+	    free((size_t *)enc.dims);
+	free(start);
+	free(count);
+	NC_CHECK(nc_free_iter(iterp));
+	return stat;
+    }
+
     if(buf && do_realloc) {
 	free(buf);
 	buf = 0;
@@ -1617,15 +2051,10 @@ copy_var_data(int igrp, int varid, int ogrp) {
 	NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
 	NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, buf));
 #ifdef USE_NETCDF4
-	/* we have to explicitly free values for strings and vlens */
-	if(vartype == NC_STRING) {
+	if(freekind == COPYPOOL_FREE_STRINGS) {
 	    NC_CHECK(nc_free_string(ntoget, (char **)buf));
-	} else if(vartype > NC_STRING) { /* user-defined type */
-	    nc_type vclass;
-	    NC_CHECK(nc_inq_user_type(igrp, vartype, NULL, NULL, NULL, NULL, &vclass));
-	    if(vclass == NC_VLEN) {
-		NC_CHECK(nc_free_vlens(ntoget, (nc_vlen_t *)buf));
-	    }
+	} else if(freekind == COPYPOOL_FREE_VLENS) {
+	    NC_CHECK(nc_free_vlens(ntoget, (nc_vlen_t *)buf));
 	}
 #endif	/* USE_NETCDF4 */
     } /* end main iteration loop */
@@ -1766,6 +2195,30 @@ nc3_special_case(int ncid, int kind) {
     return 0;
 }
 
+/* Between classic format files, copy all the data as stored, with
+ * no conversion to and from native values. Not done with -v or -V,
+ * where only some variables get their data. Returns 1 if the data was
+ * copied, 0 if the variables differ in a way that needs the usual
+ * value-by-value copy. */
+static int
+copy_data_raw(int igrp, int inkind, int ogrp, int outkind)
+{
+    int stat;
+    if(!(inkind == NC_FORMAT_CLASSIC || inkind == NC_FORMAT_64BIT_OFFSET
+	 || inkind == NC_FORMAT_CDF5))
+	return 0;
+    if(!(outkind == NC_FORMAT_CLASSIC || outkind == NC_FORMAT_64BIT_OFFSET
+	 || outkind == NC_FORMAT_CDF5))
+	return 0;
+    if(option_nlvars > 0)
+	return 0;
+    stat = nc_copy_data_raw(igrp, ogrp);
+    if(stat == NC_EINVAL)
+	return 0;
+    NC_CHECK(stat);
+    return 1;
+}
+
 /* Classify variables in ncid as either fixed-size variables (with no
  * unlimited dimension) or as record variables (with an unlimited
  * dimension) */
@@ -1852,12 +2305,22 @@ copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
     size_t ivar;
     void **buf;			/* space for reading in data for each variable */
     int *rec_ovarids;		/* corresponding varids in output */
+    int *rec_ndims;		/* ranks of record variables */
+    size_t *rec_nvals;		/* values in one record of each variable */
+    size_t *rec_value_size;	/* bytes per value of each variable */
+    copypool_encode_t *rec_enc;	/* with -t, how workers store chunks */
+    int *rec_encoded;
     size_t **start;
     size_t **count;
     NC_CHECK(nc_inq_unlimdim(ncid, &unlimid));
     NC_CHECK(nc_inq_dimlen(ncid, unlimid, &nrecs));
     buf = (void **) emalloc(nrec_vars * sizeof(void *));
     rec_ovarids = (int *) emalloc(nrec_vars * sizeof(int));
+    rec_ndims = (int *) emalloc(nrec_vars * sizeof(int));
+    rec_nvals = (size_t *) emalloc(nrec_vars * sizeof(size_t));
+    rec_value_size = (size_t *) emalloc(nrec_vars * sizeof(size_t));
+    rec_enc = (copypool_encode_t *) emalloc(nrec_vars * sizeof(copypool_encode_t));
+    rec_encoded = (int *) emalloc(nrec_vars * sizeof(int));
     start = (size_t **) emalloc(nrec_vars * sizeof(size_t*));
     count = (size_t **) emalloc(nrec_vars * sizeof(size_t*));
     /* get space to hold one record's worth of data for each record variable */
@@ -1888,9 +2351,18 @@ copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
 	}
 	start[ivar][0] = 0;
 	count[ivar][0] = 1;	/* 1 record */
-	buf[ivar] = (void *) emalloc(nvals * value_size);
+	rec_ndims[ivar] = ndims;
+	rec_nvals[ivar] = nvals;
+	rec_value_size[ivar] = value_size;
+	/* with -t the workers have buffers of their own */
+	buf[ivar] = copypool_nthreads() > 0 ? NULL : (void *) emalloc(nvals * value_size);
 	NC_CHECK(nc_inq_varname(ncid, varid, varname));
 	NC_CHECK(nc_inq_varid(ogrp, varname, &rec_ovarids[ivar]));
+	rec_encoded[ivar] = 0;
+#ifdef USE_NETCDF4
+	NC_CHECK(chunk_encoding(ncid, varid, ogrp, rec_ovarids[ivar],
+				&rec_enc[ivar], &rec_encoded[ivar]));
+#endif	/* USE_NETCDF4 */
 	if(dimids)
 	    free(dimids);
     }
@@ -1902,6 +2374,25 @@ copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
 	    varid = rec_varids[ivar];
 	    ovarid = rec_ovarids[ivar];
 	    start[ivar][0] = irec;
+	    if(copypool_nthreads() > 0) {
+		size_t nrecs_piece = 1;
+		/* a worker can only store whole chunks, so give it the
+		 * records of a chunk together */
+		if(rec_encoded[ivar]) {
+		    size_t recs_chunk = rec_enc[ivar].chunks[0];
+		    if(irec % recs_chunk != 0)
+			continue;
+		    nrecs_piece = nrecs - irec < recs_chunk ? nrecs - irec : recs_chunk;
+		}
+		count[ivar][0] = nrecs_piece;
+		NC_CHECK(copypool_submit(ncid, varid, ogrp, ovarid, rec_ndims[ivar],
+					 start[ivar], count[ivar],
+					 nrecs_piece * rec_nvals[ivar],
+					 nrecs_piece * rec_nvals[ivar] * rec_value_size[ivar],
+					 COPYPOOL_FREE_NONE,
+					 rec_encoded[ivar] ? &rec_enc[ivar] : NULL));
+		continue;
+	    }
 	    NC_CHECK(copy_rec_var_data(ncid, ogrp, irec, varid, ovarid,
 				       start[ivar], count[ivar], buf[ivar]));
 	}
@@ -1927,6 +2418,15 @@ copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
 	free(buf);
     if(rec_ovarids)
 	free(rec_ovarids);
+    for (ivar = 0; ivar < nrec_vars; ivar++) {
+	if(rec_encoded[ivar])
+	    free((size_t *)rec_enc[ivar].dims);
+    }
+    free(rec_ndims);
+    free(rec_nvals);
+    free(rec_value_size);
+    free(rec_enc);
+    free(rec_encoded);
     return NC_NOERR;
 }
 
@@ -1950,6 +2450,18 @@ copy(char* infile, char* outfile)
 
     NC_CHECK(nc_inq_format(igrp, &inkind));
 
+    /* With -t, a classic input file can be read by all the workers at
+     * once if it is opened with NC_CONCURRENT, where supported. */
+    if(copypool_nthreads() > 1 && !option_read_diskless
+       && (inkind == NC_FORMAT_CLASSIC || inkind == NC_FORMAT_64BIT_OFFSET
+	   || inkind == NC_FORMAT_CDF5)) {
+	int cgrp;
+	if(nc_open(infile, open_mode | NC_CONCURRENT, &cgrp) == NC_NOERR) {
+	    NC_CHECK(nc_close(igrp));
+	    igrp = cgrp;
+	}
+    }
+
 /* option_kind specifies which netCDF format for output, one of
  *
  *     SAME_AS_INPUT, NC_FORMAT_CLASSIC, NC_FORMAT_64BIT,
@@ -2035,6 +2547,9 @@ copy(char* infile, char* outfile)
 	break;
     }
     NC_CHECK(nc_create(outfile, create_mode, &ogrp));
+    rechunk_tmpbase = (char *) emalloc(strlen(outfile) + strlen(".rechunk") + 1);
+    strcpy(rechunk_tmpbase, outfile);
+    strcat(rechunk_tmpbase, ".rechunk");
     NC_CHECK(nc_set_fill(ogrp, NC_NOFILL, NULL));
 
 #ifdef USE_NETCDF4
@@ -2055,7 +2570,9 @@ copy(char* infile, char* outfile)
      * variables, to copy a record-at-a-time instead of a
      * variable-at-a-time. */
     /* TODO: check that these special cases work with -v option */
-    if(nc3_special_case(igrp, inkind)) {
+    if(copy_data_raw(igrp, inkind, ogrp, outkind)) {
+	/* copied as stored, nothing left to do */
+    } else if(nc3_special_case(igrp, inkind)) {
 	size_t nfixed_vars, nrec_vars;
 	int *fixed_varids;
 	int *rec_varids;
@@ -2073,9 +2590,13 @@ copy(char* infile, char* outfile)
     } else {
 	NC_CHECK(copy_data(igrp, ogrp)); /* recursive, to handle nested groups */
     }
+    /* With -t, wait for the workers to finish writing */
+    NC_CHECK(copypool_wait());
 
     NC_CHECK(nc_close(igrp));
     NC_CHECK(nc_close(ogrp));
+    free(rechunk_tmpbase);
+    rechunk_tmpbase = NULL;
     return stat;
 }
 
@@ -2139,6 +2660,7 @@ usage(void)
   [-g grp1,...] include data for only variables in listed groups, but all definitions\n\
   [-G grp1,...] include definitions and data only for variables in listed groups\n\
   [-m n]    set size in bytes of copy buffer, default is 5000000 bytes\n\
+  [-t n]    copy data with n threads (needs a thread-safe netCDF library)\n\
   [-h n]    set size in bytes of chunk_cache for chunked variables\n\
   [-e n]    set number of elements that chunk_cache can hold\n\
   [-r]      read whole input file into diskless file on open (classic or 64-bit offset or cdf5 formats only)\n\
@@ -2152,7 +2674,7 @@ usage(void)
     /* [-x]      use experimental computed estimates for variable-specific chunk caches\n\ */
 
 
-    error("%s [-k kind] [-[3|4|6|7]] [-d n] [-s] [-c chunkspec] [-u] [-w] [-[v|V] varlist] [-[g|G] grplist] [-m n] [-h n] [-e n] [-r] [-F filterspec] [-Ln] [-Mn] infile outfile\n%s\nnetCDF library version %s",
+    error("%s [-k kind] [-[3|4|6|7]] [-d n] [-s] [-c chunkspec] [-u] [-w] [-[v|V] varlist] [-[g|G] grplist] [-m n] [-t n] [-h n] [-e n] [-r] [-F filterspec] [-Ln] [-Mn] infile outfile\n%s\nnetCDF library version %s",
 	  progname, USAGE, nc_inq_libvers());
 
 }
@@ -2176,7 +2698,7 @@ main(int argc, char**argv)
        usage();
     }
 
-    while ((c = getopt(argc, argv, "k:3467d:sum:c:h:e:rwxg:G:v:V:F:L:M:")) != -1) {
+    while ((c = getopt(argc, argv, "k:3467d:sum:t:c:h:e:rwxg:G:v:V:F:L:M:")) != -1) {
 	switch(c) {
         case 'k': /* for specifying variant of netCDF format to be generated
                      Format names:
@@ -2242,6 +2764,11 @@ main(int argc, char**argv)
 	    option_copy_buffer_size = dval;
 	    break;
 	}
+	case 't':		/* number of threads to copy data with */
+	    option_nthreads = atoi(optarg);
+	    if(option_nthreads < 1)
+		error("invalid number of threads: %s", optarg);
+	    break;
 	case 'h':		/* non-default size of chunk cache */
 	{
 	    double dval = double_with_suffix(optarg);	/* "K" for kilobytes. "M" for megabytes, ... */
@@ -2366,8 +2893,17 @@ main(int argc, char**argv)
 #endif /*DEBUGFILTER*/
 #endif /*USE_NETCDF4*/
 
+    if(option_nthreads > 1) {
+	int stat = copypool_start(option_nthreads);
+	if(stat == NC_ENOTBUILT)
+	    fprintf(stderr, "%s: -t ignored, netCDF library is not thread-safe\n", progname);
+	else
+	    NC_CHECK(stat);
+    }
+
     if(copy(inputfile, outputfile) != NC_NOERR)
         exitcode = EXIT_FAILURE;
+    copypool_stop();
 
 #ifdef USE_NETCDF4
     /* Clean up */
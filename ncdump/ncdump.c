@@ -45,6 +45,7 @@ int optind;
 #include "dumplib.h"
 #include "ncdump.h"
 #include "vardata.h"
+#include "dumppool.h"
 #include "indent.h"
 #include "isnan.h"
 #include "cdl.h"
@@ -63,6 +64,8 @@ extern int nc__testurl(const char*,char**);
 
 #define XML_VERSION "1.0"
 
+#define OUTPUT_BUFSIZE (1 << 20)	/* stdout buffer, when not a terminal */
+
 #define int64_t long long
 #define uint64_t unsigned long long
 
@@ -129,11 +132,12 @@ usage(void)
   [-w]             With client-side caching of variables for DAP URLs\n\
   [-x]             Output XML (NcML) instead of CDL\n\
   [-Xp]            Unconditionally suppress output of the properties attribute\n\
+  [-j n]           Read and format data with n threads\n\
   [-Ln]            Set log level to n (>= 0); ignore if logging not enabled.\n\
   file             Name of netCDF file (or URL if DAP access enabled)\n"
 
     (void) fprintf(stderr,
-		   "%s [-c|-h] [-v ...] [[-b|-f] [c|f]] [-l len] [-n name] [-p n[,n]] [-k] [-x] [-s] [-t|-i] [-g ...] [-w] [-Ln] file\n%s",
+		   "%s [-c|-h] [-v ...] [[-b|-f] [c|f]] [-l len] [-n name] [-p n[,n]] [-k] [-x] [-s] [-t|-i] [-g ...] [-w] [-j n] [-Ln] file\n%s",
 		   progname,
 		   USAGE);
 
@@ -2182,6 +2186,7 @@ main(int argc, char *argv[])
     bool_t kind_out = false;	/* if true, just output kind of netCDF file */
     bool_t kind_out_extended = false;	/* output inq_format vs inq_format_extended */
     int Xp_flag = 0;    /* indicate that -Xp flag was set */
+    int nthreads = 1;	/* threads to read and format data with */
     char* path = NULL;
     char errmsg[4096];
 
@@ -2197,6 +2202,12 @@ main(int argc, char *argv[])
     opterr = 1;
     progname = argv[0];
     set_formats(FLT_DIGITS, DBL_DIGITS); /* default for float, double data */
+#ifdef HAVE_UNISTD_H
+    /* Data is written a value at a time, so use a big buffer unless
+     * someone is watching */
+    if (!isatty(fileno(stdout)))
+	setvbuf(stdout, NULL, _IOFBF, OUTPUT_BUFSIZE);
+#endif
 
     /* If the user called ncdump without arguments, print the usage
      * message and return peacefully. */
@@ -2206,7 +2217,7 @@ main(int argc, char *argv[])
        exit(EXIT_SUCCESS);
     }
 
-    while ((c = getopt(argc, argv, "b:cd:f:g:hikl:n:p:stv:xwKL:X:")) != EOF)
+    while ((c = getopt(argc, argv, "b:cd:f:g:hij:kl:n:p:stv:xwKL:X:")) != EOF)
       switch(c) {
 	case 'h':		/* dump header only, no data */
 	  formatting_specs.header_only = true;
@@ -2294,6 +2305,13 @@ main(int argc, char *argv[])
 			     * _Format, _Checksum, _NoFill */
 	  formatting_specs.special_atts = true;
 	  break;
+        case 'j':		/* number of threads to format data with */
+	  nthreads = atoi(optarg);
+	  if (nthreads < 1) {
+	      snprintf(errmsg,sizeof(errmsg),"invalid number of threads: %s", optarg);
+	      goto fail;
+	  }
+	  break;
         case 'w':		/* with client-side cache for DAP URLs */
 	  formatting_specs.with_cache = true;
 	  break;
@@ -2351,6 +2369,15 @@ main(int argc, char *argv[])
 
     init_epsilons();
 
+    if (nthreads > 1) {
+	ncstat = dumppool_start(nthreads);
+	if (ncstat == NC_ENOTBUILT)
+	    fprintf(stderr, "%s: -j ignored, netCDF library is not thread-safe\n", progname);
+	else if (ncstat != NC_NOERR)
+	    goto fail;
+	ncstat = NC_NOERR;
+    }
+
     path = strdup(argv[i]);
     if(!path) {
 	snprintf(errmsg,sizeof(errmsg),"out of memory copying argument %s", argv[i]);
@@ -2418,6 +2445,7 @@ main(int argc, char *argv[])
 	    }
 	    NC_CHECK( nc_close(ncid) );
     }
+    dumppool_stop();
     if(path) {free(path); path = NULL;}
     exit(EXIT_SUCCESS);
 
@@ -0,0 +1,632 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/*
+ * ncfilterbench: try chains of filters on a sample of the chunks of
+ * each variable of a netCDF file, print the compression ratio and the
+ * encode and decode speeds of each chain, and print the nccopy -F and
+ * -c options that give each variable the best chain for a target.
+ *
+ * - The sample is up to -n whole chunks, spread evenly over the
+ *   variable, of its chunk shape, or for variables that are not
+ *   chunked, of the shape the library would choose.
+ * - Each chain is tried by writing the sample, one chunk per sample,
+ *   to a scratch netCDF-4 file in $TMPDIR with nc_def_var_filter(),
+ *   and reading it back. The time to write the data and close the
+ *   file, and to read the data, gives the encode and decode speeds;
+ *   the best of -r runs is kept. The size of the file less what the
+ *   file takes besides the data when the sample is not filtered
+ *   gives the compressed size.
+ * - Chains whose filters are not available, because HDF5 cannot find
+ *   their plugins, are reported as such and skipped. Chains that do
+ *   not give back the same values, such as quantize, are marked lossy,
+ *   and are only chosen as the best with -L.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+#include <string.h>
+#include <sys/stat.h>
+#include "netcdf.h"
+#include "netcdf_filter.h"
+#include "utils.h"
+
+#ifdef _MSC_VER
+#include "XGetopt.h"
+int opterr;
+int optind;
+#endif
+
+#define MEGABYTE 1000000.0
+
+/* Tried when no -f is given. Those whose plugins are not found are
+ * reported as not available. */
+static const char *default_chains[] = {
+    "none",
+    "deflate,1", "deflate,5", "deflate,9",
+    "shuffle|deflate,1", "shuffle|deflate,5", "shuffle|deflate,9",
+    "bzip2,9",
+    "blockshuffle|deflate,1", "blockshuffle|zstd,3", "blockshuffle|zstd,9",
+    "zstd,3", "blockshuffle,1|lz4", "lz4",
+    NULL
+};
+
+char *progname;
+static char scratch[4096];		/* the file the chains are tried in */
+static int nscratch = 0;
+
+static int option_nsamples = 8;		/* -n */
+static int option_reps = 3;		/* -r */
+static double option_min_decode = 0;	/* -d, MB/s */
+static double option_min_encode = 0;	/* -e, MB/s */
+static double option_min_ratio = 0;	/* -R */
+static int option_speed = 0;		/* -t speed */
+static int option_lossy = 0;		/* -L */
+
+/* A chain of filters to try */
+typedef struct Chain {
+    const char *spec;
+    size_t nfilters;
+    NC4_Filterspec **filters;
+} Chain;
+
+/* What a chain did with the sample of a variable */
+typedef struct Result {
+    int available;
+    int exact;			/* the values came back */
+    double ratio;
+    double encode;		/* MB/s */
+    double decode;
+} Result;
+
+/* A variable and its sample */
+typedef struct Bvar {
+    char *path;			/* as nccopy names it */
+    int grpid, varid;
+    nc_type type;
+    size_t size;		/* of a value */
+    int rank;
+    size_t dims[NC_MAX_VAR_DIMS];
+    size_t chunks[NC_MAX_VAR_DIMS];
+    size_t counts[NC_MAX_VAR_DIMS];	/* of a sample: chunks, less any that do not fit */
+    size_t nsamples;
+    size_t bytes;		/* of a sample */
+    unsigned char *data;	/* the samples, one after another */
+    unsigned char *back;	/* what was read back */
+} Bvar;
+
+/* Move on to a new scratch file. One a chain failed in may be left
+ * open by HDF5. */
+static void
+next_scratch(void)
+{
+    const char *tmpdir = getenv("TMPDIR");
+    int pid = 0;
+
+    if(nscratch > 0)
+	remove(scratch);
+#ifdef HAVE_UNISTD_H
+    pid = (int)getpid();
+#endif
+    if(tmpdir == NULL || *tmpdir == '\0')
+	tmpdir = "/tmp";
+    snprintf(scratch, sizeof(scratch), "%s/ncfilterbench%d_%d.nc", tmpdir, pid, nscratch++);
+}
+
+static double
+now(void)
+{
+#ifdef HAVE_SYS_TIME_H
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec * 1e-6;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static void
+parse_chain(const char *spec, Chain *c)
+{
+    int format;
+
+    memset(c, 0, sizeof(Chain));
+    c->spec = spec;
+    if(strcmp(spec, "none") == 0)
+	return;
+    if(NC_parsefilterlist(spec, &format, &c->nfilters, (NC_Filterspec ***)&c->filters) != NC_NOERR
+       || format != NC_FILTER_FORMAT_HDF5)
+	error("invalid filter chain: %s", spec);
+}
+
+static void
+free_chain(Chain *c)
+{
+    size_t i;
+    for(i = 0; i < c->nfilters; i++) {
+	free(c->filters[i]->params);
+	free(c->filters[i]);
+    }
+    free(c->filters);
+}
+
+/* Copy name into out with nccopy's escapes, and return the end */
+static char *
+escape(char *out, const char *name)
+{
+    for(; *name; name++) {
+	if(strchr("\\,|: ", *name) != NULL)
+	    *out++ = '\\';
+	*out++ = *name;
+    }
+    *out = '\0';
+    return out;
+}
+
+/* The chunk shape the library gives the variable when it is
+ * compressed, for variables that are not chunked. */
+static int
+default_chunks(Bvar *v, int dimids[])
+{
+    int stat, ncid, varid, d, i;
+    int ids[NC_MAX_VAR_DIMS];
+    int nunlims, unlims[NC_MAX_DIMS];
+    unsigned int level = 1;
+    int storage;
+
+    if((stat = nc_inq_unlimdims(v->grpid, &nunlims, unlims)))
+	return stat;
+    if((stat = nc_create(scratch, NC_NETCDF4|NC_CLOBBER, &ncid)))
+	return stat;
+    for(d = 0; d < v->rank; d++) {
+	char name[NC_MAX_NAME + 1];
+	size_t len = v->dims[d];
+	for(i = 0; i < nunlims; i++)
+	    if(unlims[i] == dimids[d])
+		len = NC_UNLIMITED;
+	snprintf(name, sizeof(name), "d%d", d);
+	if((stat = nc_def_dim(ncid, name, len, &ids[d])))
+	    goto done;
+    }
+    if((stat = nc_def_var(ncid, "v", v->type, v->rank, ids, &varid)))
+	goto done;
+    if((stat = nc_def_var_filter(ncid, varid, H5Z_FILTER_DEFLATE, 1, &level)))
+	goto done;
+    stat = nc_inq_var_chunking(ncid, varid, &storage, v->chunks);
+done:
+    nc_abort(ncid);
+    return stat;
+}
+
+/* Choose the sample of a variable and read it. Return 0 if the
+ * variable cannot be filtered or read. */
+static int
+read_sample(Bvar *v)
+{
+    int dimids[NC_MAX_VAR_DIMS];
+    int storage, d, stat;
+    size_t nfull[NC_MAX_VAR_DIMS];
+    size_t total = 1, k;
+
+    if(nc_inq_var(v->grpid, v->varid, NULL, &v->type, &v->rank, dimids, NULL))
+	return 0;
+    /* Only variables of numbers can be filtered here */
+    if(v->rank == 0 || v->type < NC_BYTE || v->type > NC_UINT64 || v->type == NC_CHAR)
+	return 0;
+    NC_CHECK(nc_inq_type(v->grpid, v->type, NULL, &v->size));
+    for(d = 0; d < v->rank; d++) {
+	NC_CHECK(nc_inq_dimlen(v->grpid, dimids[d], &v->dims[d]));
+	if(v->dims[d] == 0)
+	    return 0;
+    }
+    NC_CHECK(nc_inq_var_chunking(v->grpid, v->varid, &storage, v->chunks));
+    if(storage != NC_CHUNKED && (stat = default_chunks(v, dimids))) {
+	next_scratch();
+	fprintf(stderr, "%s: %s: %s\n", progname, v->path, nc_strerror(stat));
+	return 0;
+    }
+
+    /* Whole chunks, spread evenly */
+    v->bytes = v->size;
+    for(d = 0; d < v->rank; d++) {
+	v->counts[d] = v->chunks[d];
+	nfull[d] = v->dims[d] / v->chunks[d];
+	if(nfull[d] == 0) {
+	    v->counts[d] = v->dims[d];
+	    nfull[d] = 1;
+	}
+	total *= nfull[d];
+	v->bytes *= v->counts[d];
+    }
+    v->nsamples = (total < (size_t)option_nsamples ? total : (size_t)option_nsamples);
+    v->data = (unsigned char *)emalloc(v->nsamples * v->bytes);
+    v->back = (unsigned char *)emalloc(v->nsamples * v->bytes);
+    for(k = 0; k < v->nsamples; k++) {
+	size_t start[NC_MAX_VAR_DIMS];
+	size_t chunk = (size_t)((double)k * (double)total / (double)v->nsamples);
+	for(d = v->rank - 1; d >= 0; d--) {
+	    start[d] = (chunk % nfull[d]) * v->chunks[d];
+	    chunk /= nfull[d];
+	}
+	if((stat = nc_get_vara(v->grpid, v->varid, start, v->counts, v->data + k * v->bytes))) {
+	    fprintf(stderr, "%s: %s: %s\n", progname, v->path, nc_strerror(stat));
+	    return 0;
+	}
+    }
+    return 1;
+}
+
+/* Write the sample to the scratch file through the chain, and return
+ * its size and the time to write and close it. */
+static int
+write_sample(Bvar *v, const Chain *c, size_t *sizep, double *timep)
+{
+    int ret, ncid, varid, d;
+    int dimids[NC_MAX_VAR_DIMS + 1];
+    size_t chunks[NC_MAX_VAR_DIMS + 1];
+    size_t start[NC_MAX_VAR_DIMS + 1], count[NC_MAX_VAR_DIMS + 1];
+    size_t i, k;
+    struct stat st;
+    double t;
+
+    if((ret = nc_create(scratch, NC_NETCDF4|NC_CLOBBER, &ncid)))
+	return ret;
+    if((ret = nc_def_dim(ncid, "sample", v->nsamples, &dimids[0])))
+	goto fail;
+    chunks[0] = 1;
+    for(d = 0; d < v->rank; d++) {
+	char name[NC_MAX_NAME + 1];
+	snprintf(name, sizeof(name), "d%d", d);
+	if((ret = nc_def_dim(ncid, name, v->counts[d], &dimids[d + 1])))
+	    goto fail;
+	chunks[d + 1] = v->counts[d];
+    }
+    if((ret = nc_def_var(ncid, "v", v->type, v->rank + 1, dimids, &varid)))
+	goto fail;
+    if((ret = nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunks)))
+	goto fail;
+    if((ret = nc_def_var_fill(ncid, varid, NC_NOFILL, NULL)))
+	goto fail;
+    for(i = 0; i < c->nfilters; i++)
+	if((ret = nc_def_var_filter(ncid, varid, c->filters[i]->filterid,
+				     c->filters[i]->nparams, c->filters[i]->params)))
+	    goto fail;
+    if((ret = nc_enddef(ncid)))
+	goto fail;
+    for(d = 0; d < v->rank; d++) {
+	start[d + 1] = 0;
+	count[d + 1] = v->counts[d];
+    }
+    count[0] = 1;
+    t = now();
+    for(k = 0; k < v->nsamples; k++) {
+	start[0] = k;
+	if((ret = nc_put_vara(ncid, varid, start, count, v->data + k * v->bytes)))
+	    goto fail;
+    }
+    /* The chunks are compressed as they leave the cache */
+    if((ret = nc_close(ncid)))
+	return ret;
+    *timep = now() - t;
+    if(stat(scratch, &st) != 0)
+	return NC_EIO;
+    *sizep = (size_t)st.st_size;
+    return NC_NOERR;
+fail:
+    nc_abort(ncid);
+    return ret;
+}
+
+/* Read the sample back from the scratch file */
+static int
+read_back(Bvar *v, double *timep)
+{
+    int stat, ncid, d;
+    size_t start[NC_MAX_VAR_DIMS + 1], count[NC_MAX_VAR_DIMS + 1];
+    size_t k;
+    double t;
+
+    if((stat = nc_open(scratch, NC_NOWRITE, &ncid)))
+	return stat;
+    for(d = 0; d < v->rank; d++) {
+	start[d + 1] = 0;
+	count[d + 1] = v->counts[d];
+    }
+    count[0] = 1;
+    t = now();
+    for(k = 0; k < v->nsamples; k++) {
+	start[0] = k;
+	if((stat = nc_get_vara(ncid, 0, start, count, v->back + k * v->bytes)))
+	    break;
+    }
+    *timep = now() - t;
+    nc_close(ncid);
+    return stat;
+}
+
+static void
+try_chain(Bvar *v, const Chain *c, size_t overhead, Result *res)
+{
+    double bytes = (double)(v->nsamples * v->bytes);
+    double t, best_encode = 0, best_decode = 0;
+    size_t size = 0;
+    int r;
+
+    memset(res, 0, sizeof(Result));
+    for(r = 0; r < option_reps; r++) {
+	if(write_sample(v, c, &size, &t)) {
+	    next_scratch();
+	    return;
+	}
+	if(r == 0 || t < best_encode)
+	    best_encode = t;
+    }
+    for(r = 0; r < option_reps; r++) {
+	if(read_back(v, &t))
+	    return;
+	if(r == 0 || t < best_decode)
+	    best_decode = t;
+    }
+    res->available = 1;
+    res->exact = (memcmp(v->data, v->back, v->nsamples * v->bytes) == 0);
+    res->ratio = bytes / (double)(size > overhead ? size - overhead : 1);
+    res->encode = bytes / MEGABYTE / (best_encode > 0 ? best_encode : 1e-6);
+    res->decode = bytes / MEGABYTE / (best_decode > 0 ? best_decode : 1e-6);
+}
+
+/* The index of the best chain for the target, or -1 */
+static int
+choose(const Result *res, int nchains)
+{
+    int i, best = -1;
+
+    for(i = 0; i < nchains; i++) {
+	const Result *r = &res[i];
+	if(!r->available || r->encode < option_min_encode)
+	    continue;
+	if(!r->exact && !option_lossy)
+	    continue;
+	if(option_speed) {
+	    if(r->ratio < option_min_ratio)
+		continue;
+	    if(best < 0 || r->decode > res[best].decode)
+		best = i;
+	} else {
+	    if(r->decode < option_min_decode)
+		continue;
+	    if(best < 0 || r->ratio > res[best].ratio
+	       || (r->ratio == res[best].ratio && r->decode > res[best].decode))
+		best = i;
+	}
+    }
+    return best;
+}
+
+static void
+bench_var(Bvar *v, const Chain *chains, int nchains, Result *res)
+{
+    int i, best, d;
+    char *options, *p;
+    Chain none;
+    size_t overhead;
+    double t;
+
+    static const char *types[] = {NULL, "byte", "char", "short", "int", "float",
+				  "double", "ubyte", "ushort", "uint", "int64", "uint64"};
+
+    printf("%s: %s, %d chunk%s of ", v->path, types[v->type],
+	   (int)v->nsamples, v->nsamples > 1 ? "s" : "");
+    for(d = 0; d < v->rank; d++)
+	printf("%s%lu", d ? "x" : "", (unsigned long)v->counts[d]);
+    printf(", %lu bytes\n", (unsigned long)(v->nsamples * v->bytes));
+    /* What the file takes besides the data */
+    memset(&none, 0, sizeof(none));
+    if((i = write_sample(v, &none, &overhead, &t))) {
+	fprintf(stderr, "%s: %s: %s\n", progname, v->path, nc_strerror(i));
+	return;
+    }
+    overhead = (overhead > v->nsamples * v->bytes ? overhead - v->nsamples * v->bytes : 0);
+    printf("  %8s %12s %12s  %s\n", "ratio", "encode MB/s", "decode MB/s", "chain");
+    for(i = 0; i < nchains; i++) {
+	try_chain(v, &chains[i], overhead, &res[i]);
+	if(res[i].available)
+	    printf("  %8.2f %12.1f %12.1f  %s%s\n", res[i].ratio, res[i].encode,
+		   res[i].decode, chains[i].spec, res[i].exact ? "" : " (lossy)");
+	else
+	    printf("  %8s %12s %12s  %s (not available)\n", "-", "-", "-", chains[i].spec);
+    }
+    best = choose(res, nchains);
+    if(best < 0) {
+	printf("  no chain meets the target\n");
+	return;
+    }
+    /* The chain, and the chunks it was tried with */
+    options = (char *)emalloc(2 * strlen(v->path) * 2 + strlen(chains[best].spec)
+			      + (size_t)v->rank * 24 + 32);
+    p = options;
+    p += sprintf(p, "-F \"");
+    p = escape(p, v->path);
+    p += sprintf(p, ",%s\" -c \"", chains[best].spec);
+    p = escape(p, v->path);
+    *p++ = ':';
+    for(d = 0; d < v->rank; d++)
+	p += sprintf(p, "%s%lu", d ? "," : "", (unsigned long)v->chunks[d]);
+    sprintf(p, "\"");
+    printf("  best: %s%s\n", options, res[best].exact ? "" : " (lossy)");
+    free(options);
+}
+
+static void
+usage(void)
+{
+#define USAGE   "\
+  [-f chain] try this chain of filters, in the syntax of nccopy -F without\n\
+            the variables, e.g. \"shuffle|deflate,5\" (may be repeated);\n\
+            \"none\" is no filter. By default, a list of common chains\n\
+  [-v var1,...] only these variables\n\
+  [-n n]    sample at most n chunks of each variable (default 8)\n\
+  [-r n]    time each chain n times and keep the best (default 3)\n\
+  [-t target] \"ratio\" (default): the highest ratio that meets -d and -e;\n\
+            \"speed\": the fastest decoding that meets -R and -e\n\
+  [-d MB/s] the slowest decoding allowed\n\
+  [-e MB/s] the slowest encoding allowed\n\
+  [-R ratio] the lowest ratio allowed\n\
+  [-L]      let a lossy chain be the best\n\
+  file      name of netCDF file\n"
+
+    error("%s [-f chain]... [-v var1,...] [-n n] [-r n] [-t ratio|speed] [-d MB/s] [-e MB/s] [-R ratio] [-L] file\n%s\nnetCDF library version %s",
+	  progname, USAGE, nc_inq_libvers());
+}
+
+/* Is the variable in the -v list, by its full or, in the root
+ * group, plain name */
+static int
+wanted(const char *path, int nlvars, char **lvars)
+{
+    int i;
+    if(nlvars == 0)
+	return 1;
+    for(i = 0; i < nlvars; i++)
+	if(strcmp(lvars[i], path) == 0
+	   || (path[0] == '/' && strcmp(lvars[i], path + 1) == 0))
+	    return 1;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    const char **specs = NULL;
+    int nspecs = 0;
+    Chain *chains;
+    Result *res;
+    int nlvars = 0;
+    char **lvars = NULL;
+    int ncid, ngrps, g, i, c;
+    int *grpids;
+    int nvars = 0;
+
+    opterr = 1;
+    progname = argv[0];
+    specs = (const char **)emalloc((size_t)(argc + 1) * sizeof(char *));
+
+    while ((c = getopt(argc, argv, "f:v:n:r:t:d:e:R:L")) != -1) {
+	switch(c) {
+	case 'f':		/* a chain to try */
+	    specs[nspecs++] = optarg;
+	    break;
+	case 'v':		/* variables to try them on */
+	    make_lvars(optarg, &nlvars, &lvars);
+	    break;
+	case 'n':
+	    option_nsamples = atoi(optarg);
+	    if(option_nsamples < 1)
+		error("invalid number of chunks: %s", optarg);
+	    break;
+	case 'r':
+	    option_reps = atoi(optarg);
+	    if(option_reps < 1)
+		error("invalid number of runs: %s", optarg);
+	    break;
+	case 't':
+	    if(strcmp(optarg, "speed") == 0)
+		option_speed = 1;
+	    else if(strcmp(optarg, "ratio") == 0)
+		option_speed = 0;
+	    else
+		error("invalid target: %s", optarg);
+	    break;
+	case 'd':
+	    option_min_decode = atof(optarg);
+	    break;
+	case 'e':
+	    option_min_encode = atof(optarg);
+	    break;
+	case 'R':
+	    option_min_ratio = atof(optarg);
+	    break;
+	case 'L':		/* a lossy chain may be the best */
+	    option_lossy = 1;
+	    break;
+	default:
+	    usage();
+	}
+    }
+    argc -= optind;
+    argv += optind;
+    if(argc != 1)
+	usage();
+    if(nspecs == 0)
+	for(; default_chains[nspecs] != NULL; nspecs++)
+	    specs[nspecs] = default_chains[nspecs];
+
+    chains = (Chain *)emalloc((size_t)nspecs * sizeof(Chain));
+    res = (Result *)emalloc((size_t)nspecs * sizeof(Result));
+    for(i = 0; i < nspecs; i++)
+	parse_chain(specs[i], &chains[i]);
+
+    next_scratch();
+    NC_CHECK(nc_open(argv[0], NC_NOWRITE, &ncid));
+    NC_CHECK(nc_inq_grps_full(ncid, &ngrps, NULL));
+    grpids = (int *)emalloc((size_t)ngrps * sizeof(int));
+    NC_CHECK(nc_inq_grps_full(ncid, &ngrps, grpids));
+    for(g = 0; g < ngrps; g++) {
+	char *grpname;
+	size_t len;
+	int n, iv;
+
+	NC_CHECK(nc_inq_grpname_full(grpids[g], &len, NULL));
+	grpname = (char *)emalloc(len + 2);
+	NC_CHECK(nc_inq_grpname_full(grpids[g], NULL, grpname));
+	if(strcmp(grpname, "/") != 0)
+	    strcat(grpname, "/");
+	NC_CHECK(nc_inq_nvars(grpids[g], &n));
+	for(iv = 0; iv < n; iv++) {
+	    Bvar v;
+	    char name[NC_MAX_NAME + 1];
+
+	    memset(&v, 0, sizeof(v));
+	    v.grpid = grpids[g];
+	    v.varid = iv;
+	    NC_CHECK(nc_inq_varname(v.grpid, iv, name));
+	    v.path = (char *)emalloc(strlen(grpname) + strlen(name) + 1);
+	    strcpy(v.path, grpname);
+	    strcat(v.path, name);
+	    if(wanted(v.path, nlvars, lvars) && read_sample(&v)) {
+		if(nvars++ > 0)
+		    printf("\n");
+		bench_var(&v, chains, nspecs, res);
+	    }
+	    free(v.data);
+	    free(v.back);
+	    free(v.path);
+	}
+	free(grpname);
+    }
+    free(grpids);
+    NC_CHECK(nc_close(ncid));
+    remove(scratch);
+
+    for(i = 0; i < nspecs; i++)
+	free_chain(&chains[i]);
+    free(chains);
+    free(res);
+    free(specs);
+    if(nvars == 0)
+	error("no variables to try filters on");
+    exit(EXIT_SUCCESS);
+}
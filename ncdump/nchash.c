@@ -0,0 +1,772 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/*
+ * nchash: print SHA-256 digests of the contents of a netCDF file, one
+ * per variable, one per group for its attributes and one for the
+ * whole file, or compare the contents of two files.
+ *
+ * The digests depend only on what the netCDF API returns: not on the
+ * format, chunking, compression or byte order of the file, nor on the
+ * order of variables and attributes in it.
+ *
+ * - The values of a variable, in row-major order, are split into
+ *   leaves of at most LEAF_BYTES, chosen from its shape and type
+ *   alone. Each leaf is read with one nc_get_vara() call and hashed
+ *   on its own, so leaves of all variables can be read and hashed by
+ *   several threads at once.
+ * - A variable digest covers its type, its shape, the digest of its
+ *   attributes (unless -a) and the digests of its leaves, in order.
+ * - The file digest covers the paths and digests of all variables and
+ *   groups, sorted by path.
+ *
+ * Values are hashed in a canonical form: numbers little-endian,
+ * strings and vlens as an 8-byte length followed by their contents,
+ * compounds field by field without padding.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include <string.h>
+#include "netcdf.h"
+#include "netcdf_aux.h"
+#include "utils.h"
+#include "sha256.h"
+
+#ifdef _MSC_VER
+#include "XGetopt.h"
+int opterr;
+int optind;
+#endif
+
+#ifdef ENABLE_THREADSAFE
+#include <pthread.h>
+#endif
+
+/* Largest leaf of a variable, in canonical bytes. Changing it
+ * changes every digest. */
+#define LEAF_BYTES (4 * 1048576)
+
+/* Canonical size of a string or vlen, for splitting into leaves */
+#define NOMINAL_VARLEN_SIZE 16
+
+char *progname;
+
+static int option_noatts = 0;	/* -a: ignore attributes */
+static int option_quiet = 0;	/* -q */
+static int option_nthreads = 1;	/* -t */
+
+/* A type, with what is needed to hash its values */
+typedef struct Tinfo {
+    nc_type type;
+    int tclass;			/* the type itself for atomic types */
+    size_t size;		/* in memory */
+    size_t nominal;		/* canonical size, for splitting into leaves */
+    int hasvarlen;		/* has strings or vlens to reclaim */
+    struct Tinfo *base;		/* of a vlen or enum */
+    int nfields;
+    struct Field {
+	size_t offset;
+	size_t nvals;		/* values in the field array */
+	struct Tinfo *type;
+    } *fields;
+    char *desc;			/* canonical description */
+    struct Tinfo *next;
+} Tinfo;
+
+typedef struct Hvar {
+    char *path;
+    int grpid, varid;
+    Tinfo *type;
+    int rank;
+    size_t *dims;
+    /* A leaf takes a run of indices of dimension split-1 and all of
+     * the later dimensions; split is 0 if one leaf takes it all */
+    int split;
+    size_t run;
+    size_t nruns;
+    size_t nleaves;
+    unsigned char *leaves;	/* digests of the leaves */
+    unsigned char attrs[SHA256_LEN];
+} Hvar;
+
+/* A digest that goes into the file digest */
+typedef struct Entry {
+    char *path;			/* groups end with a / */
+    unsigned char digest[SHA256_LEN];
+} Entry;
+
+typedef struct Hfile {
+    const char *path;
+    int ncid;
+    Tinfo *types;
+    Hvar *vars;
+    int nvars;
+    Entry *entries;
+    int nentries;
+    unsigned char digest[SHA256_LEN];
+    /* leaves still to hash, in order; locked when threaded */
+    int nextvar;
+    size_t nextleaf;
+    int stat;			/* first error in a worker */
+#ifdef ENABLE_THREADSAFE
+    pthread_mutex_t lock;
+#endif
+} Hfile;
+
+static int
+islittleendian(void)
+{
+    unsigned int one = 1;
+    return *(unsigned char *)&one == 1;
+}
+
+/* Return a malloced string formatted as by printf */
+static char *
+strfmt(const char *fmt, ...)
+{
+    va_list args;
+    char *s;
+    int len;
+
+    va_start(args, fmt);
+    len = vsnprintf(NULL, 0, fmt, args);
+    va_end(args);
+    s = (char *)emalloc((size_t)len + 1);
+    va_start(args, fmt);
+    vsnprintf(s, (size_t)len + 1, fmt, args);
+    va_end(args);
+    return s;
+}
+
+static void
+hash_len(sha256_t *ctx, unsigned long long len)
+{
+    unsigned char b[8];
+    int i;
+    for(i = 0; i < 8; i++)
+	b[i] = (unsigned char)(len >> (8 * i));
+    sha256_update(ctx, b, sizeof(b));
+}
+
+/* Hash n numbers of the given size, little-endian */
+static void
+hash_numbers(sha256_t *ctx, const void *data, size_t n, size_t size)
+{
+    unsigned char tmp[4096];
+    const unsigned char *p = (const unsigned char *)data;
+    size_t per = sizeof(tmp) / size;
+
+    if(size == 1 || islittleendian()) {
+	sha256_update(ctx, data, n * size);
+	return;
+    }
+    while(n > 0) {
+	size_t m = (n < per ? n : per);
+	size_t i, j;
+	for(i = 0; i < m; i++, p += size)
+	    for(j = 0; j < size; j++)
+		tmp[i * size + j] = p[size - 1 - j];
+	sha256_update(ctx, tmp, m * size);
+	n -= m;
+    }
+}
+
+/* Hash n values of type t at data, in canonical form */
+static void
+hash_values(sha256_t *ctx, const Tinfo *t, const void *data, size_t n)
+{
+    const char *p = (const char *)data;
+    size_t i;
+    int f;
+
+    switch(t->tclass) {
+    case NC_STRING:
+	for(i = 0; i < n; i++) {
+	    const char *s = ((char *const *)data)[i];
+	    size_t len = (s == NULL ? 0 : strlen(s));
+	    hash_len(ctx, s == NULL ? 0 : len + 1); /* NULL differs from "" */
+	    sha256_update(ctx, s, len);
+	}
+	break;
+    case NC_VLEN:
+	for(i = 0; i < n; i++) {
+	    const nc_vlen_t *vl = &((const nc_vlen_t *)data)[i];
+	    hash_len(ctx, vl->len);
+	    hash_values(ctx, t->base, vl->p, vl->len);
+	}
+	break;
+    case NC_OPAQUE:
+	sha256_update(ctx, data, n * t->size);
+	break;
+    case NC_ENUM:
+	hash_values(ctx, t->base, data, n);
+	break;
+    case NC_COMPOUND:
+	for(i = 0; i < n; i++, p += t->size)
+	    for(f = 0; f < t->nfields; f++)
+		hash_values(ctx, t->fields[f].type, p + t->fields[f].offset,
+			    t->fields[f].nvals);
+	break;
+    default:			/* atomic numbers and chars */
+	hash_numbers(ctx, data, n, t->size);
+	break;
+    }
+}
+
+/* Get what is needed to hash values of a type */
+static Tinfo *
+gettinfo(Hfile *hf, nc_type type)
+{
+    char name[NC_MAX_NAME + 1];
+    Tinfo *t;
+
+    for(t = hf->types; t != NULL; t = t->next)
+	if(t->type == type)
+	    return t;
+    t = (Tinfo *)ecalloc(sizeof(Tinfo));
+    t->type = type;
+    if(type <= NC_MAX_ATOMIC_TYPE) {
+	NC_CHECK(nc_inq_type(hf->ncid, type, name, &t->size));
+	t->tclass = type;
+	t->nominal = t->size;
+	if(type == NC_STRING) {
+	    t->nominal = NOMINAL_VARLEN_SIZE;
+	    t->hasvarlen = 1;
+	}
+	t->desc = strdup(name);
+    } else {
+	nc_type base;
+	size_t nfields;
+	int f;
+	NC_CHECK(nc_inq_user_type(hf->ncid, type, name, &t->size, &base,
+				  &nfields, &t->tclass));
+	switch(t->tclass) {
+	case NC_VLEN:
+	    t->base = gettinfo(hf, base);
+	    t->nominal = NOMINAL_VARLEN_SIZE;
+	    t->hasvarlen = 1;
+	    t->desc = strfmt("vlen %s(%s)", name, t->base->desc);
+	    break;
+	case NC_OPAQUE:
+	    t->nominal = t->size;
+	    t->desc = strfmt("opaque %s(%zu)", name, t->size);
+	    break;
+	case NC_ENUM:
+	    t->base = gettinfo(hf, base);
+	    t->nominal = t->base->nominal;
+	    t->desc = strfmt("enum %s(%s)", name, t->base->desc);
+	    break;
+	case NC_COMPOUND:
+	    t->nfields = (int)nfields;
+	    t->fields = (struct Field *)ecalloc(nfields * sizeof(struct Field));
+	    t->desc = strfmt("compound %s{", name);
+	    for(f = 0; f < t->nfields; f++) {
+		char fname[NC_MAX_NAME + 1];
+		int dimsizes[NC_MAX_VAR_DIMS];
+		nc_type ftype;
+		int ndims, d;
+		char *desc;
+		NC_CHECK(nc_inq_compound_field(hf->ncid, type, f, fname,
+					       &t->fields[f].offset, &ftype,
+					       &ndims, dimsizes));
+		t->fields[f].type = gettinfo(hf, ftype);
+		t->fields[f].nvals = 1;
+		desc = strfmt("%s%s %s", t->desc, t->fields[f].type->desc, fname);
+		free(t->desc);
+		t->desc = desc;
+		for(d = 0; d < ndims; d++) {
+		    t->fields[f].nvals *= (size_t)dimsizes[d];
+		    desc = strfmt("%s[%d]", t->desc, dimsizes[d]);
+		    free(t->desc);
+		    t->desc = desc;
+		}
+		desc = strfmt("%s;", t->desc);
+		free(t->desc);
+		t->desc = desc;
+		t->nominal += t->fields[f].nvals * t->fields[f].type->nominal;
+		if(t->fields[f].type->hasvarlen)
+		    t->hasvarlen = 1;
+	    }
+	    {
+		char *desc = strfmt("%s}", t->desc);
+		free(t->desc);
+		t->desc = desc;
+	    }
+	    break;
+	default:
+	    error("unknown class of type %s", name);
+	}
+	if(t->nominal == 0)
+	    t->nominal = 1;
+    }
+    t->next = hf->types;
+    hf->types = t;
+    return t;
+}
+
+static void
+freetinfos(Tinfo *t)
+{
+    while(t != NULL) {
+	Tinfo *next = t->next;
+	free(t->fields);
+	free(t->desc);
+	free(t);
+	t = next;
+    }
+}
+
+static int
+namecmp(const void *a, const void *b)
+{
+    return strcmp((const char *)a, (const char *)b);
+}
+
+/* Digest of the attributes of a variable, or of a group for NC_GLOBAL,
+ * in order of name */
+static void
+hash_atts(Hfile *hf, int grpid, int varid, unsigned char digest[SHA256_LEN])
+{
+    sha256_t ctx;
+    char (*names)[NC_MAX_NAME + 1];
+    int natts, a;
+
+    NC_CHECK(nc_inq_varnatts(grpid, varid, &natts));
+    names = emalloc((size_t)(natts > 0 ? natts : 1) * sizeof(*names));
+    for(a = 0; a < natts; a++)
+	NC_CHECK(nc_inq_attname(grpid, varid, a, names[a]));
+    qsort(names, (size_t)natts, sizeof(*names), namecmp);
+    sha256_init(&ctx);
+    for(a = 0; a < natts; a++) {
+	nc_type type;
+	size_t len;
+	Tinfo *t;
+	void *vals;
+	NC_CHECK(nc_inq_att(grpid, varid, names[a], &type, &len));
+	t = gettinfo(hf, type);
+	vals = emalloc(len * t->size + 1);
+	NC_CHECK(nc_get_att(grpid, varid, names[a], vals));
+	sha256_update(&ctx, names[a], strlen(names[a]) + 1);
+	sha256_update(&ctx, t->desc, strlen(t->desc) + 1);
+	hash_len(&ctx, len);
+	hash_values(&ctx, t, vals, len);
+	if(t->hasvarlen)
+	    NC_CHECK(ncaux_reclaim_data(grpid, type, vals, len));
+	free(vals);
+    }
+    sha256_final(&ctx, digest);
+    free(names);
+}
+
+/* Split the values of a variable into leaves */
+static void
+plan_leaves(Hvar *v)
+{
+    size_t bytes = v->type->nominal;	/* of the values after split-1 */
+    int d;
+
+    for(d = 0; d < v->rank; d++) {
+	if(v->dims[d] == 0) {
+	    v->nleaves = 0;
+	    return;
+	}
+    }
+    v->split = v->rank;
+    while(v->split > 0 && v->dims[v->split - 1] <= LEAF_BYTES / bytes) {
+	bytes *= v->dims[v->split - 1];
+	v->split--;
+    }
+    if(v->split == 0) {
+	v->nleaves = 1;
+	return;
+    }
+    v->run = LEAF_BYTES / bytes;
+    if(v->run == 0)
+	v->run = 1;
+    v->nruns = (v->dims[v->split - 1] + v->run - 1) / v->run;
+    v->nleaves = v->nruns;
+    for(d = 0; d < v->split - 1; d++)
+	v->nleaves *= v->dims[d];
+}
+
+/* The slab of leaf number leaf of v; returns its number of values */
+static size_t
+leaf_slab(const Hvar *v, size_t leaf, size_t *start, size_t *count)
+{
+    size_t nvals = 1;
+    int d;
+
+    for(d = v->rank - 1; d >= 0; d--) {
+	if(d >= v->split) {
+	    start[d] = 0;
+	    count[d] = v->dims[d];
+	} else if(d == v->split - 1) {
+	    start[d] = (leaf % v->nruns) * v->run;
+	    count[d] = v->dims[d] - start[d];
+	    if(count[d] > v->run)
+		count[d] = v->run;
+	    leaf /= v->nruns;
+	} else {
+	    start[d] = leaf % v->dims[d];
+	    count[d] = 1;
+	    leaf /= v->dims[d];
+	}
+	nvals *= count[d];
+    }
+    return nvals;
+}
+
+/* Take the next leaf to hash; returns 0 when there are none left */
+static int
+next_leaf(Hfile *hf, int *varp, size_t *leafp)
+{
+    int found = 0;
+#ifdef ENABLE_THREADSAFE
+    pthread_mutex_lock(&hf->lock);
+#endif
+    while(hf->stat == NC_NOERR && hf->nextvar < hf->nvars) {
+	if(hf->nextleaf < hf->vars[hf->nextvar].nleaves) {
+	    *varp = hf->nextvar;
+	    *leafp = hf->nextleaf++;
+	    found = 1;
+	    break;
+	}
+	hf->nextvar++;
+	hf->nextleaf = 0;
+    }
+#ifdef ENABLE_THREADSAFE
+    pthread_mutex_unlock(&hf->lock);
+#endif
+    return found;
+}
+
+static void
+set_error(Hfile *hf, int stat)
+{
+#ifdef ENABLE_THREADSAFE
+    pthread_mutex_lock(&hf->lock);
+#endif
+    if(hf->stat == NC_NOERR)
+	hf->stat = stat;
+#ifdef ENABLE_THREADSAFE
+    pthread_mutex_unlock(&hf->lock);
+#endif
+}
+
+/* Read and hash leaves until there are none left */
+static void *
+worker(void *arg)
+{
+    Hfile *hf = (Hfile *)arg;
+    size_t start[NC_MAX_VAR_DIMS], count[NC_MAX_VAR_DIMS];
+    void *buf = NULL;
+    size_t bufsize = 0;
+    size_t leaf;
+    int iv;
+
+    while(next_leaf(hf, &iv, &leaf)) {
+	Hvar *v = &hf->vars[iv];
+	size_t nvals = leaf_slab(v, leaf, start, count);
+	sha256_t ctx;
+	int stat;
+
+	if(nvals * v->type->size > bufsize) {
+	    free(buf);
+	    bufsize = nvals * v->type->size;
+	    if((buf = malloc(bufsize)) == NULL) {
+		bufsize = 0;
+		set_error(hf, NC_ENOMEM);
+		break;
+	    }
+	}
+	stat = nc_get_vara(v->grpid, v->varid, start, count, buf);
+	if(stat != NC_NOERR) {
+	    set_error(hf, stat);
+	    break;
+	}
+	sha256_init(&ctx);
+	hash_values(&ctx, v->type, buf, nvals);
+	sha256_final(&ctx, v->leaves + leaf * SHA256_LEN);
+	if(v->type->hasvarlen &&
+	   (stat = ncaux_reclaim_data(v->grpid, v->type->type, buf, nvals)) != NC_NOERR) {
+	    set_error(hf, stat);
+	    break;
+	}
+    }
+    free(buf);
+    return NULL;
+}
+
+/* Hash all the leaves, with option_nthreads threads if possible */
+static int
+hash_leaves(Hfile *hf)
+{
+    hf->nextvar = 0;
+    hf->nextleaf = 0;
+    hf->stat = NC_NOERR;
+#ifdef ENABLE_THREADSAFE
+    pthread_mutex_init(&hf->lock, NULL);
+    if(option_nthreads > 1) {
+	pthread_t *threads = (pthread_t *)emalloc((size_t)option_nthreads * sizeof(pthread_t));
+	int i, n;
+	for(n = 0; n < option_nthreads; n++)
+	    if(pthread_create(&threads[n], NULL, worker, hf) != 0)
+		break;
+	if(n == 0)
+	    worker(hf);
+	for(i = 0; i < n; i++)
+	    pthread_join(threads[i], NULL);
+	free(threads);
+    } else {
+	worker(hf);
+    }
+    pthread_mutex_destroy(&hf->lock);
+#else
+    worker(hf);
+#endif
+    return hf->stat;
+}
+
+static int
+entrycmp(const void *a, const void *b)
+{
+    return strcmp(((const Entry *)a)->path, ((const Entry *)b)->path);
+}
+
+/* Compute all the digests of a file */
+static void
+hash_file(Hfile *hf)
+{
+    int ngrps, g, i, nentries = 0;
+    int *grpids;
+    sha256_t ctx;
+    int stat;
+
+    stat = nc_open(hf->path, NC_NOWRITE, &hf->ncid);
+    if(stat != NC_NOERR)
+	error("%s: %s", hf->path, nc_strerror(stat));
+    NC_CHECK(nc_inq_grps_full(hf->ncid, &ngrps, NULL));
+    grpids = (int *)emalloc((size_t)ngrps * sizeof(int));
+    NC_CHECK(nc_inq_grps_full(hf->ncid, &ngrps, grpids));
+
+    /* Every variable, with its leaves planned */
+    hf->nvars = 0;
+    for(g = 0; g < ngrps; g++) {
+	int nvars;
+	NC_CHECK(nc_inq_nvars(grpids[g], &nvars));
+	hf->nvars += nvars;
+    }
+    hf->vars = (Hvar *)ecalloc((size_t)(hf->nvars > 0 ? hf->nvars : 1) * sizeof(Hvar));
+    hf->entries = (Entry *)ecalloc((size_t)(hf->nvars + ngrps) * sizeof(Entry));
+    for(i = 0, g = 0; g < ngrps; g++) {
+	char *grpname;
+	size_t len;
+	int nvars, iv;
+
+	NC_CHECK(nc_inq_grpname_full(grpids[g], &len, NULL));
+	grpname = (char *)emalloc(len + 2);
+	NC_CHECK(nc_inq_grpname_full(grpids[g], NULL, grpname));
+	if(strcmp(grpname, "/") != 0)
+	    strcat(grpname, "/");
+	if(!option_noatts) {
+	    Entry *e = &hf->entries[nentries++];
+	    e->path = strdup(grpname);
+	    hash_atts(hf, grpids[g], NC_GLOBAL, e->digest);
+	}
+	NC_CHECK(nc_inq_nvars(grpids[g], &nvars));
+	for(iv = 0; iv < nvars; iv++, i++) {
+	    Hvar *v = &hf->vars[i];
+	    char name[NC_MAX_NAME + 1];
+	    int dimids[NC_MAX_VAR_DIMS];
+	    nc_type type;
+	    int d;
+
+	    v->grpid = grpids[g];
+	    v->varid = iv;
+	    NC_CHECK(nc_inq_var(v->grpid, iv, name, &type, &v->rank, dimids, NULL));
+	    v->path = strfmt("%s%s", grpname, name);
+	    v->type = gettinfo(hf, type);
+	    v->dims = (size_t *)emalloc((size_t)(v->rank > 0 ? v->rank : 1) * sizeof(size_t));
+	    for(d = 0; d < v->rank; d++)
+		NC_CHECK(nc_inq_dimlen(v->grpid, dimids[d], &v->dims[d]));
+	    plan_leaves(v);
+	    v->leaves = (unsigned char *)emalloc((v->nleaves > 0 ? v->nleaves : 1) * SHA256_LEN);
+	    if(!option_noatts)
+		hash_atts(hf, v->grpid, iv, v->attrs);
+	}
+	free(grpname);
+    }
+    free(grpids);
+
+    NC_CHECK(hash_leaves(hf));
+
+    /* Variable digests */
+    for(i = 0; i < hf->nvars; i++) {
+	Hvar *v = &hf->vars[i];
+	Entry *e = &hf->entries[nentries++];
+	int d;
+	sha256_init(&ctx);
+	sha256_update(&ctx, v->type->desc, strlen(v->type->desc) + 1);
+	hash_len(&ctx, (unsigned long long)v->rank);
+	for(d = 0; d < v->rank; d++)
+	    hash_len(&ctx, v->dims[d]);
+	if(!option_noatts)
+	    sha256_update(&ctx, v->attrs, SHA256_LEN);
+	sha256_update(&ctx, v->leaves, v->nleaves * SHA256_LEN);
+	sha256_final(&ctx, e->digest);
+	e->path = v->path;
+	v->path = NULL;
+	free(v->dims);
+	free(v->leaves);
+    }
+    free(hf->vars);
+    hf->vars = NULL;
+    hf->nentries = nentries;
+
+    /* File digest */
+    qsort(hf->entries, (size_t)nentries, sizeof(Entry), entrycmp);
+    sha256_init(&ctx);
+    for(i = 0; i < nentries; i++) {
+	sha256_update(&ctx, hf->entries[i].path, strlen(hf->entries[i].path) + 1);
+	sha256_update(&ctx, hf->entries[i].digest, SHA256_LEN);
+    }
+    sha256_final(&ctx, hf->digest);
+
+    NC_CHECK(nc_close(hf->ncid));
+    freetinfos(hf->types);
+    hf->types = NULL;
+}
+
+static void
+free_entries(Hfile *hf)
+{
+    int i;
+    for(i = 0; i < hf->nentries; i++)
+	free(hf->entries[i].path);
+    free(hf->entries);
+    hf->entries = NULL;
+}
+
+static void
+print_digest(const unsigned char digest[SHA256_LEN], const char *name)
+{
+    int i;
+    for(i = 0; i < SHA256_LEN; i++)
+	printf("%02x", digest[i]);
+    printf("  %s\n", name);
+}
+
+/* Print what differs between two files; return 1 if anything does */
+static int
+compare(const Hfile *a, const Hfile *b)
+{
+    int i = 0, j = 0;
+
+    if(memcmp(a->digest, b->digest, SHA256_LEN) == 0)
+	return 0;
+    while(i < a->nentries || j < b->nentries) {
+	int c = (i == a->nentries ? 1 : j == b->nentries ? -1
+		 : strcmp(a->entries[i].path, b->entries[j].path));
+	if(c < 0) {
+	    if(!option_quiet)
+		printf("only in %s: %s\n", a->path, a->entries[i].path);
+	    i++;
+	} else if(c > 0) {
+	    if(!option_quiet)
+		printf("only in %s: %s\n", b->path, b->entries[j].path);
+	    j++;
+	} else {
+	    if(memcmp(a->entries[i].digest, b->entries[j].digest, SHA256_LEN) != 0
+	       && !option_quiet)
+		printf("differs: %s\n", a->entries[i].path);
+	    i++;
+	    j++;
+	}
+    }
+    return 1;
+}
+
+static void
+usage(void)
+{
+#define USAGE   "\
+  [-a]      ignore attributes\n\
+  [-q]      print only the digest of the whole file; when comparing,\n\
+            print nothing and only set the exit status\n\
+  [-t n]    read and hash with n threads (needs a thread-safe netCDF library)\n\
+  file      name of netCDF file to hash\n\
+  file2     if given, compare the contents of file and file2 instead:\n\
+            print what differs and exit with status 1 if anything does\n"
+
+    error("%s [-a] [-q] [-t n] file [file2]\n%s\nnetCDF library version %s",
+	  progname, USAGE, nc_inq_libvers());
+}
+
+int
+main(int argc, char **argv)
+{
+    Hfile files[2];
+    int nfiles, f, i, c;
+    int exitcode = EXIT_SUCCESS;
+
+    opterr = 1;
+    progname = argv[0];
+
+    while ((c = getopt(argc, argv, "aqt:")) != -1) {
+	switch(c) {
+	case 'a':
+	    option_noatts = 1;
+	    break;
+	case 'q':
+	    option_quiet = 1;
+	    break;
+	case 't':		/* number of threads to hash with */
+	    option_nthreads = atoi(optarg);
+	    if(option_nthreads < 1)
+		error("invalid number of threads: %s", optarg);
+	    break;
+	default:
+	    usage();
+	}
+    }
+    argc -= optind;
+    argv += optind;
+    if(argc < 1 || argc > 2)
+	usage();
+#ifndef ENABLE_THREADSAFE
+    if(option_nthreads > 1) {
+	fprintf(stderr, "%s: -t ignored, netCDF library is not thread-safe\n", progname);
+	option_nthreads = 1;
+    }
+#endif
+
+    nfiles = argc;
+    memset(files, 0, sizeof(files));
+    for(f = 0; f < nfiles; f++) {
+	files[f].path = argv[f];
+	hash_file(&files[f]);
+    }
+    if(nfiles == 2) {
+	if(compare(&files[0], &files[1]))
+	    exitcode = 1;
+    } else {
+	if(!option_quiet)
+	    for(i = 0; i < files[0].nentries; i++)
+		print_digest(files[0].entries[i].digest, files[0].entries[i].path);
+	print_digest(files[0].digest, files[0].path);
+    }
+    for(f = 0; f < nfiles; f++)
+	free_entries(&files[f]);
+    exit(exitcode);
+}
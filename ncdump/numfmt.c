@@ -0,0 +1,293 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Fast number formatting for ncdump; see numfmt.h */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include "numfmt.h"
+
+static const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const unsigned long long p10[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+/* Write the decimal digits of v ending just before end, and return
+ * where they start */
+static char *
+put_digits(char *end, unsigned long long v)
+{
+    char *p = end;
+    while(v >= 100) {
+	unsigned r = (unsigned)(v % 100);
+	v /= 100;
+	p -= 2;
+	memcpy(p, &digit_pairs[2 * r], 2);
+    }
+    if(v >= 10) {
+	p -= 2;
+	memcpy(p, &digit_pairs[2 * v], 2);
+    } else {
+	*--p = (char)('0' + v);
+    }
+    return p;
+}
+
+int
+numfmt_llu(char *buf, unsigned long long v)
+{
+    char tmp[NUMFMT_LEN];
+    char *p = put_digits(tmp + sizeof(tmp), v);
+    int len = (int)(tmp + sizeof(tmp) - p);
+    memcpy(buf, p, (size_t)len);
+    buf[len] = '\0';
+    return len;
+}
+
+int
+numfmt_lld(char *buf, long long v)
+{
+    if(v < 0) {
+	buf[0] = '-';
+	return 1 + numfmt_llu(buf + 1, 0ULL - (unsigned long long)v);
+    }
+    return numfmt_llu(buf, (unsigned long long)v);
+}
+
+int
+numfmt_g_digits(const char *fmt)
+{
+    int digits = 0;
+    const char *p;
+
+    if(fmt == NULL || fmt[0] != '%' || fmt[1] != '.')
+	return -1;
+    for(p = fmt + 2; p < fmt + 4 && *p >= '0' && *p <= '9'; p++)
+	digits = 10 * digits + (*p - '0');
+    if(p == fmt + 2 || p[0] != 'g' || p[1] != '\0')
+	return -1;
+    return digits;
+}
+
+#if defined(__SIZEOF_INT128__) && DBL_MANT_DIG == 53 && DBL_MAX_EXP == 1024
+
+typedef unsigned __int128 u128;
+
+/* Where the fraction dropped by scale() lies */
+#define FRAC_ZERO 0
+#define FRAC_BELOW_HALF 1
+#define FRAC_HALF 2
+#define FRAC_ABOVE_HALF 3
+
+static const unsigned long long p5[28] = {
+    1ULL, 5ULL, 25ULL, 125ULL, 625ULL, 3125ULL, 15625ULL, 78125ULL,
+    390625ULL, 1953125ULL, 9765625ULL, 48828125ULL, 244140625ULL,
+    1220703125ULL, 6103515625ULL, 30517578125ULL, 152587890625ULL,
+    762939453125ULL, 3814697265625ULL, 19073486328125ULL, 95367431640625ULL,
+    476837158203125ULL, 2384185791015625ULL, 11920928955078125ULL,
+    59604644775390625ULL, 298023223876953125ULL, 1490116119384765625ULL,
+    7450580596923828125ULL
+};
+
+/* 5 to the n, for n up to 54 */
+static u128
+pow5_128(int n)
+{
+    if(n < 28)
+	return p5[n];
+    return (u128)p5[27] * p5[n - 27];
+}
+
+/* floor(n * log10(2)), exact for |n| <= 1650 */
+static int
+log10_pow2(int n)
+{
+    if(n >= 0)
+	return (int)(((unsigned)n * 78913u) >> 18);
+    return -(int)(((unsigned)-n * 78913u) >> 18) - 1;
+}
+
+/* Split m * 2^e * 10^k into an integer part *qp and where the
+ * fraction lies, *fracp. Return 0 if that can not be done in 128
+ * bits. */
+static int
+scale(unsigned long long m, int e, int k, u128 *qp, int *fracp)
+{
+    u128 num = m, den = 1, q, rem;
+    int shift = 0;
+
+    /* 10^k is 5^k * 2^k, and 5^k has at most k * 2.3223 + 1 bits */
+    if(k > 54 || k < -54)
+	return 0;
+    if(k >= 0) {
+	if(64 - __builtin_clzll(m) + ((k * 1189) >> 9) + 1 > 127)
+	    return 0;
+	num *= pow5_128(k);
+    } else {
+	den = pow5_128(-k);
+    }
+    e += k;
+    if(e >= 0) {
+	if(e >= 127 || (num >> (127 - e)) != 0)
+	    return 0;
+	num <<= e;
+    } else {
+	shift = -e;
+	if(shift >= 127 || (den >> (127 - shift)) != 0)
+	    return 0;
+	den <<= shift;
+    }
+    if(k >= 0) {
+	/* the common case, dividing by a power of 2 */
+	q = num >> shift;
+	rem = num & (den - 1);
+    } else if((num >> 64) == 0 && (den >> 64) == 0) {
+	q = (unsigned long long)num / (unsigned long long)den;
+	rem = (unsigned long long)num % (unsigned long long)den;
+    } else {
+	q = num / den;
+	rem = num % den;
+    }
+    if(rem == 0)
+	*fracp = FRAC_ZERO;
+    else if(rem < den - rem)
+	*fracp = FRAC_BELOW_HALF;
+    else if(rem == den - rem)
+	*fracp = FRAC_HALF;
+    else
+	*fracp = FRAC_ABOVE_HALF;
+    *qp = q;
+    return 1;
+}
+
+int
+numfmt_g(char *buf, double v, int digits)
+{
+    char d[NUMFMT_LEN];
+    char *p = buf;
+    unsigned long long bits, m, n;
+    u128 q;
+    int e, x, frac, nd, i;
+
+    if(digits < 1 || digits > 17 || !isfinite(v))
+	return -1;
+    if(signbit(v)) {
+	*p++ = '-';
+	v = -v;
+    }
+    if(v == 0) {
+	*p++ = '0';
+	*p = '\0';
+	return (int)(p - buf);
+    }
+
+    /* v is exactly m * 2^e */
+    memcpy(&bits, &v, sizeof(bits));
+    e = (int)(bits >> 52);
+    if(e == 0)			/* subnormal */
+	return -1;
+    m = (bits & ((1ULL << 52) - 1)) | (1ULL << 52);
+    e -= 1075;
+    /* 10^x <= 2^(e+52) <= v < 10^(x+2) */
+    x = log10_pow2(e + 52);
+    i = __builtin_ctzll(m);
+    m >>= i;
+    e += i;
+
+    /* digits or digits+1 significant digits of v, rounded down */
+    if(!scale(m, e, digits - 1 - x, &q, &frac))
+	return -1;
+    n = (unsigned long long)q;
+    if(n >= p10[digits]) {
+	/* 10^(x+1) <= v: drop the extra digit */
+	unsigned last = (unsigned)(n % 10);
+	n /= 10;
+	x++;
+	if(last == 0)
+	    frac = (frac == FRAC_ZERO ? FRAC_ZERO : FRAC_BELOW_HALF);
+	else if(last < 5)
+	    frac = FRAC_BELOW_HALF;
+	else if(last == 5)
+	    frac = (frac == FRAC_ZERO ? FRAC_HALF : FRAC_ABOVE_HALF);
+	else
+	    frac = FRAC_ABOVE_HALF;
+    }
+    /* round to nearest, ties to even, as printf does */
+    if(frac == FRAC_ABOVE_HALF || (frac == FRAC_HALF && (n & 1)))
+	n++;
+    if(n == p10[digits]) {
+	n = p10[digits - 1];
+	x++;
+    }
+    put_digits(d + digits, n);
+    /* %g drops trailing zeros */
+    for(nd = digits; nd > 1 && d[nd - 1] == '0'; nd--)
+	;
+
+    if(x < -4 || x >= digits) {	/* %e style */
+	*p++ = d[0];
+	if(nd > 1) {
+	    *p++ = '.';
+	    memcpy(p, d + 1, (size_t)(nd - 1));
+	    p += nd - 1;
+	}
+	*p++ = 'e';
+	if(x < 0) {
+	    *p++ = '-';
+	    x = -x;
+	} else {
+	    *p++ = '+';
+	}
+	if(x < 10)
+	    *p++ = '0';
+	p += numfmt_llu(p, (unsigned long long)x);
+    } else if(x >= 0) {		/* %f style, v >= 1 */
+	memcpy(p, d, (size_t)(x + 1));
+	p += x + 1;
+	if(nd > x + 1) {
+	    *p++ = '.';
+	    memcpy(p, d + x + 1, (size_t)(nd - x - 1));
+	    p += nd - x - 1;
+	}
+    } else {			/* %f style, v < 1 */
+	*p++ = '0';
+	*p++ = '.';
+	for(i = 0; i < -x - 1; i++)
+	    *p++ = '0';
+	memcpy(p, d, (size_t)nd);
+	p += nd;
+    }
+    *p = '\0';
+    return (int)(p - buf);
+}
+
+#else /* no 128-bit integers or not IEEE doubles */
+
+int
+numfmt_g(char *buf, double v, int digits)
+{
+    return -1;
+}
+
+#endif
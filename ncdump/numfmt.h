@@ -0,0 +1,46 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/*
+ * Fast conversion of numbers to text for ncdump data output.
+ *
+ * These give exactly what snprintf gives for the formats ncdump uses
+ * by default ("%d", "%u", "%lld", "%llu" and "%.Ng", where N is set
+ * by the -p option), without going through the general printf
+ * machinery. Floating-point values are rounded exactly, with integer
+ * arithmetic on the binary value, so the digits are the correctly
+ * rounded ones printf produces. Values that would need more than 128
+ * bits for that, and precisions above 17 digits, are left to the
+ * caller to format with snprintf.
+ */
+
+#ifndef _NUMFMT_H_
+#define _NUMFMT_H_
+
+/* Big enough for any output of the functions below */
+#define NUMFMT_LEN 32
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Return N if fmt is exactly "%.Ng", otherwise -1 */
+extern int numfmt_g_digits(const char *fmt);
+
+/* Write v as "%.<digits>g" would to buf, with a trailing null, and
+ * return the number of characters, or -1 if v is not finite or needs
+ * snprintf. */
+extern int numfmt_g(char *buf, double v, int digits);
+
+/* Write v as "%lld" or "%llu" would to buf, with a trailing null, and
+ * return the number of characters. */
+extern int numfmt_lld(char *buf, long long v);
+extern int numfmt_llu(char *buf, unsigned long long v);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /*_NUMFMT_H_*/
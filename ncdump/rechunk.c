@@ -0,0 +1,297 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Rechunking planner and copier for nccopy; see rechunk.h */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#include "netcdf.h"
+#include "utils.h"
+#include "copypool.h"
+#include "rechunk.h"
+
+static size_t
+gcd(size_t a, size_t b)
+{
+    while(b != 0) {
+	size_t t = a % b;
+	a = b;
+	b = t;
+    }
+    return a;
+}
+
+/* Least common multiple of a and b, but at most cap */
+static size_t
+lcm_capped(size_t a, size_t b, size_t cap)
+{
+    size_t m = a / gcd(a, b);
+    if(m > cap / b)
+	return cap;
+    m *= b;
+    return (m < cap ? m : cap);
+}
+
+/* Bytes of a block, as a double so it can not overflow */
+static double
+block_bytes(int rank, const size_t *blk, size_t value_size)
+{
+    double bytes = (double)value_size;
+    int d;
+    for(d = 0; d < rank; d++)
+	bytes *= (double)blk[d];
+    return bytes;
+}
+
+/* Grow blk toward target while it fits in budget bytes, always by a
+ * whole factor (or up to target), so that a block still covers whole
+ * chunks of the shape it started from. Either the last dimension not
+ * at its target grows first, which keeps runs of values long, or the
+ * dimension furthest from its target. */
+static void
+grow(int rank, size_t *blk, const size_t *target, size_t value_size,
+     size_t budget, int inner_first)
+{
+    for(;;) {
+	int d, best = -1;
+	double ratio = 1.0;
+	double f;
+	for(d = 0; d < rank; d++) {
+	    double r = (double)target[d] / (double)blk[d];
+	    if(blk[d] < target[d] && (inner_first || r > ratio)) {
+		ratio = r;
+		best = d;
+	    }
+	}
+	if(best < 0)
+	    break;
+	f = (double)budget / block_bytes(rank, blk, value_size);
+	if(f < 2.0)
+	    break;
+	if(f >= ratio)
+	    blk[best] = target[best];
+	else
+	    blk[best] *= (size_t)f;
+    }
+}
+
+int
+rechunk_plan(int rank, const size_t *dims, const size_t *inchunks,
+	     const size_t *outchunks, size_t value_size, size_t budget,
+	     rechunk_plan_t *plan)
+{
+    size_t n = (size_t)(rank > 0 ? rank : 1);
+    size_t *target;
+    int d;
+
+    memset(plan, 0, sizeof(rechunk_plan_t));
+    plan->rank = rank;
+    plan->read = (size_t *) emalloc(n * sizeof(size_t));
+    plan->write = (size_t *) emalloc(n * sizeof(size_t));
+    plan->temp = (size_t *) emalloc(n * sizeof(size_t));
+    target = (size_t *) emalloc(n * sizeof(size_t));
+
+    /* Smallest block covering whole chunks of both files */
+    for(d = 0; d < rank; d++) {
+	size_t len = (dims[d] > 0 ? dims[d] : 1);
+	size_t ic = (inchunks[d] > 0 && inchunks[d] < len ? inchunks[d] : len);
+	size_t oc = (outchunks[d] > 0 && outchunks[d] < len ? outchunks[d] : len);
+	plan->read[d] = ic;
+	plan->write[d] = oc;
+	target[d] = lcm_capped(ic, oc, len);
+    }
+
+    if(block_bytes(rank, target, value_size) <= (double)budget) {
+	/* One pass, in the largest such blocks that fit */
+	plan->passes = 1;
+	for(d = 0; d < rank; d++)
+	    plan->read[d] = target[d];
+	for(d = 0; d < rank; d++)
+	    target[d] = (dims[d] > 0 ? dims[d] : 1);
+	grow(rank, plan->read, target, value_size, budget, 1);
+	memcpy(plan->write, plan->read, n * sizeof(size_t));
+	memcpy(plan->temp, plan->read, n * sizeof(size_t));
+    } else {
+	/* Two passes: read whole input chunks, write whole output
+	 * chunks, each block as big as fits */
+	plan->passes = 2;
+	grow(rank, plan->read, target, value_size, budget, 0);
+	grow(rank, plan->write, target, value_size, budget, 0);
+	/* A temporary chunk must lie in one block of each pass */
+	for(d = 0; d < rank; d++) {
+	    size_t len = (dims[d] > 0 ? dims[d] : 1);
+	    size_t r = plan->read[d], w = plan->write[d];
+	    if(r >= len && w >= len)
+		plan->temp[d] = len;
+	    else if(r >= len)
+		plan->temp[d] = w;
+	    else if(w >= len)
+		plan->temp[d] = r;
+	    else
+		plan->temp[d] = gcd(r, w);
+	}
+    }
+    free(target);
+    return NC_NOERR;
+}
+
+void
+rechunk_plan_free(rechunk_plan_t *plan)
+{
+    free(plan->read);
+    free(plan->write);
+    free(plan->temp);
+    memset(plan, 0, sizeof(rechunk_plan_t));
+}
+
+/* Copy (igrp,varid) to (ogrp,ovarid) one block of shape blk at a
+ * time, through the copy pool if it is running, where the workers
+ * store the output chunks themselves if encode is not NULL. */
+static int
+copy_blocks(int igrp, int varid, int ogrp, int ovarid, int rank,
+	    const size_t *dims, const size_t *blk, size_t value_size,
+	    const copypool_encode_t *encode)
+{
+    int stat = NC_NOERR;
+    size_t n = (size_t)rank;
+    size_t *start = (size_t *) emalloc(2 * n * sizeof(size_t));
+    size_t *count = start + n;
+    void *buf = NULL;
+    int d;
+
+    if(copypool_nthreads() == 0) {
+	size_t nvals = 1;
+	for(d = 0; d < rank; d++)
+	    nvals *= blk[d];
+	buf = emalloc(nvals * value_size);
+    }
+    memset(start, 0, n * sizeof(size_t));
+    for(;;) {
+	size_t nvals = 1;
+	for(d = 0; d < rank; d++) {
+	    count[d] = dims[d] - start[d];
+	    if(count[d] > blk[d])
+		count[d] = blk[d];
+	    nvals *= count[d];
+	}
+	if(buf == NULL) {
+	    if((stat = copypool_submit(igrp, varid, ogrp, ovarid, rank, start,
+				       count, nvals, nvals * value_size,
+				       COPYPOOL_FREE_NONE, encode)))
+		goto done;
+	} else {
+	    if((stat = nc_get_vara(igrp, varid, start, count, buf))) goto done;
+	    if((stat = nc_put_vara(ogrp, ovarid, start, count, buf))) goto done;
+	}
+	/* next block, last dimension fastest */
+	for(d = rank - 1; d >= 0; d--) {
+	    start[d] += blk[d];
+	    if(start[d] < dims[d])
+		break;
+	    start[d] = 0;
+	}
+	if(d < 0)
+	    break;
+    }
+done:
+    free(buf);
+    free(start);
+    return stat;
+}
+
+/* Create the temporary file, with a name made unique by adding six
+ * characters to tmpbase. Where mkstemp() is missing, the name is
+ * tmpbase itself, and an existing file of that name is an error. */
+static int
+create_tmpfile(const char *tmpbase, char *tmpname, int *tmpidp)
+{
+    int stat;
+#ifdef HAVE_MKSTEMP
+    int fd;
+
+    strcpy(tmpname, tmpbase);
+    strcat(tmpname, "XXXXXX");
+    if((fd = mkstemp(tmpname)) < 0)
+	return errno;
+    close(fd);
+    /* Only the empty file just made is clobbered */
+    if((stat = nc_create(tmpname, NC_CLOBBER | NC_NETCDF4, tmpidp)))
+	remove(tmpname);
+#else
+    strcpy(tmpname, tmpbase);
+    stat = nc_create(tmpname, NC_NOCLOBBER | NC_NETCDF4, tmpidp);
+#endif
+    return stat;
+}
+
+int
+rechunk_copy(int igrp, int varid, int ogrp, int ovarid,
+	     const rechunk_plan_t *plan, const char *tmpbase,
+	     const copypool_encode_t *encode)
+{
+    int stat = NC_NOERR;
+    int rank = plan->rank;
+    int *dimids = (int *) emalloc(((size_t)rank + 1) * sizeof(int));
+    size_t *dims = (size_t *) emalloc(((size_t)rank + 1) * sizeof(size_t));
+    nc_type vartype;
+    size_t value_size;
+    char *tmpname = NULL;
+    int tmpid = -1, tmpvarid;
+    int d;
+
+    if((stat = nc_inq_vardimid(igrp, varid, dimids))) goto done;
+    for(d = 0; d < rank; d++)
+	if((stat = nc_inq_dimlen(igrp, dimids[d], &dims[d]))) goto done;
+    if((stat = nc_inq_vartype(igrp, varid, &vartype))) goto done;
+    if((stat = nc_inq_type(igrp, vartype, NULL, &value_size))) goto done;
+
+    if(plan->passes == 1) {
+	stat = copy_blocks(igrp, varid, ogrp, ovarid, rank, dims,
+			   plan->read, value_size, encode);
+	goto done;
+    }
+
+    tmpname = (char *) emalloc(strlen(tmpbase) + strlen("XXXXXX") + 1);
+    if((stat = create_tmpfile(tmpbase, tmpname, &tmpid))) {
+	tmpid = -1;
+	goto done;
+    }
+    for(d = 0; d < rank; d++) {
+	char name[NC_MAX_NAME + 1];
+	snprintf(name, sizeof(name), "d%d", d);
+	if((stat = nc_def_dim(tmpid, name, dims[d], &dimids[d]))) goto done;
+    }
+    if((stat = nc_set_fill(tmpid, NC_NOFILL, NULL))) goto done;
+    if((stat = nc_def_var(tmpid, "v", vartype, rank, dimids, &tmpvarid))) goto done;
+    if((stat = nc_def_var_chunking(tmpid, tmpvarid, NC_CHUNKED, plan->temp))) goto done;
+    if((stat = nc_enddef(tmpid))) goto done;
+    if((stat = copy_blocks(igrp, varid, tmpid, tmpvarid, rank, dims,
+			   plan->read, value_size, NULL))) goto done;
+    if((stat = copypool_wait())) goto done;
+    if((stat = copy_blocks(tmpid, tmpvarid, ogrp, ovarid, rank, dims,
+			   plan->write, value_size, encode))) goto done;
+
+done:
+    /* Let the workers finish with the temporary file before it goes */
+    if(tmpid >= 0) {
+	int wstat = copypool_wait();
+	if(stat == NC_NOERR)
+	    stat = wstat;
+	wstat = nc_close(tmpid);
+	if(stat == NC_NOERR)
+	    stat = wstat;
+	remove(tmpname);
+    }
+    free(tmpname);
+    free(dimids);
+    free(dims);
+    return stat;
+}
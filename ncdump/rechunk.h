@@ -0,0 +1,62 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/*
+ * Rechunking for nccopy with a bounded amount of memory.
+ *
+ * Copying a variable a piece at a time in the input's chunk shape,
+ * when the output has a very different chunk shape (say from one
+ * chunk per time to one chunk per time series), writes each output
+ * chunk many times over, and without a chunk cache big enough for a
+ * whole row of output chunks that means reading, decompressing,
+ * compressing and writing them each time. Going in the output's
+ * chunk shape instead reads each input chunk many times.
+ *
+ * The planner picks blocks that cover whole chunks of both files
+ * where the memory allows, so the copy is one pass that reads each
+ * input chunk and writes each output chunk once. Where it does not,
+ * the copy takes two passes through an uncompressed temporary file:
+ * the first reads blocks of whole input chunks and the second writes
+ * blocks of whole output chunks, and the temporary file is chunked
+ * so that each of its chunks is written by one block of the first
+ * pass and read by one block of the second.
+ */
+
+#ifndef _RECHUNK_H_
+#define _RECHUNK_H_
+
+#include "netcdf.h"
+#include "copypool.h"
+
+typedef struct rechunk_plan_t {
+    int rank;
+    int passes;		/* 1, or 2 through a temporary file */
+    size_t *read;	/* block shape of the first pass */
+    size_t *write;	/* block shape of the last pass */
+    size_t *temp;	/* chunk shape of the temporary file, if 2 passes */
+} rechunk_plan_t;
+
+/* Plan the copy of a variable of the given shape from input chunks
+ * inchunks to output chunks outchunks, with blocks of at most
+ * budget bytes where possible. Blocks are never smaller than one
+ * chunk. Free the plan with rechunk_plan_free(). */
+extern int rechunk_plan(int rank, const size_t *dims, const size_t *inchunks,
+			const size_t *outchunks, size_t value_size,
+			size_t budget, rechunk_plan_t *plan);
+
+extern void rechunk_plan_free(rechunk_plan_t *plan);
+
+/* Copy variable (igrp,varid) to (ogrp,ovarid) following a plan for
+ * the variable, which must have a fixed size type. With two passes,
+ * the temporary file is given a new, unique name that starts with
+ * tmpbase, and is removed afterwards.
+ * Blocks go through the copy pool of nccopy -t when it is running,
+ * and encode, if not NULL, is passed on with the blocks written to
+ * the output. */
+extern int rechunk_copy(int igrp, int varid, int ogrp, int ovarid,
+			const rechunk_plan_t *plan, const char *tmpbase,
+			const copypool_encode_t *encode);
+
+#endif /*_RECHUNK_H_*/
@@ -0,0 +1,122 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* SHA-256 (FIPS 180-4), for nchash; see sha256.h */
+
+#include "config.h"
+#include <string.h>
+#include "sha256.h"
+
+static const unsigned int k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/* Hash the 64-byte blocks at p */
+static void
+compress(sha256_t *ctx, const unsigned char *p, size_t nblocks)
+{
+    unsigned int w[64];
+    unsigned int a, b, c, d, e, f, g, h, t1, t2;
+    int i;
+
+    for(; nblocks > 0; nblocks--, p += 64) {
+	for(i = 0; i < 16; i++)
+	    w[i] = ((unsigned int)p[4*i] << 24) | ((unsigned int)p[4*i+1] << 16)
+		| ((unsigned int)p[4*i+2] << 8) | (unsigned int)p[4*i+3];
+	for(i = 16; i < 64; i++) {
+	    unsigned int s0 = ROTR(w[i-15], 7) ^ ROTR(w[i-15], 18) ^ (w[i-15] >> 3);
+	    unsigned int s1 = ROTR(w[i-2], 17) ^ ROTR(w[i-2], 19) ^ (w[i-2] >> 10);
+	    w[i] = w[i-16] + s0 + w[i-7] + s1;
+	}
+	a = ctx->h[0]; b = ctx->h[1]; c = ctx->h[2]; d = ctx->h[3];
+	e = ctx->h[4]; f = ctx->h[5]; g = ctx->h[6]; h = ctx->h[7];
+	for(i = 0; i < 64; i++) {
+	    t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25))
+		+ ((e & f) ^ (~e & g)) + k[i] + w[i];
+	    t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22))
+		+ ((a & b) ^ (a & c) ^ (b & c));
+	    h = g; g = f; f = e; e = d + t1;
+	    d = c; c = b; b = a; a = t1 + t2;
+	}
+	ctx->h[0] += a; ctx->h[1] += b; ctx->h[2] += c; ctx->h[3] += d;
+	ctx->h[4] += e; ctx->h[5] += f; ctx->h[6] += g; ctx->h[7] += h;
+    }
+}
+
+void
+sha256_init(sha256_t *ctx)
+{
+    static const unsigned int h0[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+	0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    memcpy(ctx->h, h0, sizeof(h0));
+    ctx->nbytes = 0;
+    ctx->nblock = 0;
+}
+
+void
+sha256_update(sha256_t *ctx, const void *data, size_t len)
+{
+    const unsigned char *p = (const unsigned char *)data;
+
+    ctx->nbytes += len;
+    if(ctx->nblock > 0) {
+	size_t n = 64 - ctx->nblock;
+	if(n > len)
+	    n = len;
+	memcpy(ctx->block + ctx->nblock, p, n);
+	ctx->nblock += n;
+	p += n;
+	len -= n;
+	if(ctx->nblock < 64)
+	    return;
+	compress(ctx, ctx->block, 1);
+	ctx->nblock = 0;
+    }
+    if(len >= 64) {
+	compress(ctx, p, len / 64);
+	p += len & ~(size_t)63;
+	len &= 63;
+    }
+    memcpy(ctx->block, p, len);
+    ctx->nblock = len;
+}
+
+void
+sha256_final(sha256_t *ctx, unsigned char digest[SHA256_LEN])
+{
+    unsigned long long nbits = ctx->nbytes * 8;
+    int i;
+
+    ctx->block[ctx->nblock++] = 0x80;
+    if(ctx->nblock > 56) {
+	memset(ctx->block + ctx->nblock, 0, 64 - ctx->nblock);
+	compress(ctx, ctx->block, 1);
+	ctx->nblock = 0;
+    }
+    memset(ctx->block + ctx->nblock, 0, 56 - ctx->nblock);
+    for(i = 0; i < 8; i++)
+	ctx->block[56 + i] = (unsigned char)(nbits >> (56 - 8 * i));
+    compress(ctx, ctx->block, 1);
+    for(i = 0; i < 8; i++) {
+	digest[4*i] = (unsigned char)(ctx->h[i] >> 24);
+	digest[4*i+1] = (unsigned char)(ctx->h[i] >> 16);
+	digest[4*i+2] = (unsigned char)(ctx->h[i] >> 8);
+	digest[4*i+3] = (unsigned char)ctx->h[i];
+    }
+}
@@ -0,0 +1,26 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* SHA-256 (FIPS 180-4), for nchash */
+
+#ifndef _SHA256_H_
+#define _SHA256_H_
+
+#include <stddef.h>
+
+#define SHA256_LEN 32		/* bytes in a digest */
+
+typedef struct sha256_t {
+    unsigned int h[8];
+    unsigned long long nbytes;	/* total hashed so far */
+    unsigned char block[64];	/* partial block */
+    size_t nblock;
+} sha256_t;
+
+extern void sha256_init(sha256_t *ctx);
+extern void sha256_update(sha256_t *ctx, const void *data, size_t len);
+extern void sha256_final(sha256_t *ctx, unsigned char digest[SHA256_LEN]);
+
+#endif /*_SHA256_H_*/
@@ -41,6 +41,14 @@ ls -l $i.nc
     diff nccopy3_copy_of_$i.cdl tmp_tst_nccopy3.cdl
     rm nccopy3_copy_of_$i.nc nccopy3_copy_of_$i.cdl tmp_tst_nccopy3.cdl
 done
+echo "*** Testing nccopy -t 4 on ncdump/*.nc files"
+for i in $TESTFILES ; do
+    ${NCCOPY} -t 4 -m 1k $i.nc nccopy3_copy_of_$i.nc
+    ${NCDUMP} -n nccopy3_copy_of_$i $i.nc > tmp_tst_nccopy3.cdl
+    ${NCDUMP} nccopy3_copy_of_$i.nc > nccopy3_copy_of_$i.cdl
+    diff nccopy3_copy_of_$i.cdl tmp_tst_nccopy3.cdl
+    rm nccopy3_copy_of_$i.nc nccopy3_copy_of_$i.cdl tmp_tst_nccopy3.cdl
+done
 echo "*** Testing nccopy -u"
 ${NCGEN} -b $srcdir/tst_brecs.cdl
 # convert record dimension to fixed-size dimension
@@ -50,5 +58,31 @@ ${NCDUMP} nccopy3_copy_of_tst_brecs.nc >  nccopy3_copy_of_tst_brecs.cdl
 diff -b nccopy3_copy_of_tst_brecs.cdl tmp_tst_nccopy3.cdl
 rm nccopy3_copy_of_tst_brecs.cdl tmp_tst_nccopy3.cdl tst_brecs.nc nccopy3_copy_of_tst_brecs.nc
 
+echo "*** Testing nccopy -v and -V on a classic file"
+cat > tmp_tst_nccopy3.cdl <<EOF
+netcdf tst_nccopy3_v {
+dimensions:
+	n = 3 ;
+variables:
+	int a(n) ;
+	int b(n) ;
+data:
+ a = 1, 2, 3 ;
+ b = 4, 5, 6 ;
+}
+EOF
+${NCGEN} -b -o tst_nccopy3_v.nc tmp_tst_nccopy3.cdl
+# -v copies the data of a only; b is left unwritten
+$NCCOPY -v a tst_nccopy3_v.nc nccopy3_copy_of_tst_nccopy3_v.nc
+${NCDUMP} nccopy3_copy_of_tst_nccopy3_v.nc > nccopy3_copy_of_tst_nccopy3_v.cdl
+grep ' a = 1, 2, 3 ;' nccopy3_copy_of_tst_nccopy3_v.cdl
+grep ' b = 0, 0, 0 ;' nccopy3_copy_of_tst_nccopy3_v.cdl
+# -V leaves b out
+$NCCOPY -V a tst_nccopy3_v.nc nccopy3_copy_of_tst_nccopy3_v.nc
+${NCDUMP} nccopy3_copy_of_tst_nccopy3_v.nc > nccopy3_copy_of_tst_nccopy3_v.cdl
+grep ' a = 1, 2, 3 ;' nccopy3_copy_of_tst_nccopy3_v.cdl
+if grep ' b' nccopy3_copy_of_tst_nccopy3_v.cdl ; then exit 1; fi
+rm tmp_tst_nccopy3.cdl tst_nccopy3_v.nc nccopy3_copy_of_tst_nccopy3_v.nc nccopy3_copy_of_tst_nccopy3_v.cdl
+
 echo "*** All nccopy tests passed!"
 exit 0
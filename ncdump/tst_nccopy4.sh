@@ -32,6 +32,23 @@ ${NCDUMP} copy_of_$i.nc > copy_of_$i.cdl
     diff copy_of_$i.cdl tmp.cdl
     rm copy_of_$i.nc copy_of_$i.cdl tmp.cdl
 done
+echo "*** Testing nccopy -t 4 on ncdump/*.nc files"
+for i in $TESTFILES ; do
+    # An existing file named like the rechunking temporary file is left alone
+    echo keep > copy_of_$i.nc.rechunk
+    ${NCCOPY} -t 4 -m 1k $i.nc copy_of_$i.nc
+    ${NCDUMP} -n copy_of_$i $i.nc > tmp.cdl
+    ${NCDUMP} copy_of_$i.nc > copy_of_$i.cdl
+    diff copy_of_$i.cdl tmp.cdl
+    test "`cat copy_of_$i.nc.rechunk`" = keep
+    rm copy_of_$i.nc.rechunk
+    test "`ls copy_of_$i.nc.rechunk* 2>/dev/null`" = ""
+    # the workers deflate the chunks themselves
+    ${NCCOPY} -t 4 -m 1k -d1 -s $i.nc copy_of_$i.nc
+    ${NCDUMP} copy_of_$i.nc > copy_of_$i.cdl
+    diff copy_of_$i.cdl tmp.cdl
+    rm copy_of_$i.nc copy_of_$i.cdl tmp.cdl
+done
 # echo "*** Testing compression of deflatable files ..."
 ./tst_compress
 echo "*** Test nccopy -d1 can compress a classic format file ..."
@@ -88,6 +105,14 @@ diff tmp.cdl tmp-unchunked.cdl
 ${NCCOPY} -c // tmp-chunked.nc tmp-unchunked.nc
 ${NCDUMP} -n tmp tmp-unchunked.nc > tmp-unchunked.cdl
 diff tmp.cdl tmp-unchunked.cdl
+echo "*** Test that nccopy -c can rechunk through a temporary file"
+${NCCOPY} -m 4k -c dim0/7,dim1/1,dim2/1,dim3/1,dim4/1,dim5/1,dim6/1 tmp-chunked.nc tmp-rechunked.nc
+${NCDUMP} -n tmp tmp-rechunked.nc > tmp-rechunked.cdl
+diff tmp.cdl tmp-rechunked.cdl
+test "`ls tmp-rechunked.nc.rechunk* 2>/dev/null`" = ""
+${NCCOPY} -t 4 -m 4k -c dim0/7,dim1/1,dim2/1,dim3/1,dim4/1,dim5/1,dim6/1 tmp-chunked.nc tmp-rechunked.nc
+${NCDUMP} -n tmp tmp-rechunked.nc > tmp-rechunked.cdl
+diff tmp.cdl tmp-rechunked.cdl
 echo "*** Test that nccopy -c works as intended for record dimension default (1)"
 ${NCGEN} -b -o tst_bug321.nc $srcdir/tst_bug321.cdl
 ${NCCOPY} -k nc7 -c"lat/2,lon/2" tst_bug321.nc tmp.nc
@@ -95,6 +120,27 @@ ${NCDUMP} -n tst_bug321 tmp.nc > tmp.cdl
 diff -b $srcdir/tst_bug321.cdl tmp.cdl
 # echo "*** Test that nccopy compression with chunking can improve compression"
 rm tst_chunking.nc tmp.nc tmp.cdl tmp-chunked.nc tmp-chunked.cdl tmp-unchunked.nc tmp-unchunked.cdl
+rm tmp-rechunked.nc tmp-rechunked.cdl
+echo "*** Test nccopy of several record variables copied as stored chunks"
+cat > tmp_recs.cdl <<EOF
+netcdf tmp_recs {
+dimensions:
+	t = UNLIMITED ;
+	x = 2 ;
+variables:
+	int a(t) ;
+	short b(t, x) ;
+data:
+ a = 1, 2, 3 ;
+ b = 4, 5, 6, 7, 8, 9 ;
+}
+EOF
+${NCGEN} -k nc4 -b -o tmp_recs.nc tmp_recs.cdl
+${NCCOPY} tmp_recs.nc tmp_recs_copy.nc
+${NCDUMP} tmp_recs.nc > tmp_recs.cdl
+${NCDUMP} -n tmp_recs tmp_recs_copy.nc > tmp_recs_copy.cdl
+diff tmp_recs.cdl tmp_recs_copy.cdl
+rm tmp_recs.nc tmp_recs_copy.nc tmp_recs.cdl tmp_recs_copy.cdl
 
 echo "*** All nccopy tests passed!"
 exit 0
@@ -0,0 +1,90 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+# This shell script tests that nchash gives the same digests for
+# copies of a classic file in other formats and with other chunking
+# and compression, and finds what differs between two files.
+
+set -e
+echo ""
+echo "*** Testing nchash"
+
+CLEANUP="tst_nchash*.nc tst_nchash*.cdl tst_nchash*.out"
+rm -f $CLEANUP
+
+# big spans several 4 MB leaves, mostly fill values
+cat > tst_nchash.cdl <<EOF
+netcdf tst_nchash {
+dimensions:
+	t = UNLIMITED ;
+	y = 300 ;
+	x = 100 ;
+	z = 100 ;
+	n = 8 ;
+variables:
+	float big(y, x, z) ;
+		big:units = "m" ;
+	double d(t, x) ;
+	char c(t, n) ;
+	short s ;
+		s:_FillValue = -1s ;
+
+// global attributes:
+		:title = "nchash test" ;
+data:
+
+ big = 1, 2, 3 ;
+
+ d = 0.5, 1.5, 2.5 ;
+
+ c = "one", "two" ;
+
+ s = 7 ;
+}
+EOF
+${NCGEN} -k nc3 -o tst_nchash.nc tst_nchash.cdl
+
+echo "*** Testing digests of copies in other formats"
+${NCCOPY} -k nc6 tst_nchash.nc tst_nchash_6.nc
+${NCHASH} -q tst_nchash.nc | cut -d' ' -f1 > tst_nchash.out
+${NCHASH} -q tst_nchash_6.nc | cut -d' ' -f1 > tst_nchash_6.out
+cmp tst_nchash.out tst_nchash_6.out
+${NCHASH} tst_nchash.nc tst_nchash_6.nc
+if ${NCCOPY} -k nc7 -d 1 -s -c big/30,50,50 tst_nchash.nc tst_nchash_7.nc 2>/dev/null ; then
+    echo "*** Testing digests of a compressed copy"
+    ${NCHASH} tst_nchash.nc tst_nchash_7.nc
+fi
+
+echo "*** Testing that threads give the same digests"
+${NCHASH} tst_nchash.nc > tst_nchash_1.out
+${NCHASH} -t 3 tst_nchash.nc 2>/dev/null > tst_nchash_3.out
+cmp tst_nchash_1.out tst_nchash_3.out
+
+echo "*** Testing that a changed value differs"
+sed -e 's/1, 2, 3 ;/1, 2, 4 ;/' tst_nchash.cdl > tst_nchash_d.cdl
+${NCGEN} -k nc3 -o tst_nchash_d.nc tst_nchash_d.cdl
+if ${NCHASH} tst_nchash.nc tst_nchash_d.nc > tst_nchash_d.out ; then
+    echo "*** FAIL: nchash found no difference" ; exit 1
+fi
+cat tst_nchash_d.out
+test "`cat tst_nchash_d.out`" = "differs: /big"
+if ${NCHASH} -a tst_nchash.nc tst_nchash_d.nc > /dev/null ; then
+    echo "*** FAIL: nchash -a found no difference" ; exit 1
+fi
+
+echo "*** Testing that a changed attribute differs, unless -a"
+sed -e 's/"m"/"km"/' tst_nchash.cdl > tst_nchash_a.cdl
+${NCGEN} -k nc3 -o tst_nchash_a.nc tst_nchash_a.cdl
+if ${NCHASH} -q tst_nchash.nc tst_nchash_a.nc ; then
+    echo "*** FAIL: nchash found no difference" ; exit 1
+fi
+${NCHASH} -a tst_nchash.nc tst_nchash_a.nc
+${NCHASH} -a -q tst_nchash.nc | cut -d' ' -f1 > tst_nchash.out
+${NCHASH} -a -q tst_nchash_a.nc | cut -d' ' -f1 > tst_nchash_a.out
+cmp tst_nchash.out tst_nchash_a.out
+
+echo "*** All nchash tests passed!"
+rm -f $CLEANUP
+exit 0
@@ -0,0 +1,244 @@
+/*
+Copyright 2018, UCAR/Unidata
+See COPYRIGHT file for copying and redistribution conditions.
+
+Test that the number formatting ncdump uses for data (numfmt.c) gives
+exactly what snprintf gives for the same formats, for every -p
+precision, and time the two against each other.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <limits.h>
+#include <sys/time.h>
+#include "numfmt.h"
+
+#define NVALS 200000
+#define NBENCH 1000000
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* xorshift, so the values are the same everywhere */
+static unsigned long long
+next_random(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+/* A mix of values: any bit pattern, any float, and values of the
+   sizes found in real data, some just below a power of ten */
+static double
+random_value(int i)
+{
+    unsigned long long r = next_random();
+    double v;
+    switch(i % 4) {
+    case 0:
+	memcpy(&v, &r, sizeof(v));
+	break;
+    case 1: {
+	float f;
+	unsigned int r32 = (unsigned int)r;
+	memcpy(&f, &r32, sizeof(f));
+	v = f;
+	break;
+    }
+    case 2:
+	v = (double)((long long)(r % 2000001) - 1000000) / pow(10, (double)(r % 12));
+	break;
+    default:
+	v = (double)(r % 100000) * pow(10, (double)((int)((r >> 40) % 30) - 15));
+	if(r & 1)
+	    v = nextafter(v, 0);
+	break;
+    }
+    return v;
+}
+
+/* Milliseconds since some point in the past */
+static double
+now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+static int
+check_g(double v, int digits, const char *fmt)
+{
+    char got[NUMFMT_LEN], want[NUMFMT_LEN * 4];
+    int len = numfmt_g(got, v, digits);
+    if(len < 0)
+	return 0;		/* left to snprintf */
+    snprintf(want, sizeof(want), fmt, v);
+    if(strcmp(got, want) != 0 || len != (int)strlen(want)) {
+	printf("\n%s of %.17g: got %s, expected %s\n", fmt, v, got, want);
+	return 1;
+    }
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing ncdump number formatting.\n");
+    printf("*** checking the %%.Ng formats...");
+    {
+	char fmt[16];
+	int digits;
+
+	if(numfmt_g_digits("%.7g") != 7) ERR;
+	if(numfmt_g_digits("%.15g") != 15) ERR;
+	if(numfmt_g_digits("%g") != -1) ERR;
+	if(numfmt_g_digits("%.7f") != -1) ERR;
+	if(numfmt_g_digits("%#.7g") != -1) ERR;
+	if(numfmt_g_digits("%.7g ") != -1) ERR;
+	if(numfmt_g_digits("%.123g") != -1) ERR;
+	for(digits = 1; digits <= 17; digits++) {
+	    snprintf(fmt, sizeof(fmt), "%%.%dg", digits);
+	    if(numfmt_g_digits(fmt) != digits) ERR;
+	}
+    }
+    SUMMARIZE_ERR;
+    printf("*** checking special values...");
+    {
+	static const double special[] = {
+	    0.0, 1.0, 0.5, 1.5, 2.5, 0.125, 9.5, 99.5, 999.5, 1e-4, 1e-5,
+	    9.9999999, 0.00009999995, 1e15, 1e16, 1e17, 1e22, 1e23,
+	    123456789012345678.0, FLT_MAX, FLT_MIN, DBL_MAX, DBL_MIN,
+	    9999999999.9999981, 9.9999999999999991e-06
+	};
+	char fmt[16];
+	int digits, i, k;
+
+	for(digits = 1; digits <= 17; digits++) {
+	    snprintf(fmt, sizeof(fmt), "%%.%dg", digits);
+	    for(i = 0; i < (int)(sizeof(special)/sizeof(special[0])); i++) {
+		if(check_g(special[i], digits, fmt)) ERR;
+		if(check_g(-special[i], digits, fmt)) ERR;
+	    }
+	    /* powers of ten and their neighbours */
+	    for(k = -40; k <= 40; k++) {
+		double p = pow(10, k);
+		if(check_g(p, digits, fmt)) ERR;
+		if(check_g(nextafter(p, 0), digits, fmt)) ERR;
+		if(check_g(nextafter(p, HUGE_VAL), digits, fmt)) ERR;
+		if(check_g((double)nextafterf((float)p, 0), digits, fmt)) ERR;
+		if(check_g(9.5 * p, digits, fmt)) ERR;
+		if(check_g(0.95 * p, digits, fmt)) ERR;
+	    }
+	}
+	if(numfmt_g(fmt, NAN, 7) != -1) ERR;
+	if(numfmt_g(fmt, HUGE_VAL, 7) != -1) ERR;
+	if(numfmt_g(fmt, 1.0, 0) != -1) ERR;
+	if(numfmt_g(fmt, 1.0, 18) != -1) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("*** checking random values...");
+    {
+	char fmt[16];
+	int digits, i;
+
+	for(digits = 1; digits <= 17; digits++) {
+	    snprintf(fmt, sizeof(fmt), "%%.%dg", digits);
+	    for(i = 0; i < NVALS; i++) {
+		double v = random_value(i);
+		if(isfinite(v) && check_g(v, digits, fmt)) ERR;
+	    }
+	}
+    }
+    SUMMARIZE_ERR;
+    printf("*** checking integers...");
+    {
+	static const long long special[] = {
+	    0, 1, -1, 9, 10, 99, 100, -100, 12345, INT_MAX, INT_MIN,
+	    LLONG_MAX, LLONG_MIN
+	};
+	char got[NUMFMT_LEN], want[NUMFMT_LEN];
+	int i;
+
+	for(i = 0; i < NVALS + (int)(sizeof(special)/sizeof(special[0])); i++) {
+	    long long v = (i < (int)(sizeof(special)/sizeof(special[0]))
+			   ? special[i] : (long long)next_random());
+	    if(i % 3 == 1)
+		v >>= (i % 60);
+	    numfmt_lld(got, v);
+	    snprintf(want, sizeof(want), "%lld", v);
+	    if(strcmp(got, want)) ERR;
+	    numfmt_llu(got, (unsigned long long)v);
+	    snprintf(want, sizeof(want), "%llu", (unsigned long long)v);
+	    if(strcmp(got, want)) ERR;
+	}
+    }
+    SUMMARIZE_ERR;
+    printf("*** timing against snprintf...\n");
+    {
+	static const struct Case {
+	    const char *name;
+	    int digits;		/* 0 for integers */
+	    int isfloat;
+	} cases[] = {
+	    {"float %.7g", 7, 1},
+	    {"double %.15g", 15, 0},
+	    {"double %.17g", 17, 0},
+	    {"int %d", 0, 0},
+	};
+	double *vals;
+	char buf[NUMFMT_LEN * 4];
+	int c, i;
+
+	if(!(vals = malloc(NBENCH * sizeof(double)))) ERR;
+	printf("%-14s %14s %14s\n", "format", "snprintf ns", "numfmt ns");
+	for(c = 0; c < (int)(sizeof(cases)/sizeof(cases[0])); c++) {
+	    char fmt[16];
+	    double t0, t1, t2;
+	    size_t total = 0;
+
+	    /* values like those in a typical data variable */
+	    for(i = 0; i < NBENCH; i++) {
+		unsigned long long r = next_random();
+		double v = ((double)(r % 2000001) - 1000000) *
+		    pow(10, (double)((int)((r >> 32) % 12) - 8));
+		vals[i] = (cases[c].isfloat ? (float)v : cases[c].digits ? v :
+			   (double)(int)(r % 2000000001 - 1000000000));
+	    }
+	    if(cases[c].digits)
+		snprintf(fmt, sizeof(fmt), "%%.%dg", cases[c].digits);
+	    t0 = now();
+	    for(i = 0; i < NBENCH; i++) {
+		if(cases[c].digits)
+		    total += (size_t)snprintf(buf, sizeof(buf), fmt, vals[i]);
+		else
+		    total += (size_t)snprintf(buf, sizeof(buf), "%d", (int)vals[i]);
+	    }
+	    t1 = now();
+	    for(i = 0; i < NBENCH; i++) {
+		int len = -1;
+		if(cases[c].digits)
+		    len = numfmt_g(buf, vals[i], cases[c].digits);
+		else
+		    len = numfmt_lld(buf, (int)vals[i]);
+		if(len < 0)
+		    len = snprintf(buf, sizeof(buf), fmt, vals[i]);
+		total -= (size_t)len;
+	    }
+	    t2 = now();
+	    if(total != 0) ERR;
+	    printf("%-14s %14.1f %14.1f\n", cases[c].name,
+		   (t1 - t0) * 1e6 / NBENCH, (t2 - t1) * 1e6 / NBENCH);
+	}
+	free(vals);
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
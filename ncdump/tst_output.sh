@@ -46,6 +46,16 @@ ${NCDUMP} -s tst_mslp.nc > tst_format_att.cdl
 echo "*** comparing ncdump -s of generated file with ref_tst_format_att.cdl ..."
 diff -b tst_format_att.cdl $srcdir/ref_tst_format_att.cdl
 
+echo "*** test output for ncdump -j"
+for i in tst_output_c0 tst_mslp ; do
+    for opts in "" "-b c" "-f f" "-l 20" "-p 3,5" ; do
+	${NCDUMP} $opts $i.nc > tst_output_serial.cdl
+	${NCDUMP} -j 4 $opts $i.nc > tst_output_j4.cdl
+	diff tst_output_serial.cdl tst_output_j4.cdl
+    done
+done
+rm -f tst_output_serial.cdl tst_output_j4.cdl
+
 echo "*** All ncgen and ncdump test output for classic format passed!"
 
 echo "*** Testing that ncgen with c0.cdl for 64-bit offset format."
@@ -244,8 +244,8 @@ nc_inq_varid2(int ncid, const char *path0, int* varidp, int* grpidp)
 
     /* Find the rightmost '/' and tag the start of the path */
     g = strrchr(path,'/');
-    if(g == NULL) {
-	v = path;
+    if(g == NULL || g == path) {
+	v = (g == NULL ? path : g + 1);
 	prefix = "/"; /* make sure not free'd */
     } else {
 	*g++ = '\0'; /* separate out the prefix */
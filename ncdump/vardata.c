@@ -18,6 +18,7 @@
 #include "ncdump.h"
 #include "indent.h"
 #include "vardata.h"
+#include "dumppool.h"
 #include "netcdf_aux.h"
 
 /* maximum len of string needed for one value of a primitive type */
@@ -68,7 +69,7 @@ lput(const char *cp) {
 	(void) fputs(LINEPIND, stdout);
 	linep = (int)strlen(LINEPIND) + indent_get();
     }
-    (void) fputs(cp,stdout);
+    (void) fwrite(cp, 1, nn, stdout);
     if (nn > 0 && cp[nn - 1] == '\n') {
 	linep = indent_get();
     } else
@@ -524,6 +525,100 @@ print_rows(
     return NC_NOERR;
 }
 
+/* Whether the values of a variable can be read and formatted by the
+ * workers of ncdump -j: numeric values of a variable with dimensions,
+ * where only the first may be unlimited, so no "{}" record markers
+ * are needed. */
+static bool_t
+pooled_dump(int ncid, const ncvar_t *vp)
+{
+    int id;
+    if(dumppool_nthreads() == 0 || vp->ndims < 1)
+	return false;
+    if(vp->type == NC_CHAR || vp->type > NC_UINT64)
+	return false;
+    if(vp->has_timeval && formatting_specs.string_times)
+	return false;
+    for(id = 1; id < vp->ndims; id++) {
+	if(is_unlim_dim(ncid, vp->dims[id]))
+	    return false;
+    }
+    return true;
+}
+
+/* Print the data of a variable like print_rows(), but with the
+ * values read and formatted by the workers of ncdump -j */
+static int
+print_rows_pooled(
+    int ncid,		/* netcdf id */
+    int varid,		/* variable id */
+    const ncvar_t *vp,	/* variable */
+    size_t vdims[]     	/* variable dimension sizes */
+    )
+{
+    int rank = vp->ndims;
+    size_t ncols = vdims[rank - 1]; /* number of values in a row */
+    size_t *cor = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    size_t iel = 0;		/* column of next value in its row */
+    safebuf_t *sb = sbuf_new();
+    int j;
+
+    for(j = 0; j < rank; j++)
+	cor[j] = 0;
+    NC_CHECK(dumppool_begin(ncid, varid, vp, vdims, print_any_val));
+    for(;;) {
+	const char *text;
+	size_t nvals;
+	NC_CHECK(dumppool_next(&text, &nvals));
+	if(nvals == 0)
+	    break;
+	for(; nvals > 0; nvals--, text += strlen(text) + 1) {
+	    bool_t lastrow;
+	    if(iel == 0 && formatting_specs.brief_data_cmnts && rank > 1) {
+		annotate_brief(vp, cor, vdims);
+	    }
+	    if(iel < ncols - 1) {
+		if (formatting_specs.full_data_cmnts) {
+		    printf("%s, ", text);
+		    annotate (vp, cor, (long)iel);
+		} else {
+		    sbuf_cpy(sb, text);
+		    sbuf_cat(sb, ", ");
+		    lput(sbuf_str(sb));
+		}
+		iel++;
+		continue;
+	    }
+	    /* last value in the row */
+	    lastrow = true;
+	    for(j = 0; j < rank - 1; j++) {
+		if (cor[j] != vdims[j] - 1) {
+		    lastrow = false;
+		    break;
+		}
+	    }
+	    if (formatting_specs.full_data_cmnts) {
+		printf("%s", text);
+		lastdelim (0, lastrow);
+		annotate (vp, cor, (long)iel);
+	    } else {
+		lput(text);
+		lastdelim2 (0, lastrow);
+	    }
+	    iel = 0;
+	    for(j = rank - 2; j >= 0; j--) {
+		if(++cor[j] < vdims[j])
+		    break;
+		cor[j] = 0;
+	    }
+	}
+    }
+    dumppool_end();
+    sbuf_free(sb);
+    free(cor);
+    return NC_NOERR;
+}
+
 /* Output the data for a single variable, in CDL syntax. */
 int
 vardata(
@@ -583,10 +678,13 @@ vardata(
 	if (vrank > 1)
 	  add[vrank-2] = 1;
     }
-    vals = emalloc(ncols * vp->tinfo->size);
-
-    NC_CHECK(print_rows(level, ncid, varid, vp, vdims, cor, edg, vals, marks_pending));
-    free(vals);
+    if(nels > 0 && pooled_dump(ncid, vp)) {
+	NC_CHECK(print_rows_pooled(ncid, varid, vp, vdims));
+    } else {
+	vals = emalloc(ncols * vp->tinfo->size);
+	NC_CHECK(print_rows(level, ncid, varid, vp, vdims, cor, edg, vals, marks_pending));
+	free(vals);
+    }
     free(cor);
     free(edg);
     free(add);
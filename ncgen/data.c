@@ -734,6 +734,8 @@ reclaimdatalist(Datalist* list)
        efree(list->data);
        list->data = NULL;
    }
+   if(list->spool != NULL)
+       fclose(list->spool);
    efree(list);
 }
 
@@ -765,6 +767,139 @@ fprintf(stderr,"XXX\n");
     alldatalists = NULL;    
 }
 
+/**************************************************/
+/* Streaming of large variable data lists */
+
+/*
+The data list of a large numeric variable can take far more memory
+as NCConstant nodes than the data itself.  For binary output, the
+parser passes the top level data list of such a variable to
+datastreamflush() as it grows; once it holds DATASTREAMBLOCK
+constants, they are appended, as is, to a temporary spool file and
+freed.  The generator reads them back in order (datalistget()), so
+conversion, fill and error reporting are unchanged.
+
+Only variables whose data is generated in one pass, in list order,
+are streamed: primitive non-char, non-string type, with at most the
+first dimension unlimited.  Only constants that need no further
+semantic processing are spooled; anything else ({..}, strings,
+opaques, enum constants, NIL) ends the streaming and the rest of
+the list stays in memory.
+*/
+
+#define DATASTREAMBLOCK 4096
+
+static struct Datastream {
+    int active;
+    int depth; /* nesting of {..} in the data list */
+} datastream;
+
+static int
+isspoolable(NCConstant* con)
+{
+    switch (con->nctype) {
+    case NC_CHAR: case NC_BYTE: case NC_UBYTE:
+    case NC_SHORT: case NC_USHORT: case NC_INT: case NC_UINT:
+    case NC_INT64: case NC_UINT64: case NC_FLOAT: case NC_DOUBLE:
+    case NC_FILLVALUE:
+	return 1;
+    default: break;
+    }
+    return 0;
+}
+
+/* Move the leading spoolable constants of dl to its spool */
+static void
+spooldatalist(Datalist* dl)
+{
+    size_t i,n;
+
+    for(n=0;n<dl->length;n++) {
+	if(!isspoolable(dl->data[n])) {
+	    datastream.active = 0;
+	    break;
+	}
+    }
+    if(n == 0) return;
+    if(dl->spool == NULL && (dl->spool = tmpfile()) == NULL) {
+	datastream.active = 0; /* keep it all in memory */
+	return;
+    }
+    for(i=0;i<n;i++) {
+	if(fwrite(dl->data[i],sizeof(NCConstant),1,dl->spool) != 1)
+	    semerror(dl->data[i]->lineno,"Cannot write data spool file");
+	efree(dl->data[i]);
+    }
+    dl->spooled += n;
+    dl->length -= n;
+    memmove(dl->data,dl->data+n,sizeof(NCConstant*)*dl->length);
+}
+
+/* Called before the data list of vsym is parsed */
+void
+datastreambegin(Symbol* vsym)
+{
+    Symbol* basetype = vsym->typ.basetype;
+    Dimset* dimset = &vsym->typ.dimset;
+
+    memset(&datastream,0,sizeof(datastream));
+    if(l_flag != L_BINARY) return;
+    if(basetype == NULL || basetype->subclass != NC_PRIM) return;
+    if(basetype->typ.typecode == NC_CHAR || basetype->typ.typecode == NC_STRING)
+	return;
+    if(dimset->ndims == 0 || findunlimited(dimset,1) != dimset->ndims)
+	return;
+    datastream.active = 1;
+}
+
+/* Track entry to and exit from a {..} sublist */
+void
+datastreamdepth(int delta)
+{
+    datastream.depth += delta;
+}
+
+/* Called each time a constant is appended to a data list */
+void
+datastreamflush(Datalist* dl)
+{
+    if(!datastream.active || datastream.depth > 0) return;
+    if(dl->length >= DATASTREAMBLOCK)
+	spooldatalist(dl);
+}
+
+/* Called when the data list of a variable is complete */
+Datalist*
+datastreamend(Datalist* dl)
+{
+    /* Once started, spool the tail too, so the list is read in one pass */
+    if(datastream.active && dl->spooled > 0)
+	spooldatalist(dl);
+    memset(&datastream,0,sizeof(datastream));
+    return dl;
+}
+
+void
+datalistrewind(Datalist* dl)
+{
+    if(dl != NULL && dl->spool != NULL)
+	rewind(dl->spool);
+}
+
+/* Get the i'th constant of dl, counting spooled ones; spooled
+   constants are read into *tmp and must be got in order, starting
+   after datalistrewind() */
+NCConstant*
+datalistget(Datalist* dl, size_t i, NCConstant* tmp)
+{
+    if(dl == NULL) return NULL;
+    if(i >= dl->spooled)
+	return datalistith(dl,i - dl->spooled);
+    if(fread(tmp,sizeof(NCConstant),1,dl->spool) != 1)
+	semerror(0,"Cannot read data spool file");
+    return tmp;
+}
+
 /* Obsolete */
 #if 0
 /* return 1 if the next element in the datasrc is compound*/
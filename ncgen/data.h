@@ -60,6 +60,10 @@ typedef struct Datalist {
     size_t  length; /* |data| */
     size_t  alloc;  /* track total allocated space for data field*/
     NCConstant**     data; /* actual list of constants constituting the datalist*/
+    /* Leading constants of a large variable data list that were
+       moved out of memory while parsing (see datastreambegin()) */
+    FILE*         spool;
+    size_t        spooled; /* |spool|; they precede data[0] */
     /* Track various values associated with the datalist*/
     /* (used to be in Constvalue.compoundv)*/
 #if 0
@@ -110,6 +114,16 @@ extern void reclaimconstant(NCConstant*);
 int       datalistline(Datalist*);
 #define   datalistith(dl,i) ((dl)==NULL?NULL:((i) >= (dl)->length?NULL:(dl)->data[i]))
 #define   datalistlen(dl) ((dl)==NULL?0:(dl)->length)
+/* Length counting any spooled constants */
+#define   datalisttotal(dl) ((dl)==NULL?0:(dl)->spooled+(dl)->length)
+
+/* Streaming of variable data lists while parsing */
+extern void datastreambegin(struct Symbol* vsym);
+extern void datastreamdepth(int delta);
+extern void datastreamflush(Datalist* dl);
+extern Datalist* datastreamend(Datalist* dl);
+extern void datalistrewind(Datalist* dl);
+extern NCConstant* datalistget(Datalist* dl, size_t i, NCConstant* tmp);
 
 NCConstant* list2const(Datalist*);
 Datalist* const2list(NCConstant* con);
@@ -158,17 +158,19 @@ generate_array(Symbol* vsym,
             /* Case: dim 1..rank-1 are not unlimited, dim 0 might be */
             size_t offset = 0; /* where are we in the data list */
             size_t nelems = 0; /* # of data list items to generate */
+            NCConstant spooled; /* holds constants read from a spool */
             /* Create an iterator and odometer and just walk the datalist */
             nc_get_iter(vsym,nciterbuffersize,&iter);
+            datalistrewind(vsym->data);
             for(;;offset+=nelems) {
                 int i,uid;
                 nelems=nc_next_iter(&iter,odometerstartvector(odom),odometercountvector(odom));
                 if(nelems == 0)
 		    break;
                 bbClear(code);
-                generator->listbegin(generator,vsym,NULL,LISTDATA,vsym->data->length,code,&uid);
+                generator->listbegin(generator,vsym,NULL,LISTDATA,datalisttotal(vsym->data),code,&uid);
                 for(i=0;i<nelems;i++) {
-                    NCConstant* con = datalistith(vsym->data,i+offset);
+                    NCConstant* con = datalistget(vsym->data,i+offset,&spooled);
                     generator->list(generator,vsym,NULL,LISTDATA,uid,i,code);
                     generate_basetype(basetype,con,code,filler,generator);
                 }
@@ -799,8 +799,8 @@ datadecls:      datadecl ';'
                 | datadecls datadecl ';'
                 ;
 
-datadecl:       varref '=' datalist
-                   {$1->data = $3;}
+datadecl:       varref '=' {datastreambegin($1);} datalist
+                   {$1->data = datastreamend($4);}
                 ;
 datalist:
 	  datalist0 {$$ = $1;}
@@ -814,12 +814,13 @@ datalist0:
 datalist1: /* Must have at least 1 element */
 	  dataitem {$$ = const2list($1);}
 	| datalist ',' dataitem
-	    {dlappend($1,($3)); $$=$1; }
+	    {dlappend($1,($3)); datastreamflush($1); $$=$1; }
 	;
 
 dataitem:
 	  constdata {$$=$1;}
-	| '{' datalist '}' {$$=builddatasublist($2);}
+	| '{' {datastreamdepth(1);} datalist '}'
+	    {datastreamdepth(-1); $$=builddatasublist($3);}
 	;
 
 constdata:
@@ -1213,7 +1213,7 @@ thisunlim->name,
 	        }
 	    }
 	} else { /* Data list should be a list of simple non-char constants */
-   	    length = data->length;
+   	    length = datalisttotal(data);
 	}
 	unlimsize = length / xproduct;
 	if(length % xproduct != 0)
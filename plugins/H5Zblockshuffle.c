@@ -0,0 +1,347 @@
+#include "config.h"
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <hdf5.h>
+/* Older versions of the hdf library may define H5PL_type_t here */
+#include <H5PLextern.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifndef DLL_EXPORT
+#define DLL_EXPORT
+#endif
+
+/* WARNING: see H5Zbzip2.c about the memory passed to and from HDF5. */
+
+#include "h5blockshuffle.h"
+
+/*
+A blocked shuffle, in the manner of blosc, to go in front of a
+compressor such as deflate, zstd or lz4.
+
+The data is cut into blocks of about cd_values[1] bytes. Within a
+block of m elements of size n, the byte shuffle stores byte j of
+element i at j*m+i, so that each of the n bytes of the elements make
+a run of m bytes. The bit shuffle goes on to split each such run into
+8 runs of m/8 bytes, one per bit. Byte k of run b holds bit b of
+bytes 8k..8k+7 of the byte run, the first of them in the low bit.
+The bit shuffle takes the elements 8 at a time; any that are left
+over at the end, like the bytes that do not make an element, are
+stored as they are.
+
+Unlike the HDF5 shuffle, the blocks keep the runs short enough to
+stay in the cache, and the bit shuffle does much better with
+floating point data that varies slowly.
+*/
+
+const H5Z_class2_t H5Z_BLOCKSHUFFLE[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    (H5Z_filter_t)H5Z_FILTER_BLOCKSHUFFLE,         /* Filter id number             */
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "blockshuffle",                  /* Filter name for debugging    */
+    (H5Z_can_apply_func_t)H5Z_blockshuffle_can_apply, /* The "can apply" callback  */
+    (H5Z_set_local_func_t)H5Z_blockshuffle_set_local, /* The "set local" callback     */
+    (H5Z_func_t)H5Z_filter_blockshuffle,         /* The actual filter function   */
+}};
+
+/* External Discovery Functions */
+H5PL_type_t
+H5PLget_plugin_type(void)
+{
+    return H5PL_TYPE_FILTER;
+}
+
+const void*
+H5PLget_plugin_info(void)
+{
+    return H5Z_BLOCKSHUFFLE;
+}
+
+/*
+ * The "can_apply" callback returns positive a valid combination, zero for an
+ * invalid combination and negative for an error.
+ */
+htri_t
+H5Z_blockshuffle_can_apply(hid_t dcpl_id, hid_t type_id, hid_t space_id)
+{
+    return 1; /* Any type has bytes to shuffle */
+}
+
+/*
+ * Fill in the defaults and the element size of the variable, which
+ * are then stored with the filter in the file.
+ */
+herr_t
+H5Z_blockshuffle_set_local(hid_t dcpl_id, hid_t type_id, hid_t space_id)
+{
+    unsigned int flags;
+    size_t nelmts = 3;
+    unsigned int values[3] = {0, 0, 0};
+    size_t typesize;
+
+    if(H5Pget_filter_by_id2(dcpl_id, H5Z_FILTER_BLOCKSHUFFLE, &flags, &nelmts,
+                            values, 0, NULL, NULL) < 0)
+        return -1;
+    if(nelmts < 1 || values[0] == 0)
+        values[0] = BLOCKSHUFFLE_BIT;
+    if(nelmts < 2 || values[1] == 0)
+        values[1] = BLOCKSHUFFLE_BLOCKSIZE;
+    if((typesize = H5Tget_size(type_id)) == 0)
+        return -1;
+    values[2] = (unsigned int)typesize;
+    if(H5Pmodify_filter(dcpl_id, H5Z_FILTER_BLOCKSHUFFLE, flags, 3, values) < 0)
+        return -1;
+    return 1;
+}
+
+/* Transpose the 8x8 bit matrix whose row k is byte k of x */
+static unsigned long long
+transpose8(unsigned long long x)
+{
+    unsigned long long t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x = x ^ t ^ (t << 28);
+    return x;
+}
+
+#ifdef __SSE2__
+/* Transpose the 4x4 byte matrix in each of x[0..3] */
+static void
+transpose4x4(__m128i x[4])
+{
+    int k;
+    for(k=0;k<4;k++) {
+        x[k] = _mm_unpacklo_epi8(x[k], _mm_srli_si128(x[k], 8));
+        x[k] = _mm_unpacklo_epi8(x[k], _mm_srli_si128(x[k], 8));
+    }
+}
+
+/* Transpose the 4x4 matrix of 32 bit words x[0..3] */
+static void
+transpose4x32(__m128i x[4])
+{
+    __m128i a, b, c, d;
+    a = _mm_unpacklo_epi32(x[0], x[1]);
+    b = _mm_unpackhi_epi32(x[0], x[1]);
+    c = _mm_unpacklo_epi32(x[2], x[3]);
+    d = _mm_unpackhi_epi32(x[2], x[3]);
+    x[0] = _mm_unpacklo_epi64(a, c);
+    x[1] = _mm_unpackhi_epi64(a, c);
+    x[2] = _mm_unpacklo_epi64(b, d);
+    x[3] = _mm_unpackhi_epi64(b, d);
+}
+#endif
+
+/* Byte shuffle m elements of size n */
+static void
+byteshuffle(const unsigned char* in, unsigned char* out, size_t m, size_t n)
+{
+    size_t i = 0, j;
+
+#ifdef __SSE2__
+    if(n == 4) {
+        for(;i+16<=m;i+=16) {
+            __m128i x[4];
+            int k;
+            for(k=0;k<4;k++)
+                x[k] = _mm_loadu_si128((const __m128i*)(in + (i + 4*k) * 4));
+            /* 16 elements of 4 bytes to their 4 byte runs */
+            transpose4x4(x);
+            transpose4x32(x);
+            for(k=0;k<4;k++)
+                _mm_storeu_si128((__m128i*)(out + k * m + i), x[k]);
+        }
+    }
+#endif
+    for(;i<m;i++)
+        for(j=0;j<n;j++)
+            out[j*m+i] = in[i*n+j];
+}
+
+/* Undo byteshuffle() */
+static void
+byteunshuffle(const unsigned char* in, unsigned char* out, size_t m, size_t n)
+{
+    size_t i = 0, j;
+
+#ifdef __SSE2__
+    if(n == 4) {
+        for(;i+16<=m;i+=16) {
+            __m128i x[4];
+            int k;
+            for(k=0;k<4;k++)
+                x[k] = _mm_loadu_si128((const __m128i*)(in + k * m + i));
+            transpose4x32(x);
+            transpose4x4(x);
+            for(k=0;k<4;k++)
+                _mm_storeu_si128((__m128i*)(out + (i + 4*k) * 4), x[k]);
+        }
+    }
+#endif
+    for(;i<m;i++)
+        for(j=0;j<n;j++)
+            out[i*n+j] = in[j*m+i];
+}
+
+/* Split a run of m bytes, m a multiple of 8, into 8 runs of bits */
+static void
+bitshuffle(const unsigned char* in, unsigned char* out, size_t m)
+{
+    size_t g = 0, plane = m / 8;
+    int b;
+
+#ifdef __SSE2__
+    for(;g+16<=m;g+=16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(in + g));
+        for(b=7;b>=0;b--) {
+            /* The top bit of each byte is now bit b */
+            int mask = _mm_movemask_epi8(x);
+            out[b*plane + g/8] = (unsigned char)(mask & 0xff);
+            out[b*plane + g/8 + 1] = (unsigned char)(mask >> 8);
+            x = _mm_add_epi8(x, x);
+        }
+    }
+#endif
+    for(;g<m;g+=8) {
+        unsigned long long x = 0;
+        for(b=0;b<8;b++)
+            x |= (unsigned long long)in[g+b] << (8*b);
+        x = transpose8(x);
+        for(b=0;b<8;b++)
+            out[b*plane + g/8] = (unsigned char)(x >> (8*b));
+    }
+}
+
+/* Undo bitshuffle() */
+static void
+bitunshuffle(const unsigned char* in, unsigned char* out, size_t m)
+{
+    size_t g, plane = m / 8;
+    int b;
+
+    for(g=0;g<m;g+=8) {
+        unsigned long long x = 0;
+        for(b=0;b<8;b++)
+            x |= (unsigned long long)in[b*plane + g/8] << (8*b);
+        x = transpose8(x);
+        for(b=0;b<8;b++)
+            out[g+b] = (unsigned char)(x >> (8*b));
+    }
+}
+
+/* Shuffle, or with reverse unshuffle, nbytes from in to out;
+   tmp holds a block. */
+static void
+blockshuffle(int reverse, int mode, size_t n, size_t blocksize,
+             const unsigned char* in, unsigned char* out, unsigned char* tmp,
+             size_t nbytes)
+{
+    size_t nelems = nbytes / n;
+    size_t group = (mode == BLOCKSHUFFLE_BIT ? 8 : 1);
+    size_t block = (blocksize / n) / group * group;
+    size_t pos = 0, j;
+
+    if(block == 0)
+        block = group;
+    while(nelems - pos >= group) {
+        size_t m = nelems - pos;
+        const unsigned char* src = in + pos * n;
+        unsigned char* dst = out + pos * n;
+        if(m > block) m = block;
+        m = m / group * group;
+        if(mode == BLOCKSHUFFLE_BYTE) {
+            if(reverse)
+                byteunshuffle(src, dst, m, n);
+            else
+                byteshuffle(src, dst, m, n);
+        } else if(reverse) {
+            for(j=0;j<n;j++)
+                bitunshuffle(src + j*m, tmp + j*m, m);
+            byteunshuffle(tmp, dst, m, n);
+        } else {
+            byteshuffle(src, tmp, m, n);
+            for(j=0;j<n;j++)
+                bitshuffle(tmp + j*m, dst + j*m, m);
+        }
+        pos += m;
+    }
+    /* The leftovers */
+    memcpy(out + pos * n, in + pos * n, nbytes - pos * n);
+}
+
+size_t
+H5Z_filter_blockshuffle(unsigned int flags, size_t cd_nelmts,
+                     const unsigned int cd_values[], size_t nbytes,
+                     size_t *buf_size, void **buf)
+{
+    unsigned char* outbuf = NULL;
+    unsigned char* tmp = NULL;
+    int mode;
+    size_t n, blocksize;
+
+    if(cd_nelmts < 3) {
+        fprintf(stderr, "blockshuffle: expected 3 parameters, got %d\n", (int)cd_nelmts);
+        goto cleanupAndFail;
+    }
+    mode = (int)cd_values[0];
+    blocksize = cd_values[1];
+    n = cd_values[2];
+    if((mode != BLOCKSHUFFLE_BYTE && mode != BLOCKSHUFFLE_BIT) || n == 0) {
+        fprintf(stderr, "blockshuffle: invalid parameters %u,%u,%u\n",
+                cd_values[0], cd_values[1], cd_values[2]);
+        goto cleanupAndFail;
+    }
+    /* Nothing to shuffle */
+    if(n == 1 && mode == BLOCKSHUFFLE_BYTE)
+        return nbytes;
+
+#ifdef HAVE_H5ALLOCATE_MEMORY
+    outbuf = H5allocate_memory(nbytes,0);
+#else
+    outbuf = (unsigned char*)malloc(nbytes);
+#endif
+    if(outbuf == NULL) {
+        fprintf(stderr, "memory allocation failed for blockshuffle\n");
+        goto cleanupAndFail;
+    }
+    if(mode == BLOCKSHUFFLE_BIT) {
+        size_t tmpsize = (blocksize / n) * n;
+        if(tmpsize < 8 * n) tmpsize = 8 * n;
+        if((tmp = (unsigned char*)malloc(tmpsize)) == NULL) {
+            fprintf(stderr, "memory allocation failed for blockshuffle\n");
+            goto cleanupAndFail;
+        }
+    }
+
+    blockshuffle((flags & H5Z_FLAG_REVERSE) != 0, mode, n, blocksize,
+                 (const unsigned char*)*buf, outbuf, tmp, nbytes);
+    free(tmp);
+
+    /* Always replace the input buffer with the output buffer. */
+#ifdef HAVE_H5FREE_MEMORY
+    H5free_memory(*buf);
+#else
+    free(*buf);
+#endif
+    *buf = outbuf;
+    *buf_size = nbytes;
+    return nbytes;
+
+cleanupAndFail:
+    free(tmp);
+    if (outbuf)
+#ifdef HAVE_H5FREE_MEMORY
+      H5free_memory(outbuf);
+#else
+      free(outbuf);
+#endif
+    return 0;
+}
@@ -0,0 +1,211 @@
+#include "config.h"
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <hdf5.h>
+/* Older versions of the hdf library may define H5PL_type_t here */
+#include <H5PLextern.h>
+
+#ifndef DLL_EXPORT
+#define DLL_EXPORT
+#endif
+
+/* WARNING: see H5Zbzip2.c about the memory passed to and from HDF5. */
+
+#include "h5lz4.h"
+
+/*
+LZ4 compression, in the format of the other lz4 filters that use the
+registered id, so that files written by either can be read by the
+other. A chunk is stored as
+
+    the size of the data, 8 bytes
+    the size of a block, 4 bytes
+    for each block:
+        the size of the compressed block, 4 bytes
+        the compressed block, or the block as it is if that would
+        not be smaller
+
+with the sizes big endian. The last block may be short.
+*/
+
+const H5Z_class2_t H5Z_LZ4[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    (H5Z_filter_t)H5Z_FILTER_LZ4,         /* Filter id number             */
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "lz4",                  /* Filter name for debugging    */
+    (H5Z_can_apply_func_t)H5Z_lz4_can_apply, /* The "can apply" callback  */
+    NULL,                       /* The "set local" callback     */
+    (H5Z_func_t)H5Z_filter_lz4,         /* The actual filter function   */
+}};
+
+/* External Discovery Functions */
+H5PL_type_t
+H5PLget_plugin_type(void)
+{
+    return H5PL_TYPE_FILTER;
+}
+
+const void*
+H5PLget_plugin_info(void)
+{
+    return H5Z_LZ4;
+}
+
+/*
+ * The "can_apply" callback returns positive a valid combination, zero for an
+ * invalid combination and negative for an error.
+ */
+htri_t
+H5Z_lz4_can_apply(hid_t dcpl_id, hid_t type_id, hid_t space_id)
+{
+    return 1; /* Assume it can always apply */
+}
+
+static unsigned long long
+getbe(const unsigned char* p, int n)
+{
+    unsigned long long v = 0;
+    int i;
+    for(i=0;i<n;i++)
+        v = (v << 8) | p[i];
+    return v;
+}
+
+static void
+putbe(unsigned char* p, int n, unsigned long long v)
+{
+    int i;
+    for(i=n-1;i>=0;i--) {
+        p[i] = (unsigned char)(v & 0xff);
+        v >>= 8;
+    }
+}
+
+size_t
+H5Z_filter_lz4(unsigned int flags, size_t cd_nelmts,
+               const unsigned int cd_values[], size_t nbytes,
+               size_t *buf_size, void **buf)
+{
+    unsigned char *outbuf = NULL;
+    const unsigned char *in = (const unsigned char*)*buf;
+    size_t outbuflen, outdatalen, blocksize, pos;
+
+    if (flags & H5Z_FLAG_REVERSE) {
+
+        /** Decompress data. **/
+
+        unsigned char *out;
+
+        if (nbytes < 12) {
+            fprintf(stderr, "lz4: chunk too short\n");
+            goto cleanupAndFail;
+        }
+        outbuflen = (size_t)getbe(in, 8);
+        blocksize = (size_t)getbe(in + 8, 4);
+        if (blocksize == 0 && outbuflen > 0) {
+            fprintf(stderr, "lz4: invalid block size\n");
+            goto cleanupAndFail;
+        }
+#ifdef HAVE_H5ALLOCATE_MEMORY
+        outbuf = H5allocate_memory(outbuflen,0);
+#else
+        outbuf = (unsigned char*)malloc(outbuflen);
+#endif
+        if (outbuf == NULL) {
+            fprintf(stderr, "memory allocation failed for lz4 decompression\n");
+            goto cleanupAndFail;
+        }
+        out = outbuf;
+        pos = 12;
+        for (outdatalen = 0; outdatalen < outbuflen;) {
+            size_t n = outbuflen - outdatalen, csize;
+            if (n > blocksize) n = blocksize;
+            if (pos + 4 > nbytes) {
+                fprintf(stderr, "lz4: chunk too short\n");
+                goto cleanupAndFail;
+            }
+            csize = (size_t)getbe(in + pos, 4);
+            pos += 4;
+            if (pos + csize > nbytes) {
+                fprintf(stderr, "lz4: chunk too short\n");
+                goto cleanupAndFail;
+            }
+            if (csize == n)
+                memcpy(out, in + pos, n);
+            else if (LZ4_decompress_safe((const char*)in + pos, (char*)out,
+                                         (int)csize, (int)n) != (int)n) {
+                fprintf(stderr, "lz4 decompression failed\n");
+                goto cleanupAndFail;
+            }
+            pos += csize;
+            out += n;
+            outdatalen += n;
+        }
+
+    } else {
+
+        /** Compress data. **/
+
+        unsigned char *out;
+        size_t nblocks;
+
+        blocksize = H5Z_LZ4_BLOCKSIZE;
+        if (cd_nelmts > 0 && cd_values[0] > 0)
+            blocksize = cd_values[0];
+        if (blocksize > LZ4_MAX_INPUT_SIZE)
+            blocksize = LZ4_MAX_INPUT_SIZE;
+        if (blocksize > nbytes)
+            blocksize = nbytes;
+        nblocks = blocksize ? (nbytes + blocksize - 1) / blocksize : 0;
+        outbuflen = 12 + nblocks * (4 + (size_t)LZ4_compressBound((int)blocksize));
+#ifdef HAVE_H5ALLOCATE_MEMORY
+        outbuf = H5allocate_memory(outbuflen,0);
+#else
+        outbuf = (unsigned char*)malloc(outbuflen);
+#endif
+        if (outbuf == NULL) {
+            fprintf(stderr, "memory allocation failed for lz4 compression\n");
+            goto cleanupAndFail;
+        }
+        putbe(outbuf, 8, nbytes);
+        putbe(outbuf + 8, 4, blocksize);
+        out = outbuf + 12;
+        for (pos = 0; pos < nbytes; pos += blocksize) {
+            size_t n = nbytes - pos;
+            int csize;
+            if (n > blocksize) n = blocksize;
+            csize = LZ4_compress_default((const char*)in + pos, (char*)out + 4,
+                                         (int)n, LZ4_compressBound((int)n));
+            if (csize <= 0 || (size_t)csize >= n) {
+                /* Store it as it is */
+                memcpy(out + 4, in + pos, n);
+                csize = (int)n;
+            }
+            putbe(out, 4, (unsigned long long)csize);
+            out += 4 + csize;
+        }
+        outdatalen = (size_t)(out - outbuf);
+    }
+
+    /* Always replace the input buffer with the output buffer. */
+#ifdef HAVE_H5FREE_MEMORY
+    H5free_memory(*buf);
+#else
+    free(*buf);
+#endif
+    *buf = outbuf;
+    *buf_size = outbuflen;
+    return outdatalen;
+
+cleanupAndFail:
+    if (outbuf)
+#ifdef HAVE_H5FREE_MEMORY
+        H5free_memory(outbuf);
+#else
+        free(outbuf);
+#endif
+    return 0;
+}
@@ -0,0 +1,377 @@
+#include "config.h"
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <hdf5.h>
+/* Older versions of the hdf library may define H5PL_type_t here */
+#include <H5PLextern.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifndef DLL_EXPORT
+#define DLL_EXPORT
+#endif
+
+#include "h5quantize.h"
+
+/*
+Lossy quantization of floating point data, to go in front of a
+shuffle and a compressor. The trailing bits of the mantissa of each
+value are set to a pattern that compresses well, and the data is
+read back as it was written, so no plugin is needed to read it.
+
+BitRound keeps cd_values[1] bits of the mantissa, rounding to the
+nearest value that has them, ties to even. BitGroom keeps enough
+bits for cd_values[1] significant decimal digits, and alternately
+clears and sets the rest, so that the mean of the data is kept.
+Infinities, NaNs and the fill value are left alone.
+
+The library records the quantization in an attribute of the
+variable; see NC4_filter_actions in libhdf5/hdf5filter.c.
+*/
+
+const H5Z_class2_t H5Z_QUANTIZE[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    (H5Z_filter_t)H5Z_FILTER_QUANTIZE,         /* Filter id number             */
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "quantize",                  /* Filter name for debugging    */
+    (H5Z_can_apply_func_t)H5Z_quantize_can_apply, /* The "can apply" callback  */
+    (H5Z_set_local_func_t)H5Z_quantize_set_local, /* The "set local" callback     */
+    (H5Z_func_t)H5Z_filter_quantize,         /* The actual filter function   */
+}};
+
+/* External Discovery Functions */
+H5PL_type_t
+H5PLget_plugin_type(void)
+{
+    return H5PL_TYPE_FILTER;
+}
+
+const void*
+H5PLget_plugin_info(void)
+{
+    return H5Z_QUANTIZE;
+}
+
+#define EXP32 0x7f800000U
+#define EXP64 0x7ff0000000000000ULL
+#define MANT32 23
+#define MANT64 52
+
+/*
+ * The "can_apply" callback returns positive a valid combination, zero for an
+ * invalid combination and negative for an error.
+ */
+htri_t
+H5Z_quantize_can_apply(hid_t dcpl_id, hid_t type_id, hid_t space_id)
+{
+    size_t size;
+    if(H5Tget_class(type_id) != H5T_FLOAT)
+        return 0;
+    size = H5Tget_size(type_id);
+    return (size == 4 || size == 8);
+}
+
+/*
+ * Add the element size, byte order and fill value of the variable,
+ * which are then stored with the filter in the file.
+ */
+herr_t
+H5Z_quantize_set_local(hid_t dcpl_id, hid_t type_id, hid_t space_id)
+{
+    unsigned int flags;
+    size_t nelmts = QUANTIZE_NPARAMS;
+    unsigned int values[QUANTIZE_NPARAMS] = {0, 0, 0, 0, 0, 0};
+    size_t typesize;
+    H5D_fill_value_t status;
+    unsigned long long bits = 0;
+
+    if(H5Pget_filter_by_id2(dcpl_id, H5Z_FILTER_QUANTIZE, &flags, &nelmts,
+                            values, 0, NULL, NULL) < 0)
+        return -1;
+    if(nelmts < 2)
+        return -1;
+    if((typesize = H5Tget_size(type_id)) == 0)
+        return -1;
+    values[2] = (unsigned int)typesize;
+    values[3] = (H5Tget_order(type_id) == H5T_ORDER_BE);
+    /* The fill value as it is in memory here */
+    if(H5Pfill_value_defined(dcpl_id, &status) < 0)
+        return -1;
+    if(status != H5D_FILL_VALUE_UNDEFINED) {
+        if(typesize == 4) {
+            float f;
+            unsigned int u;
+            if(H5Pget_fill_value(dcpl_id, H5T_NATIVE_FLOAT, &f) < 0)
+                return -1;
+            memcpy(&u, &f, sizeof(u));
+            bits = u;
+        } else {
+            double d;
+            if(H5Pget_fill_value(dcpl_id, H5T_NATIVE_DOUBLE, &d) < 0)
+                return -1;
+            memcpy(&bits, &d, sizeof(bits));
+        }
+    }
+    values[4] = (unsigned int)(bits & 0xffffffffULL);
+    values[5] = (unsigned int)(bits >> 32);
+    if(H5Pmodify_filter(dcpl_id, H5Z_FILTER_QUANTIZE, flags, QUANTIZE_NPARAMS, values) < 0)
+        return -1;
+    return 1;
+}
+
+/* The number of mantissa bits to clear, or -1 if the parameters are wrong */
+static int
+zerobits(unsigned int mode, unsigned int keep, size_t size)
+{
+    int mant = (size == 4 ? MANT32 : MANT64);
+    int maxdigits = (size == 4 ? 7 : 15);
+    int bits;
+
+    switch (mode) {
+    case QUANTIZE_BITROUND:
+        if(keep < 1 || keep > (unsigned int)mant) return -1;
+        bits = (int)keep;
+        break;
+    case QUANTIZE_BITGROOM:
+        if(keep < 1 || keep > (unsigned int)maxdigits) return -1;
+        /* ceil(digits * log2(10)) bits, and one more for the rounding */
+        bits = (int)((keep * 3321929U + 999999U) / 1000000U) + 1;
+        break;
+    default:
+        return -1;
+    }
+    return (bits >= mant ? 0 : mant - bits);
+}
+
+static void
+byteswap(unsigned char* p, size_t n, size_t size)
+{
+    size_t i, k;
+    for(i=0;i<n;i++,p+=size) {
+        for(k=0;k<size/2;k++) {
+            unsigned char t = p[k];
+            p[k] = p[size-1-k];
+            p[size-1-k] = t;
+        }
+    }
+}
+
+#ifdef __SSE2__
+/* All ones in each 64 bit lane where a and b are equal */
+static __m128i
+cmpeq64(__m128i a, __m128i b)
+{
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2,3,0,1)));
+}
+
+/* a where sel is set, b elsewhere */
+static __m128i
+select128(__m128i sel, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(sel, a), _mm_andnot_si128(sel, b));
+}
+#endif
+
+static void
+bitround32(unsigned int* u, size_t n, int z, unsigned int fill)
+{
+    const unsigned int mask = ~0U << z;
+    const unsigned int half = (1U << (z - 1)) - 1;
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i vmask = _mm_set1_epi32((int)mask);
+    const __m128i vhalf = _mm_set1_epi32((int)half);
+    const __m128i vexp = _mm_set1_epi32((int)EXP32);
+    const __m128i vfill = _mm_set1_epi32((int)fill);
+    const __m128i vone = _mm_set1_epi32(1);
+    const __m128i vz = _mm_cvtsi32_si128(z);
+    for(;i+4<=n;i+=4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(u + i));
+        __m128i keep = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(x, vexp), vexp),
+                                    _mm_cmpeq_epi32(x, vfill));
+        __m128i r = _mm_add_epi32(_mm_add_epi32(x, vhalf),
+                                  _mm_and_si128(_mm_srl_epi32(x, vz), vone));
+        r = _mm_and_si128(r, vmask);
+        /* Truncate rather than round up to infinity */
+        r = select128(_mm_cmpeq_epi32(_mm_and_si128(r, vexp), vexp),
+                      _mm_and_si128(x, vmask), r);
+        _mm_storeu_si128((__m128i*)(u + i), select128(keep, x, r));
+    }
+#endif
+    for(;i<n;i++) {
+        unsigned int x = u[i], r;
+        if((x & EXP32) == EXP32 || x == fill)
+            continue;
+        r = (x + half + ((x >> z) & 1U)) & mask;
+        if((r & EXP32) == EXP32)
+            r = x & mask;
+        u[i] = r;
+    }
+}
+
+static void
+bitround64(unsigned long long* u, size_t n, int z, unsigned long long fill)
+{
+    const unsigned long long mask = ~0ULL << z;
+    const unsigned long long half = (1ULL << (z - 1)) - 1;
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i vmask = _mm_set1_epi64x((long long)mask);
+    const __m128i vhalf = _mm_set1_epi64x((long long)half);
+    const __m128i vexp = _mm_set1_epi64x((long long)EXP64);
+    const __m128i vfill = _mm_set1_epi64x((long long)fill);
+    const __m128i vone = _mm_set1_epi64x(1);
+    const __m128i vz = _mm_cvtsi32_si128(z);
+    for(;i+2<=n;i+=2) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(u + i));
+        __m128i keep = _mm_or_si128(cmpeq64(_mm_and_si128(x, vexp), vexp),
+                                    cmpeq64(x, vfill));
+        __m128i r = _mm_add_epi64(_mm_add_epi64(x, vhalf),
+                                  _mm_and_si128(_mm_srl_epi64(x, vz), vone));
+        r = _mm_and_si128(r, vmask);
+        r = select128(cmpeq64(_mm_and_si128(r, vexp), vexp),
+                      _mm_and_si128(x, vmask), r);
+        _mm_storeu_si128((__m128i*)(u + i), select128(keep, x, r));
+    }
+#endif
+    for(;i<n;i++) {
+        unsigned long long x = u[i], r;
+        if((x & EXP64) == EXP64 || x == fill)
+            continue;
+        r = (x + half + ((x >> z) & 1ULL)) & mask;
+        if((r & EXP64) == EXP64)
+            r = x & mask;
+        u[i] = r;
+    }
+}
+
+/* Clear the bits of the even elements and set them in the odd ones,
+   but leave zeros as they are. */
+static void
+bitgroom32(unsigned int* u, size_t n, int z, unsigned int fill)
+{
+    const unsigned int shave = ~0U << z;
+    const unsigned int set = ~shave;
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i vshave = _mm_set1_epi32((int)shave);
+    const __m128i vset = _mm_set1_epi32((int)set);
+    const __m128i vexp = _mm_set1_epi32((int)EXP32);
+    const __m128i vfill = _mm_set1_epi32((int)fill);
+    const __m128i vabs = _mm_set1_epi32(0x7fffffff);
+    const __m128i vodd = _mm_setr_epi32(0, -1, 0, -1);
+    for(;i+4<=n;i+=4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(u + i));
+        __m128i keep = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(x, vexp), vexp),
+                                    _mm_cmpeq_epi32(x, vfill));
+        __m128i zero = _mm_cmpeq_epi32(_mm_and_si128(x, vabs), _mm_setzero_si128());
+        __m128i r = select128(vodd, _mm_or_si128(x, vset), _mm_and_si128(x, vshave));
+        keep = _mm_or_si128(keep, _mm_and_si128(vodd, zero));
+        _mm_storeu_si128((__m128i*)(u + i), select128(keep, x, r));
+    }
+#endif
+    for(;i<n;i++) {
+        unsigned int x = u[i];
+        if((x & EXP32) == EXP32 || x == fill)
+            continue;
+        if(i % 2 == 0)
+            u[i] = x & shave;
+        else if((x & 0x7fffffffU) != 0)
+            u[i] = x | set;
+    }
+}
+
+static void
+bitgroom64(unsigned long long* u, size_t n, int z, unsigned long long fill)
+{
+    const unsigned long long shave = ~0ULL << z;
+    const unsigned long long set = ~shave;
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i vshave = _mm_set1_epi64x((long long)shave);
+    const __m128i vset = _mm_set1_epi64x((long long)set);
+    const __m128i vexp = _mm_set1_epi64x((long long)EXP64);
+    const __m128i vfill = _mm_set1_epi64x((long long)fill);
+    const __m128i vabs = _mm_set1_epi64x(0x7fffffffffffffffLL);
+    const __m128i vodd = _mm_set_epi64x(-1, 0);
+    for(;i+2<=n;i+=2) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(u + i));
+        __m128i keep = _mm_or_si128(cmpeq64(_mm_and_si128(x, vexp), vexp),
+                                    cmpeq64(x, vfill));
+        __m128i zero = cmpeq64(_mm_and_si128(x, vabs), _mm_setzero_si128());
+        __m128i r = select128(vodd, _mm_or_si128(x, vset), _mm_and_si128(x, vshave));
+        keep = _mm_or_si128(keep, _mm_and_si128(vodd, zero));
+        _mm_storeu_si128((__m128i*)(u + i), select128(keep, x, r));
+    }
+#endif
+    for(;i<n;i++) {
+        unsigned long long x = u[i];
+        if((x & EXP64) == EXP64 || x == fill)
+            continue;
+        if(i % 2 == 0)
+            u[i] = x & shave;
+        else if((x & 0x7fffffffffffffffULL) != 0)
+            u[i] = x | set;
+    }
+}
+
+size_t
+H5Z_filter_quantize(unsigned int flags, size_t cd_nelmts,
+                    const unsigned int cd_values[], size_t nbytes,
+                    size_t *buf_size, void **buf)
+{
+    size_t size, n;
+    int z, swap;
+    unsigned long long fill;
+
+    /* The data is read back as it was written */
+    if (flags & H5Z_FLAG_REVERSE)
+        return nbytes;
+
+    if (cd_nelmts < QUANTIZE_NPARAMS) {
+        fprintf(stderr, "quantize: missing parameters\n");
+        return 0;
+    }
+    size = cd_values[2];
+    if ((size != 4 && size != 8)
+        || (z = zerobits(cd_values[0], cd_values[1], size)) < 0) {
+        fprintf(stderr, "quantize: invalid parameters %u,%u for %u byte values\n",
+                cd_values[0], cd_values[1], (unsigned)size);
+        return 0;
+    }
+    if (z == 0)
+        return nbytes;
+
+#ifdef WORDS_BIGENDIAN
+    swap = !cd_values[3];
+#else
+    swap = (cd_values[3] != 0);
+#endif
+    fill = ((unsigned long long)cd_values[5] << 32) | cd_values[4];
+    n = nbytes / size;
+
+    /* Quantize the data where it is */
+    if (swap) byteswap((unsigned char*)*buf, n, size);
+    if (size == 4) {
+        if (cd_values[0] == QUANTIZE_BITROUND)
+            bitround32((unsigned int*)*buf, n, z, (unsigned int)fill);
+        else
+            bitgroom32((unsigned int*)*buf, n, z, (unsigned int)fill);
+    } else {
+        if (cd_values[0] == QUANTIZE_BITROUND)
+            bitround64((unsigned long long*)*buf, n, z, fill);
+        else
+            bitgroom64((unsigned long long*)*buf, n, z, fill);
+    }
+    if (swap) byteswap((unsigned char*)*buf, n, size);
+    return nbytes;
+}
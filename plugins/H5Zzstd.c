@@ -0,0 +1,144 @@
+#include "config.h"
+#include <sys/types.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <hdf5.h>
+/* Older versions of the hdf library may define H5PL_type_t here */
+#include <H5PLextern.h>
+
+#ifndef DLL_EXPORT
+#define DLL_EXPORT
+#endif
+
+/* WARNING: see H5Zbzip2.c about the memory passed to and from HDF5. */
+
+#include "h5zstd.h"
+
+/*
+Zstandard compression. Each chunk is stored as one zstd frame, which
+records the size of the data, as with the other zstd filters that use
+the registered id, so that files written by either can be read by
+the other.
+*/
+
+const H5Z_class2_t H5Z_ZSTD[1] = {{
+    H5Z_CLASS_T_VERS,       /* H5Z_class_t version */
+    (H5Z_filter_t)H5Z_FILTER_ZSTD,         /* Filter id number             */
+    1,              /* encoder_present flag (set to true) */
+    1,              /* decoder_present flag (set to true) */
+    "zstd",                  /* Filter name for debugging    */
+    (H5Z_can_apply_func_t)H5Z_zstd_can_apply, /* The "can apply" callback  */
+    NULL,                       /* The "set local" callback     */
+    (H5Z_func_t)H5Z_filter_zstd,         /* The actual filter function   */
+}};
+
+/* External Discovery Functions */
+H5PL_type_t
+H5PLget_plugin_type(void)
+{
+    return H5PL_TYPE_FILTER;
+}
+
+const void*
+H5PLget_plugin_info(void)
+{
+    return H5Z_ZSTD;
+}
+
+/*
+ * The "can_apply" callback returns positive a valid combination, zero for an
+ * invalid combination and negative for an error.
+ */
+htri_t
+H5Z_zstd_can_apply(hid_t dcpl_id, hid_t type_id, hid_t space_id)
+{
+    return 1; /* Assume it can always apply */
+}
+
+size_t
+H5Z_filter_zstd(unsigned int flags, size_t cd_nelmts,
+                const unsigned int cd_values[], size_t nbytes,
+                size_t *buf_size, void **buf)
+{
+    char *outbuf = NULL;
+    size_t outbuflen, outdatalen;
+
+    if (flags & H5Z_FLAG_REVERSE) {
+
+        /** Decompress data. The frame says how big the data is. **/
+
+        unsigned long long size = ZSTD_getFrameContentSize(*buf, nbytes);
+        if (size == ZSTD_CONTENTSIZE_UNKNOWN || size == ZSTD_CONTENTSIZE_ERROR) {
+            fprintf(stderr, "zstd: cannot get the size of the data\n");
+            goto cleanupAndFail;
+        }
+        outbuflen = (size_t)size;
+#ifdef HAVE_H5ALLOCATE_MEMORY
+        outbuf = H5allocate_memory(outbuflen,0);
+#else
+        outbuf = (char*)malloc(outbuflen);
+#endif
+        if (outbuf == NULL) {
+            fprintf(stderr, "memory allocation failed for zstd decompression\n");
+            goto cleanupAndFail;
+        }
+        outdatalen = ZSTD_decompress(outbuf, outbuflen, *buf, nbytes);
+        if (ZSTD_isError(outdatalen)) {
+            fprintf(stderr, "zstd decompression failed: %s\n",
+                    ZSTD_getErrorName(outdatalen));
+            goto cleanupAndFail;
+        }
+
+    } else {
+
+        /** Compress data. **/
+
+        int level = H5Z_ZSTD_LEVEL;
+
+        /* Get compression level if present. */
+        if (cd_nelmts > 0) {
+            level = (int)cd_values[0];
+            if (level < 1 || level > ZSTD_maxCLevel()) {
+                fprintf(stderr, "invalid zstd compression level: %d\n", level);
+                goto cleanupAndFail;
+            }
+        }
+
+        outbuflen = ZSTD_compressBound(nbytes);
+#ifdef HAVE_H5ALLOCATE_MEMORY
+        outbuf = H5allocate_memory(outbuflen,0);
+#else
+        outbuf = (char*)malloc(outbuflen);
+#endif
+        if (outbuf == NULL) {
+            fprintf(stderr, "memory allocation failed for zstd compression\n");
+            goto cleanupAndFail;
+        }
+        outdatalen = ZSTD_compress(outbuf, outbuflen, *buf, nbytes, level);
+        if (ZSTD_isError(outdatalen)) {
+            fprintf(stderr, "zstd compression failed: %s\n",
+                    ZSTD_getErrorName(outdatalen));
+            goto cleanupAndFail;
+        }
+    }
+
+    /* Always replace the input buffer with the output buffer. */
+#ifdef HAVE_H5FREE_MEMORY
+    H5free_memory(*buf);
+#else
+    free(*buf);
+#endif
+    *buf = outbuf;
+    *buf_size = outbuflen;
+    return outdatalen;
+
+cleanupAndFail:
+    if (outbuf)
+#ifdef HAVE_H5FREE_MEMORY
+        H5free_memory(outbuf);
+#else
+        free(outbuf);
+#endif
+    return 0;
+}
@@ -0,0 +1,38 @@
+#ifndef H5BLOCKSHUFFLE_H
+#define H5BLOCKSHUFFLE_H
+
+#ifdef _MSC_VER
+  #ifdef DLL_EXPORT /* define when building the library */
+    #define DECLSPEC __declspec(dllexport)
+  #else
+    #define DECLSPEC __declspec(dllimport)
+  #endif
+#else
+  #define DECLSPEC extern
+#endif
+
+/* Not registered with the HDF Group; see the first user-defined
+   filter id (32768) in libdispatch/dfilter.c. */
+#define H5Z_FILTER_BLOCKSHUFFLE 32769
+
+/* cd_values[0]: the shuffle */
+#define BLOCKSHUFFLE_BYTE 1 /* group the bytes of the elements */
+#define BLOCKSHUFFLE_BIT  2 /* group the bits of the elements */
+
+/* cd_values[1]: bytes per block, default */
+#define BLOCKSHUFFLE_BLOCKSIZE 16384
+
+/* cd_values[2]: size of an element, set from the type by set_local */
+
+/* declare the hdf5 interface */
+DECLSPEC H5PL_type_t H5PLget_plugin_type(void);
+DECLSPEC const void* H5PLget_plugin_info(void);
+DECLSPEC const H5Z_class2_t H5Z_BLOCKSHUFFLE[1];
+
+/* Declare filter specific functions */
+DECLSPEC htri_t H5Z_blockshuffle_can_apply(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+DECLSPEC herr_t H5Z_blockshuffle_set_local(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+DECLSPEC size_t H5Z_filter_blockshuffle(unsigned flags,size_t cd_nelmts,const unsigned cd_values[],
+                    size_t nbytes,size_t *buf_size,void**buf);
+
+#endif /*H5BLOCKSHUFFLE_H*/
@@ -0,0 +1,39 @@
+#ifndef H5QUANTIZE_H
+#define H5QUANTIZE_H
+
+#ifdef _MSC_VER
+  #ifdef DLL_EXPORT /* define when building the library */
+    #define DECLSPEC __declspec(dllexport)
+  #else
+    #define DECLSPEC __declspec(dllimport)
+  #endif
+#else
+  #define DECLSPEC extern
+#endif
+
+/* Not registered with the HDF Group; must match H5Z_FILTER_QUANTIZE
+   in netcdf_filter.h. */
+#define H5Z_FILTER_QUANTIZE 32770
+
+/* cd_values[0]: the quantization; must match netcdf_filter.h */
+#define QUANTIZE_BITGROOM 1 /* keep cd_values[1] significant digits */
+#define QUANTIZE_BITROUND 2 /* keep cd_values[1] bits of the mantissa */
+
+/* cd_values[2]: size of an element, 4 or 8,
+   cd_values[3]: 1 if the elements are big endian,
+   cd_values[4..5]: the bits of the fill value, low word first;
+   all set from the variable by set_local */
+#define QUANTIZE_NPARAMS 6
+
+/* declare the hdf5 interface */
+DECLSPEC H5PL_type_t H5PLget_plugin_type(void);
+DECLSPEC const void* H5PLget_plugin_info(void);
+DECLSPEC const H5Z_class2_t H5Z_QUANTIZE[1];
+
+/* Declare filter specific functions */
+DECLSPEC htri_t H5Z_quantize_can_apply(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+DECLSPEC herr_t H5Z_quantize_set_local(hid_t dcpl_id, hid_t type_id, hid_t space_id);
+DECLSPEC size_t H5Z_filter_quantize(unsigned flags,size_t cd_nelmts,const unsigned cd_values[],
+                    size_t nbytes,size_t *buf_size,void**buf);
+
+#endif /*H5QUANTIZE_H*/
@@ -0,0 +1,76 @@
+/* This is part of the netCDF package. Copyright 2019 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test the crc32 function in libdispatch/crc32.c. The result must
+   not depend on which method (hardware, word at a time or byte at a
+   time) was chosen for a given length and alignment.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include "err_macros.h"
+
+#define BUFSIZE 4096
+
+/* Prototype for the crc32 function */
+extern unsigned int NC_crc32(unsigned int crc, const unsigned char* buf, unsigned int len);
+
+/* Bit at a time reference crc32. */
+static unsigned int
+refcrc32(unsigned int crc, const unsigned char* buf, size_t len)
+{
+    int k;
+    crc = ~crc;
+    while(len--) {
+        crc ^= *buf++;
+        for(k = 0; k < 8; k++)
+            crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320U : (crc >> 1);
+    }
+    return ~crc;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing netcdf internal crc32 function.\n");
+    printf("Testing check value...");
+    {
+        const char* check = "123456789";
+        if (NC_crc32(0, (const unsigned char*)check, 9) != 0xcbf43926U) ERR;
+        if (NC_crc32(0, (const unsigned char*)check, 0) != 0) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("Testing all lengths and alignments...");
+    {
+        unsigned char buf[BUFSIZE + 16];
+        size_t off, len;
+        int i;
+
+        for (i = 0; i < BUFSIZE + 16; i++)
+            buf[i] = (unsigned char)(i * 131 + 7);
+        for (off = 0; off < 16; off++)
+            for (len = 0; len <= 300; len++)
+                if (NC_crc32(0, buf + off, (unsigned int)len) != refcrc32(0, buf + off, len)) ERR;
+        for (len = 300; len <= BUFSIZE; len += 97)
+            if (NC_crc32(0, buf + 3, (unsigned int)len) != refcrc32(0, buf + 3, len)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("Testing incremental crc...");
+    {
+        unsigned char buf[BUFSIZE];
+        unsigned int crc;
+        size_t split;
+        int i;
+
+        for (i = 0; i < BUFSIZE; i++)
+            buf[i] = (unsigned char)(i ^ (i >> 8));
+        for (split = 0; split < BUFSIZE; split += 211) {
+            crc = NC_crc32(0, buf, (unsigned int)split);
+            crc = NC_crc32(crc, buf + split, (unsigned int)(BUFSIZE - split));
+            if (crc != refcrc32(0, buf, BUFSIZE)) ERR;
+        }
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
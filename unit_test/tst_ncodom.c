@@ -0,0 +1,197 @@
+/* This is part of the netCDF package. Copyright 2019 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test the hyperslab odometer in libdispatch/ncodom.c. Every walk
+   must visit exactly the elements a one element at a time walk
+   visits, in the same order, whatever the runs were coalesced into.
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "ncodom.h"
+
+#define MAXRANK 4
+#define MAXDIM 5
+#define NTRIALS 2000
+#define MAXELEMS (MAXDIM*MAXDIM*MAXDIM*MAXDIM)
+
+static size_t expvar[MAXELEMS]; /* variable offsets, in walk order */
+static size_t expmem[MAXELEMS]; /* memory offsets, in walk order */
+
+/* Fill in expvar and expmem the slow way; returns the count. */
+static size_t
+brute(int rank, const size_t* shape, const size_t* start, const size_t* count,
+      const ptrdiff_t* stride, const ptrdiff_t* imap)
+{
+    size_t n = 0, i, total = 1;
+    int d;
+    for(d = 0; d < rank; d++) total *= count[d];
+    for(i = 0; i < total; i++) {
+        size_t rem = i, voff = 0, moff = 0, vprod = 1, mprod = 1;
+        for(d = rank - 1; d >= 0; d--) {
+            size_t j = rem % count[d];
+            rem /= count[d];
+            voff += (start[d] + j * (size_t)stride[d]) * vprod;
+            moff += j * (imap != NULL ? (size_t)imap[d] : mprod);
+            vprod *= shape[d];
+            mprod *= count[d];
+        }
+        expvar[n] = voff;
+        expmem[n] = moff;
+        n++;
+    }
+    return n;
+}
+
+/* Walk an odometer and compare every element of every run. */
+static int
+check(int rank, const size_t* shape, const size_t* start, const size_t* count,
+      const ptrdiff_t* stride, const ptrdiff_t* imap, int flags)
+{
+    NCodometer odom;
+    size_t n, seen = 0, nruns = 0;
+    int d;
+
+    n = brute(rank, shape, start, count, stride, imap);
+    if(NC_odom_init(&odom, rank, shape, start, count, stride, imap, flags)) ERR;
+    if(NC_odom_nelements(&odom) != n) ERR;
+    for(; NC_odom_more(&odom); NC_odom_next(&odom)) {
+        size_t k, prod = 1;
+        nruns++;
+        for(d = 0; d < rank; d++) prod *= odom.runedges[d];
+        if(prod != odom.runlen) ERR;
+        if((flags & NC_ODOM_ELEMENTS) && odom.runlen != 1) ERR;
+        if((flags & NC_ODOM_RECORDS) && !(flags & NC_ODOM_BOX)
+           && rank > 1 && odom.runedges[0] != 1) ERR;
+        /* the run is contiguous in memory */
+        for(k = 0; k < odom.runlen; k++)
+            if(expmem[seen + k] != odom.memoffset + k) ERR;
+        /* and it starts at index and spans runedges in the variable */
+        for(k = 0; k < odom.runlen; k++) {
+            size_t rem = k, voff = 0, vprod = 1;
+            for(d = rank - 1; d >= 0; d--) {
+                voff += (odom.index[d] + rem % odom.runedges[d]) * vprod;
+                rem /= odom.runedges[d];
+                vprod *= shape[d];
+            }
+            if(expvar[seen + k] != voff) ERR;
+            /* linear runs are contiguous in the variable too */
+            if(!(flags & NC_ODOM_BOX) && voff != odom.offset + k) ERR;
+        }
+        if(odom.offset != expvar[seen]) ERR;
+        seen += odom.runlen;
+        if(seen > n) ERR;
+    }
+    if(seen != n) ERR;
+    if(rank == 0 && nruns != 1) ERR;
+    NC_odom_free(&odom);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing netcdf internal hyperslab odometer.\n");
+    printf("Testing whole variable is one run...");
+    {
+        NCodometer odom;
+        size_t shape[3] = {4, 5, 6}, start[3] = {0, 0, 0};
+        ptrdiff_t stride[3] = {1, 1, 1};
+        if(NC_odom_init(&odom, 3, shape, NULL, NULL, NULL, NULL, 0)) ERR;
+        if(odom.runlen != 120 || odom.outer != 0) ERR;
+        NC_odom_next(&odom);
+        if(NC_odom_more(&odom)) ERR;
+        NC_odom_free(&odom);
+        /* but a record dimension is not coalesced */
+        if(NC_odom_init(&odom, 3, shape, NULL, NULL, NULL, NULL, NC_ODOM_RECORDS)) ERR;
+        if(odom.runlen != 30 || odom.outer != 1) ERR;
+        NC_odom_free(&odom);
+        if(check(3, shape, start, shape, stride, NULL, 0)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("Testing bad arguments...");
+    {
+        NCodometer odom;
+        size_t shape[2] = {4, 5}, start[2] = {0, 0}, count[2] = {2, 2};
+        ptrdiff_t stride[2] = {1, 0};
+        if(NC_odom_init(&odom, 2, shape, start, count, stride, NULL, 0) != NC_ESTRIDE) ERR;
+        if(NC_odom_init(&odom, -1, shape, start, count, NULL, NULL, 0) != NC_EINVAL) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("Testing random selections against brute force...");
+    {
+        int t;
+        srand(12345);
+        for(t = 0; t < NTRIALS; t++) {
+            int rank = rand() % (MAXRANK + 1), d, f;
+            size_t shape[MAXRANK], start[MAXRANK], count[MAXRANK];
+            ptrdiff_t stride[MAXRANK], imap[MAXRANK];
+            size_t prod = 1;
+            for(d = rank - 1; d >= 0; d--) {
+                shape[d] = 1 + rand() % MAXDIM;
+                stride[d] = 1 + (rand() % 3 == 0 ? rand() % 2 : 0);
+                start[d] = rand() % shape[d];
+                count[d] = (shape[d] - start[d] + stride[d] - 1) / stride[d];
+                if(rand() % 2) count[d] = rand() % (count[d] + 1);
+                /* imaps that transpose or pad the memory layout */
+                imap[d] = (ptrdiff_t)prod;
+                prod *= count[d] + (rand() % 4 == 0);
+            }
+            if(rank > 1 && rand() % 3 == 0) {
+                ptrdiff_t tmp = imap[0];
+                imap[0] = imap[rank - 1];
+                imap[rank - 1] = tmp;
+            }
+            for(f = 0; f < 4; f++) {
+                static const int flags[4] = {0, NC_ODOM_BOX, NC_ODOM_ELEMENTS,
+                                             NC_ODOM_RECORDS};
+                if(check(rank, shape, start, count, stride, NULL, flags[f])) ERR;
+                if(check(rank, shape, start, count, stride, imap, flags[f])) ERR;
+            }
+        }
+    }
+    SUMMARIZE_ERR;
+    printf("Testing chunk grid walk and intersection...");
+    {
+        size_t start[2] = {3, 1}, count[2] = {4, 3}, chunks[2] = {4, 2};
+        ptrdiff_t stride[2] = {2, 3};
+        size_t total = 0;
+        int seen[4][3];
+        NCodometer odom;
+        /* rows 3,5,7,9 and columns 1,4,7 of a 10x8 variable */
+        memset(seen, 0, sizeof(seen));
+        if(NC_odom_initchunks(&odom, 2, start, count, stride, chunks)) ERR;
+        if(NC_odom_nelements(&odom) != 3 * 4) ERR;
+        for(; NC_odom_more(&odom); NC_odom_next(&odom)) {
+            size_t origin[2], istart[2], icount[2], ipos[2], n, i, j;
+            origin[0] = odom.index[0] * chunks[0];
+            origin[1] = odom.index[1] * chunks[1];
+            n = NC_odom_intersect(2, start, count, stride, origin, chunks,
+                                  istart, icount, ipos);
+            total += n;
+            for(i = 0; i < icount[0]; i++)
+                for(j = 0; j < icount[1]; j++) {
+                    size_t r = istart[0] + i * 2, c = istart[1] + j * 3;
+                    if(r < origin[0] || r >= origin[0] + chunks[0]) ERR;
+                    if(c < origin[1] || c >= origin[1] + chunks[1]) ERR;
+                    if(r != start[0] + (ipos[0] + i) * 2) ERR;
+                    if(c != start[1] + (ipos[1] + j) * 3) ERR;
+                    seen[ipos[0] + i][ipos[1] + j]++;
+                }
+        }
+        NC_odom_free(&odom);
+        if(total != 4 * 3) ERR;
+        {
+            int i, j;
+            for(i = 0; i < 4; i++)
+                for(j = 0; j < 3; j++)
+                    if(seen[i][j] != 1) ERR;
+        }
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}